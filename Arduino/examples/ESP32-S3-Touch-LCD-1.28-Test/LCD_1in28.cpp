@@ -16,9 +16,13 @@
 
 #include <stdlib.h>		//itoa()
 #include <stdio.h>
+#include <math.h>		//sqrtf()
 
 LCD_1IN28_ATTRIBUTES LCD_1IN28;
 
+// Visible part of each row of the round panel, first and last column
+static UBYTE LCD_1IN28_Span[LCD_1IN28_HEIGHT][2];
+
 
 /******************************************************************************
 function :	Hardware reset
@@ -346,6 +350,27 @@ static void LCD_1IN28_SetAttributes(UBYTE Scan_dir)
 	LCD_1IN28_SendData_8Bit(MemoryAccessReg);	//0x08 set RGB
 }
 
+/********************************************************************************
+function :	Build the table of visible row spans
+parameter:
+info     :	A pixel is visible if any part of it is inside the circle that fits
+		the panel, the pixels in the corners are never seen
+********************************************************************************/
+static void LCD_1IN28_InitSpan(void)
+{
+    UWORD j;
+    for (j = 0; j < LCD_1IN28_HEIGHT; j++) {
+        // Distance from the centre to the row edge nearest to it, in half pixels
+        int e = abs(2 * j + 1 - LCD_1IN28_HEIGHT) - 1;
+        if (e < 0) e = 0;
+        float hw = LCD_1IN28_WIDTH * sqrtf((float)LCD_1IN28_HEIGHT * LCD_1IN28_HEIGHT - (float)e * e) / LCD_1IN28_HEIGHT;
+        int xs = (int)floorf((LCD_1IN28_WIDTH - hw) * 0.5f);
+        int xe = (int)ceilf((LCD_1IN28_WIDTH + hw) * 0.5f) - 1;
+        LCD_1IN28_Span[j][0] = xs < 0 ? 0 : xs;
+        LCD_1IN28_Span[j][1] = xe >= LCD_1IN28_WIDTH ? LCD_1IN28_WIDTH - 1 : xe;
+    }
+}
+
 /********************************************************************************
 function :	Initialize the lcd
 parameter:
@@ -362,6 +387,9 @@ void LCD_1IN28_Init(UBYTE Scan_dir)
     
     //Set the initialization register
     LCD_1IN28_InitReg();
+
+    //Visible row spans used by LCD_1IN28_Display()
+    LCD_1IN28_InitSpan();
 }
 
 /********************************************************************************
@@ -408,24 +436,30 @@ void LCD_1IN28_Clear(UWORD Color)
         Image[j] = Color;
     }
     
-    LCD_1IN28_SetWindows(0, 0, LCD_1IN28_WIDTH, LCD_1IN28_HEIGHT);
-    DEV_Digital_Write(LCD_DC_PIN, 1);
-    for(j = 0; j < LCD_1IN28_HEIGHT; j++){
-        DEV_SPI_Write_nByte((uint8_t *)&Image[j*LCD_1IN28_WIDTH], LCD_1IN28_WIDTH*2);
-    }
+    LCD_1IN28_Display(Image);
 }
 
 /******************************************************************************
 function :	Sends the image buffer in RAM to displays
 parameter:
+info     :	Only the visible round area is sent, rows with the same span share
+		one window so about 21% fewer bytes are sent than for the whole buffer
 ******************************************************************************/
 void LCD_1IN28_Display(UWORD *Image)
 {
-    UWORD j;
-    LCD_1IN28_SetWindows(0, 0, LCD_1IN28_WIDTH, LCD_1IN28_HEIGHT);
-    DEV_Digital_Write(LCD_DC_PIN, 1);;
-    for (j = 0; j < LCD_1IN28_HEIGHT; j++) {
-        DEV_SPI_Write_nByte((uint8_t *)&Image[j*LCD_1IN28_WIDTH], LCD_1IN28_WIDTH*2);
+    UWORD j, k, xs, w;
+    for (j = 0; j < LCD_1IN28_HEIGHT; j = k) {
+        xs = LCD_1IN28_Span[j][0];
+        w = LCD_1IN28_Span[j][1] - xs + 1;
+        for (k = j + 1; k < LCD_1IN28_HEIGHT; k++) {
+            if (LCD_1IN28_Span[k][0] != xs || LCD_1IN28_Span[k][1] != xs + w - 1) break;
+        }
+
+        LCD_1IN28_SetWindows(xs, j, xs + w, k);
+        DEV_Digital_Write(LCD_DC_PIN, 1);
+        for (; j < k; j++) {
+            DEV_SPI_Write_nByte((uint8_t *)&Image[j*LCD_1IN28_WIDTH + xs], w*2);
+        }
     }
 }
 
@@ -0,0 +1,506 @@
+/**************************************************************************************
+// The following class records graphics calls in a display list and renders the list
+// in horizontal tiles using a Sprite as a line buffer, see Display_list.h
+***************************************************************************************/
+
+// Display list command codes
+#define DL_PIXEL          0
+#define DL_HLINE          1
+#define DL_VLINE          2
+#define DL_LINE           3
+#define DL_RECT           4
+#define DL_FILL_RECT      5
+#define DL_ROUND_RECT     6
+#define DL_FILL_RRECT     7
+#define DL_SMOOTH_RRECT   8
+#define DL_CIRCLE         9
+#define DL_FILL_CIRCLE    10
+#define DL_SMOOTH_CIRCLE  11
+#define DL_FILL_TRIANGLE  12
+#define DL_SMOOTH_ARC     13
+#define DL_ARC            14
+#define DL_WEDGE_LINE     15 // Also used for wide lines
+#define DL_STRING         16
+
+// Wide line coordinates are stored as 1/16 pixel fixed point
+#define DL_FIXED(F)   ((int16_t)lroundf((F) * 16.0f))
+#define DL_FLOAT(I)   ((I) / 16.0f)
+
+/***************************************************************************************
+** Function name:           TFT_eDisplayList
+** Description:             Class constructor
+***************************************************************************************/
+TFT_eDisplayList::TFT_eDisplayList(TFT_eSPI *tft)
+{
+  _tft = tft;
+
+  _spr[0] = nullptr;
+  _spr[1] = nullptr;
+  _cmd  = nullptr;
+  _text = nullptr;
+  _hash = nullptr;
+
+  _maxCommands = 0;
+  _count = 0;
+  _textBytes = 0;
+  _textUsed = 0;
+  _tiles = 0;
+  _tileHeight = 16;
+  _width = 0;
+  _height = 0;
+
+  _bg = TFT_BLACK;
+  _textFg = TFT_WHITE;
+  _textBg = TFT_WHITE;
+  _textSize = 1;
+  _textDatum = TL_DATUM;
+
+  _overflow = false;
+  _invalid = true;
+}
+
+/***************************************************************************************
+** Function name:           ~TFT_eDisplayList
+** Description:             Class destructor
+***************************************************************************************/
+TFT_eDisplayList::~TFT_eDisplayList(void)
+{
+  end();
+}
+
+/***************************************************************************************
+** Function name:           begin
+** Description:             Allocate the list and tile buffers
+***************************************************************************************/
+bool TFT_eDisplayList::begin(uint16_t maxCommands, uint16_t textBytes, uint8_t tileHeight)
+{
+  end();
+
+  if (maxCommands == 0 || tileHeight == 0) return false;
+
+  _width  = _tft->width();
+  _height = _tft->height();
+  _tileHeight = tileHeight;
+  _tiles = (_height + tileHeight - 1) / tileHeight;
+
+  _maxCommands = maxCommands;
+  _textBytes = textBytes;
+
+  _cmd  = (dl_command_t*)malloc(maxCommands * sizeof(dl_command_t));
+  _text = (char*)malloc(textBytes ? textBytes : 1);
+  _hash = (uint32_t*)calloc(_tiles, sizeof(uint32_t));
+
+  // Second tile buffer is only needed to overlap rendering with DMA transfers
+  uint8_t buffers = _tft->DMA_Enabled ? 2 : 1;
+  for (uint8_t i = 0; i < buffers; i++) {
+    _spr[i] = new TFT_eSprite(_tft);
+    _spr[i]->setColorDepth(16);
+    if (_spr[i]->createSprite(_width, _tileHeight) == nullptr) { end(); return false; }
+  }
+
+  if (!_cmd || !_text || !_hash) { end(); return false; }
+
+  clear(_bg);
+  _invalid = true;
+
+  return true;
+}
+
+/***************************************************************************************
+** Function name:           end
+** Description:             Free all memory
+***************************************************************************************/
+void TFT_eDisplayList::end(void)
+{
+  for (uint8_t i = 0; i < 2; i++) {
+    if (_spr[i]) { _spr[i]->deleteSprite(); delete _spr[i]; _spr[i] = nullptr; }
+  }
+
+  free(_cmd);  _cmd  = nullptr;
+  free(_text); _text = nullptr;
+  free(_hash); _hash = nullptr;
+
+  _maxCommands = 0;
+  _count = 0;
+  _tiles = 0;
+}
+
+/***************************************************************************************
+** Function name:           clear
+** Description:             Start a new list with the screen cleared to bg_color
+***************************************************************************************/
+void TFT_eDisplayList::clear(uint32_t bg_color)
+{
+  _bg = bg_color;
+  _count = 0;
+  _textUsed = 0;
+  _overflow = false;
+}
+
+/***************************************************************************************
+** Function name:           invalidate
+** Description:             Force all tiles to be pushed by the next render
+***************************************************************************************/
+void TFT_eDisplayList::invalidate(void)
+{
+  _invalid = true;
+}
+
+/***************************************************************************************
+** Function name:           addCommand
+** Description:             Add a command covering rows y0 to y1, returns nullptr if dropped
+***************************************************************************************/
+dl_command_t* TFT_eDisplayList::addCommand(uint8_t op, int32_t y0, int32_t y1)
+{
+  if (!_cmd) return nullptr;
+
+  if (y0 > y1) { int32_t t = y0; y0 = y1; y1 = t; }
+
+  // Not visible
+  if (y1 < 0 || y0 >= _height) return nullptr;
+
+  if (_count >= _maxCommands) { _overflow = true; return nullptr; }
+
+  if (y0 < 0) y0 = 0;
+  if (y1 >= _height) y1 = _height - 1;
+
+  dl_command_t* c = &_cmd[_count++];
+  memset(c, 0, sizeof(dl_command_t)); // Unused fields must be zero for tile hashing
+
+  c->op = op;
+  c->tile0 = y0 / _tileHeight;
+  c->tile1 = y1 / _tileHeight;
+
+  return c;
+}
+
+/***************************************************************************************
+** Function name:           arcExtent
+** Description:             Find the rows covered by an arc
+***************************************************************************************/
+// Angle 0 is at 6 o'clock and arcs are drawn clockwise, so y = cy + r * cos(angle)
+void TFT_eDisplayList::arcExtent(int32_t y, int32_t r, int32_t ir, uint32_t startAngle, uint32_t endAngle, int32_t *y0, int32_t *y1)
+{
+  if (startAngle > 360) startAngle = 360;
+  if (endAngle   > 360) endAngle   = 360;
+
+  // Arc end points, round ends may extend the arc by half the arc width
+  float ca = cosf(startAngle * DEG_TO_RAD), cb = cosf(endAngle * DEG_TO_RAD);
+  float top = fminf(fminf(r * ca, ir * ca), fminf(r * cb, ir * cb)) - (r - ir) / 2.0f;
+  float bot = fmaxf(fmaxf(r * ca, ir * ca), fmaxf(r * cb, ir * cb)) + (r - ir) / 2.0f;
+
+  // Arc passes through 12 o'clock (180 degrees) or 6 o'clock (0/360 degrees)
+  if (startAngle > endAngle) { // Arc wraps through 0
+    if (startAngle <= 180 || endAngle >= 180) top = -r;
+    bot = r;
+  }
+  else {
+    if (startAngle <= 180 && endAngle >= 180) top = -r;
+    if (startAngle == 0 || endAngle == 360) bot = r;
+  }
+
+  *y0 = y + (int32_t)floorf(top) - 1;
+  *y1 = y + (int32_t)ceilf(bot) + 1;
+}
+
+/***************************************************************************************
+** Function name:           Graphics recording functions
+** Description:             Record a command, parameters as per TFT_eSPI
+***************************************************************************************/
+void TFT_eDisplayList::drawPixel(int32_t x, int32_t y, uint32_t color)
+{
+  dl_command_t* c = addCommand(DL_PIXEL, y, y);
+  if (!c) return;
+  c->p[0] = x; c->p[1] = y; c->fg = color;
+}
+
+void TFT_eDisplayList::drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color)
+{
+  dl_command_t* c = addCommand(DL_HLINE, y, y);
+  if (!c) return;
+  c->p[0] = x; c->p[1] = y; c->p[2] = w; c->fg = color;
+}
+
+void TFT_eDisplayList::drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color)
+{
+  dl_command_t* c = addCommand(DL_VLINE, y, y + h - 1);
+  if (!c) return;
+  c->p[0] = x; c->p[1] = y; c->p[2] = h; c->fg = color;
+}
+
+void TFT_eDisplayList::drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t color)
+{
+  dl_command_t* c = addCommand(DL_LINE, y0, y1);
+  if (!c) return;
+  c->p[0] = x0; c->p[1] = y0; c->p[2] = x1; c->p[3] = y1; c->fg = color;
+}
+
+void TFT_eDisplayList::drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color)
+{
+  dl_command_t* c = addCommand(DL_RECT, y, y + h - 1);
+  if (!c) return;
+  c->p[0] = x; c->p[1] = y; c->p[2] = w; c->p[3] = h; c->fg = color;
+}
+
+void TFT_eDisplayList::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color)
+{
+  dl_command_t* c = addCommand(DL_FILL_RECT, y, y + h - 1);
+  if (!c) return;
+  c->p[0] = x; c->p[1] = y; c->p[2] = w; c->p[3] = h; c->fg = color;
+}
+
+void TFT_eDisplayList::drawRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t radius, uint32_t color)
+{
+  dl_command_t* c = addCommand(DL_ROUND_RECT, y, y + h - 1);
+  if (!c) return;
+  c->p[0] = x; c->p[1] = y; c->p[2] = w; c->p[3] = h; c->p[4] = radius; c->fg = color;
+}
+
+void TFT_eDisplayList::fillRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t radius, uint32_t color)
+{
+  dl_command_t* c = addCommand(DL_FILL_RRECT, y, y + h - 1);
+  if (!c) return;
+  c->p[0] = x; c->p[1] = y; c->p[2] = w; c->p[3] = h; c->p[4] = radius; c->fg = color;
+}
+
+void TFT_eDisplayList::fillSmoothRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t radius, uint32_t color, uint32_t bg_color)
+{
+  dl_command_t* c = addCommand(DL_SMOOTH_RRECT, y, y + h - 1);
+  if (!c) return;
+  c->p[0] = x; c->p[1] = y; c->p[2] = w; c->p[3] = h; c->p[4] = radius; c->fg = color; c->bg = bg_color;
+}
+
+void TFT_eDisplayList::drawCircle(int32_t x, int32_t y, int32_t r, uint32_t color)
+{
+  dl_command_t* c = addCommand(DL_CIRCLE, y - r, y + r);
+  if (!c) return;
+  c->p[0] = x; c->p[1] = y; c->p[2] = r; c->fg = color;
+}
+
+void TFT_eDisplayList::fillCircle(int32_t x, int32_t y, int32_t r, uint32_t color)
+{
+  dl_command_t* c = addCommand(DL_FILL_CIRCLE, y - r, y + r);
+  if (!c) return;
+  c->p[0] = x; c->p[1] = y; c->p[2] = r; c->fg = color;
+}
+
+void TFT_eDisplayList::fillSmoothCircle(int32_t x, int32_t y, int32_t r, uint32_t color, uint32_t bg_color)
+{
+  dl_command_t* c = addCommand(DL_SMOOTH_CIRCLE, y - r - 1, y + r + 1);
+  if (!c) return;
+  c->p[0] = x; c->p[1] = y; c->p[2] = r; c->fg = color; c->bg = bg_color;
+}
+
+void TFT_eDisplayList::fillTriangle(int32_t x1,int32_t y1, int32_t x2,int32_t y2, int32_t x3,int32_t y3, uint32_t color)
+{
+  dl_command_t* c = addCommand(DL_FILL_TRIANGLE, min(y1, min(y2, y3)), max(y1, max(y2, y3)));
+  if (!c) return;
+  c->p[0] = x1; c->p[1] = y1; c->p[2] = x2; c->p[3] = y2; c->p[4] = x3; c->p[5] = y3; c->fg = color;
+}
+
+void TFT_eDisplayList::drawSmoothArc(int32_t x, int32_t y, int32_t r, int32_t ir, uint32_t startAngle, uint32_t endAngle, uint32_t fg_color, uint32_t bg_color, bool roundEnds)
+{
+  int32_t y0, y1;
+  arcExtent(y, r, ir, startAngle, endAngle, &y0, &y1);
+  dl_command_t* c = addCommand(DL_SMOOTH_ARC, y0, y1);
+  if (!c) return;
+  c->p[0] = x; c->p[1] = y; c->p[2] = r; c->p[3] = ir; c->p[4] = startAngle; c->p[5] = endAngle;
+  c->fg = fg_color; c->bg = bg_color; c->flags = roundEnds;
+}
+
+void TFT_eDisplayList::drawArc(int32_t x, int32_t y, int32_t r, int32_t ir, uint32_t startAngle, uint32_t endAngle, uint32_t fg_color, uint32_t bg_color, bool smoothArc)
+{
+  int32_t y0, y1;
+  arcExtent(y, r, ir, startAngle, endAngle, &y0, &y1);
+  dl_command_t* c = addCommand(DL_ARC, y0, y1);
+  if (!c) return;
+  c->p[0] = x; c->p[1] = y; c->p[2] = r; c->p[3] = ir; c->p[4] = startAngle; c->p[5] = endAngle;
+  c->fg = fg_color; c->bg = bg_color; c->flags = smoothArc;
+}
+
+void TFT_eDisplayList::drawWideLine(float ax, float ay, float bx, float by, float wd, uint32_t fg_color, uint32_t bg_color)
+{
+  drawWedgeLine(ax, ay, bx, by, wd/2.0, wd/2.0, fg_color, bg_color);
+}
+
+// As for TFT_eSPI, aw and bw are the end radii
+void TFT_eDisplayList::drawWedgeLine(float ax, float ay, float bx, float by, float aw, float bw, uint32_t fg_color, uint32_t bg_color)
+{
+  dl_command_t* c = addCommand(DL_WEDGE_LINE, floorf(fminf(ay - aw, by - bw)) - 1, ceilf(fmaxf(ay + aw, by + bw)) + 1);
+  if (!c) return;
+  c->p[0] = DL_FIXED(ax); c->p[1] = DL_FIXED(ay); c->p[2] = DL_FIXED(bx); c->p[3] = DL_FIXED(by);
+  c->p[4] = DL_FIXED(aw); c->p[5] = DL_FIXED(bw);
+  c->fg = fg_color; c->bg = bg_color;
+}
+
+/***************************************************************************************
+** Function name:           Text recording functions
+** Description:             Set text state and record strings
+***************************************************************************************/
+void TFT_eDisplayList::setTextColor(uint16_t color)
+{
+  _textFg = color;
+  _textBg = color; // Same colour means no background is drawn
+}
+
+void TFT_eDisplayList::setTextColor(uint16_t fgcolor, uint16_t bgcolor)
+{
+  _textFg = fgcolor;
+  _textBg = bgcolor;
+}
+
+void TFT_eDisplayList::setTextSize(uint8_t size)
+{
+  _textSize = size ? size : 1;
+}
+
+void TFT_eDisplayList::setTextDatum(uint8_t datum)
+{
+  _textDatum = datum;
+}
+
+void TFT_eDisplayList::drawString(const String& string, int32_t x, int32_t y, uint8_t font)
+{
+  drawString(string.c_str(), x, y, font);
+}
+
+void TFT_eDisplayList::drawString(const char *string, int32_t x, int32_t y, uint8_t font)
+{
+  if (!_cmd) return;
+
+  uint16_t len = strlen(string) + 1;
+  if (_textUsed + len > _textBytes) { _overflow = true; return; }
+
+  // Conservative vertical extent, the datum can place the string above or below y
+  _spr[0]->setTextSize(_textSize);
+  int32_t h = _spr[0]->fontHeight(font);
+
+  dl_command_t* c = addCommand(DL_STRING, y - h, y + h);
+  if (!c) return;
+
+  memcpy(_text + _textUsed, string, len);
+  c->text = _textUsed;
+  _textUsed += len;
+
+  c->p[0] = x; c->p[1] = y; c->p[2] = _textDatum; c->p[3] = _textSize;
+  c->fg = _textFg; c->bg = _textBg; c->flags = font;
+}
+
+/***************************************************************************************
+** Function name:           drawCommand
+** Description:             Draw a command in a tile buffer, oy = tile y coordinate
+***************************************************************************************/
+void TFT_eDisplayList::drawCommand(TFT_eSprite *spr, const dl_command_t *c, int32_t oy)
+{
+  const int16_t* p = c->p;
+
+  switch (c->op) {
+    case DL_PIXEL:         spr->drawPixel(p[0], p[1] - oy, c->fg); break;
+    case DL_HLINE:         spr->drawFastHLine(p[0], p[1] - oy, p[2], c->fg); break;
+    case DL_VLINE:         spr->drawFastVLine(p[0], p[1] - oy, p[2], c->fg); break;
+    case DL_LINE:          spr->drawLine(p[0], p[1] - oy, p[2], p[3] - oy, c->fg); break;
+    case DL_RECT:          spr->drawRect(p[0], p[1] - oy, p[2], p[3], c->fg); break;
+    case DL_FILL_RECT:     spr->fillRect(p[0], p[1] - oy, p[2], p[3], c->fg); break;
+    case DL_ROUND_RECT:    spr->drawRoundRect(p[0], p[1] - oy, p[2], p[3], p[4], c->fg); break;
+    case DL_FILL_RRECT:    spr->fillRoundRect(p[0], p[1] - oy, p[2], p[3], p[4], c->fg); break;
+    case DL_SMOOTH_RRECT:  spr->fillSmoothRoundRect(p[0], p[1] - oy, p[2], p[3], p[4], c->fg, c->bg); break;
+    case DL_CIRCLE:        spr->drawCircle(p[0], p[1] - oy, p[2], c->fg); break;
+    case DL_FILL_CIRCLE:   spr->fillCircle(p[0], p[1] - oy, p[2], c->fg); break;
+    case DL_SMOOTH_CIRCLE: spr->fillSmoothCircle(p[0], p[1] - oy, p[2], c->fg, c->bg); break;
+    case DL_FILL_TRIANGLE: spr->fillTriangle(p[0], p[1] - oy, p[2], p[3] - oy, p[4], p[5] - oy, c->fg); break;
+    case DL_SMOOTH_ARC:    spr->drawSmoothArc(p[0], p[1] - oy, p[2], p[3], p[4], p[5], c->fg, c->bg, c->flags); break;
+    case DL_ARC:           spr->drawArc(p[0], p[1] - oy, p[2], p[3], p[4], p[5], c->fg, c->bg, c->flags); break;
+    case DL_WEDGE_LINE:
+      spr->drawWedgeLine(DL_FLOAT(p[0]), DL_FLOAT(p[1]) - oy, DL_FLOAT(p[2]), DL_FLOAT(p[3]) - oy,
+                         DL_FLOAT(p[4]), DL_FLOAT(p[5]), c->fg, c->bg);
+      break;
+    case DL_STRING:
+      spr->setTextColor(c->fg, c->bg);
+      spr->setTextDatum(p[2]);
+      spr->setTextSize(p[3]);
+      spr->drawString(_text + c->text, p[0], p[1] - oy, c->flags);
+      break;
+  }
+}
+
+/***************************************************************************************
+** Function name:           tileHash
+** Description:             FNV-1a hash of the background and commands touching a tile
+***************************************************************************************/
+uint32_t TFT_eDisplayList::tileHash(uint16_t tile)
+{
+  uint32_t hash = 2166136261UL ^ _bg;
+
+  for (uint16_t i = 0; i < _count; i++) {
+    const dl_command_t* c = &_cmd[i];
+    if (tile < c->tile0 || tile > c->tile1) continue;
+
+    const uint8_t* b = (const uint8_t*)c;
+    for (uint16_t n = 0; n < sizeof(dl_command_t); n++) hash = (hash ^ b[n]) * 16777619UL;
+
+    if (c->op == DL_STRING) {
+      for (const char* s = _text + c->text; *s; s++) hash = (hash ^ (uint8_t)*s) * 16777619UL;
+    }
+  }
+
+  return hash;
+}
+
+/***************************************************************************************
+** Function name:           render
+** Description:             Draw the list tile by tile and push changed tiles to the TFT
+***************************************************************************************/
+uint16_t TFT_eDisplayList::render(bool force)
+{
+  if (!_cmd) return 0;
+
+  uint16_t pushed = 0;
+  uint8_t  buf = 0;
+  bool     dma = _tft->DMA_Enabled && _spr[1];
+
+  // Sprite buffers are already in TFT byte order
+  bool swap = _tft->getSwapBytes();
+  _tft->setSwapBytes(false);
+
+  _tft->startWrite();
+
+  for (uint16_t t = 0; t < _tiles; t++) {
+    uint32_t hash = tileHash(t);
+    if (!force && !_invalid && hash == _hash[t]) continue;
+    _hash[t] = hash;
+
+    int32_t y = t * _tileHeight;
+    int32_t h = min((int32_t)_tileHeight, _height - y);
+
+    TFT_eSprite* spr = _spr[buf];
+    spr->fillSprite(_bg);
+
+    for (uint16_t i = 0; i < _count; i++) {
+      if (t >= _cmd[i].tile0 && t <= _cmd[i].tile1) drawCommand(spr, &_cmd[i], y);
+    }
+
+#ifdef DMA_LINE_BUFFERS
+    if (dma) {
+      // Render the next tile into the other buffer while this one is sent
+      _tft->pushImageDMA(0, y, _width, h, (uint16_t*)spr->getPointer());
+      buf ^= 1;
+    }
+    else
+#endif
+    _tft->pushImage(0, y, _width, h, (uint16_t*)spr->getPointer());
+
+    pushed++;
+  }
+
+#ifdef DMA_LINE_BUFFERS
+  if (dma) _tft->dmaWait();
+#endif
+
+  _tft->endWrite();
+
+  _tft->setSwapBytes(swap);
+
+  _invalid = false;
+
+  return pushed;
+}
@@ -0,0 +1,106 @@
+/***************************************************************************************
+// The following class records graphics calls in a display list (retained mode) and then
+// renders the list in horizontal tiles (default 16 pixel rows). Each tile is drawn into
+// a Sprite line buffer and pushed to the TFT once, so overlapping graphics are not
+// overdrawn on the TFT and the screen does not flicker. A full screen Sprite is not
+// needed. Tiles whose commands have not changed since the last render are not sent.
+//
+// Typical use, in a loop:
+//   dl.clear(TFT_BLACK);               // Start a new list
+//   dl.fillRoundRect(...);             // Record graphics, same parameters as TFT_eSPI
+//   dl.drawString("123", 120, 120, 7);
+//   dl.render();                       // Push tiles that have changed
+***************************************************************************************/
+
+// One recorded graphics call
+typedef struct
+{
+  uint8_t  op;        // Command code
+  uint8_t  flags;     // Font number, arc round ends etc.
+  uint16_t tile0;     // First tile touched by the command
+  uint16_t tile1;     // Last tile touched by the command
+  uint16_t text;      // Offset of string in text pool
+  int16_t  p[6];      // Coordinates, sizes and angles, wide line values are 1/16 pixel
+  uint32_t fg, bg;    // Colours
+} dl_command_t;
+
+class TFT_eDisplayList {
+
+ public:
+
+  explicit TFT_eDisplayList(TFT_eSPI *tft);
+  ~TFT_eDisplayList(void);
+
+           // Allocate the command list, text pool and tile buffer(s), returns false if out of RAM
+           // RAM needed is 28 bytes per command + textBytes + TFT width * tileHeight * 2 bytes
+           // (doubled if DMA is enabled by tft.initDMA() before begin() is called)
+  bool     begin(uint16_t maxCommands = 128, uint16_t textBytes = 512, uint8_t tileHeight = 16);
+  void     end(void);
+
+           // Start a new list with the screen cleared to bg_color
+  void     clear(uint32_t bg_color);
+  void     fillScreen(uint32_t color) { clear(color); }
+
+           // Graphics recording, parameters as per TFT_eSPI functions
+  void     drawPixel(int32_t x, int32_t y, uint32_t color);
+  void     drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color);
+  void     drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color);
+  void     drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t color);
+  void     drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+  void     fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+  void     drawRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t radius, uint32_t color);
+  void     fillRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t radius, uint32_t color);
+  void     fillSmoothRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t radius, uint32_t color, uint32_t bg_color = 0x00FFFFFF);
+  void     drawCircle(int32_t x, int32_t y, int32_t r, uint32_t color);
+  void     fillCircle(int32_t x, int32_t y, int32_t r, uint32_t color);
+  void     fillSmoothCircle(int32_t x, int32_t y, int32_t r, uint32_t color, uint32_t bg_color = 0x00FFFFFF);
+  void     fillTriangle(int32_t x1,int32_t y1, int32_t x2,int32_t y2, int32_t x3,int32_t y3, uint32_t color);
+  void     drawSmoothArc(int32_t x, int32_t y, int32_t r, int32_t ir, uint32_t startAngle, uint32_t endAngle, uint32_t fg_color, uint32_t bg_color, bool roundEnds = false);
+  void     drawArc(int32_t x, int32_t y, int32_t r, int32_t ir, uint32_t startAngle, uint32_t endAngle, uint32_t fg_color, uint32_t bg_color, bool smoothArc = true);
+  void     drawWideLine(float ax, float ay, float bx, float by, float wd, uint32_t fg_color, uint32_t bg_color = 0x00FFFFFF);
+  void     drawWedgeLine(float ax, float ay, float bx, float by, float aw, float bw, uint32_t fg_color, uint32_t bg_color = 0x00FFFFFF);
+
+           // Text recording, the string is copied. Fonts 1-8 are supported.
+  void     setTextColor(uint16_t color);
+  void     setTextColor(uint16_t fgcolor, uint16_t bgcolor);
+  void     setTextSize(uint8_t size);
+  void     setTextDatum(uint8_t datum);
+  void     drawString(const char *string, int32_t x, int32_t y, uint8_t font);
+  void     drawString(const String& string, int32_t x, int32_t y, uint8_t font);
+
+           // Render the list, only tiles that differ from the last render are pushed unless
+           // force is true. Returns the number of tiles pushed.
+  uint16_t render(bool force = false);
+
+           // Make the next render() push all tiles, e.g. if the screen has been drawn over
+  void     invalidate(void);
+
+  uint16_t commands(void) { return _count; }  // Commands in list
+  uint16_t tiles(void)    { return _tiles; }  // Number of tiles on screen
+  bool     overflow(void) { return _overflow; } // True if commands were dropped since clear()
+
+ private:
+
+  dl_command_t* addCommand(uint8_t op, int32_t y0, int32_t y1);
+  void     arcExtent(int32_t y, int32_t r, int32_t ir, uint32_t startAngle, uint32_t endAngle, int32_t *y0, int32_t *y1);
+  void     drawCommand(TFT_eSprite *spr, const dl_command_t *c, int32_t oy);
+  uint32_t tileHash(uint16_t tile);
+
+  TFT_eSPI     *_tft;
+  TFT_eSprite  *_spr[2];      // Tile buffers, second is used for DMA double buffering
+  dl_command_t *_cmd;         // Command list
+  char         *_text;        // Text pool
+  uint32_t     *_hash;        // Tile content hash from last render
+
+  uint16_t _maxCommands, _count;
+  uint16_t _textBytes, _textUsed;
+  uint16_t _tiles;
+  uint8_t  _tileHeight;
+  int32_t  _width, _height;
+
+  uint32_t _bg;               // Screen background colour
+  uint32_t _textFg, _textBg;  // Text state
+  uint8_t  _textSize, _textDatum;
+
+  bool     _overflow, _invalid;
+};
@@ -0,0 +1,321 @@
+/**************************************************************************************
+// The following class paces frames and sends their regions in step with the panel
+// scan, see Frame_scheduler.h
+***************************************************************************************/
+
+#ifdef DMA_LINE_BUFFERS
+  #define FRAME_DMA (_tft->DMA_Enabled)
+#else
+  #define FRAME_DMA false
+#endif
+
+/***************************************************************************************
+** Function name:           TFT_eFrameScheduler
+** Description:             Class constructor
+***************************************************************************************/
+TFT_eFrameScheduler::TFT_eFrameScheduler(TFT_eSPI *tft)
+{
+  _tft = tft;
+
+  _te = -1;
+  _frameUs = 33333;
+  _refreshes = 1;
+  _periodUs = 16667;
+  _blankUs = _periodUs / 16;
+  _teTime = 0;
+#ifdef SPI_FREQUENCY
+  _busRate = SPI_FREQUENCY;
+#else
+  _busRate = 40000000;
+#endif
+
+  _next = _frameStart = _idle = 0;
+  _open = false;
+  _regions = 0;
+  resetStats();
+}
+
+/***************************************************************************************
+** Function name:           setScan
+** Description:             Set the panel refresh period and blanking time
+***************************************************************************************/
+void TFT_eFrameScheduler::setScan(uint32_t periodUs, uint32_t blankUs)
+{
+  if (!periodUs) return;
+  _periodUs = periodUs;
+  _blankUs = blankUs ? blankUs : periodUs / 16;
+  _stats.periodUs = _periodUs;
+}
+
+/***************************************************************************************
+** Function name:           begin
+** Description:             Start pacing frames, measure the refresh if TE is connected
+***************************************************************************************/
+void TFT_eFrameScheduler::begin(uint16_t fps, int8_t tePin)
+{
+  flush();
+  _frameUs = 1000000 / (fps ? fps : 1);
+  _te = tePin;
+  _regions = 0;
+
+  if (_te >= 0) {
+    pinMode(_te, INPUT);
+    // Two rising edges give the period, no edges means TE is not working
+    if (waitTE(3 * _periodUs)) {
+      uint32_t t0 = _teTime;
+      if (waitTE(2 * _periodUs)) _periodUs = _teTime - t0;
+      else _te = -1;
+    }
+    else _te = -1;
+  }
+
+  // With TE a frame is a whole number of refreshes
+  if (_te >= 0) {
+    _refreshes = (_frameUs + _periodUs / 2) / _periodUs;
+    if (_refreshes < 1) _refreshes = 1;
+    _frameUs = _refreshes * _periodUs;
+  }
+
+  resetStats();
+  _next = micros();
+}
+
+/***************************************************************************************
+** Function name:           resetStats
+** Description:             Clear the frame statistics
+***************************************************************************************/
+void TFT_eFrameScheduler::resetStats(void)
+{
+  memset(&_stats, 0, sizeof(_stats));
+  _stats.periodUs = _periodUs;
+}
+
+/***************************************************************************************
+** Function name:           beginFrame
+** Description:             Wait for the next frame slot
+***************************************************************************************/
+bool TFT_eFrameScheduler::beginFrame(bool wait)
+{
+  uint32_t t0 = micros();
+
+  // Without TE the refresh phase is unknown and aligning frames to a guessed one tears
+  // more than not aligning them, so slots only cap the frame rate
+  if (_te < 0) {
+    uint32_t now = micros();
+    if ((int32_t)(_next - now) > 0) {
+      if (!wait) return false;
+      waitUntil(_next);
+    }
+    if (!wait && _open && FRAME_DMA && _tft->dmaBusy()) return false;
+
+    // More than a frame behind, start again from now
+    now = micros();
+    if ((int32_t)(now - _next) > (int32_t)_frameUs) {
+      _stats.late++;
+      _next = now;
+    }
+    _next += _frameUs;
+  }
+  else {
+    // Wake up a little before the TE edge, then wait for it
+    for (;;) {
+      uint32_t now = micros();
+      if ((int32_t)(_next - now) > (int32_t)_blankUs) {
+        if (!wait) return false;
+        waitUntil(_next - _blankUs);
+        continue;
+      }
+
+      // The last frame is still being sent, skip this slot
+      if (_open && FRAME_DMA && _tft->dmaBusy()) {
+        _stats.throttled++;
+        _next += _frameUs;
+        if (!wait) return false;
+        continue;
+      }
+
+      // More than a frame behind, start again from now
+      if ((int32_t)(now - _next) > (int32_t)_frameUs) {
+        _stats.late++;
+        _next = now;
+      }
+      break;
+    }
+
+    uint32_t last = _teTime;
+    // If the wait overran into blanking take the predicted edge, else wait for it
+    bool edge = digitalRead(_te) && (int32_t)(micros() - _next) < (int32_t)_blankUs;
+    if (edge) _teTime = _next;
+    else edge = waitTE(2 * _periodUs);
+    if (edge) {
+      // Track the refresh period
+      uint32_t n = (_teTime - last + _periodUs / 2) / _periodUs;
+      if (n >= 1 && n <= 8) _periodUs = (_periodUs * 7 + (_teTime - last) / n) / 8;
+      _stats.periodUs = _periodUs;
+      _frameUs = _refreshes * _periodUs;
+      _next = _teTime + _frameUs;
+    }
+    else _next += _frameUs;
+  }
+
+  // Waiting for the end of the last frame is transfer time
+  uint32_t t1 = micros();
+  flush();
+  _frameStart = micros();
+  _stats.transferUs    += _frameStart - t1;
+  _stats.transferTotal += _frameStart - t1;
+  _idle = t1 - t0;
+
+  _regions = 0;
+  return true;
+}
+
+/***************************************************************************************
+** Function name:           push
+** Description:             Queue a region to be sent by endFrame()
+***************************************************************************************/
+bool TFT_eFrameScheduler::push(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *data)
+{
+  if (_regions >= FRAME_REGIONS || w < 1 || h < 1) return false;
+
+  // Insert in scan order
+  uint8_t i = _regions++;
+  while (i && _region[i - 1].y > y) { _region[i] = _region[i - 1]; i--; }
+  _region[i] = { x, y, w, h, data };
+  return true;
+}
+
+/***************************************************************************************
+** Function name:           endFrame
+** Description:             Send the queued regions top to bottom
+***************************************************************************************/
+void TFT_eFrameScheduler::endFrame(void)
+{
+  uint32_t t0 = micros();
+
+  if (!_open) {
+    _tft->startWrite();
+    _open = true;
+  }
+
+  for (uint8_t i = 0; i < _regions; i++) send(_region[i]);
+
+  // Without DMA the transfers are over
+  if (!FRAME_DMA) flush();
+
+  uint32_t t1 = micros();
+  _stats.frames++;
+  _stats.regions    += _regions;
+  _stats.renderUs    = t0 - _frameStart;
+  _stats.transferUs  = t1 - t0;
+  _stats.idleUs      = _idle;
+  _stats.renderTotal   += _stats.renderUs;
+  _stats.transferTotal += _stats.transferUs;
+  _stats.idleTotal     += _stats.idleUs;
+  _regions = 0;
+}
+
+/***************************************************************************************
+** Function name:           flush
+** Description:             Wait for the last transfer and close the TFT transaction
+***************************************************************************************/
+void TFT_eFrameScheduler::flush(void)
+{
+  if (!_open) return;
+#ifdef DMA_LINE_BUFFERS
+  if (_tft->DMA_Enabled) _tft->dmaWait();
+#endif
+  _tft->endWrite();
+  _open = false;
+}
+
+/***************************************************************************************
+** Function name:           send
+** Description:             Send a region when the scan will not cross it
+***************************************************************************************/
+void TFT_eFrameScheduler::send(const Region &r)
+{
+  if (_te >= 0) {
+    int32_t y = r.y < 0 ? 0 : r.y;
+    int32_t h = (r.y + r.h > _tft->height() ? _tft->height() : r.y + r.h) - y;
+
+    // Transfers are sent one at a time, so the start time is known once the last ends
+#ifdef DMA_LINE_BUFFERS
+    if (_tft->DMA_Enabled) _tft->dmaWait();
+#endif
+
+    if (h > 0) {
+      uint32_t time = (uint64_t)r.w * h * 16 * 1000000 / _busRate;
+      uint32_t step = 4 * (_periodUs - _blankUs) / _tft->height() + 1; // 4 scan lines
+      uint32_t now  = micros();
+
+      // First start time within a refresh that the scan does not cross
+      uint32_t t = 0;
+      while (t < _periodUs && crosses(now + t, time, y, h)) t += step;
+
+      if (t >= _periodUs) _stats.unsafe++;
+      else if (t) {
+        _stats.delayed++;
+        waitUntil(now + t);
+      }
+    }
+  }
+
+#ifdef DMA_LINE_BUFFERS
+  // DMA coordinates do not include the viewport datum
+  if (_tft->DMA_Enabled) _tft->pushImageDMA(r.x + _tft->getViewportX(), r.y + _tft->getViewportY(), r.w, r.h, r.data);
+  else
+#endif
+  _tft->pushImage(r.x, r.y, r.w, r.h, r.data);
+}
+
+/***************************************************************************************
+** Function name:           crosses
+** Description:             Check if the scan crosses rows y to y + h - 1 while written
+***************************************************************************************/
+// Rows are written in order at a constant rate, row i of h at start + time * (i + 1) / h.
+// For each refresh the time from the write of a row to its scan changes linearly from
+// the first row to the last, if it changes sign the refresh shows new and old rows.
+bool TFT_eFrameScheduler::crosses(uint32_t start, uint32_t time, int32_t y, int32_t h)
+{
+  if (h < 2) return false;
+
+  double  p = _periodUs, line = (double)(_periodUs - _blankUs) / _tft->height();
+  int32_t s = start - _teTime; // Scan row 0 of refresh k starts at k * p + blank
+  int32_t k0 = (int32_t)floor((double)s / p) - 1, k1 = (int32_t)floor((double)(s + time) / p) + 1;
+
+  for (int32_t k = k0; k <= k1; k++) {
+    double g0 = k * p + _blankUs + y * line - (s + (double)time / h);
+    double g1 = k * p + _blankUs + (y + h - 1) * line - ((double)s + time);
+    if ((g0 < 0) != (g1 < 0)) return true;
+  }
+  return false;
+}
+
+/***************************************************************************************
+** Function name:           waitTE
+** Description:             Wait for a TE rising edge, false if none before timeout
+***************************************************************************************/
+bool TFT_eFrameScheduler::waitTE(uint32_t timeout)
+{
+  uint32_t t0 = micros();
+  while (digitalRead(_te))  if (micros() - t0 > timeout) return false;
+  while (!digitalRead(_te)) if (micros() - t0 > timeout) return false;
+  _teTime = micros();
+  return true;
+}
+
+/***************************************************************************************
+** Function name:           waitUntil
+** Description:             Wait until a micros() time
+***************************************************************************************/
+void TFT_eFrameScheduler::waitUntil(uint32_t time)
+{
+  for (;;) {
+    int32_t left = time - micros();
+    if (left <= 0) return;
+    // Long waits let other tasks run
+    if (left > 2000) delay((left - 1000) / 1000);
+    else if (left > 50) delayMicroseconds(left - 20);
+  }
+}
@@ -0,0 +1,121 @@
+/***************************************************************************************
+// The following class paces screen updates to a target frame rate and sends the changed
+// regions of each frame in an order and at times that follow the panel scan, so partial
+// updates do not tear. A frame is:
+//   beginFrame() : waits for the next frame slot, then for any DMA transfer of the last
+//                  frame, so its buffers can be reused
+//   push()       : queues a region of pixels rendered by the sketch (a Sprite buffer or
+//                  line buffer in pushImage() format)
+//   endFrame()   : sends the regions top to bottom with pushImageDMA() (pushImage() if
+//                  tft.initDMA() has not been called), the last transfer continues while
+//                  the sketch moves on
+//
+// If the DMA transfers of a frame are still running at the next frame slot the slot is
+// skipped (with TE), so rendering is throttled to what the bus can carry instead of
+// waiting in every call. Render, transfer and idle times are recorded in frame_stats_t.
+//
+// Tearing: the panel scans its memory top to bottom once per refresh. A region tears if
+// one refresh shows some of its new rows and some of its old ones, which happens when
+// the scan line passes the row being written. If the panel TE (tearing effect) output
+// is connected the scheduler measures the refresh period and phase, starts frames on a
+// TE edge, and starts each region at the first time the scan will not cross it, from
+// the region size and bus rate. Without a TE pin (or if no TE edges are seen) the phase
+// of the refresh is unknown, and aligning frames to a guessed one tears more often than
+// not aligning them. Frame slots then only cap the frame rate, from micros(), and the
+// regions are sent in scan order as soon as the slot starts.
+//
+// The scan model assumes screen rows are panel rows (rotation 0 on most panels) and TE
+// mode 0 (high during vertical blanking, enabled by the panel init code).
+//
+// Typical use:
+//   TFT_eFrameScheduler frames = TFT_eFrameScheduler(&tft);
+//   tft.initDMA();
+//   frames.begin(30, TFT_TE_PIN);              // 30 fps, TE pin or -1
+//   ...
+//   frames.beginFrame();
+//   spr.fillSprite(TFT_BLACK); ...             // Render the changed regions
+//   frames.push(x, y, spr.width(), spr.height(), (uint16_t*)spr.getPointer());
+//   frames.endFrame();
+//
+// Region buffers must not be changed until the next beginFrame() returns. The TFT
+// transaction stays open while the last transfer runs, so do not draw to the TFT
+// between endFrame() and beginFrame(), or call flush() first.
+***************************************************************************************/
+
+#define FRAME_REGIONS   16 // Regions queued per frame
+
+typedef struct {
+  uint32_t frames;         // Frames sent by endFrame()
+  uint32_t throttled;      // Frame slots skipped as DMA was still sending the last frame (TE)
+  uint32_t late;           // Frames started more than a frame after their slot
+  uint32_t regions;        // Regions sent
+  uint32_t delayed;        // Regions started later so the scan would not cross them (TE)
+  uint32_t unsafe;         // Regions with no tear free start time (too slow to send, TE)
+  uint32_t renderUs;       // Last frame: beginFrame() return to endFrame() call
+  uint32_t transferUs;     // Last frame: time in endFrame() and waiting for its DMA
+  uint32_t idleUs;         // Last frame: time beginFrame() waited for the frame slot
+  uint64_t renderTotal;    // Totals of the above for all frames, microseconds
+  uint64_t transferTotal;
+  uint64_t idleTotal;
+  uint32_t periodUs;       // Panel refresh period (measured if a TE pin is used)
+} frame_stats_t;
+
+class TFT_eFrameScheduler {
+
+ public:
+
+  explicit TFT_eFrameScheduler(TFT_eSPI *tft);
+
+           // Start pacing at fps frames per second. tePin is the panel TE output, -1 if
+           // not connected (frames are not aligned to the refresh). With a TE pin this
+           // measures the refresh (up to 3 periods).
+  void     begin(uint16_t fps, int8_t tePin = -1);
+
+           // Panel refresh period and vertical blanking time in microseconds, the first
+           // estimate before TE is measured. Default 60Hz, blank = period / 16.
+  void     setScan(uint32_t periodUs, uint32_t blankUs = 0);
+           // Bus clock used to estimate transfer times, bits per second (default SPI_FREQUENCY)
+  void     setBusRate(uint32_t bitsPerSecond) { _busRate = bitsPerSecond; }
+
+           // Wait for the next frame slot, true when the frame can be rendered. If wait
+           // is false it returns false at once when the slot is not due (or, without TE,
+           // while the last frame is still being sent).
+  bool     beginFrame(bool wait = true);
+           // Queue a region, pixels as pushImage(), sent by endFrame(). False if full.
+  bool     push(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *data);
+           // Send the queued regions
+  void     endFrame(void);
+           // Wait for the last transfer to end and close the TFT transaction
+  void     flush(void);
+
+  void     getStats(frame_stats_t &stats) { stats = _stats; }
+  void     resetStats(void);
+
+ private:
+
+  struct Region { int32_t x, y, w, h; uint16_t *data; };
+
+  void     waitUntil(uint32_t time);
+  bool     waitTE(uint32_t timeout);
+  bool     crosses(uint32_t start, uint32_t time, int32_t y, int32_t h);
+  void     send(const Region &r);
+
+  TFT_eSPI *_tft;
+
+  int8_t   _te;                               // TE pin, -1 if none
+  uint32_t _frameUs;                          // Frame period
+  uint8_t  _refreshes;                        // Refreshes per frame with a TE pin
+  uint32_t _periodUs, _blankUs;               // Panel scan model
+  uint32_t _teTime;                           // micros() of the last TE rising edge
+  uint32_t _busRate;
+
+  uint32_t _next;                             // Time of the next frame slot
+  uint32_t _frameStart;                       // beginFrame() return time
+  uint32_t _idle;                             // Idle time before this frame
+  bool     _open;                             // TFT transaction open, last transfer may be running
+
+  Region   _region[FRAME_REGIONS];
+  uint8_t  _regions;
+
+  frame_stats_t _stats;
+};
@@ -0,0 +1,397 @@
+/**************************************************************************************
+// The following class fills areas with colour gradients or patterns using a colour ramp
+// lookup table and line buffers, see Gradient.h
+***************************************************************************************/
+
+#define GRADIENT_DMA_PIXELS 1024 // Size of each DMA line buffer
+#define GRADIENT_LINE_PIXELS 64  // Size of the line buffer on the stack if DMA is not used
+
+// 4x4 Bayer matrix for ordered dithering
+static const uint8_t bayer4x4[16] = {
+   0,  8,  2, 10,
+  12,  4, 14,  6,
+   3, 11,  1,  9,
+  15,  7, 13,  5
+};
+
+/***************************************************************************************
+** Function name:           rampIndex
+** Description:             Convert a ramp position (65536 per ramp) to a ramp index
+***************************************************************************************/
+static inline uint8_t rampIndex(int32_t t, uint8_t spread)
+{
+  if (spread == GRADIENT_REPEAT) return t >> 8;
+  if (spread == GRADIENT_REFLECT) {
+    t = (t >> 8) & 0x1FF;
+    return t > 255 ? 511 - t : t;
+  }
+  return t < 0 ? 0 : (t > 0xFFFF ? 255 : t >> 8);
+}
+
+/***************************************************************************************
+** Function name:           atan2Turns
+** Description:             Fast atan2(y, x) in turns (0 to 1), error < 0.00025 turn
+***************************************************************************************/
+static inline float atan2Turns(float y, float x)
+{
+  float ax = fabsf(x), ay = fabsf(y);
+  if (ax + ay == 0.0f) return 0.0f;
+
+  // First octant angle from a quadratic correction to atan(z) = z * PI/4
+  float z = (ax > ay) ? ay / ax : ax / ay;
+  float a = z * (0.125f + (1.0f - z) * (0.038946f + 0.010552f * z));
+
+  if (ay > ax) a = 0.25f - a;
+  if (x < 0.0f) a = 0.5f - a;
+  if (y < 0.0f) a = 1.0f - a;
+  return a;
+}
+
+/***************************************************************************************
+** Function name:           TFT_eGradient
+** Description:             Class constructor, draws on the TFT
+***************************************************************************************/
+TFT_eGradient::TFT_eGradient(TFT_eSPI *tft)
+{
+  _tft = tft;
+  _spr = nullptr;
+
+  _type   = GRADIENT_LINEAR;
+  _spread = GRADIENT_PAD;
+  _dither = false;
+  _swapTile = false;
+
+  _x0 = 0;
+  _y0 = 0;
+  _dx = 0;
+  _dy = 0;
+  _start = 0;
+  _scale = 0;
+
+  _tile  = nullptr;
+  _tileW = 0;
+  _tileH = 0;
+
+  setColors(TFT_BLACK, TFT_WHITE);
+}
+
+/***************************************************************************************
+** Function name:           TFT_eGradient
+** Description:             Class constructor, draws in a Sprite
+***************************************************************************************/
+TFT_eGradient::TFT_eGradient(TFT_eSprite *spr) : TFT_eGradient((TFT_eSPI*)spr)
+{
+  _spr = spr;
+}
+
+/***************************************************************************************
+** Function name:           setColors
+** Description:             Set the ramp end colours and remove other colour stops
+***************************************************************************************/
+void TFT_eGradient::setColors(uint16_t color1, uint16_t color2)
+{
+  _stops = 2;
+  _stopPos[0] = 0;
+  _stopPos[1] = 255;
+  _stopColor[0] = color1;
+  _stopColor[1] = color2;
+  _rampValid = false;
+}
+
+/***************************************************************************************
+** Function name:           addStop
+** Description:             Add a colour stop, stops at the same position give a hard edge
+***************************************************************************************/
+bool TFT_eGradient::addStop(uint8_t position, uint16_t color)
+{
+  if (_stops >= GRADIENT_STOPS) return false;
+
+  // Keep stops in position order
+  uint8_t i = _stops++;
+  while (i > 0 && _stopPos[i - 1] > position) {
+    _stopPos[i] = _stopPos[i - 1];
+    _stopColor[i] = _stopColor[i - 1];
+    i--;
+  }
+  _stopPos[i] = position;
+  _stopColor[i] = color;
+  _rampValid = false;
+
+  return true;
+}
+
+/***************************************************************************************
+** Function name:           setLinear
+** Description:             Set a linear gradient from x0,y0 to x1,y1
+***************************************************************************************/
+void TFT_eGradient::setLinear(int32_t x0, int32_t y0, int32_t x1, int32_t y1)
+{
+  _type = GRADIENT_LINEAR;
+  _x0 = x0;
+  _y0 = y0;
+
+  // Ramp position is the projection onto the gradient vector, divided by its length squared
+  float dx = x1 - x0, dy = y1 - y0;
+  float len2 = dx * dx + dy * dy;
+  if (len2 < 1.0f) len2 = 1.0f;
+  _dx = lroundf(dx * 65536.0f / len2);
+  _dy = lroundf(dy * 65536.0f / len2);
+}
+
+/***************************************************************************************
+** Function name:           setRadial
+** Description:             Set a radial gradient centred on x,y with radius r
+***************************************************************************************/
+void TFT_eGradient::setRadial(int32_t x, int32_t y, int32_t r)
+{
+  _type = GRADIENT_RADIAL;
+  _x0 = x;
+  _y0 = y;
+  if (r < 1) r = 1;
+  _scale = 65536.0f / r;
+}
+
+/***************************************************************************************
+** Function name:           setConic
+** Description:             Set a conic gradient centred on x,y starting at angle
+***************************************************************************************/
+void TFT_eGradient::setConic(int32_t x, int32_t y, uint16_t angle)
+{
+  _type = GRADIENT_CONIC;
+  _x0 = x;
+  _y0 = y;
+  _start = (angle % 360) * 65536 / 360;
+}
+
+/***************************************************************************************
+** Function name:           setPattern
+** Description:             Set an image tile to be repeated
+***************************************************************************************/
+void TFT_eGradient::setPattern(const uint16_t *tile, uint16_t w, uint16_t h)
+{
+  _type = GRADIENT_PATTERN;
+  _tile = tile;
+  _tileW = w;
+  _tileH = h;
+}
+
+/***************************************************************************************
+** Function name:           fillRect
+** Description:             Fill a rectangle with the gradient or pattern
+***************************************************************************************/
+void TFT_eGradient::fillRect(int32_t x, int32_t y, int32_t w, int32_t h)
+{
+  fillArea(x, y, w, h, -1);
+}
+
+/***************************************************************************************
+** Function name:           fillCircle
+** Description:             Fill a circle with the gradient or pattern
+***************************************************************************************/
+void TFT_eGradient::fillCircle(int32_t x, int32_t y, int32_t r)
+{
+  if (r < 0) return;
+  fillArea(x - r, y - r, r + r + 1, r + r + 1, r);
+}
+
+/***************************************************************************************
+** Function name:           makeRamp
+** Description:             Calculate the colour ramp lookup tables from the colour stops
+***************************************************************************************/
+void TFT_eGradient::makeRamp(void)
+{
+  uint8_t s = 0; // Stop at or before the ramp index
+
+  for (uint16_t i = 0; i < 256; i++) {
+    while (s + 1 < _stops && i > _stopPos[s + 1]) s++;
+
+    uint16_t c0 = _stopColor[s], c1 = c0;
+    int32_t  f = 0, span = 1;
+    if (s + 1 < _stops && i > _stopPos[s]) {
+      c1 = _stopColor[s + 1];
+      span = _stopPos[s + 1] - _stopPos[s];
+      f = i - _stopPos[s];
+    }
+
+    // Interpolate with 8 bit channels, 565 colours are scaled so stop colours dither to themselves
+    uint32_t r = ((((c0 >> 11) & 0x1F) << 3) * (span - f) + (((c1 >> 11) & 0x1F) << 3) * f + (span >> 1)) / span;
+    uint32_t g = ((((c0 >>  5) & 0x3F) << 2) * (span - f) + (((c1 >>  5) & 0x3F) << 2) * f + (span >> 1)) / span;
+    uint32_t b = ((( c0        & 0x1F) << 3) * (span - f) + (( c1        & 0x1F) << 3) * f + (span >> 1)) / span;
+
+    // Channels are spaced out so a dither threshold can be added to all three at once
+    _rampDither[i] = (r << 20) | (g << 10) | b;
+
+    uint16_t rgb = (((r + 4) >> 3) << 11) | (((g + 2) >> 2) << 5) | ((b + 4) >> 3);
+    _ramp[i] = (rgb >> 8) | (rgb << 8);
+  }
+
+  _rampValid = true;
+}
+
+/***************************************************************************************
+** Function name:           rampColor
+** Description:             Get the colour in TFT byte order for a ramp position
+***************************************************************************************/
+inline uint16_t TFT_eGradient::rampColor(int32_t t, uint32_t threshold)
+{
+  uint8_t i = rampIndex(t, _spread);
+  if (!_dither) return _ramp[i];
+
+  uint32_t c = _rampDither[i] + threshold;
+  uint16_t rgb = ((c >> 12) & 0xF800) | ((c >> 7) & 0x07E0) | ((c >> 3) & 0x001F);
+  return (rgb >> 8) | (rgb << 8);
+}
+
+/***************************************************************************************
+** Function name:           drawRow
+** Description:             Generate w pixels of row y starting at x into a line buffer
+***************************************************************************************/
+void TFT_eGradient::drawRow(uint16_t *buf, int32_t x, int32_t y, int32_t w)
+{
+  if (_type == GRADIENT_PATTERN) {
+    int32_t tx = x % _tileW, ty = y % _tileH;
+    if (tx < 0) tx += _tileW;
+    if (ty < 0) ty += _tileH;
+    const uint16_t *row = _tile + ty * _tileW;
+
+    while (w > 0) {
+      int32_t len = min(w, (int32_t)_tileW - tx);
+      if (_swapTile) _tft->swapBytes16(buf, row + tx, len);
+      else memcpy(buf, row + tx, len << 1);
+      buf += len;
+      w -= len;
+      tx = 0;
+    }
+    return;
+  }
+
+  // Dither thresholds for this row indexed by x & 3: 0-7 for red and blue, 0-3 for green
+  uint32_t threshold[4] = { 0, 0, 0, 0 };
+  if (_dither) {
+    for (uint8_t i = 0; i < 4; i++) {
+      uint32_t d = bayer4x4[((y & 3) << 2) + i];
+      threshold[i] = ((d >> 1) << 20) | ((d >> 2) << 10) | (d >> 1);
+    }
+  }
+
+  int32_t dx = x - _x0;
+  int32_t dy = y - _y0;
+
+  if (_type == GRADIENT_LINEAR) {
+    int32_t t = dx * _dx + dy * _dy;
+    while (w--) {
+      *buf++ = rampColor(t, threshold[x++ & 3]);
+      t += _dx;
+    }
+  }
+  else if (_type == GRADIENT_RADIAL) {
+    int32_t d2 = dx * dx + dy * dy; // Distance squared, updated as x increases
+    while (w--) {
+      *buf++ = rampColor((int32_t)(sqrtf((float)d2) * _scale), threshold[x++ & 3]);
+      d2 += dx + dx + 1;
+      dx++;
+    }
+  }
+  else { // GRADIENT_CONIC
+    while (w--) {
+      // Clockwise from 6 o'clock is atan2(-dx, dy) for screen coordinates
+      int32_t t = ((int32_t)(atan2Turns(-dx, dy) * 65536.0f) - _start) & 0xFFFF;
+      *buf++ = rampColor(t, threshold[x++ & 3]);
+      dx++;
+    }
+  }
+}
+
+/***************************************************************************************
+** Function name:           circleSpan (local)
+** Description:             Clip x range xs to xe to row y of a circle, false if empty
+***************************************************************************************/
+static bool circleSpan(int32_t cx, int32_t cy, int32_t r, int32_t y, int32_t *xs, int32_t *xe)
+{
+  int32_t dy = y - cy;
+  int32_t hw = (int32_t)sqrtf((float)(r * r + r - dy * dy));
+  if (*xs < cx - hw) *xs = cx - hw;
+  if (*xe > cx + hw + 1) *xe = cx + hw + 1;
+  return *xs < *xe;
+}
+
+/***************************************************************************************
+** Function name:           fillArea
+** Description:             Fill a rectangle, or circle of radius r if r >= 0
+***************************************************************************************/
+void TFT_eGradient::fillArea(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r)
+{
+  if (_type == GRADIENT_PATTERN && (!_tile || !_tileW || !_tileH)) return;
+
+  int32_t cx = x + r, cy = y + r; // Circle centre
+
+  // Clip to the viewport, then convert back to coordinates relative to the datum
+  if (!_tft->clipAddrWindow(&x, &y, &w, &h)) return;
+  x -= _tft->getViewportX();
+  y -= _tft->getViewportY();
+
+  if (!_rampValid) makeRamp();
+
+  // Line buffers are in TFT byte order, a pattern tile is in the byte order set by the sketch
+  _swapTile = _tft->getSwapBytes();
+  _tft->setSwapBytes(false);
+
+  if (!_spr) _tft->startWrite();
+
+#ifdef DMA_LINE_BUFFERS
+  if (!_spr && _tft->DMA_Enabled) {
+    // Rectangles are sent several lines at a time, circle rows are sent separately
+    int32_t lines = 1;
+    if (r < 0) {
+      lines = GRADIENT_DMA_PIXELS / w;
+      if (lines < 1) lines = 1;
+      if (lines > h) lines = h;
+    }
+    uint16_t* dmaBuf = (uint16_t*)DMA_LINE_MALLOC(2 * lines * w * sizeof(uint16_t));
+    if (dmaBuf) {
+      uint16_t* buf = dmaBuf;
+      int32_t n = 0; // Lines in buffer
+      for (int32_t yp = y; yp < y + h; yp++) {
+        int32_t xs = x, xe = x + w;
+        if (r >= 0 && !circleSpan(cx, cy, r, yp, &xs, &xe)) continue;
+        drawRow(buf + n * w, xs, yp, xe - xs);
+        if (r < 0 && ++n < lines && yp + 1 < y + h) continue;
+        // DMA coordinates do not include the viewport datum. Waits for the previous buffer to be sent.
+        int32_t rows = (r < 0) ? n : 1;
+        _tft->pushImageDMA(xs + _tft->getViewportX(), yp + 1 - rows + _tft->getViewportY(), xe - xs, rows, buf);
+        buf = (buf == dmaBuf) ? dmaBuf + lines * w : dmaBuf;
+        n = 0;
+      }
+      _tft->dmaWait();
+      DMA_LINE_FREE(dmaBuf);
+      _tft->endWrite();
+      _tft->setSwapBytes(_swapTile);
+      return;
+    }
+  }
+#endif
+
+  // Fixed size buffer on the stack, rows are sent in several parts to one TFT window.
+  // setWindow() coordinates do not include the viewport datum.
+  uint16_t lineBuf[GRADIENT_LINE_PIXELS];
+  int32_t vx = _tft->getViewportX(), vy = _tft->getViewportY();
+  if (!_spr && r < 0) _tft->setWindow(x + vx, y + vy, x + vx + w - 1, y + vy + h - 1);
+
+  for (int32_t yp = y; yp < y + h; yp++) {
+    int32_t xs = x, xe = x + w;
+    if (r >= 0) {
+      if (!circleSpan(cx, cy, r, yp, &xs, &xe)) continue;
+      if (!_spr) _tft->setWindow(xs + vx, yp + vy, xe + vx - 1, yp + vy);
+    }
+    for (int32_t xp = xs; xp < xe; xp += GRADIENT_LINE_PIXELS) {
+      int32_t len = min(xe - xp, (int32_t)GRADIENT_LINE_PIXELS);
+      drawRow(lineBuf, xp, yp, len);
+      if (_spr) _spr->pushImage(xp, yp, len, 1, lineBuf);
+      else _tft->pushPixels(lineBuf, len);
+    }
+  }
+
+  if (!_spr) _tft->endWrite();
+
+  _tft->setSwapBytes(_swapTile);
+}
@@ -0,0 +1,87 @@
+/***************************************************************************************
+// The following class fills rectangles and circles with linear, radial or conic colour
+// gradients, or with a repeated image tile (pattern). The colour ramp is calculated once
+// into a 256 entry lookup table, pixels are generated into line buffers and pushed to
+// the TFT (with DMA double buffering if tft.initDMA() has been called) or a Sprite.
+// Ordered (4x4 Bayer) dithering can be enabled to hide the banding of RGB565 colours.
+//
+// Typical use:
+//   TFT_eGradient grad = TFT_eGradient(&tft);  // or TFT_eGradient(&sprite)
+//   grad.setColors(TFT_NAVY, TFT_CYAN);        // Ramp end colours
+//   grad.addStop(128, TFT_WHITE);              // Optional extra colours
+//   grad.setRadial(120, 120, 120);             // Ramp runs from the centre to the radius
+//   grad.setDither(true);
+//   grad.fillCircle(120, 120, 120);
+***************************************************************************************/
+
+// Gradient types
+#define GRADIENT_LINEAR  0
+#define GRADIENT_RADIAL  1
+#define GRADIENT_CONIC   2
+#define GRADIENT_PATTERN 3
+
+// Ramp extension beyond the ends of a linear or radial gradient
+#define GRADIENT_PAD     0 // End colours continue
+#define GRADIENT_REPEAT  1 // Ramp repeats
+#define GRADIENT_REFLECT 2 // Ramp repeats, alternately reversed
+
+#define GRADIENT_STOPS   8 // Maximum number of colour stops
+
+class TFT_eGradient {
+
+ public:
+
+  explicit TFT_eGradient(TFT_eSPI *tft);
+  explicit TFT_eGradient(TFT_eSprite *spr);
+
+           // Colour ramp, the two colours are at positions 0 and 255. Clears other stops.
+  void     setColors(uint16_t color1, uint16_t color2);
+           // Add a colour stop at position 0-255, returns false if all stops are used
+  bool     addStop(uint8_t position, uint16_t color);
+
+           // Linear gradient, the ramp runs from x0,y0 to x1,y1
+  void     setLinear(int32_t x0, int32_t y0, int32_t x1, int32_t y1);
+           // Radial gradient, the ramp runs from the centre x,y out to radius r
+  void     setRadial(int32_t x, int32_t y, int32_t r);
+           // Conic gradient, the ramp runs clockwise around x,y starting at angle
+           // Angles are in degrees, 0 degrees is at 6 o'clock (as for drawArc)
+  void     setConic(int32_t x, int32_t y, uint16_t angle = 0);
+           // Pattern, the w x h image tile is repeated from 0,0. RGB565 colours are in the
+           // same byte order as pushImage() expects with the current setSwapBytes() setting.
+  void     setPattern(const uint16_t *tile, uint16_t w, uint16_t h);
+
+  void     setSpread(uint8_t spread) { _spread = spread; } // GRADIENT_PAD/REPEAT/REFLECT
+  void     setDither(bool dither)    { _dither = dither; } // Ordered dithering on or off
+
+           // Fill the area with the gradient or pattern, coordinates are as for TFT_eSPI
+  void     fillRect(int32_t x, int32_t y, int32_t w, int32_t h);
+  void     fillCircle(int32_t x, int32_t y, int32_t r);
+
+ private:
+
+  void     fillArea(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r);
+  void     drawRow(uint16_t *buf, int32_t x, int32_t y, int32_t w);
+  void     makeRamp(void);
+  uint16_t rampColor(int32_t t, uint32_t threshold);
+
+  TFT_eSPI    *_tft;          // Drawing target
+  TFT_eSprite *_spr;          // Sprite target, nullptr if drawing to the TFT
+
+  uint8_t  _type, _spread;
+  bool     _dither, _swapTile, _rampValid;
+
+  uint8_t  _stops;
+  uint8_t  _stopPos[GRADIENT_STOPS];
+  uint16_t _stopColor[GRADIENT_STOPS];
+
+  int32_t  _x0, _y0;           // Start point or centre
+  int32_t  _dx, _dy;           // Linear ramp position change per pixel, 65536 per ramp
+  int32_t  _start;             // Conic start angle, 65536 per turn
+  float    _scale;             // Radial ramp position change per pixel, 65536 per ramp
+
+  const uint16_t *_tile;
+  uint16_t _tileW, _tileH;
+
+  uint16_t _ramp[256];         // RGB565 colours in TFT byte order
+  uint32_t _rampDither[256];   // RGB colours with 8 bit precision for dithering
+};
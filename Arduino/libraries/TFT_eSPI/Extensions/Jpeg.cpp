@@ -0,0 +1,856 @@
+/**************************************************************************************
+// The following class decodes baseline JPEGs into strip buffers and pushes them to the
+// TFT or a Sprite, see Jpeg.h
+***************************************************************************************/
+
+// Markers
+#define JPEG_SOF0 0xC0
+#define JPEG_SOF1 0xC1
+#define JPEG_DHT  0xC4
+#define JPEG_RST0 0xD0
+#define JPEG_RST7 0xD7
+#define JPEG_SOI  0xD8
+#define JPEG_EOI  0xD9
+#define JPEG_SOS  0xDA
+#define JPEG_DQT  0xDB
+#define JPEG_DRI  0xDD
+
+// Natural (row major) position of each zigzag coefficient
+static const uint8_t jpegZigzag[64] = {
+   0,  1,  8, 16,  9,  2,  3, 10,
+  17, 24, 32, 25, 18, 11,  4,  5,
+  12, 19, 26, 33, 40, 48, 41, 34,
+  27, 20, 13,  6,  7, 14, 21, 28,
+  35, 42, 49, 56, 57, 50, 43, 36,
+  29, 22, 15, 23, 30, 37, 44, 51,
+  58, 59, 52, 45, 38, 31, 39, 46,
+  53, 60, 61, 54, 47, 55, 62, 63
+};
+
+// Reduced size inverse DCT coefficients, 4096 * C(u)/2 * cos((2x + 1) * u * PI / 2N)
+// for output sample x and coefficient u, where C(0) = 1/sqrt(2) and C(u) = 1 otherwise
+static const int16_t jpegIdct4[4][4] = {
+  { 1448,  1892,  1448,   784 },
+  { 1448,   784, -1448, -1892 },
+  { 1448,  -784, -1448,  1892 },
+  { 1448, -1892,  1448,  -784 }
+};
+
+static const int16_t jpegIdct2[2][2] = {
+  { 1448,  1448 },
+  { 1448, -1448 }
+};
+
+// 8 point inverse DCT constants (Loeffler, Ligtenberg and Moschytz), 13 bit fixed point
+#define JPEG_CONST_BITS  13
+#define JPEG_PASS1_BITS  2
+#define FIX_0_298631336  2446
+#define FIX_0_390180644  3196
+#define FIX_0_541196100  4433
+#define FIX_0_765366865  6270
+#define FIX_0_899976223  7373
+#define FIX_1_175875602  9633
+#define FIX_1_501321110  12299
+#define FIX_1_847759065  15137
+#define FIX_1_961570560  16069
+#define FIX_2_053119869  16819
+#define FIX_2_562915447  20995
+#define FIX_3_072711026  25172
+
+/***************************************************************************************
+** Function name:           jpegClamp
+** Description:             Limit a sample to the range 0-255
+***************************************************************************************/
+static inline uint8_t jpegClamp(int32_t v)
+{
+  if ((uint32_t)v > 255) return v < 0 ? 0 : 255;
+  return v;
+}
+
+/***************************************************************************************
+** Function name:           TFT_eJpeg
+** Description:             Class constructor, draws on the TFT
+***************************************************************************************/
+TFT_eJpeg::TFT_eJpeg(TFT_eSPI *tft)
+{
+  _tft = tft;
+  _spr = nullptr;
+
+  _t = nullptr;
+
+  _inPtr = nullptr;
+  _inEnd = nullptr;
+  _reader = nullptr;
+  _user = nullptr;
+  _inBuf = nullptr;
+  _error = JPEG_OK;
+
+  _bits = 0;
+  _nbits = 0;
+  _marker = 0;
+
+  _width = 0;
+  _height = 0;
+  _comps = 0;
+  _hmax = 1;
+  _vmax = 1;
+  _restartInterval = 0;
+  _qtValid = 0;
+  _htValid = 0;
+
+  _blockN = 8;
+
+  _mcuCount = 0;
+  _stripCount = 0;
+}
+
+/***************************************************************************************
+** Function name:           TFT_eJpeg
+** Description:             Class constructor, draws in a Sprite
+***************************************************************************************/
+TFT_eJpeg::TFT_eJpeg(TFT_eSprite *spr) : TFT_eJpeg((TFT_eSPI*)spr)
+{
+  _spr = spr;
+}
+
+/***************************************************************************************
+** Function name:           getSize
+** Description:             Get the size of a JPEG in memory
+***************************************************************************************/
+int8_t TFT_eJpeg::getSize(const uint8_t *data, uint32_t len, uint16_t *w, uint16_t *h)
+{
+  begin(data, len, nullptr, nullptr);
+  int8_t result = readHeaders(true);
+  *w = result == JPEG_OK ? _width : 0;
+  *h = result == JPEG_OK ? _height : 0;
+  return result;
+}
+
+/***************************************************************************************
+** Function name:           getSize
+** Description:             Get the size of a JPEG read through a callback
+***************************************************************************************/
+int8_t TFT_eJpeg::getSize(JpegReader reader, void *user, uint16_t *w, uint16_t *h)
+{
+  uint8_t inBuf[JPEG_INPUT_BUFFER];
+  _inBuf = inBuf;
+  begin(nullptr, 0, reader, user);
+  int8_t result = readHeaders(true);
+  _inBuf = nullptr;
+  *w = result == JPEG_OK ? _width : 0;
+  *h = result == JPEG_OK ? _height : 0;
+  return result;
+}
+
+/***************************************************************************************
+** Function name:           drawJpg
+** Description:             Draw a JPEG in memory
+***************************************************************************************/
+int8_t TFT_eJpeg::drawJpg(int32_t x, int32_t y, const uint8_t *data, uint32_t len, uint8_t scale)
+{
+  _t = (Tables*)malloc(sizeof(Tables));
+  if (!_t) return JPEG_ERR_MEMORY;
+
+  begin(data, len, nullptr, nullptr);
+  int8_t result = readHeaders(false);
+  if (result == JPEG_OK) result = decode(x, y, scale);
+
+  free(_t);
+  _t = nullptr;
+  return result;
+}
+
+/***************************************************************************************
+** Function name:           drawJpg
+** Description:             Draw a JPEG read through a callback
+***************************************************************************************/
+int8_t TFT_eJpeg::drawJpg(int32_t x, int32_t y, JpegReader reader, void *user, uint8_t scale)
+{
+  _t = (Tables*)malloc(sizeof(Tables));
+  _inBuf = (uint8_t*)malloc(JPEG_INPUT_BUFFER);
+
+  int8_t result = JPEG_ERR_MEMORY;
+  if (_t && _inBuf) {
+    begin(nullptr, 0, reader, user);
+    result = readHeaders(false);
+    if (result == JPEG_OK) result = decode(x, y, scale);
+  }
+
+  if (_t) free(_t);
+  if (_inBuf) free(_inBuf);
+  _t = nullptr;
+  _inBuf = nullptr;
+  return result;
+}
+
+/***************************************************************************************
+** Function name:           begin
+** Description:             Set the input and clear the decoder state
+***************************************************************************************/
+void TFT_eJpeg::begin(const uint8_t *data, uint32_t len, JpegReader reader, void *user)
+{
+  _inPtr = data;
+  _inEnd = data + len;
+  _reader = reader;
+  _user = user;
+  if (reader) _inPtr = _inEnd = nullptr;
+  _error = JPEG_OK;
+
+  _bits = 0;
+  _nbits = 0;
+  _marker = 0;
+
+  _width = 0;
+  _height = 0;
+  _comps = 0;
+  _restartInterval = 0;
+  _qtValid = 0;
+  _htValid = 0;
+
+  _mcuCount = 0;
+  _stripCount = 0;
+}
+
+/***************************************************************************************
+** Function name:           fill
+** Description:             Refill the input buffer, returns false at the end of the input
+***************************************************************************************/
+bool TFT_eJpeg::fill(void)
+{
+  uint32_t n = _reader ? _reader(_user, _inBuf, JPEG_INPUT_BUFFER) : 0;
+  if (n == 0) {
+    _error = JPEG_ERR_INPUT;
+    return false;
+  }
+  _inPtr = _inBuf;
+  _inEnd = _inBuf + n;
+  return true;
+}
+
+/***************************************************************************************
+** Function name:           skip
+** Description:             Skip input bytes
+***************************************************************************************/
+void TFT_eJpeg::skip(uint32_t n)
+{
+  while (n && _error == JPEG_OK) {
+    uint32_t avail = _inEnd - _inPtr;
+    if (avail == 0) {
+      if (!fill()) return;
+      continue;
+    }
+    if (avail > n) avail = n;
+    _inPtr += avail;
+    n -= avail;
+  }
+}
+
+/***************************************************************************************
+** Function name:           readHeaders
+** Description:             Read markers up to the frame header, or the start of the scan
+***************************************************************************************/
+int8_t TFT_eJpeg::readHeaders(bool frameOnly)
+{
+  if (getByte() != 0xFF || getByte() != JPEG_SOI) return _error ? _error : JPEG_ERR_FORMAT;
+
+  while (_error == JPEG_OK) {
+    // Find the next marker, 0xFF fill bytes may come before it
+    if (getByte() != 0xFF) return _error ? _error : JPEG_ERR_FORMAT;
+    uint8_t marker = getByte();
+    while (marker == 0xFF) marker = getByte();
+
+    if (marker == JPEG_EOI || (marker >= JPEG_RST0 && marker <= JPEG_RST7)) return JPEG_ERR_FORMAT;
+    int32_t len = getWord() - 2;
+    if (len < 0) return JPEG_ERR_FORMAT;
+
+    switch (marker) {
+
+      case JPEG_SOF0:
+      case JPEG_SOF1:
+        if (getByte() != 8) return JPEG_ERR_UNSUPPORTED; // Sample precision
+        _height = getWord();
+        _width  = getWord();
+        _comps  = getByte();
+        if (_comps != 1 && _comps != 3) return JPEG_ERR_UNSUPPORTED;
+        if (!_width || !_height || len != 6 + _comps * 3) return JPEG_ERR_FORMAT;
+        for (uint8_t i = 0; i < _comps; i++) {
+          _comp[i].id = getByte();
+          uint8_t hv  = getByte();
+          _comp[i].h  = hv >> 4;
+          _comp[i].v  = hv & 0x0F;
+          _comp[i].tq = getByte() & 3;
+        }
+        // A single component image is coded in 8x8 MCUs whatever its sampling factors
+        _hmax = _vmax = 1;
+        if (_comps == 3) {
+          if (_comp[1].h != 1 || _comp[1].v != 1 || _comp[2].h != 1 || _comp[2].v != 1) return JPEG_ERR_UNSUPPORTED;
+          if (_comp[0].h < 1 || _comp[0].h > 2 || _comp[0].v < 1 || _comp[0].v > 2) return JPEG_ERR_UNSUPPORTED;
+          _hmax = _comp[0].h;
+          _vmax = _comp[0].v;
+        }
+        if (frameOnly) return _error;
+        break;
+
+      case JPEG_DQT:
+        if (frameOnly) { skip(len); break; }
+        while (len > 0 && _error == JPEG_OK) {
+          uint8_t pq = getByte();
+          uint8_t tq = pq & 3;
+          bool wide = pq >> 4;
+          for (uint8_t k = 0; k < 64; k++) _t->quant[tq][k] = wide ? getWord() : getByte();
+          _qtValid |= 1 << tq;
+          len -= wide ? 129 : 65;
+        }
+        if (len) return JPEG_ERR_FORMAT;
+        break;
+
+      case JPEG_DHT:
+        if (frameOnly) { skip(len); break; }
+        while (len > 0 && _error == JPEG_OK) {
+          uint8_t tc = getByte();
+          uint8_t th = tc & 0x0F;
+          if (th > 1 || (tc >> 4) > 1) return JPEG_ERR_FORMAT;
+          uint8_t n = (tc >> 4) * 2 + th; // DC tables first
+          Huffman *huff = &_t->huff[n];
+
+          uint8_t  count[17];
+          uint16_t total = 0;
+          for (uint8_t l = 1; l <= 16; l++) total += count[l] = getByte();
+          if (total > 256) return JPEG_ERR_FORMAT;
+          for (uint16_t i = 0; i < total; i++) huff->symbol[i] = getByte();
+          len -= 17 + total;
+
+          // Canonical codes, lookup table entries for all codes that start with a short code
+          memset(huff->fast, 0, sizeof(huff->fast));
+          uint32_t code = 0;
+          uint16_t k = 0;
+          for (uint8_t l = 1; l <= 16; l++) {
+            huff->delta[l] = k - code;
+            for (uint8_t i = 0; i < count[l]; i++, k++, code++) {
+              if (l <= JPEG_FAST_BITS) {
+                uint16_t first = code << (JPEG_FAST_BITS - l);
+                uint16_t last  = first + (1 << (JPEG_FAST_BITS - l));
+                if (last > (1 << JPEG_FAST_BITS)) return JPEG_ERR_FORMAT;
+                for (uint16_t j = first; j < last; j++) huff->fast[j] = (l << 8) | huff->symbol[k];
+              }
+            }
+            huff->maxcode[l] = code;
+            if (code > (1UL << l)) return JPEG_ERR_FORMAT;
+            code <<= 1;
+          }
+          _htValid |= 1 << n;
+        }
+        if (len) return JPEG_ERR_FORMAT;
+        break;
+
+      case JPEG_DRI:
+        if (len < 2) return JPEG_ERR_FORMAT;
+        _restartInterval = getWord();
+        skip(len - 2);
+        break;
+
+      case JPEG_SOS:
+        {
+          if (!_comps) return JPEG_ERR_FORMAT;
+          // Components must be interleaved in one scan
+          if (getByte() != _comps) return JPEG_ERR_UNSUPPORTED;
+          for (uint8_t i = 0; i < _comps; i++) {
+            uint8_t id = getByte();
+            uint8_t t  = getByte();
+            uint8_t c = 0;
+            while (c < _comps && _comp[c].id != id) c++;
+            if (c == _comps) return JPEG_ERR_FORMAT;
+            _comp[c].td = t >> 4;
+            _comp[c].ta = t & 0x0F;
+            if (_comp[c].td > 1 || _comp[c].ta > 1) return JPEG_ERR_FORMAT;
+            if (!(_htValid & (1 << _comp[c].td)) || !(_htValid & (4 << _comp[c].ta))) return JPEG_ERR_FORMAT;
+            if (!(_qtValid & (1 << _comp[c].tq))) return JPEG_ERR_FORMAT;
+          }
+          skip(3); // Spectral selection and successive approximation, fixed for baseline
+          return _error;
+        }
+
+      default:
+        // Other frame types are not supported, other markers (APPn, COM etc.) are skipped
+        if (marker >= 0xC2 && marker <= 0xCF && marker != 0xC4 && marker != 0xC8 && marker != 0xCC) {
+          return JPEG_ERR_UNSUPPORTED;
+        }
+        skip(len);
+        break;
+    }
+  }
+
+  return _error;
+}
+
+/***************************************************************************************
+** Function name:           fillBits
+** Description:             Add entropy coded bytes to the bit buffer
+***************************************************************************************/
+void TFT_eJpeg::fillBits(void)
+{
+  while (_nbits <= 24) {
+    uint32_t c = 0;
+    // After a marker zero bits are supplied, the marker is dealt with at the next restart
+    if (!_marker) {
+      c = getByte();
+      if (c == 0xFF) {
+        uint8_t m = getByte();
+        while (m == 0xFF) m = getByte();
+        if (m) {
+          _marker = m;
+          c = 0;
+        }
+      }
+    }
+    _bits |= c << (24 - _nbits);
+    _nbits += 8;
+  }
+}
+
+/***************************************************************************************
+** Function name:           getBits
+** Description:             Get the next n bits (0-16)
+***************************************************************************************/
+int32_t TFT_eJpeg::getBits(uint8_t n)
+{
+  if (!n) return 0;
+  if (_nbits < n) fillBits();
+  int32_t v = _bits >> (32 - n);
+  _bits <<= n;
+  _nbits -= n;
+  return v;
+}
+
+/***************************************************************************************
+** Function name:           decodeHuffman
+** Description:             Decode a Huffman coded symbol
+***************************************************************************************/
+uint8_t TFT_eJpeg::decodeHuffman(const Huffman *huff)
+{
+  if (_nbits < 16) fillBits();
+
+  uint16_t entry = huff->fast[_bits >> (32 - JPEG_FAST_BITS)];
+  if (entry) {
+    _bits <<= entry >> 8;
+    _nbits -= entry >> 8;
+    return entry;
+  }
+
+  // Longer codes
+  uint32_t code = _bits >> 16;
+  for (uint8_t l = JPEG_FAST_BITS + 1; l <= 16; l++) {
+    int32_t c = code >> (16 - l);
+    if (c < huff->maxcode[l]) {
+      _bits <<= l;
+      _nbits -= l;
+      return huff->symbol[c + huff->delta[l]];
+    }
+  }
+
+  _error = JPEG_ERR_FORMAT;
+  return 0;
+}
+
+/***************************************************************************************
+** Function name:           decodeBlock
+** Description:             Decode a block, the coefficients are only kept if store is true
+***************************************************************************************/
+void TFT_eJpeg::decodeBlock(Component *comp, bool store)
+{
+  const Huffman  *ac = &_t->huff[2 + comp->ta];
+  const uint16_t *q  = _t->quant[comp->tq];
+  int16_t *coef = _t->coef;
+
+  // DC difference from the last block of this component
+  uint8_t s = decodeHuffman(&_t->huff[comp->td]);
+  if (s > 11) { _error = JPEG_ERR_FORMAT; return; }
+  int32_t v = getBits(s);
+  if (s && v < (1 << (s - 1))) v -= (1 << s) - 1;
+  comp->dc += v;
+
+  if (store) {
+    memset(coef, 0, sizeof(_t->coef));
+    coef[0] = comp->dc * q[0];
+  }
+
+  for (uint8_t k = 1; k < 64; k++) {
+    uint8_t rs = decodeHuffman(ac);
+    s = rs & 0x0F;
+    if (!s) {
+      if (rs != 0xF0) break; // End of block, else a run of 16 zeros
+      k += 15;
+      continue;
+    }
+    k += rs >> 4;
+    if (k > 63) { _error = JPEG_ERR_FORMAT; return; }
+    v = getBits(s);
+    if (v < (1 << (s - 1))) v -= (1 << s) - 1;
+    if (store) coef[jpegZigzag[k]] = v * q[k];
+  }
+}
+
+/***************************************************************************************
+** Function name:           restart
+** Description:             Find a restart marker and reset the decoder
+***************************************************************************************/
+void TFT_eJpeg::restart(void)
+{
+  // Any bits left are padding
+  _bits = 0;
+  _nbits = 0;
+
+  if (!_marker) {
+    while (_error == JPEG_OK) {
+      if (getByte() != 0xFF) continue;
+      uint8_t m = getByte();
+      while (m == 0xFF) m = getByte();
+      if (m) { _marker = m; break; }
+    }
+  }
+  _marker = 0;
+
+  for (uint8_t i = 0; i < _comps; i++) _comp[i].dc = 0;
+}
+
+/***************************************************************************************
+** Function name:           idct8
+** Description:             Full size inverse DCT of the coefficients to 8x8 samples
+***************************************************************************************/
+// Two passes of the 8 point LLM inverse DCT, first on columns then on rows, with the
+// intermediate results scaled up by 2^JPEG_PASS1_BITS
+void TFT_eJpeg::idct8(uint8_t *out)
+{
+  int16_t *in = _t->coef;
+  int32_t  ws[64];
+  int32_t  tmp0, tmp1, tmp2, tmp3, tmp10, tmp11, tmp12, tmp13, z1, z2, z3, z4, z5;
+
+  for (uint8_t c = 0; c < 8; c++) {
+    const int16_t *p = in + c;
+    int32_t *w = ws + c;
+
+    // Columns with only a DC term are common
+    if (!(p[8] | p[16] | p[24] | p[32] | p[40] | p[48] | p[56])) {
+      int32_t dc = p[0] << JPEG_PASS1_BITS;
+      for (uint8_t r = 0; r < 64; r += 8) w[r] = dc;
+      continue;
+    }
+
+    // Even part
+    z2 = p[16];
+    z3 = p[48];
+    z1 = (z2 + z3) * FIX_0_541196100;
+    tmp2 = z1 - z3 * FIX_1_847759065;
+    tmp3 = z1 + z2 * FIX_0_765366865;
+    z2 = p[0];
+    z3 = p[32];
+    tmp0 = (z2 + z3) << JPEG_CONST_BITS;
+    tmp1 = (z2 - z3) << JPEG_CONST_BITS;
+    tmp10 = tmp0 + tmp3;
+    tmp13 = tmp0 - tmp3;
+    tmp11 = tmp1 + tmp2;
+    tmp12 = tmp1 - tmp2;
+
+    // Odd part
+    tmp0 = p[56];
+    tmp1 = p[40];
+    tmp2 = p[24];
+    tmp3 = p[8];
+    z1 = tmp0 + tmp3;
+    z2 = tmp1 + tmp2;
+    z3 = tmp0 + tmp2;
+    z4 = tmp1 + tmp3;
+    z5 = (z3 + z4) * FIX_1_175875602;
+    tmp0 *= FIX_0_298631336;
+    tmp1 *= FIX_2_053119869;
+    tmp2 *= FIX_3_072711026;
+    tmp3 *= FIX_1_501321110;
+    z1 *= -FIX_0_899976223;
+    z2 *= -FIX_2_562915447;
+    z3 = z3 * -FIX_1_961570560 + z5;
+    z4 = z4 * -FIX_0_390180644 + z5;
+    tmp0 += z1 + z3;
+    tmp1 += z2 + z4;
+    tmp2 += z2 + z3;
+    tmp3 += z1 + z4;
+
+    const uint8_t  shift = JPEG_CONST_BITS - JPEG_PASS1_BITS;
+    const int32_t  round = 1 << (shift - 1);
+    w[0]  = (tmp10 + tmp3 + round) >> shift;
+    w[56] = (tmp10 - tmp3 + round) >> shift;
+    w[8]  = (tmp11 + tmp2 + round) >> shift;
+    w[48] = (tmp11 - tmp2 + round) >> shift;
+    w[16] = (tmp12 + tmp1 + round) >> shift;
+    w[40] = (tmp12 - tmp1 + round) >> shift;
+    w[24] = (tmp13 + tmp0 + round) >> shift;
+    w[32] = (tmp13 - tmp0 + round) >> shift;
+  }
+
+  for (uint8_t r = 0; r < 64; r += 8) {
+    const int32_t *w = ws + r;
+    uint8_t *o = out + r;
+
+    // Level shift by 128 is added with the rounding
+    const uint8_t  shift = JPEG_CONST_BITS + JPEG_PASS1_BITS + 3;
+    const int32_t  round = (1 << (shift - 1)) + (128 << shift);
+
+    if (!(w[1] | w[2] | w[3] | w[4] | w[5] | w[6] | w[7])) {
+      uint8_t v = jpegClamp((w[0] + (round >> JPEG_CONST_BITS)) >> (JPEG_PASS1_BITS + 3));
+      memset(o, v, 8);
+      continue;
+    }
+
+    // Even part
+    z2 = w[2];
+    z3 = w[6];
+    z1 = (z2 + z3) * FIX_0_541196100;
+    tmp2 = z1 - z3 * FIX_1_847759065;
+    tmp3 = z1 + z2 * FIX_0_765366865;
+    tmp0 = (w[0] + w[4]) << JPEG_CONST_BITS;
+    tmp1 = (w[0] - w[4]) << JPEG_CONST_BITS;
+    tmp10 = tmp0 + tmp3 + round;
+    tmp13 = tmp0 - tmp3 + round;
+    tmp11 = tmp1 + tmp2 + round;
+    tmp12 = tmp1 - tmp2 + round;
+
+    // Odd part
+    tmp0 = w[7];
+    tmp1 = w[5];
+    tmp2 = w[3];
+    tmp3 = w[1];
+    z1 = tmp0 + tmp3;
+    z2 = tmp1 + tmp2;
+    z3 = tmp0 + tmp2;
+    z4 = tmp1 + tmp3;
+    z5 = (z3 + z4) * FIX_1_175875602;
+    tmp0 *= FIX_0_298631336;
+    tmp1 *= FIX_2_053119869;
+    tmp2 *= FIX_3_072711026;
+    tmp3 *= FIX_1_501321110;
+    z1 *= -FIX_0_899976223;
+    z2 *= -FIX_2_562915447;
+    z3 = z3 * -FIX_1_961570560 + z5;
+    z4 = z4 * -FIX_0_390180644 + z5;
+    tmp0 += z1 + z3;
+    tmp1 += z2 + z4;
+    tmp2 += z2 + z3;
+    tmp3 += z1 + z4;
+
+    o[0] = jpegClamp((tmp10 + tmp3) >> shift);
+    o[7] = jpegClamp((tmp10 - tmp3) >> shift);
+    o[1] = jpegClamp((tmp11 + tmp2) >> shift);
+    o[6] = jpegClamp((tmp11 - tmp2) >> shift);
+    o[2] = jpegClamp((tmp12 + tmp1) >> shift);
+    o[5] = jpegClamp((tmp12 - tmp1) >> shift);
+    o[3] = jpegClamp((tmp13 + tmp0) >> shift);
+    o[4] = jpegClamp((tmp13 - tmp0) >> shift);
+  }
+}
+
+/***************************************************************************************
+** Function name:           idctReduced
+** Description:             Inverse DCT to n x n samples (n = 4, 2 or 1)
+***************************************************************************************/
+// Only the n x n lowest frequency coefficients are used, which gives the samples of the
+// full size block at the centres of the reduced size pixels
+void TFT_eJpeg::idctReduced(uint8_t *out, uint8_t n)
+{
+  const int16_t *in = _t->coef;
+
+  if (n == 1) {
+    // DC is 8 times the mean
+    out[0] = jpegClamp(128 + ((in[0] + 4) >> 3));
+    return;
+  }
+
+  const int16_t *m = (n == 4) ? jpegIdct4[0] : jpegIdct2[0];
+  int32_t ws[16];
+
+  // Columns, result scaled up by 4
+  for (uint8_t c = 0; c < n; c++) {
+    for (uint8_t r = 0; r < n; r++) {
+      int32_t sum = 0;
+      for (uint8_t u = 0; u < n; u++) sum += m[r * n + u] * in[u * 8 + c];
+      ws[r * n + c] = (sum + (1 << 9)) >> 10;
+    }
+  }
+
+  // Rows, with the level shift
+  for (uint8_t r = 0; r < n; r++) {
+    for (uint8_t c = 0; c < n; c++) {
+      int32_t sum = (1 << 13) + (128 << 14);
+      for (uint8_t u = 0; u < n; u++) sum += m[c * n + u] * ws[r * n + u];
+      out[r * n + c] = jpegClamp(sum >> 14);
+    }
+  }
+}
+
+/***************************************************************************************
+** Function name:           colorMCU
+** Description:             Convert MCU pixels x0-x1, y0-y1 to RGB565 in TFT byte order
+***************************************************************************************/
+void TFT_eJpeg::colorMCU(uint16_t *out, int32_t stride, int32_t x0, int32_t x1, int32_t y0, int32_t y1)
+{
+  const uint8_t n = _blockN;
+
+  for (int32_t y = y0; y < y1; y++, out += stride) {
+    // Luma block row and chroma row (chroma samples are repeated for 2x luma sampling)
+    const uint8_t *luma = _t->sample[(y / n) * _hmax] + (y % n) * n;
+    const uint8_t *cb = _t->sample[_hmax * _vmax] + (y >> (_vmax - 1)) * n;
+    const uint8_t *cr = cb + 64;
+    uint16_t *p = out;
+
+    for (int32_t x = x0; x < x1; x++) {
+      int32_t Y = luma[(x / n) * 64 + (x % n)];
+      int32_t r = Y, g = Y, b = Y;
+
+      if (_comps == 3) {
+        int32_t u = cb[x >> (_hmax - 1)] - 128;
+        int32_t v = cr[x >> (_hmax - 1)] - 128;
+        // JFIF YCbCr to RGB, 16 bit fixed point
+        r += (91881 * v + 32768) >> 16;
+        g += (-22554 * u - 46802 * v + 32768) >> 16;
+        b += (116130 * u + 32768) >> 16;
+        r = jpegClamp(r);
+        g = jpegClamp(g);
+        b = jpegClamp(b);
+      }
+
+      // RGB565 with the high byte first in memory
+      *p++ = (r & 0xF8) | (g >> 5) | ((g & 0x1C) << 11) | ((b & 0xF8) << 5);
+    }
+  }
+}
+
+/***************************************************************************************
+** Function name:           push
+** Description:             Push lines from a strip buffer in TFT byte order
+***************************************************************************************/
+void TFT_eJpeg::push(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *buf, bool dma)
+{
+  _stripCount++;
+  if (_spr) _spr->pushImage(x, y, w, h, buf);
+#ifdef DMA_LINE_BUFFERS
+  // DMA coordinates do not include the viewport datum. Waits for the previous strip to be sent.
+  else if (dma) _tft->pushImageDMA(x + _tft->getViewportX(), y + _tft->getViewportY(), w, h, buf);
+#endif
+  else _tft->pushImage(x, y, w, h, buf);
+}
+
+/***************************************************************************************
+** Function name:           decode
+** Description:             Decode the scan and draw the image at x,y
+***************************************************************************************/
+int8_t TFT_eJpeg::decode(int32_t x, int32_t y, uint8_t scale)
+{
+  uint8_t shift = 0;
+  while ((1 << shift) < scale && shift < 3) shift++;
+  _blockN = 8 >> shift;
+
+  // Scaled image and MCU sizes
+  int32_t w = (_width  + (1 << shift) - 1) >> shift;
+  int32_t h = (_height + (1 << shift) - 1) >> shift;
+  int32_t mcuW = _hmax * _blockN;
+  int32_t mcuH = _vmax * _blockN;
+  int32_t mcuCols = (_width + _hmax * 8 - 1) / (_hmax * 8);
+
+  // Visible part of the image, relative to the image top left corner
+  int32_t vx = x, vy = y, vw = w, vh = h;
+  if (!_tft->clipAddrWindow(&vx, &vy, &vw, &vh)) return JPEG_OK;
+  vx -= _tft->getViewportX() + x;
+  vy -= _tft->getViewportY() + y;
+
+  int32_t colFirst = vx / mcuW;
+  int32_t colEnd   = (vx + vw - 1) / mcuW + 1;
+  int32_t rowEnd   = (vy + vh - 1) / mcuH + 1;
+
+  // Strip of whole MCU rows, the visible columns only
+  int32_t rowsPerStrip = (JPEG_STRIP_LINES + mcuH - 1) / mcuH;
+  int32_t stripH = rowsPerStrip * mcuH;
+  int32_t stripLen = vw * stripH;
+
+  uint16_t* strip  = nullptr;
+  uint16_t* buf    = nullptr;
+  bool      dma    = false;
+
+#ifdef DMA_LINE_BUFFERS
+  if (!_spr && _tft->DMA_Enabled) {
+    // Two strips only help if the next strip can be decoded while one is sent
+    if (rowEnd > rowsPerStrip) {
+      strip = (uint16_t*)DMA_LINE_MALLOC(2 * stripLen * sizeof(uint16_t));
+      dma = strip != nullptr;
+    }
+    if (!dma) _tft->dmaWait(); // Pixels are sent without DMA
+  }
+#endif
+  if (!strip) strip = (uint16_t*)malloc(stripLen * sizeof(uint16_t));
+  if (!strip) return JPEG_ERR_MEMORY;
+  buf = strip;
+
+  // Strip buffers are in TFT byte order
+  bool swap = _tft->getSwapBytes();
+  _tft->setSwapBytes(false);
+  if (!_spr) _tft->startWrite();
+
+  uint8_t  blocks = _hmax * _vmax + (_comps == 3 ? 2 : 0);
+  uint16_t restartCount = _restartInterval;
+  for (uint8_t i = 0; i < _comps; i++) _comp[i].dc = 0;
+
+  for (int32_t row = 0; row < rowEnd && _error == JPEG_OK; row++) {
+    int32_t yStrip = (row % rowsPerStrip) * mcuH; // MCU row position in the strip
+    bool rowVisible = (row + 1) * mcuH > vy;
+
+    for (int32_t col = 0; col < mcuCols; col++) {
+      if (_restartInterval) {
+        if (!restartCount) {
+          restart();
+          restartCount = _restartInterval;
+        }
+        restartCount--;
+      }
+
+      // Blocks are always decoded, only visible MCUs are transformed and colour converted
+      bool visible = rowVisible && col >= colFirst && col < colEnd;
+      for (uint8_t b = 0; b < blocks; b++) {
+        decodeBlock(&_comp[b < _hmax * _vmax ? 0 : b - _hmax * _vmax + 1], visible);
+        if (!visible) continue;
+        if (_blockN == 8) idct8(_t->sample[b]);
+        else idctReduced(_t->sample[b], _blockN);
+      }
+      if (_error) break;
+      _mcuCount++;
+
+      if (visible) {
+        int32_t xs = max(vx, col * mcuW);
+        int32_t xe = min(vx + vw, (col + 1) * mcuW);
+        colorMCU(buf + yStrip * vw + xs - vx, vw, xs - col * mcuW, xe - col * mcuW, 0, mcuH);
+      }
+    }
+
+    // Push the strip when it is full, or at the end
+    if (yStrip + mcuH == stripH || row + 1 == rowEnd) {
+      int32_t top = row * mcuH - yStrip; // Image line at the top of the strip
+      int32_t ys = max(vy, top);
+      int32_t ye = min(vy + vh, row * mcuH + mcuH);
+      if (ys < ye) {
+        push(x + vx, y + ys, vw, ye - ys, buf + (ys - top) * vw, dma);
+        if (dma) buf = (buf == strip) ? strip + stripLen : strip;
+      }
+    }
+  }
+
+#ifdef DMA_LINE_BUFFERS
+  if (dma) _tft->dmaWait();
+#endif
+
+  if (!_spr) _tft->endWrite();
+  _tft->setSwapBytes(swap);
+
+#ifdef DMA_LINE_BUFFERS
+  if (dma) DMA_LINE_FREE(strip);
+  else
+#endif
+  free(strip);
+
+  return _error;
+}
@@ -0,0 +1,138 @@
+/***************************************************************************************
+// The following class decodes baseline JPEG images straight to the TFT or a Sprite.
+// Each row of MCUs (the 8x8 or 16x16 pixel blocks a JPEG is coded in) is colour
+// converted into a full width strip buffer in TFT byte order and the strip is pushed
+// with one window, instead of one window per MCU. If tft.initDMA() has been called and
+// the image needs more than one strip, two strip buffers are used so the next strip is
+// decoded while DMA sends the last one.
+// Images can be reduced in size by 2, 4 or 8 while decoding, which needs less work as
+// a reduced size inverse DCT is used. MCUs outside the viewport are not colour converted
+// and decoding stops after the last visible row.
+//
+// Typical use:
+//   TFT_eJpeg jpeg = TFT_eJpeg(&tft);             // or TFT_eJpeg(&sprite)
+//   jpeg.drawJpg(0, 0, panda, sizeof(panda));     // JPEG in a FLASH array
+//   jpeg.drawJpg(0, 0, panda, sizeof(panda), 2);  // Half size
+//
+// JPEGs in files are read through a callback that fills a buffer, for example:
+//   uint32_t readFile(void *user, uint8_t *buf, uint32_t len) {
+//     return ((File*)user)->read(buf, len);
+//   }
+//   jpeg.drawJpg(0, 0, readFile, &file);
+//
+// Baseline (SOF0/SOF1) 8 bit JPEGs are supported: greyscale, or colour with the
+// chroma sampled 1x1 and luma 1x1, 2x1, 1x2 or 2x2 (4:4:4, 4:2:2, 4:4:0 and 4:2:0),
+// with or without restart markers. Progressive JPEGs return JPEG_ERR_UNSUPPORTED.
+// Colour (chroma) samples are repeated to fill the MCU, they are not interpolated.
+//
+// RAM is allocated while an image is drawn: about 7 kbytes for the decoder tables
+// plus one (two with DMA) strip buffers of visible width * 16 lines * 2 bytes.
+***************************************************************************************/
+
+// Return values
+#define JPEG_OK               0
+#define JPEG_ERR_FORMAT      -1 // Not a JPEG or the data is corrupt
+#define JPEG_ERR_UNSUPPORTED -2 // Progressive, arithmetic coded, 12 bit or unusual sampling
+#define JPEG_ERR_MEMORY      -3 // Not enough RAM
+#define JPEG_ERR_INPUT       -4 // Image data ended early or the reader failed
+
+#define JPEG_FAST_BITS        9 // Huffman codes up to this length are decoded with one lookup
+#define JPEG_INPUT_BUFFER   512 // Bytes read at a time by a reader callback
+#define JPEG_STRIP_LINES     16 // Minimum lines in a strip buffer
+
+// Reader callback, copy up to len bytes into buf and return the number of bytes copied
+typedef uint32_t (*JpegReader)(void *user, uint8_t *buf, uint32_t len);
+
+class TFT_eJpeg {
+
+ public:
+
+  explicit TFT_eJpeg(TFT_eSPI *tft);
+  explicit TFT_eJpeg(TFT_eSprite *spr);
+
+           // Get the image width and height in pixels, returns JPEG_OK or an error
+  int8_t   getSize(const uint8_t *data, uint32_t len, uint16_t *w, uint16_t *h);
+  int8_t   getSize(JpegReader reader, void *user, uint16_t *w, uint16_t *h);
+
+           // Draw the image with the top left corner at x,y, scale is 1, 2, 4 or 8
+           // to reduce the image size. Returns JPEG_OK or an error.
+  int8_t   drawJpg(int32_t x, int32_t y, const uint8_t *data, uint32_t len, uint8_t scale = 1);
+  int8_t   drawJpg(int32_t x, int32_t y, JpegReader reader, void *user, uint8_t scale = 1);
+
+           // Counts for the last image drawn
+  uint32_t mcus(void)   { return _mcuCount; }   // MCUs decoded (skipped rows at the end not included)
+  uint32_t strips(void) { return _stripCount; } // Strips (windows) pushed
+
+ private:
+
+  struct Huffman {
+    uint16_t fast[1 << JPEG_FAST_BITS]; // (code length << 8) | symbol, 0 for longer codes
+    int32_t  maxcode[17];               // Codes of each length are below this value
+    int32_t  delta[17];                 // Code to symbol index offset for each length
+    uint8_t  symbol[256];
+  };
+
+  struct Component {
+    uint8_t  id;
+    uint8_t  h, v;                      // Sampling factors
+    uint8_t  tq, td, ta;                // Quantisation, DC and AC Huffman table numbers
+    int16_t  dc;                        // DC prediction
+  };
+
+  struct Tables {
+    Huffman  huff[4];                   // DC 0, DC 1, AC 0, AC 1
+    uint16_t quant[4][64];              // In zigzag order
+    int16_t  coef[64];                  // Block being decoded
+    uint8_t  sample[6][64];             // Decoded blocks of an MCU
+  };
+
+  void     begin(const uint8_t *data, uint32_t len, JpegReader reader, void *user);
+  int8_t   readHeaders(bool frameOnly);
+  int8_t   decode(int32_t x, int32_t y, uint8_t scale);
+
+  bool     fill(void);
+  uint8_t  getByte(void)  { if (_inPtr == _inEnd && !fill()) return 0; return *_inPtr++; }
+  uint16_t getWord(void)  { uint16_t w = getByte() << 8; return w | getByte(); }
+  void     skip(uint32_t n);
+
+  void     fillBits(void);
+  int32_t  getBits(uint8_t n);
+  uint8_t  decodeHuffman(const Huffman *huff);
+  void     decodeBlock(Component *comp, bool store);
+  void     restart(void);
+
+  void     idct8(uint8_t *out);
+  void     idctReduced(uint8_t *out, uint8_t n);
+  void     colorMCU(uint16_t *out, int32_t stride, int32_t x0, int32_t x1, int32_t y0, int32_t y1);
+  void     push(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *buf, bool dma);
+
+  TFT_eSPI    *_tft;          // Drawing target
+  TFT_eSprite *_spr;          // Sprite target, nullptr if drawing to the TFT
+
+  Tables  *_t;                // Allocated while an image is decoded
+
+  // Input
+  const uint8_t *_inPtr, *_inEnd;
+  JpegReader _reader;
+  void    *_user;
+  uint8_t *_inBuf;            // Reader callback buffer
+  int8_t   _error;
+
+  // Entropy coded data
+  uint32_t _bits;             // Next bits, most significant bit first
+  int8_t   _nbits;            // Valid bits in _bits
+  uint8_t  _marker;           // Marker found in the entropy coded data, 0 if none
+
+  // Frame
+  uint16_t _width, _height;
+  uint8_t  _comps;
+  Component _comp[3];
+  uint8_t  _hmax, _vmax;      // Luma sampling factors
+  uint16_t _restartInterval;
+  uint8_t  _qtValid, _htValid; // Bit masks of tables defined
+
+  uint8_t  _blockN;           // Decoded block size, 8 / scale
+
+  uint32_t _mcuCount;
+  uint32_t _stripCount;
+};
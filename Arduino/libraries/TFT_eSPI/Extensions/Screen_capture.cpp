@@ -0,0 +1,272 @@
+/**************************************************************************************
+// The following class streams screen captures with unchanged blocks skipped and run
+// length encoded pixels, see Screen_capture.h for the stream format
+***************************************************************************************/
+
+#define CAPTURE_FNV_BASIS 2166136261UL
+#define CAPTURE_FNV_PRIME 16777619UL
+
+/***************************************************************************************
+** Function name:           TFT_eScreenCapture
+** Description:             Class constructor, captures the TFT screen
+***************************************************************************************/
+TFT_eScreenCapture::TFT_eScreenCapture(TFT_eSPI *tft)
+{
+  _tft = tft;
+  _spr = nullptr;
+
+  _hash  = nullptr;
+  _strip = nullptr;
+
+  _width  = 0;
+  _height = 0;
+  _cols = 0;
+  _rows = 0;
+  _blockW = 16;
+  _blockH = 8;
+
+  _frame = 0;
+  _keyInterval = 0;
+  _changed = 0;
+
+  _out = nullptr;
+  _written = 0;
+  _bufLen = 0;
+}
+
+/***************************************************************************************
+** Function name:           TFT_eScreenCapture
+** Description:             Class constructor, captures a Sprite
+***************************************************************************************/
+TFT_eScreenCapture::TFT_eScreenCapture(TFT_eSprite *spr) : TFT_eScreenCapture((TFT_eSPI*)spr)
+{
+  _spr = spr;
+}
+
+/***************************************************************************************
+** Function name:           ~TFT_eScreenCapture
+** Description:             Class destructor
+***************************************************************************************/
+TFT_eScreenCapture::~TFT_eScreenCapture(void)
+{
+  end();
+}
+
+/***************************************************************************************
+** Function name:           begin
+** Description:             Allocate the block hash table and strip buffer
+***************************************************************************************/
+bool TFT_eScreenCapture::begin(uint8_t blockW, uint8_t blockH)
+{
+  end();
+
+  if (blockW < 1) blockW = 1;
+  if (blockH < 1) blockH = 1;
+
+  _blockW = blockW;
+  _blockH = blockH;
+  _width  = _tft->width();
+  _height = _tft->height();
+  _cols = (_width  + blockW - 1) / blockW;
+  _rows = (_height + blockH - 1) / blockH;
+
+  _hash  = (uint32_t*)malloc(_cols * _rows * sizeof(uint32_t));
+  _strip = (uint16_t*)malloc(_width * blockH * sizeof(uint16_t));
+
+  if (!_hash || !_strip) {
+    end();
+    return false;
+  }
+
+  _frame = 0;
+
+  return true;
+}
+
+/***************************************************************************************
+** Function name:           end
+** Description:             Free the buffers
+***************************************************************************************/
+void TFT_eScreenCapture::end(void)
+{
+  if (_hash)  free(_hash);
+  if (_strip) free(_strip);
+
+  _hash  = nullptr;
+  _strip = nullptr;
+}
+
+/***************************************************************************************
+** Function name:           readStrip
+** Description:             Get h lines of pixels from line y in TFT byte order
+***************************************************************************************/
+const uint16_t* TFT_eScreenCapture::readStrip(int32_t y, int32_t h)
+{
+  if (_spr) {
+    // Unrotated 16 bit Sprites are used in place
+    if (_spr->getColorDepth() == 16 && _spr->getRotation() == 0) {
+      return (uint16_t*)_spr->getPointer() + y * _width;
+    }
+
+    uint16_t *p = _strip;
+    for (int32_t yp = y; yp < y + h; yp++) {
+      for (int32_t xp = 0; xp < _width; xp++) {
+        uint16_t color = _spr->readPixel(xp, yp);
+        *p++ = (color >> 8) | (color << 8);
+      }
+    }
+    return _strip;
+  }
+
+  _tft->readRect(0, y, _width, h, _strip);
+  return _strip;
+}
+
+/***************************************************************************************
+** Function name:           put
+** Description:             Buffer bytes for the output
+***************************************************************************************/
+void TFT_eScreenCapture::put(const void *data, uint32_t len)
+{
+  if (_bufLen + len > sizeof(_buf)) flush();
+
+  if (len >= sizeof(_buf)) _out->write((const uint8_t*)data, len);
+  else {
+    memcpy(_buf + _bufLen, data, len);
+    _bufLen += len;
+  }
+
+  _written += len;
+}
+
+/***************************************************************************************
+** Function name:           put16
+** Description:             Buffer a little-endian 16 bit value
+***************************************************************************************/
+void TFT_eScreenCapture::put16(uint16_t value)
+{
+  uint8_t le[2] = { (uint8_t)value, (uint8_t)(value >> 8) };
+  put(le, 2);
+}
+
+/***************************************************************************************
+** Function name:           flush
+** Description:             Write buffered bytes to the output
+***************************************************************************************/
+void TFT_eScreenCapture::flush(void)
+{
+  if (_bufLen) _out->write(_buf, _bufLen);
+  _bufLen = 0;
+}
+
+/***************************************************************************************
+** Function name:           encode
+** Description:             Run length encode a line of pixels
+***************************************************************************************/
+void TFT_eScreenCapture::encode(const uint16_t *pixels, int32_t len)
+{
+  while (len > 0) {
+    // Repeated pixels
+    int32_t run = 1;
+    while (run < len && run < 129 && pixels[run] == pixels[0]) run++;
+
+    if (run > 1) {
+      uint8_t n = 126 + run;
+      put(&n, 1);
+      put(pixels, 2);
+    }
+    else {
+      // Different pixels, up to the start of the next repeat
+      run = 1;
+      while (run < len && run < 128 && (run + 1 >= len || pixels[run] != pixels[run + 1])) run++;
+
+      uint8_t n = run - 1;
+      put(&n, 1);
+      put(pixels, run * 2);
+    }
+
+    pixels += run;
+    len -= run;
+  }
+}
+
+/***************************************************************************************
+** Function name:           capture
+** Description:             Capture a frame, only changed blocks are written to out
+***************************************************************************************/
+uint32_t TFT_eScreenCapture::capture(Print &out, bool keyFrame)
+{
+  // Start again if the screen size (rotation) has changed
+  if (!_hash || _width != _tft->width() || _height != _tft->height()) {
+    if (!begin(_blockW, _blockH)) return 0;
+  }
+
+  if (_frame == 0 || (_keyInterval && (_frame % _keyInterval) == 0)) keyFrame = true;
+
+  _out = &out;
+  _written = 0;
+  _bufLen = 0;
+  _changed = 0;
+
+  // Frame header
+  uint8_t header[5] = { 'T', 'F', (uint8_t)(keyFrame ? CAPTURE_KEY_FRAME : 0), _blockW, _blockH };
+  put(header, 5);
+  put16(_width);
+  put16(_height);
+  put16(_frame);
+  put16(_frame >> 16);
+
+  uint32_t  checksum = CAPTURE_FNV_BASIS;
+  uint32_t  rowHash[_cols];
+
+  for (uint16_t r = 0; r < _rows; r++) {
+    int32_t y = r * _blockH;
+    int32_t h = min((int32_t)_blockH, _height - y);
+    const uint16_t *lines = readStrip(y, h);
+
+    // Hash the blocks in this strip
+    for (uint16_t c = 0; c < _cols; c++) rowHash[c] = CAPTURE_FNV_BASIS;
+    const uint16_t *p = lines;
+    for (int32_t yp = 0; yp < h; yp++) {
+      for (uint16_t c = 0; c < _cols; c++) {
+        uint32_t hash = rowHash[c];
+        int32_t  n = min((int32_t)_blockW, _width - c * _blockW);
+        while (n--) hash = (hash ^ *p++) * CAPTURE_FNV_PRIME;
+        rowHash[c] = hash;
+      }
+    }
+
+    uint32_t *last = _hash + r * _cols;
+    for (uint16_t c = 0; c < _cols; c++) checksum = (checksum ^ rowHash[c]) * CAPTURE_FNV_PRIME;
+
+    // Send runs of changed blocks as rectangles
+    for (uint16_t c = 0; c < _cols; ) {
+      if (!keyFrame && rowHash[c] == last[c]) { c++; continue; }
+
+      uint16_t c0 = c;
+      while (c < _cols && (keyFrame || rowHash[c] != last[c])) { last[c] = rowHash[c]; c++; }
+      _changed += c - c0;
+
+      int32_t x = c0 * _blockW;
+      int32_t w = min((int32_t)(c * _blockW), _width) - x;
+      put16(x);
+      put16(y);
+      put16(w);
+      put16(h);
+      for (int32_t yp = 0; yp < h; yp++) encode(lines + yp * _width + x, w);
+    }
+  }
+
+  // End of frame
+  put16(0);
+  put16(0);
+  put16(0);
+  put16(0);
+  put16(checksum);
+  put16(checksum >> 16);
+  flush();
+
+  _frame++;
+
+  return _written;
+}
@@ -0,0 +1,91 @@
+/***************************************************************************************
+// The following class captures the screen (read back from the TFT with readRect() in
+// strips of lines) or a Sprite and streams it to any Print object (Serial, a network
+// client, a file etc.). The screen is split into blocks and a hash of each block is
+// kept, so after the first (key) frame only the blocks that have changed are sent.
+// Pixels are run length encoded. Tools/Host/Capture_decoder.cpp decodes the stream.
+//
+// Typical use:
+//   TFT_eScreenCapture cap = TFT_eScreenCapture(&tft);  // or TFT_eScreenCapture(&sprite)
+//   cap.begin();
+//   ...
+//   cap.capture(Serial);                                 // After each screen update
+//
+// The whole screen is captured, call tft.resetViewport() first if a viewport is set.
+// Reading the TFT needs the MISO (or bi-directional SDA) line to be connected.
+//
+// Stream format, 16 bit and 32 bit values are little-endian:
+//   Frame header (13 bytes):
+//     'T' 'F'            Magic
+//     uint8_t  flags     CAPTURE_KEY_FRAME if all blocks are sent
+//     uint8_t  blockW    Block width and height in pixels
+//     uint8_t  blockH
+//     uint16_t width     Screen size
+//     uint16_t height
+//     uint32_t frame     Frame number
+//   Then rectangles of changed pixels:
+//     uint16_t x, y, w, h
+//     Run length encoded pixels, in rows, until w * h pixels are decoded:
+//       control byte n < 128  : n + 1 pixels follow
+//       control byte n >= 128 : next pixel is repeated n - 126 times (2 to 129)
+//     Pixels are RGB565 with the high byte first (TFT byte order)
+//   Then an end of frame rectangle with w = 0 followed by:
+//     uint32_t checksum  FNV-1a hash of all block hashes in row order, each hashed as one word
+//
+// A block hash is the 32 bit FNV-1a hash of its pixels in row order, each pixel being
+// hashed as one 16 bit word (RGB565 low byte in bits 8-15, high byte in bits 0-7).
+***************************************************************************************/
+
+#define CAPTURE_KEY_FRAME 0x01 // Frame header flag, all blocks are sent
+
+class TFT_eScreenCapture {
+
+ public:
+
+  explicit TFT_eScreenCapture(TFT_eSPI *tft);
+  explicit TFT_eScreenCapture(TFT_eSprite *spr);
+  ~TFT_eScreenCapture(void);
+
+           // Allocate the block hash table and a strip buffer, returns false if out of RAM
+           // RAM needed is 4 bytes per block + screen width * blockH * 2 bytes
+  bool     begin(uint8_t blockW = 16, uint8_t blockH = 8);
+  void     end(void);
+
+           // Capture a frame and write it to out, returns the number of bytes written
+           // Only blocks that have changed since the last frame are sent unless keyFrame is true
+  uint32_t capture(Print &out, bool keyFrame = false);
+
+           // Send a key frame every n frames (0 = only the first frame is a key frame)
+  void     setKeyFrameInterval(uint16_t n) { _keyInterval = n; }
+
+  uint32_t frames(void)        { return _frame; }      // Frames captured
+  uint32_t changedBlocks(void) { return _changed; }    // Blocks sent in the last frame
+  uint32_t blocks(void)        { return _cols * _rows; } // Blocks per frame
+
+ private:
+
+  const uint16_t* readStrip(int32_t y, int32_t h);
+  void     put(const void *data, uint32_t len);
+  void     put16(uint16_t value);
+  void     flush(void);
+  void     encode(const uint16_t *pixels, int32_t len);
+
+  TFT_eSPI    *_tft;
+  TFT_eSprite *_spr;          // Sprite source, nullptr if the TFT is read
+
+  uint32_t *_hash;            // Block hashes from the last frame
+  uint16_t *_strip;           // Lines of pixels being compared and sent
+
+  int32_t  _width, _height;
+  uint16_t _cols, _rows;      // Blocks across and down
+  uint8_t  _blockW, _blockH;
+
+  uint32_t _frame;            // Frame number
+  uint16_t _keyInterval;
+  uint32_t _changed;
+
+  Print   *_out;              // Output buffering
+  uint32_t _written;
+  uint16_t _bufLen;
+  uint8_t  _buf[64];
+};
@@ -36,6 +36,19 @@ TFT_eSprite::TFT_eSprite(TFT_eSPI *tft)
 
   _colorMap = nullptr;
 
+  _deltaMode = SPRITE_DELTA_OFF;
+  _blockShiftW = 4;
+  _blockShiftH = 3;
+  _blockCols = 0;
+  _blockRows = 0;
+  _dirty = nullptr;
+  _blockHash = nullptr;
+  _deltaX = 0;
+  _deltaY = 0;
+  _deltaValid = false;
+  _deltaRects = 0;
+  _deltaPixels = 0;
+
   _psram_enable = true;
   
   // Ensure end_tft_write() does nothing in inherited functions.
@@ -284,6 +297,8 @@ void* TFT_eSprite::frameBuffer(int8_t f)
   if ( f == 2 ) _img8 = _img8_2;
   else          _img8 = _img8_1;
 
+  track(0, 0, _iwidth, _iheight);
+
   if (_bpp == 16) _img = (uint16_t*)_img8;
 
   //if (_bpp == 8) _img8 = _img8;
@@ -372,6 +387,9 @@ uint16_t TFT_eSprite::getPaletteColor(uint8_t index)
 ***************************************************************************************/
 void TFT_eSprite::deleteSprite(void)
 {
+  setDeltaPush(SPRITE_DELTA_OFF);
+  resetRoundClip();
+
   if (_colorMap != nullptr)
   {
     free(_colorMap);
@@ -660,6 +678,12 @@ void TFT_eSprite::pushSprite(int32_t x, int32_t y)
 {
   if (!_created) return;
 
+  if (_deltaMode != SPRITE_DELTA_OFF)
+  {
+    pushDelta(x, y);
+    return;
+  }
+
   if (_bpp == 16)
   {
     bool oldSwapBytes = _tft->getSwapBytes();
@@ -891,6 +915,224 @@ bool TFT_eSprite::pushSprite(int32_t tx, int32_t ty, int32_t sx, int32_t sy, int
 }
 
 
+/***************************************************************************************
+** Function name:           setDeltaPush
+** Description:             Set pushSprite(x, y) to send changed blocks only
+***************************************************************************************/
+bool TFT_eSprite::setDeltaPush(uint8_t mode, uint8_t blockW, uint8_t blockH)
+{
+  if (_dirty) free(_dirty);
+  if (_blockHash) free(_blockHash);
+  _dirty = nullptr;
+  _blockHash = nullptr;
+  _deltaMode = SPRITE_DELTA_OFF;
+  _deltaValid = false;
+
+  if (mode == SPRITE_DELTA_OFF) return true;
+  if (!_created || _bpp != 16) return false;
+
+  // Power of 2 block sizes so blocks are found with shifts
+  _blockShiftW = 2;
+  while ((2 << _blockShiftW) <= blockW) _blockShiftW++;
+  _blockShiftH = 2;
+  while ((2 << _blockShiftH) <= blockH) _blockShiftH++;
+
+  _blockCols = (_iwidth  + (1 << _blockShiftW) - 1) >> _blockShiftW;
+  _blockRows = (_iheight + (1 << _blockShiftH) - 1) >> _blockShiftH;
+  uint32_t blocks = _blockCols * _blockRows;
+
+  _dirty = (uint8_t*)calloc((blocks + 7) >> 3, 1);
+  if (mode == SPRITE_DELTA_HASH) _blockHash = (uint32_t*)malloc(blocks * sizeof(uint32_t));
+
+  if (!_dirty || (mode == SPRITE_DELTA_HASH && !_blockHash)) {
+    setDeltaPush(SPRITE_DELTA_OFF);
+    return false;
+  }
+
+  _deltaMode = mode;
+  return true;
+}
+
+
+/***************************************************************************************
+** Function name:           markDirty
+** Description:             Mark the blocks in an area as changed
+***************************************************************************************/
+void TFT_eSprite::markDirty(int32_t x, int32_t y, int32_t w, int32_t h)
+{
+  if (!_dirty) return;
+
+  if (x < 0) { w += x; x = 0; }
+  if (y < 0) { h += y; y = 0; }
+  if ((x + w) > _iwidth)  w = _iwidth  - x;
+  if ((y + h) > _iheight) h = _iheight - y;
+  if ((w < 1) || (h < 1)) return;
+
+  int32_t c0 = x >> _blockShiftW;
+  int32_t c1 = (x + w - 1) >> _blockShiftW;
+  int32_t r1 = (y + h - 1) >> _blockShiftH;
+
+  for (int32_t r = y >> _blockShiftH; r <= r1; r++) {
+    uint32_t bit = r * _blockCols + c0;
+    for (int32_t c = c0; c <= c1; c++, bit++) _dirty[bit >> 3] |= 1 << (bit & 7);
+  }
+}
+
+
+/***************************************************************************************
+** Function name:           hashBlocks
+** Description:             Hash the blocks, mark those that differ from the last push
+***************************************************************************************/
+// 32 bit FNV-1a hash of the pixels in each block, in row order
+void TFT_eSprite::hashBlocks(void)
+{
+  uint32_t rowHash[_blockCols];
+  int32_t  bw = 1 << _blockShiftW;
+  int32_t  bh = 1 << _blockShiftH;
+
+  for (int32_t r = 0; r < _blockRows; r++) {
+    for (int32_t c = 0; c < _blockCols; c++) rowHash[c] = 2166136261UL;
+
+    int32_t y0 = r * bh;
+    int32_t y1 = min(y0 + bh, _iheight);
+    for (int32_t y = y0; y < y1; y++) {
+      const uint16_t *p = _img + y * _iwidth;
+      for (int32_t c = 0; c < _blockCols; c++) {
+        uint32_t hash = rowHash[c];
+        int32_t  n = min(bw, _iwidth - c * bw);
+        while (n--) hash = (hash ^ *p++) * 16777619UL;
+        rowHash[c] = hash;
+      }
+    }
+
+    uint32_t *last = _blockHash + r * _blockCols;
+    for (int32_t c = 0; c < _blockCols; c++) {
+      if (rowHash[c] == last[c]) continue;
+      last[c] = rowHash[c];
+      uint32_t bit = r * _blockCols + c;
+      _dirty[bit >> 3] |= 1 << (bit & 7);
+    }
+  }
+}
+
+
+/***************************************************************************************
+** Function name:           pushDelta
+** Description:             Push the changed blocks of the sprite to the TFT at x, y
+***************************************************************************************/
+// Each run of changed blocks in a block row is a rectangle, runs with the same start and
+// end in the rows below are added to it so it is sent with one window
+void TFT_eSprite::pushDelta(int32_t x, int32_t y)
+{
+  // Everything is sent if the TFT does not hold the last push at this position
+  if (!_deltaValid || x != _deltaX || y != _deltaY) markDirty(0, 0, _iwidth, _iheight);
+  if (_deltaMode == SPRITE_DELTA_HASH) hashBlocks();
+
+  _deltaRects = 0;
+  _deltaPixels = 0;
+
+  int32_t bw = 1 << _blockShiftW;
+  int32_t bh = 1 << _blockShiftH;
+
+  // Open rectangles: first and last block column, first block row
+  uint16_t openC0[_blockCols], openC1[_blockCols], openR0[_blockCols];
+  uint16_t open = 0;
+
+  bool oldSwapBytes = _tft->getSwapBytes();
+  _tft->setSwapBytes(false);
+  _tft->startWrite();
+
+  for (int32_t r = 0; r <= _blockRows; r++) {
+    // Runs of changed blocks in this block row (none after the last row)
+    uint16_t runC0[_blockCols], runC1[_blockCols];
+    uint16_t runs = 0;
+    for (int32_t c = 0; r < _blockRows && c < _blockCols; c++) {
+      uint32_t bit = r * _blockCols + c;
+      if (!(_dirty[bit >> 3] & (1 << (bit & 7)))) continue;
+      runC0[runs] = c;
+      for (bit++; c + 1 < _blockCols && (_dirty[bit >> 3] & (1 << (bit & 7))); bit++) c++;
+      runC1[runs++] = c;
+    }
+
+    // Extend the open rectangles that match a run, send the others
+    uint16_t nextC0[_blockCols], nextC1[_blockCols], nextR0[_blockCols];
+    uint16_t next = 0, i = 0, j = 0;
+    while (i < open || j < runs) {
+      if (i < open && j < runs && openC0[i] == runC0[j] && openC1[i] == runC1[j]) {
+        nextC0[next] = runC0[j];
+        nextC1[next] = runC1[j++];
+        nextR0[next++] = openR0[i++];
+      }
+      else if (i < open && (j == runs || openC0[i] <= runC0[j])) {
+        pushArea(x, y, openC0[i] * bw, openR0[i] * bh, (openC1[i] - openC0[i] + 1) * bw, (r - openR0[i]) * bh);
+        i++;
+      }
+      else {
+        nextC0[next] = runC0[j];
+        nextC1[next] = runC1[j++];
+        nextR0[next++] = r;
+      }
+    }
+
+    memcpy(openC0, nextC0, next * sizeof(uint16_t));
+    memcpy(openC1, nextC1, next * sizeof(uint16_t));
+    memcpy(openR0, nextR0, next * sizeof(uint16_t));
+    open = next;
+  }
+
+  _tft->endWrite();
+  _tft->setSwapBytes(oldSwapBytes);
+
+  memset(_dirty, 0, (_blockCols * _blockRows + 7) >> 3);
+  _deltaX = x;
+  _deltaY = y;
+  _deltaValid = true;
+}
+
+
+/***************************************************************************************
+** Function name:           pushArea
+** Description:             Push an area of a 16 bit sprite to the TFT with one window
+***************************************************************************************/
+// Areas that cross the edge of the TFT round clip area are sent one row span at a time
+void TFT_eSprite::pushArea(int32_t x, int32_t y, int32_t sx, int32_t sy, int32_t sw, int32_t sh)
+{
+  // Clip to the sprite, then to the TFT viewport
+  if ((sx + sw) > _dwidth)  sw = _dwidth  - sx;
+  if ((sy + sh) > _dheight) sh = _dheight - sy;
+
+  int32_t tx = x + sx, ty = y + sy;
+  int32_t xs = tx + _tft->getViewportX(), ys = ty + _tft->getViewportY();
+  if (!_tft->clipAddrWindow(&tx, &ty, &sw, &sh)) return;
+  sx += tx - xs;
+  sy += ty - ys;
+
+  if (_tft->roundInside(tx, ty, sw, sh)) {
+    _tft->setWindow(tx, ty, tx + sw - 1, ty + sh - 1);
+    for (int32_t yp = sy; yp < sy + sh; yp++) _tft->pushPixels(_img + sx + yp * _iwidth, sw);
+
+    _deltaRects++;
+    _deltaPixels += sw * sh;
+    return;
+  }
+
+  // The area crosses the edge of the TFT round clip area, send each visible row span
+  for (int32_t yp = 0; yp < sh; yp++) {
+    int32_t xs, xe;
+    if (!_tft->getRoundSpan(ty + yp, &xs, &xe)) continue;
+    if (xs < tx) xs = tx;
+    if (xe > tx + sw - 1) xe = tx + sw - 1;
+    if (xs > xe) continue;
+
+    _tft->setWindow(xs, ty + yp, xe, ty + yp);
+    _tft->pushPixels(_img + sx + xs - tx + (sy + yp) * _iwidth, xe - xs + 1);
+
+    _deltaRects++;
+    _deltaPixels += xe - xs + 1;
+  }
+}
+
+
 /***************************************************************************************
 ** Function name:           readPixelValue
 ** Description:             Read the color map index of a pixel at defined coordinates
@@ -1032,8 +1274,12 @@ void  TFT_eSprite::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, uint16_
 {
   if (data == nullptr || !_created) return;
 
+  ROUND_CLIP(x, y, w, h, pushImage(x, y, w, h, data, sbpp));
+
   PI_CLIP;
 
+  track(x, y, dw, dh);
+
   if (_bpp == 16) // Plot a 16 bpp image into a 16 bpp Sprite
   {
     // Pointer within original image
@@ -1045,13 +1291,7 @@ void  TFT_eSprite::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, uint16_
     {
       while (dh--)
       {
-        // Fast copy with a 1 byte shift
-        memcpy(ptrs+1, ptro, (dw<<1) - 1);
-        // Now correct just the even numbered bytes
-        for (int32_t xp = 0; xp < (dw<<1); xp+=2)
-        {
-          ptrs[xp] = ptro[xp+1];;
-        }
+        swapBytes16((uint16_t*)ptrs, (uint16_t*)ptro, dw);
         ptro += w<<1;
         ptrs += _iwidth<<1;
       }
@@ -1175,8 +1415,12 @@ void  TFT_eSprite::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const u
   // Partitioned memory FLASH processor
   if (data == nullptr || !_created) return;
 
+  ROUND_CLIP(x, y, w, h, pushImage(x, y, w, h, data));
+
   PI_CLIP;
 
+  track(x, y, dw, dh);
+
   if (_bpp == 16) // Plot a 16 bpp image into a 16 bpp Sprite
   {
     for (int32_t yp = dy; yp < dy + dh; yp++)
@@ -1276,6 +1520,8 @@ void TFT_eSprite::setWindow(int32_t x0, int32_t y0, int32_t x1, int32_t y1)
     _ys = y0;
     _xe = x1;
     _ye = y1;
+
+    track(_xs, _ys, _xe - _xs + 1, _ye - _ys + 1);
   }
 
   _xptr = _xs;
@@ -1417,6 +1663,8 @@ void TFT_eSprite::setScrollRect(int32_t x, int32_t y, int32_t w, int32_t h, uint
 ***************************************************************************************/
 void TFT_eSprite::scroll(int16_t dx, int16_t dy)
 {
+  track(_sx, _sy, _sw, _sh);
+
   if (abs(dx) >= _sw || abs(dy) >= _sh)
   {
     fillRect (_sx, _sy, _sw, _sh, _scolor);
@@ -1518,8 +1766,10 @@ void TFT_eSprite::fillSprite(uint32_t color)
   if (!_created || _vpOoB) return;
 
   // Use memset if possible as it is super fast
-  if(_xDatum == 0 && _yDatum == 0  &&  _xWidth == width())
+  if(_xDatum == 0 && _yDatum == 0  &&  _xWidth == width() && !_roundSpan)
   {
+    track(0, 0, _iwidth, _yHeight);
+
     if(_bpp == 16) {
       if ( (uint8_t)color == (uint8_t)(color>>8) ) {
         memset(_img,  (uint8_t)color, _iwidth * _yHeight * 2);
@@ -1610,6 +1860,8 @@ void TFT_eSprite::setRotation(uint8_t r)
   else {
     resetViewport();
   }
+
+  if (_roundSpan) setRoundClip(_roundX, _roundY, _roundW, _roundH);
 }
 
 
@@ -1636,6 +1888,9 @@ void TFT_eSprite::drawPixel(int32_t x, int32_t y, uint32_t color)
 
   // Range checking
   if ((x < _vpX) || (y < _vpY) ||(x >= _vpW) || (y >= _vpH)) return;
+  if (_roundSpan && (x < _roundSpan[2 * y] || x > _roundSpan[2 * y + 1])) return;
+
+  track(x, y, 1, 1);
 
   if (_bpp == 16)
   {
@@ -1749,6 +2004,8 @@ void TFT_eSprite::drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color)
 {
   if (!_created || _vpOoB) return;
 
+  ROUND_CLIP(x, y, 1, h, drawFastVLine(x, y, h, color));
+
   x+= _xDatum;
   y+= _yDatum;
 
@@ -1761,6 +2018,8 @@ void TFT_eSprite::drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color)
 
   if (h < 1) return;
 
+  track(x, y, 1, h);
+
   if (_bpp == 16)
   {
     color = (color >> 8) | (color << 8);
@@ -1810,6 +2069,8 @@ void TFT_eSprite::drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color)
 {
   if (!_created || _vpOoB) return;
 
+  ROUND_CLIP(x, y, w, 1, drawFastHLine(x, y, w, color));
+
   x+= _xDatum;
   y+= _yDatum;
 
@@ -1822,6 +2083,8 @@ void TFT_eSprite::drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color)
 
   if (w < 1) return;
 
+  track(x, y, w, 1);
+
   if (_bpp == 16)
   {
     color = (color >> 8) | (color << 8);
@@ -1873,6 +2136,8 @@ void TFT_eSprite::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t
 {
   if (!_created || _vpOoB) return;
 
+  ROUND_CLIP(x, y, w, h, fillRect(x, y, w, h, color));
+
   x+= _xDatum;
   y+= _yDatum;
 
@@ -1887,11 +2152,22 @@ void TFT_eSprite::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t
 
   if ((w < 1) || (h < 1)) return;
 
+  track(x, y, w, h);
+
   int32_t yp = _iwidth * y + x;
 
   if (_bpp == 16)
   {
     color = (color >> 8) | (color << 8);
+    if ((uint8_t)color == (uint8_t)(color >> 8)) // Both bytes the same, e.g. black or white
+    {
+      while (h--)
+      {
+        memset(_img + yp, (uint8_t)color, w << 1);
+        yp += _iwidth;
+      }
+      return;
+    }
     uint32_t iw = w;
     int32_t ys = yp;
     if(h--)  {while (iw--) _img[yp++] = (uint16_t) color;}
@@ -2189,6 +2465,9 @@ int16_t TFT_eSprite::drawChar(uint16_t uniCode, int32_t x, int32_t y, uint8_t fo
   int32_t height = 0;
   uint32_t flash_address = 0;
   uniCode -= 32;
+#ifdef SPAN_FONTS
+  const uint8_t *sp = nullptr, *se = nullptr; // Span list start and end
+#endif
 
 #ifdef LOAD_FONT2
   if (font == 2) {
@@ -2220,7 +2499,8 @@ int16_t TFT_eSprite::drawChar(uint16_t uniCode, int32_t x, int32_t y, uint8_t fo
   int32_t pX      = 0;
   int32_t pY      = y;
   uint8_t line = 0;
-  bool clip = xd < _vpX || xd + width  * textsize >= _vpW || yd < _vpY || yd + height * textsize >= _vpH;
+  bool clip = xd < _vpX || xd + width  * textsize >= _vpW || yd < _vpY || yd + height * textsize >= _vpH ||
+              !roundInside(xd, yd, width * textsize, height * textsize);
 
 #ifdef LOAD_FONT2 // chop out code if we do not need it
   if (font == 2) {
@@ -2269,6 +2549,21 @@ int16_t TFT_eSprite::drawChar(uint16_t uniCode, int32_t x, int32_t y, uint8_t fo
 #endif  //FONT2
 
 #ifdef LOAD_RLE  //674 bytes of code
+#ifdef SPAN_FONTS
+  // Font has a precompiled span list, Sprite pixels are in RAM so the background
+  // is filled and the spans drawn over it
+  if (_spanFont && charSpans(font, uniCode, &sp, &se)) {
+    if (textcolor != textbgcolor) fillRect(x, y, width * textsize, height * textsize, textbgcolor);
+    while (sp < se) {
+      int32_t sx = pgm_read_byte(sp++);
+      int32_t sy = pgm_read_byte(sp++);
+      int32_t sl = pgm_read_byte(sp++);
+      if (textsize == 1) drawFastHLine(x + sx, y + sy, sl, textcolor);
+      else fillRect(x + sx * textsize, y + sy * textsize, sl * textsize, textsize, textcolor);
+    }
+  }
+  else
+#endif
   // Font is not 2 and hence is RLE encoded
   {
     w *= height; // Now w is total number of pixels in the character
@@ -5,6 +5,11 @@
 // graphics are written to the Sprite rather than the TFT.
 ***************************************************************************************/
 
+// pushSprite(x, y) delta modes, see setDeltaPush()
+#define SPRITE_DELTA_OFF   0 // The whole Sprite is sent
+#define SPRITE_DELTA_TRACK 1 // Sprite drawing functions mark the blocks they write to
+#define SPRITE_DELTA_HASH  2 // A hash of each block is compared with the hash at the last push
+
 class TFT_eSprite : public TFT_eSPI {
 
  public:
@@ -126,6 +131,21 @@ class TFT_eSprite : public TFT_eSPI {
            // Push a windowed area of the sprite to the TFT at tx, ty
   bool     pushSprite(int32_t tx, int32_t ty, int32_t sx, int32_t sy, int32_t sw, int32_t sh);
 
+           // Make pushSprite(x, y) send only the blocks of a 16 bit Sprite that have changed since
+           // the last push to the same position, as rectangles with blocks above each other merged.
+           // Blocks are blockW x blockH pixels (rounded down to a power of 2, minimum 4).
+           // SPRITE_DELTA_TRACK needs 1 bit per block, writes through getPointer() must be marked.
+           // SPRITE_DELTA_HASH needs 4 bytes per block and finds changes however they are made,
+           // but each push takes longer (and a change with the same 32 bit hash would be missed).
+           // Returns false if the Sprite is not 16 bit or there is not enough RAM.
+  bool     setDeltaPush(uint8_t mode, uint8_t blockW = 16, uint8_t blockH = 8);
+           // Mark an area (in Sprite memory coordinates, the viewport datum is not added) as changed.
+           // Marking the whole Sprite makes the next pushSprite(x, y) send it all.
+  void     markDirty(int32_t x, int32_t y, int32_t w, int32_t h);
+           // Rectangles (windows) and pixels sent by the last pushSprite(x, y)
+  uint16_t deltaRects(void)  { return _deltaRects; }
+  uint32_t deltaPixels(void) { return _deltaPixels; }
+
            // Push the sprite to another sprite at x,y. This fn calls pushImage() in the destination sprite (dspr) class.
   bool     pushToSprite(TFT_eSprite *dspr, int32_t x, int32_t y);
   bool     pushToSprite(TFT_eSprite *dspr, int32_t x, int32_t y, uint16_t transparent);
@@ -155,6 +175,12 @@ class TFT_eSprite : public TFT_eSPI {
            // Reserve memory for the Sprite and return a pointer
   void*    callocSprite(int16_t width, int16_t height, uint8_t frames = 1);
 
+           // Delta push support
+  void     track(int32_t x, int32_t y, int32_t w, int32_t h) { if (_deltaMode == SPRITE_DELTA_TRACK) markDirty(x, y, w, h); }
+  void     hashBlocks(void);
+  void     pushDelta(int32_t x, int32_t y);
+  void     pushArea(int32_t x, int32_t y, int32_t sx, int32_t sy, int32_t sw, int32_t sh);
+
            // Override the non-inlined TFT_eSPI functions
   void     begin_nin_write(void) { ; }
   void     end_nin_write(void) { ; }
@@ -185,4 +211,14 @@ class TFT_eSprite : public TFT_eSPI {
   int32_t  _dwidth, _dheight; // Real sprite width and height (for <8bpp Sprites)
   int32_t  _bitwidth;         // Sprite image bit width for drawPixel (for <8bpp Sprites, not swapped)
 
+  uint8_t  _deltaMode;        // SPRITE_DELTA_OFF, SPRITE_DELTA_TRACK or SPRITE_DELTA_HASH
+  uint8_t  _blockShiftW, _blockShiftH; // Block size as powers of 2
+  uint16_t _blockCols, _blockRows;
+  uint8_t  *_dirty;           // Changed block bits, row by row
+  uint32_t *_blockHash;       // Block hashes at the last push
+  int32_t  _deltaX, _deltaY;  // Position of the last push
+  bool     _deltaValid;       // The TFT holds the Sprite at _deltaX, _deltaY apart from dirty blocks
+  uint16_t _deltaRects;
+  uint32_t _deltaPixels;
+
 };
@@ -0,0 +1,512 @@
+/**************************************************************************************
+// The following classes store many transparent images in one atlas as opaque runs and
+// draw z ordered lists of them through line buffers, see Sprite_atlas.h
+***************************************************************************************/
+
+/***************************************************************************************
+** Function name:           TFT_eSpriteAtlas
+** Description:             Class constructor
+***************************************************************************************/
+TFT_eSpriteAtlas::TFT_eSpriteAtlas(void)
+{
+  _img = nullptr;
+  _w = _h = 0;
+  _transp = 0;
+
+  _frame = nullptr;
+  _frames = _maxFrames = 0;
+  _shelfX = _shelfY = _shelfH = 0;
+
+  _runs = nullptr;
+  _runLen = _runSize = 0;
+}
+
+/***************************************************************************************
+** Function name:           ~TFT_eSpriteAtlas
+** Description:             Class destructor
+***************************************************************************************/
+TFT_eSpriteAtlas::~TFT_eSpriteAtlas(void)
+{
+  deleteAtlas();
+}
+
+/***************************************************************************************
+** Function name:           createAtlas
+** Description:             Allocate the pixel store and frame table
+***************************************************************************************/
+bool TFT_eSpriteAtlas::createAtlas(uint16_t w, uint16_t h, uint16_t maxFrames, uint16_t transp)
+{
+  deleteAtlas();
+  if (!w || !h || !maxFrames) return false;
+
+  _img   = (uint16_t*)malloc((uint32_t)w * h * sizeof(uint16_t));
+  _frame = (Frame*)malloc(maxFrames * sizeof(Frame));
+  if (!_img || !_frame) {
+    deleteAtlas();
+    return false;
+  }
+
+  // Unused areas are transparent
+  _transp = transp >> 8 | transp << 8;
+  for (uint32_t i = 0; i < (uint32_t)w * h; i++) _img[i] = _transp;
+
+  _w = w;
+  _h = h;
+  _maxFrames = maxFrames;
+  return true;
+}
+
+/***************************************************************************************
+** Function name:           deleteAtlas
+** Description:             Free all the atlas memory
+***************************************************************************************/
+void TFT_eSpriteAtlas::deleteAtlas(void)
+{
+  if (_img) free(_img);
+  if (_frame) free(_frame);
+  if (_runs) free(_runs);
+
+  _img = nullptr;
+  _frame = nullptr;
+  _runs = nullptr;
+  _w = _h = 0;
+  _frames = _maxFrames = 0;
+  _shelfX = _shelfY = _shelfH = 0;
+  _runLen = _runSize = 0;
+}
+
+/***************************************************************************************
+** Function name:           place
+** Description:             Find space for a w x h frame, returns the frame or nullptr
+***************************************************************************************/
+// Frames are placed left to right in shelves, a new shelf starts below the tallest frame
+// of the last one when a frame does not fit across. Simple, and good for frames of
+// similar height such as the images of an animation.
+TFT_eSpriteAtlas::Frame* TFT_eSpriteAtlas::place(uint16_t w, uint16_t h)
+{
+  if (!_img || _frames >= _maxFrames || !w || !h || w > _w) return nullptr;
+
+  if (_shelfX + w > _w) {
+    _shelfY += _shelfH;
+    _shelfX = 0;
+    _shelfH = 0;
+  }
+  if (_shelfY + h > _h) return nullptr;
+
+  Frame* f = &_frame[_frames];
+  f->x = _shelfX;
+  f->y = _shelfY;
+  f->w = w;
+  f->h = h;
+  f->rows = 0;
+
+  _shelfX += w;
+  if (h > _shelfH) _shelfH = h;
+  return f;
+}
+
+/***************************************************************************************
+** Function name:           addFrame
+** Description:             Copy an image array into the atlas
+***************************************************************************************/
+int16_t TFT_eSpriteAtlas::addFrame(const uint16_t *data, uint16_t w, uint16_t h, bool swap)
+{
+  Frame* f = place(w, h);
+  if (!f || !data) return ATLAS_NO_FRAME;
+
+  for (int32_t y = 0; y < h; y++) {
+    uint16_t* dst = _img + (f->y + y) * _w + f->x;
+    const uint16_t* src = data + y * w;
+    if (swap) for (int32_t x = 0; x < w; x++) dst[x] = src[x] >> 8 | src[x] << 8;
+    else memcpy(dst, src, w * sizeof(uint16_t));
+  }
+
+  if (!addRuns(f)) return ATLAS_NO_FRAME;
+  return _frames++;
+}
+
+/***************************************************************************************
+** Function name:           addFrame
+** Description:             Copy a Sprite into the atlas
+***************************************************************************************/
+int16_t TFT_eSpriteAtlas::addFrame(TFT_eSprite *spr)
+{
+  return addFrame(spr, 0, 0, spr->width(), spr->height());
+}
+
+/***************************************************************************************
+** Function name:           addFrame
+** Description:             Copy an area of a Sprite into the atlas
+***************************************************************************************/
+// Pixels are read with readPixel(), so any colour depth and rotation can be used
+int16_t TFT_eSpriteAtlas::addFrame(TFT_eSprite *spr, int32_t sx, int32_t sy, int32_t sw, int32_t sh)
+{
+  if (!spr->created() || sw <= 0 || sh <= 0 || sw > 0xFFFF || sh > 0xFFFF) return ATLAS_NO_FRAME;
+
+  Frame* f = place(sw, sh);
+  if (!f) return ATLAS_NO_FRAME;
+
+  for (int32_t y = 0; y < sh; y++) {
+    uint16_t* dst = _img + (f->y + y) * _w + f->x;
+    for (int32_t x = 0; x < sw; x++) {
+      uint16_t color = spr->readPixel(sx + x, sy + y);
+      dst[x] = color >> 8 | color << 8;
+    }
+  }
+
+  if (!addRuns(f)) return ATLAS_NO_FRAME;
+  return _frames++;
+}
+
+/***************************************************************************************
+** Function name:           addRuns
+** Description:             Scan a frame and store the opaque runs of each row
+***************************************************************************************/
+// The row table holds h + 1 running totals of the runs, so row r has the runs from
+// table[r] to table[r + 1] - 1. Totals are 16 bit, very large noisy frames can fail.
+bool TFT_eSpriteAtlas::addRuns(Frame *f)
+{
+  // Count the runs first so the space is allocated once
+  uint32_t count = 0;
+  for (int32_t y = 0; y < f->h; y++) {
+    const uint16_t* src = _img + (f->y + y) * _w + f->x;
+    bool opaque = false;
+    for (int32_t x = 0; x < f->w; x++) {
+      bool o = src[x] != _transp;
+      if (o && !opaque) count++;
+      opaque = o;
+    }
+  }
+  if (count > 0xFFFF) return false;
+
+  uint32_t need = _runLen + f->h + 1 + 2 * count;
+  if (need > _runSize) {
+    uint32_t size = _runSize ? _runSize : 256;
+    while (size < need) size *= 2;
+    uint16_t* runs = (uint16_t*)realloc(_runs, size * sizeof(uint16_t));
+    if (!runs) return false;
+    _runs = runs;
+    _runSize = size;
+  }
+
+  f->rows = _runLen;
+  uint16_t* table = _runs + _runLen;
+  uint16_t* pair  = table + f->h + 1;
+  uint16_t  n = 0;
+
+  for (int32_t y = 0; y < f->h; y++) {
+    const uint16_t* src = _img + (f->y + y) * _w + f->x;
+    table[y] = n;
+    int32_t x = 0;
+    while (x < f->w) {
+      while (x < f->w && src[x] == _transp) x++;
+      if (x == f->w) break;
+      int32_t xs = x;
+      while (x < f->w && src[x] != _transp) x++;
+      *pair++ = xs;
+      *pair++ = x - xs;
+      n++;
+    }
+  }
+  table[f->h] = n;
+
+  _runLen = need;
+  return true;
+}
+
+/***************************************************************************************
+** Function name:           opaqueRuns
+** Description:             Return the number of opaque runs in a frame
+***************************************************************************************/
+uint32_t TFT_eSpriteAtlas::opaqueRuns(uint16_t f)
+{
+  if (f >= _frames) return 0;
+  return _runs[_frame[f].rows + _frame[f].h];
+}
+
+/***************************************************************************************
+** Function name:           memoryUsed
+** Description:             Return the bytes allocated by the atlas
+***************************************************************************************/
+uint32_t TFT_eSpriteAtlas::memoryUsed(void)
+{
+  return (uint32_t)_w * _h * sizeof(uint16_t) + _maxFrames * sizeof(Frame) + _runSize * sizeof(uint16_t);
+}
+
+
+/***************************************************************************************
+** Function name:           TFT_eCompositor
+** Description:             Class constructor, draw to the TFT
+***************************************************************************************/
+TFT_eCompositor::TFT_eCompositor(TFT_eSPI *tft)
+{
+  _tft = tft;
+  _spr = nullptr;
+
+  _item = nullptr;
+  _order = nullptr;
+  _items = _maxItems = 0;
+  _sorted = true;
+
+  _buf = nullptr;
+  _bufLen = 0;
+  _lines = COMPOSITOR_LINES;
+  _bg = TFT_BLACK;
+
+  _bandCount = _runCount = _pixelCount = 0;
+}
+
+/***************************************************************************************
+** Function name:           TFT_eCompositor
+** Description:             Class constructor, draw to a Sprite
+***************************************************************************************/
+TFT_eCompositor::TFT_eCompositor(TFT_eSprite *spr) : TFT_eCompositor((TFT_eSPI*)spr)
+{
+  _spr = spr;
+}
+
+/***************************************************************************************
+** Function name:           ~TFT_eCompositor
+** Description:             Class destructor
+***************************************************************************************/
+TFT_eCompositor::~TFT_eCompositor(void)
+{
+  end();
+}
+
+/***************************************************************************************
+** Function name:           begin
+** Description:             Allocate the item list
+***************************************************************************************/
+bool TFT_eCompositor::begin(uint16_t maxItems, uint16_t lines)
+{
+  end();
+  if (!maxItems) return false;
+
+  _item  = (Item*)malloc(maxItems * sizeof(Item));
+  _order = (uint16_t*)malloc(maxItems * sizeof(uint16_t));
+  if (!_item || !_order) {
+    end();
+    return false;
+  }
+
+  _maxItems = maxItems;
+  _lines = lines ? lines : 1;
+  return true;
+}
+
+/***************************************************************************************
+** Function name:           end
+** Description:             Free the item list and line buffers
+***************************************************************************************/
+void TFT_eCompositor::end(void)
+{
+  if (_item) free(_item);
+  if (_order) free(_order);
+  if (_buf) DMA_LINE_FREE(_buf);
+
+  _item = nullptr;
+  _order = nullptr;
+  _buf = nullptr;
+  _items = _maxItems = 0;
+  _bufLen = 0;
+}
+
+/***************************************************************************************
+** Function name:           add
+** Description:             Add an atlas frame to the scene, returns the item number
+***************************************************************************************/
+int16_t TFT_eCompositor::add(TFT_eSpriteAtlas *atlas, uint16_t frame, int32_t x, int32_t y, int16_t z)
+{
+  if (_items >= _maxItems || !atlas) return -1;
+
+  Item* it = &_item[_items];
+  it->atlas = atlas;
+  it->frame = frame;
+  it->x = x;
+  it->y = y;
+  it->z = z;
+  it->visible = true;
+
+  _order[_items] = _items;
+  _sorted = false;
+  return _items++;
+}
+
+/***************************************************************************************
+** Function name:           setItem
+** Description:             Change the frame and position of an item
+***************************************************************************************/
+void TFT_eCompositor::setItem(uint16_t item, uint16_t frame, int32_t x, int32_t y)
+{
+  if (item >= _items) return;
+  _item[item].frame = frame;
+  _item[item].x = x;
+  _item[item].y = y;
+}
+
+/***************************************************************************************
+** Function name:           setZ
+** Description:             Change the drawing order of an item
+***************************************************************************************/
+void TFT_eCompositor::setZ(uint16_t item, int16_t z)
+{
+  if (item >= _items || _item[item].z == z) return;
+  _item[item].z = z;
+  _sorted = false;
+}
+
+/***************************************************************************************
+** Function name:           setVisible
+** Description:             Show or hide an item
+***************************************************************************************/
+void TFT_eCompositor::setVisible(uint16_t item, bool visible)
+{
+  if (item < _items) _item[item].visible = visible;
+}
+
+/***************************************************************************************
+** Function name:           sort
+** Description:             Sort the drawing order by z, then item number
+***************************************************************************************/
+// Insertion sort, the order changes little between frames so this is close to linear
+void TFT_eCompositor::sort(void)
+{
+  for (uint16_t i = 1; i < _items; i++) {
+    uint16_t n = _order[i];
+    int32_t  j = i - 1;
+    while (j >= 0 && (_item[_order[j]].z > _item[n].z || (_item[_order[j]].z == _item[n].z && _order[j] > n))) {
+      _order[j + 1] = _order[j];
+      j--;
+    }
+    _order[j + 1] = n;
+  }
+  _sorted = true;
+}
+
+/***************************************************************************************
+** Function name:           render
+** Description:             Draw the whole screen or Sprite
+***************************************************************************************/
+void TFT_eCompositor::render(void)
+{
+  render(0, 0, _tft->width(), _tft->height());
+}
+
+/***************************************************************************************
+** Function name:           render
+** Description:             Draw an area of the screen or Sprite
+***************************************************************************************/
+void TFT_eCompositor::render(int32_t x, int32_t y, int32_t w, int32_t h)
+{
+  _bandCount = _runCount = _pixelCount = 0;
+
+  // Visible area, relative to the viewport datum as item positions are
+  int32_t vx = x, vy = y, vw = w, vh = h;
+  if (!_tft->clipAddrWindow(&vx, &vy, &vw, &vh)) return;
+  vx -= _tft->getViewportX();
+  vy -= _tft->getViewportY();
+
+  if (!_sorted) sort();
+
+  uint16_t lines = vh < _lines ? vh : _lines;
+  uint32_t bandLen = vw * lines;
+  bool     dma = false;
+
+  // Line buffers are kept for the next render(). They are always allocated in DMA capable
+  // memory as a buffer allocated without DMA may be reused when DMA is enabled.
+#ifdef DMA_LINE_BUFFERS
+  if (!_spr && _tft->DMA_Enabled) {
+    if (_bufLen < 2 * bandLen) {
+      if (_buf) DMA_LINE_FREE(_buf);
+      _buf = (uint16_t*)DMA_LINE_MALLOC(2 * bandLen * sizeof(uint16_t));
+      _bufLen = _buf ? 2 * bandLen : 0;
+    }
+    dma = _buf != nullptr;
+  }
+#endif
+  if (_bufLen < bandLen) {
+    if (_buf) DMA_LINE_FREE(_buf);
+    _buf = (uint16_t*)DMA_LINE_MALLOC(bandLen * sizeof(uint16_t));
+    _bufLen = _buf ? bandLen : 0;
+  }
+  if (!_buf) return;
+  uint16_t* buf = _buf;
+
+  // Line buffers are in TFT byte order
+  bool swap = _tft->getSwapBytes();
+  _tft->setSwapBytes(false);
+  if (!_spr) _tft->startWrite();
+
+  for (int32_t ys = vy; ys < vy + vh; ys += lines) {
+    int32_t bh = vy + vh - ys < lines ? vy + vh - ys : lines;
+    drawBand(buf, vx, ys, vw, bh);
+    push(vx, ys, vw, bh, buf, dma);
+    if (dma) buf = (buf == _buf) ? _buf + bandLen : _buf;
+  }
+
+#ifdef DMA_LINE_BUFFERS
+  if (dma) _tft->dmaWait();
+#endif
+
+  if (!_spr) _tft->endWrite();
+  _tft->setSwapBytes(swap);
+}
+
+/***************************************************************************************
+** Function name:           drawBand
+** Description:             Fill a band with the background then copy in the item runs
+***************************************************************************************/
+void TFT_eCompositor::drawBand(uint16_t *buf, int32_t x, int32_t y, int32_t w, int32_t h)
+{
+  uint16_t bg = _bg >> 8 | _bg << 8;
+  uint32_t len = w * h;
+  if ((bg >> 8) == (bg & 0xFF)) memset(buf, bg & 0xFF, len * sizeof(uint16_t));
+  else for (uint32_t i = 0; i < len; i++) buf[i] = bg;
+
+  for (uint16_t i = 0; i < _items; i++) {
+    const Item& it = _item[_order[i]];
+    TFT_eSpriteAtlas* a = it.atlas;
+    if (!it.visible || it.frame >= a->_frames) continue;
+
+    const TFT_eSpriteAtlas::Frame& f = a->_frame[it.frame];
+    if (it.x >= x + w || it.x + f.w <= x || it.y >= y + h || it.y + f.h <= y) continue;
+
+    int32_t r0 = (y > it.y ? y : it.y) - it.y;
+    int32_t r1 = (y + h < it.y + f.h ? y + h : it.y + f.h) - it.y;
+    const uint16_t* table = a->_runs + f.rows;
+    const uint16_t* pairs = table + f.h + 1;
+
+    for (int32_t r = r0; r < r1; r++) {
+      uint16_t* line = buf + (it.y + r - y) * w;
+      const uint16_t* src = a->_img + (f.y + r) * a->_w + f.x;
+
+      for (uint32_t p = table[r]; p < table[r + 1]; p++) {
+        int32_t xs = it.x + pairs[2 * p];
+        int32_t xe = xs + pairs[2 * p + 1];
+        if (xs >= x + w) break; // Runs are in x order
+        if (xs < x) xs = x;
+        if (xe > x + w) xe = x + w;
+        if (xs >= xe) continue;
+        memcpy(line + xs - x, src + xs - it.x, (xe - xs) * sizeof(uint16_t));
+        _runCount++;
+        _pixelCount += xe - xs;
+      }
+    }
+  }
+}
+
+/***************************************************************************************
+** Function name:           push
+** Description:             Push a band from a line buffer in TFT byte order
+***************************************************************************************/
+void TFT_eCompositor::push(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *buf, bool dma)
+{
+  _bandCount++;
+  if (_spr) _spr->pushImage(x, y, w, h, buf);
+#ifdef DMA_LINE_BUFFERS
+  // DMA coordinates do not include the viewport datum. Waits for the previous band to be sent.
+  else if (dma) _tft->pushImageDMA(x + _tft->getViewportX(), y + _tft->getViewportY(), w, h, buf);
+#endif
+  else _tft->pushImage(x, y, w, h, buf);
+}
@@ -0,0 +1,147 @@
+/***************************************************************************************
+// The following classes draw scenes of many small transparent images (game sprites,
+// animation frames, eyes, planets etc.) without a TFT_eSprite for each image.
+//
+// TFT_eSpriteAtlas holds many frames in one 16 bit pixel allocation. When a frame is
+// added the pixels are scanned once and each row is stored as a list of opaque runs
+// (start, length), so the transparent colour is never compared again when drawing.
+//
+// TFT_eCompositor draws a z ordered list of atlas frames. The screen (or an area) is
+// built in line buffers: each band is filled with the background colour, the opaque
+// runs of the frames that cross it are copied in with memcpy() and the band is pushed
+// with one window. Every pixel is sent once, so there is no flicker and no need for a
+// full screen Sprite. If tft.initDMA() has been called two line buffers are used and
+// the next band is built while DMA sends the last one.
+//
+// Typical use:
+//   TFT_eSpriteAtlas atlas;
+//   atlas.createAtlas(128, 128, 16, TFT_BLACK);   // Pixel store size, frames, transparent colour
+//   int16_t ball = atlas.addFrame(ballImage, 24, 24, true); // swap as for setSwapBytes(true)
+//
+//   TFT_eCompositor comp = TFT_eCompositor(&tft); // or TFT_eCompositor(&sprite)
+//   comp.begin(50);                               // Maximum number of items
+//   int16_t item = comp.add(&atlas, ball, x, y, z); // Higher z is drawn on top
+//   ...
+//   comp.setItem(item, ball, x, y);               // Move or change the frame
+//   comp.render();                                // Draw the screen
+//
+// RAM: the atlas needs w * h * 2 bytes for pixels plus about 2 bytes per frame line and
+// 4 bytes per opaque run. The compositor allocates one (two with DMA) line buffers of
+// width * COMPOSITOR_LINES * 2 bytes at the first render(), freed by end().
+***************************************************************************************/
+
+#define ATLAS_NO_FRAME   -1 // addFrame() return value if the frame does not fit
+#define COMPOSITOR_LINES 16 // Default lines in a compositor line buffer
+
+class TFT_eSpriteAtlas {
+
+ friend class TFT_eCompositor;
+
+ public:
+
+  TFT_eSpriteAtlas(void);
+  ~TFT_eSpriteAtlas(void);
+
+           // Allocate a w x h pixel store for up to maxFrames frames, pixels of colour
+           // transp in added images are transparent. Returns false if out of RAM.
+  bool     createAtlas(uint16_t w, uint16_t h, uint16_t maxFrames, uint16_t transp = TFT_BLACK);
+  void     deleteAtlas(void);
+  bool     created(void) { return _img != nullptr; }
+
+           // Copy a w x h image into the atlas, returns the frame number or ATLAS_NO_FRAME.
+           // swap is true for image arrays that are drawn with setSwapBytes(true).
+  int16_t  addFrame(const uint16_t *data, uint16_t w, uint16_t h, bool swap = false);
+           // Copy a 16 bit Sprite (or part of it) into the atlas
+  int16_t  addFrame(TFT_eSprite *spr);
+  int16_t  addFrame(TFT_eSprite *spr, int32_t sx, int32_t sy, int32_t sw, int32_t sh);
+
+  uint16_t frames(void)               { return _frames; }
+  uint16_t frameWidth(uint16_t f)     { return f < _frames ? _frame[f].w : 0; }
+  uint16_t frameHeight(uint16_t f)    { return f < _frames ? _frame[f].h : 0; }
+  uint32_t opaqueRuns(uint16_t f);    // Opaque runs in a frame
+  uint32_t memoryUsed(void);          // Bytes allocated for pixels, frames and runs
+
+ private:
+
+  struct Frame {
+    uint16_t x, y;                    // Position in the pixel store
+    uint16_t w, h;
+    uint32_t rows;                    // Index in _runs of the row table, h + 1 run counts
+  };                                  // followed by the (x, length) pairs of each row
+
+  Frame   *place(uint16_t w, uint16_t h);
+  bool     addRuns(Frame *f);
+
+  uint16_t *_img;                     // Pixels in TFT byte order
+  uint16_t _w, _h;
+  uint16_t _transp;                   // Transparent colour in TFT byte order
+
+  Frame   *_frame;
+  uint16_t _frames, _maxFrames;
+  uint16_t _shelfX, _shelfY, _shelfH; // Packing position, frames are placed in rows (shelves)
+
+  uint16_t *_runs;
+  uint32_t _runLen, _runSize;         // Entries used and allocated
+};
+
+class TFT_eCompositor {
+
+ public:
+
+  explicit TFT_eCompositor(TFT_eSPI *tft);
+  explicit TFT_eCompositor(TFT_eSprite *spr);
+  ~TFT_eCompositor(void);
+
+           // Allocate the item list, lines is the height of the line buffers
+  bool     begin(uint16_t maxItems, uint16_t lines = COMPOSITOR_LINES);
+  void     end(void);
+
+           // Add a frame of an atlas at x,y, items with a higher z are drawn on top of items
+           // with a lower z, then later items on top. Returns the item number or -1.
+  int16_t  add(TFT_eSpriteAtlas *atlas, uint16_t frame, int32_t x, int32_t y, int16_t z = 0);
+  void     setItem(uint16_t item, uint16_t frame, int32_t x, int32_t y);
+  void     setZ(uint16_t item, int16_t z);
+  void     setVisible(uint16_t item, bool visible);
+  void     clear(void) { _items = 0; }   // Remove all items
+  uint16_t items(void) { return _items; }
+
+  void     setBackground(uint16_t color) { _bg = color; }
+
+           // Draw the items over the background, coordinates are as for TFT_eSPI
+  void     render(void);
+  void     render(int32_t x, int32_t y, int32_t w, int32_t h);
+
+           // Counts for the last render()
+  uint32_t bands(void)  { return _bandCount; } // Bands (windows) pushed
+  uint32_t runs(void)   { return _runCount; }  // Opaque runs copied
+  uint32_t pixels(void) { return _pixelCount; } // Item pixels copied
+
+ private:
+
+  struct Item {
+    TFT_eSpriteAtlas *atlas;
+    int32_t  x, y;
+    uint16_t frame;
+    int16_t  z;
+    bool     visible;
+  };
+
+  void     sort(void);
+  void     drawBand(uint16_t *buf, int32_t x, int32_t y, int32_t w, int32_t h);
+  void     push(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *buf, bool dma);
+
+  TFT_eSPI    *_tft;          // Drawing target
+  TFT_eSprite *_spr;          // Sprite target, nullptr if drawing to the TFT
+
+  Item     *_item;
+  uint16_t *_order;           // Item numbers in drawing order
+  uint16_t _items, _maxItems;
+  bool     _sorted;
+
+  uint16_t *_buf;             // Line buffers
+  uint32_t _bufLen;           // Pixels allocated
+  uint16_t _lines;
+  uint16_t _bg;
+
+  uint32_t _bandCount, _runCount, _pixelCount;
+};
@@ -347,3 +347,106 @@ void TFT_eSPI::setTouch(uint16_t *parameters){
   touchCalibration_invert_x = parameters[4] & 0x02;
   touchCalibration_invert_y = parameters[4] & 0x04;
 }
+
+
+/***************************************************************************************
+** Function name:           setTouchFilter
+** Description:             Set the filter that touchPoll() adds samples to
+***************************************************************************************/
+// The XPT2046 shares the display SPI bus so it cannot be read in an interrupt or another
+// task while the display is being drawn. The PENIRQ interrupt only records the press,
+// touchPoll() then reads the controller from the sketch between drawing calls.
+#ifndef IRAM_ATTR
+  #define IRAM_ATTR
+#endif
+
+static volatile bool touchIrqFlag = false;
+
+static void IRAM_ATTR touchIrq(void){
+  touchIrqFlag = true;
+}
+
+void TFT_eSPI::setTouchFilter(TFT_eTouchFilter *filter, uint8_t interval, int8_t irqPin){
+  if (_touchIrq >= 0) detachInterrupt(digitalPinToInterrupt(_touchIrq));
+
+  _touchFilter = filter;
+  _touchInterval = interval;
+  _touchTime = millis() - interval;
+  _touchIrq = irqPin;
+
+  if (irqPin >= 0) {
+    pinMode(irqPin, INPUT_PULLUP);
+    touchIrqFlag = false;
+    attachInterrupt(digitalPinToInterrupt(irqPin), touchIrq, FALLING);
+  }
+}
+
+/***************************************************************************************
+** Function name:           touchPoll
+** Description:             Add one touch sample to the filter if the interval has passed
+***************************************************************************************/
+// Unlike getTouch() there are no delays, the filter debounces the pressure and removes
+// spikes from the positions over several samples.
+bool TFT_eSPI::touchPoll(void){
+  if (!_touchFilter) return false;
+
+  uint32_t now = millis();
+  bool irq = false;
+  if (_touchIrq >= 0) {
+    irq = touchIrqFlag;
+    // Not touched and not pressed in the filter, so no need to read the bus
+    if (!irq && !_touchFilter->pressed() && digitalRead(_touchIrq)) return false;
+  }
+  if (!irq && now - _touchTime < _touchInterval) return false;
+  _touchTime = now;
+
+  uint16_t x = 0, y = 0;
+  uint16_t z = getTouchRawZ();
+  if (z) getTouchRaw(&x, &y);
+  touchIrqFlag = false; // PENIRQ can also change during the conversions
+
+  _touchFilter->addSample(now, x, y, z);
+  return true;
+}
+
+/***************************************************************************************
+** Function name:           calibrateTouch
+** Description:             Calculate a touch filter calibration matrix from 5 targets
+***************************************************************************************/
+// Targets are 1/8 of the screen in from the corners plus one in the centre, so the fit
+// does not depend on the less sensitive edges. The filter queue is cleared.
+bool TFT_eSPI::calibrateTouch(TFT_eTouchFilter *filter, uint32_t color_fg, uint32_t color_bg, uint8_t size){
+  int16_t  sx[5], sy[5];
+  uint16_t rx[5], ry[5];
+  uint16_t x_tmp, y_tmp;
+
+  for (uint8_t i = 0; i < 5; i++) {
+    sx[i] = i == 4 ? _width / 2 : (i & 1 ? _width - _width / 8 : _width / 8);
+    sy[i] = i == 4 ? _height / 2 : (i & 2 ? _height - _height / 8 : _height / 8);
+
+    drawFastHLine(sx[i] - size, sy[i], 2 * size + 1, color_fg);
+    drawFastVLine(sx[i], sy[i] - size, 2 * size + 1, color_fg);
+
+    // Average 8 valid samples, then wait for the release
+    uint32_t ax = 0, ay = 0;
+    for (uint8_t j = 0; j < 8; j++) {
+      while (!validTouch(&x_tmp, &y_tmp, Z_THRESHOLD / 2));
+      ax += x_tmp;
+      ay += y_tmp;
+    }
+    rx[i] = ax / 8;
+    ry[i] = ay / 8;
+
+    drawFastHLine(sx[i] - size, sy[i], 2 * size + 1, color_bg);
+    drawFastVLine(sx[i], sy[i] - size, 2 * size + 1, color_bg);
+
+    uint8_t released = 0;
+    while (released < 10) {
+      released = getTouchRawZ() < Z_THRESHOLD / 2 ? released + 1 : 0;
+      delay(10);
+    }
+  }
+
+  filter->clear();
+  return filter->calibrate(sx, sy, rx, ry, 5);
+}
@@ -19,6 +19,16 @@
            // Set the screen calibration values
   void     setTouch(uint16_t *data);
 
+           // Asynchronous sampling through a filter, see Touch_filter.h. touchPoll() takes one
+           // sample without delays if interval ms have passed, call it often from loop().
+           // Returns true if a sample was added to the filter. If the controller PENIRQ pin
+           // is connected to irqPin a press is sampled at the next touchPoll() and the bus
+           // is not read while the screen is not touched.
+  void     setTouchFilter(TFT_eTouchFilter *filter, uint8_t interval = 5, int8_t irqPin = -1);
+  bool     touchPoll(void);
+           // Show 5 targets and calculate the filter calibration matrix, false if it fails
+  bool     calibrateTouch(TFT_eTouchFilter *filter, uint32_t color_fg, uint32_t color_bg, uint8_t size);
+
  private:
            // Legacy support only - deprecated TODO: delete
   void     spi_begin_touch();
@@ -36,4 +46,8 @@
   uint8_t  touchCalibration_rotate = 1, touchCalibration_invert_x = 2, touchCalibration_invert_y = 0;
 
   uint32_t _pressTime;        // Press and hold time-out
+  TFT_eTouchFilter *_touchFilter = nullptr; // touchPoll() filter
+  uint8_t  _touchInterval = 5;              // touchPoll() sample interval in ms
+  uint32_t _touchTime = 0;                  // Time of the last touchPoll() sample
+  int8_t   _touchIrq = -1;                  // PENIRQ pin or -1
   uint16_t _pressX, _pressY;  // For future use (last sampled calibrated coordinates)
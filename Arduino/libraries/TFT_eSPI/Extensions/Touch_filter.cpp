@@ -0,0 +1,287 @@
+/**************************************************************************************
+// The following class filters and calibrates raw touch samples and queues timestamped
+// touch events, see Touch_filter.h
+***************************************************************************************/
+
+/***************************************************************************************
+** Function name:           TFT_eTouchFilter
+** Description:             Class constructor
+***************************************************************************************/
+TFT_eTouchFilter::TFT_eTouchFilter(void)
+{
+  _press    = 350;
+  _release  = 200;
+  _debounce = 2;
+  _moveMin  = 1;
+  _weight   = 128;
+
+  // Raw values are screen coordinates until calibrated
+  _m[0] = 1; _m[1] = 0; _m[2] = 0;
+  _m[3] = 0; _m[4] = 1; _m[5] = 0;
+
+  _samples = _dropped = 0;
+  clear();
+}
+
+/***************************************************************************************
+** Function name:           setThreshold
+** Description:             Set the press and release pressure thresholds
+***************************************************************************************/
+void TFT_eTouchFilter::setThreshold(uint16_t press, uint16_t release)
+{
+  _press = press;
+  _release = release < press ? release : press;
+}
+
+/***************************************************************************************
+** Function name:           setDebounce
+** Description:             Set the samples needed to start or end a touch
+***************************************************************************************/
+void TFT_eTouchFilter::setDebounce(uint8_t samples)
+{
+  _debounce = samples < 1 ? 1 : samples > 8 ? 8 : samples;
+}
+
+/***************************************************************************************
+** Function name:           setSmoothing
+** Description:             Set the IIR filter weight of a new position
+***************************************************************************************/
+void TFT_eTouchFilter::setSmoothing(uint16_t weight)
+{
+  _weight = weight < 1 ? 1 : weight > 256 ? 256 : weight;
+}
+
+/***************************************************************************************
+** Function name:           calibrate
+** Description:             Calculate the calibration matrix from 3 or more points
+***************************************************************************************/
+// Least squares fit of x = a*rx + b*ry + c (and the same for y), the 3x3 normal
+// equations are solved with Cramer's rule. Raw values are taken relative to their
+// mean so the sums stay well conditioned.
+bool TFT_eTouchFilter::calibrate(const int16_t *screenX, const int16_t *screenY,
+                                 const uint16_t *rawX, const uint16_t *rawY, uint8_t n)
+{
+  if (n < 3) return false;
+
+  double mx = 0, my = 0;
+  for (uint8_t i = 0; i < n; i++) {
+    mx += rawX[i];
+    my += rawY[i];
+  }
+  mx /= n;
+  my /= n;
+
+  double sxx = 0, sxy = 0, syy = 0;
+  double bx[3] = { 0, 0, 0 }, by[3] = { 0, 0, 0 };
+  for (uint8_t i = 0; i < n; i++) {
+    double rx = rawX[i] - mx, ry = rawY[i] - my;
+    sxx += rx * rx;
+    sxy += rx * ry;
+    syy += ry * ry;
+    bx[0] += rx * screenX[i]; bx[1] += ry * screenX[i]; bx[2] += screenX[i];
+    by[0] += rx * screenY[i]; by[1] += ry * screenY[i]; by[2] += screenY[i];
+  }
+
+  // With centred raw values the sums of rx and ry are 0, so the matrix is
+  // | sxx sxy 0 |
+  // | sxy syy 0 |
+  // |  0   0  n |
+  double det = sxx * syy - sxy * sxy;
+  if (det < 1e-6 * (sxx * syy + 1)) return false; // Points are in a line
+
+  double a = (bx[0] * syy - bx[1] * sxy) / det;
+  double b = (bx[1] * sxx - bx[0] * sxy) / det;
+  double d = (by[0] * syy - by[1] * sxy) / det;
+  double e = (by[1] * sxx - by[0] * sxy) / det;
+
+  _m[0] = a;
+  _m[1] = b;
+  _m[2] = bx[2] / n - a * mx - b * my;
+  _m[3] = d;
+  _m[4] = e;
+  _m[5] = by[2] / n - d * mx - e * my;
+  return true;
+}
+
+/***************************************************************************************
+** Function name:           setCalibration
+** Description:             Set the calibration matrix
+***************************************************************************************/
+void TFT_eTouchFilter::setCalibration(const float *m)
+{
+  for (uint8_t i = 0; i < 6; i++) _m[i] = m[i];
+}
+
+/***************************************************************************************
+** Function name:           getCalibration
+** Description:             Get the calibration matrix
+***************************************************************************************/
+void TFT_eTouchFilter::getCalibration(float *m)
+{
+  for (uint8_t i = 0; i < 6; i++) m[i] = _m[i];
+}
+
+/***************************************************************************************
+** Function name:           convert
+** Description:             Convert raw values to screen coordinates
+***************************************************************************************/
+void TFT_eTouchFilter::convert(uint16_t rawX, uint16_t rawY, int16_t *x, int16_t *y)
+{
+  *x = floorf(_m[0] * rawX + _m[1] * rawY + _m[2] + 0.5f);
+  *y = floorf(_m[3] * rawX + _m[4] * rawY + _m[5] + 0.5f);
+}
+
+/***************************************************************************************
+** Function name:           addSample
+** Description:             Add a raw sample and queue any event it causes
+***************************************************************************************/
+void TFT_eTouchFilter::addSample(uint32_t time, uint16_t rawX, uint16_t rawY, uint16_t z)
+{
+  _samples++;
+
+  if (!_pressed) {
+    if (z < _press) {
+      _pending = 0;
+      _hist = 0;
+      return;
+    }
+  }
+  else if (z < _release) {
+    // Positions are not used as they drift while the pressure falls
+    if (++_pending >= _debounce) {
+      _pressed = false;
+      _pending = 0;
+      _hist = 0;
+      queue(time, TOUCH_RELEASE);
+    }
+    return;
+  }
+
+  // Add to the median filter history
+  if (_hist == TOUCH_MEDIAN) {
+    memmove(_histX, _histX + 1, (TOUCH_MEDIAN - 1) * sizeof(uint16_t));
+    memmove(_histY, _histY + 1, (TOUCH_MEDIAN - 1) * sizeof(uint16_t));
+    _hist--;
+  }
+  _histX[_hist] = rawX;
+  _histY[_hist] = rawY;
+  _hist++;
+  _z = z;
+
+  int32_t mx, my;
+  median(&mx, &my);
+
+  bool start = !_pressed;
+  if (start) {
+    if (++_pending < _debounce) return;
+    _pressed = true;
+    _pending = 0;
+    _fx = mx << 8;
+    _fy = my << 8;
+  }
+  else {
+    _pending = 0;
+    _fx += (((mx << 8) - _fx) * _weight) >> 8;
+    _fy += (((my << 8) - _fy) * _weight) >> 8;
+  }
+
+  float rx = _fx / 256.0f, ry = _fy / 256.0f;
+  _x = floorf(_m[0] * rx + _m[1] * ry + _m[2] + 0.5f);
+  _y = floorf(_m[3] * rx + _m[4] * ry + _m[5] + 0.5f);
+
+  if (start) {
+    _lastX = _x;
+    _lastY = _y;
+    queue(time, TOUCH_PRESS);
+  }
+  else if (abs(_x - _lastX) >= _moveMin || abs(_y - _lastY) >= _moveMin) {
+    _lastX = _x;
+    _lastY = _y;
+    queue(time, TOUCH_MOVE);
+  }
+}
+
+/***************************************************************************************
+** Function name:           median
+** Description:             Median of the position history
+***************************************************************************************/
+void TFT_eTouchFilter::median(int32_t *x, int32_t *y)
+{
+  uint16_t sx[TOUCH_MEDIAN], sy[TOUCH_MEDIAN];
+
+  // Insertion sort, at most 7 values
+  for (uint8_t i = 0; i < _hist; i++) {
+    int8_t j = i - 1;
+    while (j >= 0 && sx[j] > _histX[i]) { sx[j + 1] = sx[j]; j--; }
+    sx[j + 1] = _histX[i];
+    j = i - 1;
+    while (j >= 0 && sy[j] > _histY[i]) { sy[j + 1] = sy[j]; j--; }
+    sy[j + 1] = _histY[i];
+  }
+
+  *x = sx[_hist / 2];
+  *y = sy[_hist / 2];
+}
+
+/***************************************************************************************
+** Function name:           queue
+** Description:             Add an event at the current position to the queue
+***************************************************************************************/
+void TFT_eTouchFilter::queue(uint32_t time, uint8_t type)
+{
+  // Only the reader moves _head, so a full queue loses the new event
+  uint8_t tail = _tail;
+  if ((uint8_t)(tail - __atomic_load_n(&_head, __ATOMIC_ACQUIRE)) >= TOUCH_QUEUE) {
+    _dropped++;
+    return;
+  }
+
+  touch_event_t* e = &_event[tail % TOUCH_QUEUE];
+  e->time = time;
+  e->x = _x;
+  e->y = _y;
+  e->z = _z;
+  e->type = type;
+  __atomic_store_n(&_tail, (uint8_t)(tail + 1), __ATOMIC_RELEASE); // Publish after the event is written
+}
+
+/***************************************************************************************
+** Function name:           getEvent
+** Description:             Get the oldest event from the queue, false if none
+***************************************************************************************/
+bool TFT_eTouchFilter::getEvent(touch_event_t *event)
+{
+  uint8_t head = _head;
+  if (head == __atomic_load_n(&_tail, __ATOMIC_ACQUIRE)) return false;
+
+  *event = _event[head % TOUCH_QUEUE];
+  __atomic_store_n(&_head, (uint8_t)(head + 1), __ATOMIC_RELEASE);
+  return true;
+}
+
+/***************************************************************************************
+** Function name:           clear
+** Description:             Empty the queue and reset the touch state
+***************************************************************************************/
+void TFT_eTouchFilter::clear(void)
+{
+  _pressed = false;
+  _pending = 0;
+  _hist = 0;
+  _fx = _fy = 0;
+  _x = _y = _lastX = _lastY = 0;
+  _z = 0;
+  _head = _tail = 0;
+}
+
+/***************************************************************************************
+** Function name:           getPoint
+** Description:             Get the last filtered position, false if not touched
+***************************************************************************************/
+bool TFT_eTouchFilter::getPoint(int16_t *x, int16_t *y)
+{
+  if (!_pressed) return false;
+  *x = _x;
+  *y = _y;
+  return true;
+}
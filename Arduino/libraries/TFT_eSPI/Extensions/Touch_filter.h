@@ -0,0 +1,115 @@
+/***************************************************************************************
+// The following class turns raw touch controller samples into filtered, calibrated and
+// timestamped touch events. Sampling is separate from drawing: each sample is added
+// with addSample() (tft.touchPoll() does this for the XPT2046 if TOUCH_CS is defined,
+// a capacitive controller driver can call it directly) and the sketch reads events
+// from a queue when it is ready, so no call waits for the panel to settle.
+//
+// The queue is a single producer, single consumer ring: addSample() may be called from
+// one timer callback, task or interrupt while the sketch calls getEvent() and
+// available(). Do not call the other functions while samples are added elsewhere.
+//
+// Each sample passes through:
+//   press detection : pressure above the press threshold for a number of samples
+//                     (debounce), released when below the release threshold
+//   median filter   : the median of the last TOUCH_MEDIAN positions removes spikes
+//   IIR filter      : a first order low pass filter removes jitter
+//   calibration     : an affine matrix (scale, rotation, skew and offset) maps raw
+//                     values to screen coordinates, calculated from 3 or more points
+//
+// Typical use:
+//   TFT_eTouchFilter touch;
+//   tft.setTouchFilter(&touch);            // XPT2046 with TOUCH_CS defined
+//   tft.calibrateTouch(&touch, TFT_WHITE, TFT_BLACK, 15); // or touch.setCalibration(m)
+//   ...
+//   tft.touchPoll();                       // In loop(), as often as possible
+//   touch_event_t e;
+//   while (touch.getEvent(&e)) {
+//     if (e.type == TOUCH_PRESS) ...       // e.x, e.y, e.time
+//   }
+//
+// Calibration and screen coordinates are for the rotation in use when calibrated.
+***************************************************************************************/
+
+#define TOUCH_QUEUE     16 // Events held in the queue, a power of 2 up to 128, new events are lost when full
+#ifndef TOUCH_MEDIAN
+  #define TOUCH_MEDIAN   3 // Median filter length, odd and up to 7 (each sample adds lag)
+#endif
+
+// Event types
+#define TOUCH_PRESS      1
+#define TOUCH_MOVE       2
+#define TOUCH_RELEASE    3
+
+typedef struct {
+  uint32_t time;          // Time of the sample that caused the event, milliseconds
+  int16_t  x, y;          // Screen coordinates
+  uint16_t z;             // Pressure
+  uint8_t  type;          // TOUCH_PRESS, TOUCH_MOVE or TOUCH_RELEASE
+} touch_event_t;
+
+class TFT_eTouchFilter {
+
+ public:
+
+  TFT_eTouchFilter(void);
+
+           // Pressure thresholds, a touch starts above press and ends below release
+  void     setThreshold(uint16_t press, uint16_t release);
+           // Samples needed to start or end a touch (1 to 8)
+  void     setDebounce(uint8_t samples);
+           // IIR filter weight of a new position, 1-256 (256 = no smoothing)
+  void     setSmoothing(uint16_t weight);
+           // Movement in pixels before a TOUCH_MOVE event is queued
+  void     setMoveThreshold(uint8_t pixels) { _moveMin = pixels; }
+
+           // Calculate the calibration from n >= 3 screen points and the raw values
+           // measured at them, least squares fit if n > 3. False if points are in a line.
+  bool     calibrate(const int16_t *screenX, const int16_t *screenY,
+                     const uint16_t *rawX, const uint16_t *rawY, uint8_t n);
+           // Set or get the calibration matrix: x = m[0]*rx + m[1]*ry + m[2], y = m[3]*rx + m[4]*ry + m[5]
+  void     setCalibration(const float *m);
+  void     getCalibration(float *m);
+           // Convert raw values to screen coordinates
+  void     convert(uint16_t rawX, uint16_t rawY, int16_t *x, int16_t *y);
+
+           // Add a sample, time in milliseconds. z is the pressure, for controllers without
+           // one use 0 when not touched and any value above the press threshold when touched.
+  void     addSample(uint32_t time, uint16_t rawX, uint16_t rawY, uint16_t z);
+
+           // Number of events in the queue, and get the oldest, false if none
+  uint8_t  available(void) { return (uint8_t)(__atomic_load_n(&_tail, __ATOMIC_ACQUIRE) - _head); }
+  bool     getEvent(touch_event_t *event);
+  void     clear(void);
+
+           // Current state, false if not touched. x, y are the last filtered position.
+  bool     getPoint(int16_t *x, int16_t *y);
+  bool     pressed(void) { return _pressed; }
+
+  uint32_t samples(void) { return _samples; } // Samples added
+  uint32_t dropped(void) { return _dropped; } // Events lost with a full queue
+
+ private:
+
+  void     queue(uint32_t time, uint8_t type);
+  void     median(int32_t *x, int32_t *y);
+
+  uint16_t _press, _release;
+  uint8_t  _debounce, _moveMin;
+  uint16_t _weight;
+
+  float    _m[6];                             // Calibration matrix
+
+  bool     _pressed;
+  uint8_t  _pending;                          // Samples towards a press or release
+  uint16_t _histX[TOUCH_MEDIAN], _histY[TOUCH_MEDIAN];
+  uint8_t  _hist;                             // Samples in the median history
+  int32_t  _fx, _fy;                          // Filtered raw position, 8 fractional bits
+  int16_t  _x, _y, _lastX, _lastY;            // Filtered and last reported screen position
+  uint16_t _z;
+
+  touch_event_t _event[TOUCH_QUEUE];
+  uint8_t  _head, _tail;                      // Free running, only getEvent() writes _head
+
+  uint32_t _samples, _dropped;
+};
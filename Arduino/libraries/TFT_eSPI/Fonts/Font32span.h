@@ -0,0 +1,591 @@
+// Font 4 as horizontal spans, used if SPAN_FONTS is defined
+//
+// Generated from Font32rle.c by Tools/Host/Span_font_compiler.cpp, do not edit
+
+// Foreground spans as x, y, length in row order
+PROGMEM const unsigned char spans_f32[6777] =
+{
+  0x03, 0x01, 0x02, 0x03, 0x02, 0x02, 0x03, 0x03, 0x02, 0x03, 0x04, 0x02,
+  0x03, 0x05, 0x02, 0x03, 0x06, 0x02, 0x03, 0x07, 0x02, 0x03, 0x08, 0x02,
+  0x03, 0x09, 0x02, 0x03, 0x0A, 0x02, 0x03, 0x0B, 0x02, 0x03, 0x0C, 0x02,
+  0x03, 0x0D, 0x02, 0x03, 0x10, 0x02, 0x03, 0x11, 0x02, 0x03, 0x12, 0x02,
+  0x02, 0x01, 0x01, 0x05, 0x01, 0x01, 0x02, 0x02, 0x01, 0x05, 0x02, 0x01,
+  0x02, 0x03, 0x01, 0x05, 0x03, 0x01, 0x02, 0x04, 0x01, 0x05, 0x04, 0x01,
+  0x02, 0x05, 0x01, 0x05, 0x05, 0x01, 0x02, 0x06, 0x01, 0x05, 0x06, 0x01,
+  0x02, 0x07, 0x01, 0x05, 0x07, 0x01, 0x09, 0x02, 0x02, 0x0D, 0x02, 0x02,
+  0x09, 0x03, 0x01, 0x0D, 0x03, 0x01, 0x09, 0x04, 0x01, 0x0D, 0x04, 0x01,
+  0x08, 0x05, 0x02, 0x0C, 0x05, 0x02, 0x08, 0x06, 0x01, 0x0C, 0x06, 0x01,
+  0x08, 0x07, 0x01, 0x0C, 0x07, 0x01, 0x03, 0x08, 0x0E, 0x07, 0x09, 0x01,
+  0x0B, 0x09, 0x01, 0x07, 0x0A, 0x01, 0x0B, 0x0A, 0x01, 0x07, 0x0B, 0x01,
+  0x0B, 0x0B, 0x01, 0x02, 0x0C, 0x0E, 0x06, 0x0D, 0x01, 0x0A, 0x0D, 0x01,
+  0x06, 0x0E, 0x01, 0x0A, 0x0E, 0x01, 0x05, 0x0F, 0x02, 0x09, 0x0F, 0x02,
+  0x05, 0x10, 0x01, 0x09, 0x10, 0x01, 0x05, 0x11, 0x01, 0x09, 0x11, 0x01,
+  0x04, 0x12, 0x02, 0x08, 0x12, 0x02, 0x07, 0x01, 0x01, 0x05, 0x02, 0x04,
+  0x03, 0x03, 0x08, 0x02, 0x04, 0x03, 0x07, 0x04, 0x01, 0x09, 0x04, 0x03,
+  0x02, 0x05, 0x02, 0x07, 0x05, 0x01, 0x0A, 0x05, 0x02, 0x02, 0x06, 0x02,
+  0x07, 0x06, 0x01, 0x0A, 0x06, 0x03, 0x02, 0x07, 0x03, 0x07, 0x07, 0x01,
+  0x03, 0x08, 0x05, 0x04, 0x09, 0x05, 0x07, 0x0A, 0x04, 0x07, 0x0B, 0x05,
+  0x07, 0x0C, 0x01, 0x0A, 0x0C, 0x03, 0x01, 0x0D, 0x03, 0x07, 0x0D, 0x01,
+  0x0B, 0x0D, 0x02, 0x02, 0x0E, 0x02, 0x07, 0x0E, 0x01, 0x0B, 0x0E, 0x02,
+  0x02, 0x0F, 0x04, 0x07, 0x0F, 0x01, 0x0A, 0x0F, 0x03, 0x03, 0x10, 0x09,
+  0x05, 0x11, 0x05, 0x07, 0x12, 0x01, 0x04, 0x02, 0x03, 0x0F, 0x02, 0x02,
+  0x02, 0x03, 0x07, 0x0F, 0x03, 0x01, 0x02, 0x04, 0x02, 0x07, 0x04, 0x02,
+  0x0E, 0x04, 0x02, 0x01, 0x05, 0x02, 0x08, 0x05, 0x02, 0x0D, 0x05, 0x02,
+  0x01, 0x06, 0x02, 0x08, 0x06, 0x02, 0x0D, 0x06, 0x01, 0x01, 0x07, 0x02,
+  0x08, 0x07, 0x02, 0x0C, 0x07, 0x02, 0x02, 0x08, 0x02, 0x07, 0x08, 0x02,
+  0x0C, 0x08, 0x01, 0x02, 0x09, 0x07, 0x0B, 0x09, 0x01, 0x04, 0x0A, 0x03,
+  0x0A, 0x0A, 0x02, 0x0F, 0x0A, 0x03, 0x0A, 0x0B, 0x01, 0x0D, 0x0B, 0x07,
+  0x09, 0x0C, 0x01, 0x0D, 0x0C, 0x02, 0x12, 0x0C, 0x02, 0x08, 0x0D, 0x02,
+  0x0C, 0x0D, 0x02, 0x13, 0x0D, 0x02, 0x08, 0x0E, 0x01, 0x0C, 0x0E, 0x02,
+  0x13, 0x0E, 0x02, 0x07, 0x0F, 0x02, 0x0C, 0x0F, 0x02, 0x13, 0x0F, 0x02,
+  0x06, 0x10, 0x02, 0x0D, 0x10, 0x02, 0x12, 0x10, 0x02, 0x06, 0x11, 0x01,
+  0x0D, 0x11, 0x07, 0x05, 0x12, 0x02, 0x0F, 0x12, 0x03, 0x05, 0x13, 0x01,
+  0x05, 0x01, 0x05, 0x04, 0x02, 0x07, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03,
+  0x03, 0x04, 0x02, 0x0A, 0x04, 0x02, 0x03, 0x05, 0x02, 0x0A, 0x05, 0x02,
+  0x03, 0x06, 0x02, 0x09, 0x06, 0x03, 0x04, 0x07, 0x02, 0x08, 0x07, 0x03,
+  0x05, 0x08, 0x05, 0x04, 0x09, 0x04, 0x03, 0x0A, 0x06, 0x0D, 0x0A, 0x02,
+  0x02, 0x0B, 0x03, 0x07, 0x0B, 0x03, 0x0D, 0x0B, 0x02, 0x01, 0x0C, 0x03,
+  0x08, 0x0C, 0x03, 0x0D, 0x0C, 0x02, 0x01, 0x0D, 0x02, 0x09, 0x0D, 0x05,
+  0x01, 0x0E, 0x02, 0x0A, 0x0E, 0x04, 0x01, 0x0F, 0x02, 0x0B, 0x0F, 0x02,
+  0x01, 0x10, 0x03, 0x09, 0x10, 0x06, 0x02, 0x11, 0x09, 0x0D, 0x11, 0x03,
+  0x03, 0x12, 0x06, 0x0E, 0x12, 0x03, 0x01, 0x01, 0x03, 0x01, 0x02, 0x03,
+  0x01, 0x03, 0x03, 0x03, 0x04, 0x01, 0x02, 0x05, 0x02, 0x01, 0x06, 0x02,
+  0x06, 0x01, 0x02, 0x06, 0x02, 0x01, 0x05, 0x03, 0x02, 0x05, 0x04, 0x01,
+  0x04, 0x05, 0x02, 0x04, 0x06, 0x02, 0x04, 0x07, 0x02, 0x03, 0x08, 0x02,
+  0x03, 0x09, 0x02, 0x03, 0x0A, 0x02, 0x03, 0x0B, 0x02, 0x03, 0x0C, 0x02,
+  0x03, 0x0D, 0x02, 0x03, 0x0E, 0x02, 0x03, 0x0F, 0x02, 0x03, 0x10, 0x02,
+  0x03, 0x11, 0x02, 0x04, 0x12, 0x02, 0x04, 0x13, 0x02, 0x04, 0x14, 0x02,
+  0x05, 0x15, 0x01, 0x05, 0x16, 0x02, 0x06, 0x17, 0x01, 0x06, 0x18, 0x02,
+  0x00, 0x01, 0x02, 0x01, 0x02, 0x01, 0x01, 0x03, 0x02, 0x02, 0x04, 0x01,
+  0x02, 0x05, 0x02, 0x02, 0x06, 0x02, 0x02, 0x07, 0x02, 0x03, 0x08, 0x02,
+  0x03, 0x09, 0x02, 0x03, 0x0A, 0x02, 0x03, 0x0B, 0x02, 0x03, 0x0C, 0x02,
+  0x03, 0x0D, 0x02, 0x03, 0x0E, 0x02, 0x03, 0x0F, 0x02, 0x03, 0x10, 0x02,
+  0x03, 0x11, 0x02, 0x02, 0x12, 0x02, 0x02, 0x13, 0x02, 0x02, 0x14, 0x02,
+  0x02, 0x15, 0x01, 0x01, 0x16, 0x02, 0x01, 0x17, 0x01, 0x00, 0x18, 0x02,
+  0x05, 0x01, 0x02, 0x05, 0x02, 0x02, 0x05, 0x03, 0x02, 0x02, 0x04, 0x01,
+  0x05, 0x04, 0x02, 0x09, 0x04, 0x01, 0x01, 0x05, 0x0A, 0x03, 0x06, 0x06,
+  0x04, 0x07, 0x04, 0x03, 0x08, 0x02, 0x07, 0x08, 0x02, 0x02, 0x09, 0x03,
+  0x07, 0x09, 0x03, 0x03, 0x0A, 0x01, 0x08, 0x0A, 0x01, 0x04, 0x08, 0x02,
+  0x04, 0x09, 0x02, 0x04, 0x0A, 0x02, 0x01, 0x0B, 0x08, 0x01, 0x0C, 0x08,
+  0x04, 0x0D, 0x02, 0x04, 0x0E, 0x02, 0x04, 0x0F, 0x02, 0x02, 0x10, 0x03,
+  0x02, 0x11, 0x03, 0x02, 0x12, 0x03, 0x04, 0x13, 0x01, 0x03, 0x14, 0x02,
+  0x03, 0x15, 0x01, 0x02, 0x16, 0x02, 0x01, 0x0B, 0x06, 0x01, 0x0C, 0x06,
+  0x02, 0x10, 0x03, 0x02, 0x11, 0x03, 0x02, 0x12, 0x03, 0x06, 0x01, 0x02,
+  0x06, 0x02, 0x02, 0x06, 0x03, 0x01, 0x05, 0x04, 0x02, 0x05, 0x05, 0x02,
+  0x05, 0x06, 0x01, 0x04, 0x07, 0x02, 0x04, 0x08, 0x02, 0x04, 0x09, 0x01,
+  0x03, 0x0A, 0x02, 0x03, 0x0B, 0x02, 0x03, 0x0C, 0x01, 0x02, 0x0D, 0x02,
+  0x02, 0x0E, 0x02, 0x02, 0x0F, 0x01, 0x01, 0x10, 0x02, 0x01, 0x11, 0x02,
+  0x01, 0x12, 0x01, 0x00, 0x13, 0x02, 0x00, 0x14, 0x02, 0x05, 0x02, 0x04,
+  0x03, 0x03, 0x08, 0x02, 0x04, 0x04, 0x08, 0x04, 0x04, 0x02, 0x05, 0x02,
+  0x0A, 0x05, 0x02, 0x01, 0x06, 0x03, 0x0A, 0x06, 0x03, 0x01, 0x07, 0x02,
+  0x0B, 0x07, 0x02, 0x01, 0x08, 0x02, 0x0B, 0x08, 0x02, 0x01, 0x09, 0x02,
+  0x0B, 0x09, 0x02, 0x01, 0x0A, 0x02, 0x0B, 0x0A, 0x02, 0x01, 0x0B, 0x02,
+  0x0B, 0x0B, 0x02, 0x01, 0x0C, 0x02, 0x0B, 0x0C, 0x02, 0x01, 0x0D, 0x02,
+  0x0B, 0x0D, 0x02, 0x01, 0x0E, 0x03, 0x0A, 0x0E, 0x03, 0x02, 0x0F, 0x02,
+  0x0A, 0x0F, 0x02, 0x02, 0x10, 0x04, 0x08, 0x10, 0x04, 0x03, 0x11, 0x08,
+  0x05, 0x12, 0x04, 0x07, 0x02, 0x02, 0x07, 0x03, 0x02, 0x06, 0x04, 0x03,
+  0x03, 0x05, 0x06, 0x03, 0x06, 0x06, 0x07, 0x07, 0x02, 0x07, 0x08, 0x02,
+  0x07, 0x09, 0x02, 0x07, 0x0A, 0x02, 0x07, 0x0B, 0x02, 0x07, 0x0C, 0x02,
+  0x07, 0x0D, 0x02, 0x07, 0x0E, 0x02, 0x07, 0x0F, 0x02, 0x07, 0x10, 0x02,
+  0x07, 0x11, 0x02, 0x07, 0x12, 0x02, 0x04, 0x02, 0x06, 0x02, 0x03, 0x0A,
+  0x02, 0x04, 0x03, 0x09, 0x04, 0x03, 0x01, 0x05, 0x03, 0x0B, 0x05, 0x02,
+  0x01, 0x06, 0x02, 0x0B, 0x06, 0x02, 0x01, 0x07, 0x02, 0x0B, 0x07, 0x02,
+  0x0B, 0x08, 0x02, 0x0A, 0x09, 0x03, 0x08, 0x0A, 0x04, 0x06, 0x0B, 0x05,
+  0x04, 0x0C, 0x05, 0x03, 0x0D, 0x04, 0x02, 0x0E, 0x03, 0x01, 0x0F, 0x03,
+  0x01, 0x10, 0x02, 0x01, 0x11, 0x0C, 0x01, 0x12, 0x0C, 0x04, 0x02, 0x06,
+  0x03, 0x03, 0x08, 0x02, 0x04, 0x03, 0x09, 0x04, 0x03, 0x02, 0x05, 0x02,
+  0x0A, 0x05, 0x02, 0x01, 0x06, 0x03, 0x0A, 0x06, 0x02, 0x0A, 0x07, 0x02,
+  0x09, 0x08, 0x03, 0x06, 0x09, 0x05, 0x06, 0x0A, 0x06, 0x0A, 0x0B, 0x03,
+  0x0B, 0x0C, 0x02, 0x01, 0x0D, 0x02, 0x0B, 0x0D, 0x02, 0x01, 0x0E, 0x02,
+  0x0B, 0x0E, 0x02, 0x01, 0x0F, 0x03, 0x0A, 0x0F, 0x03, 0x02, 0x10, 0x03,
+  0x09, 0x10, 0x03, 0x02, 0x11, 0x0A, 0x04, 0x12, 0x06, 0x09, 0x02, 0x02,
+  0x08, 0x03, 0x03, 0x07, 0x04, 0x04, 0x07, 0x05, 0x04, 0x06, 0x06, 0x02,
+  0x09, 0x06, 0x02, 0x05, 0x07, 0x02, 0x09, 0x07, 0x02, 0x04, 0x08, 0x02,
+  0x09, 0x08, 0x02, 0x04, 0x09, 0x02, 0x09, 0x09, 0x02, 0x03, 0x0A, 0x02,
+  0x09, 0x0A, 0x02, 0x02, 0x0B, 0x02, 0x09, 0x0B, 0x02, 0x01, 0x0C, 0x02,
+  0x09, 0x0C, 0x02, 0x01, 0x0D, 0x0C, 0x01, 0x0E, 0x0C, 0x09, 0x0F, 0x02,
+  0x09, 0x10, 0x02, 0x09, 0x11, 0x02, 0x09, 0x12, 0x02, 0x02, 0x02, 0x0A,
+  0x02, 0x03, 0x0A, 0x02, 0x04, 0x02, 0x02, 0x05, 0x02, 0x02, 0x06, 0x02,
+  0x02, 0x07, 0x02, 0x05, 0x07, 0x05, 0x02, 0x08, 0x0A, 0x01, 0x09, 0x04,
+  0x09, 0x09, 0x03, 0x01, 0x0A, 0x02, 0x0A, 0x0A, 0x03, 0x0B, 0x0B, 0x02,
+  0x0B, 0x0C, 0x02, 0x0B, 0x0D, 0x02, 0x01, 0x0E, 0x02, 0x0B, 0x0E, 0x02,
+  0x01, 0x0F, 0x03, 0x0A, 0x0F, 0x03, 0x02, 0x10, 0x03, 0x09, 0x10, 0x03,
+  0x02, 0x11, 0x0A, 0x04, 0x12, 0x06, 0x05, 0x02, 0x05, 0x03, 0x03, 0x09,
+  0x02, 0x04, 0x03, 0x0A, 0x04, 0x02, 0x02, 0x05, 0x02, 0x0B, 0x05, 0x02,
+  0x02, 0x06, 0x02, 0x0B, 0x06, 0x02, 0x01, 0x07, 0x02, 0x01, 0x08, 0x02,
+  0x05, 0x08, 0x05, 0x01, 0x09, 0x0B, 0x01, 0x0A, 0x04, 0x09, 0x0A, 0x03,
+  0x01, 0x0B, 0x03, 0x0A, 0x0B, 0x03, 0x01, 0x0C, 0x02, 0x0B, 0x0C, 0x02,
+  0x01, 0x0D, 0x02, 0x0B, 0x0D, 0x02, 0x01, 0x0E, 0x02, 0x0B, 0x0E, 0x02,
+  0x02, 0x0F, 0x02, 0x0A, 0x0F, 0x03, 0x02, 0x10, 0x03, 0x09, 0x10, 0x03,
+  0x03, 0x11, 0x09, 0x04, 0x12, 0x06, 0x01, 0x02, 0x0C, 0x01, 0x03, 0x0C,
+  0x0A, 0x04, 0x02, 0x09, 0x05, 0x03, 0x08, 0x06, 0x03, 0x08, 0x07, 0x02,
+  0x07, 0x08, 0x03, 0x07, 0x09, 0x02, 0x06, 0x0A, 0x02, 0x06, 0x0B, 0x02,
+  0x05, 0x0C, 0x03, 0x05, 0x0D, 0x02, 0x05, 0x0E, 0x02, 0x05, 0x0F, 0x02,
+  0x04, 0x10, 0x02, 0x04, 0x11, 0x02, 0x04, 0x12, 0x02, 0x05, 0x02, 0x04,
+  0x03, 0x03, 0x08, 0x03, 0x04, 0x02, 0x09, 0x04, 0x02, 0x02, 0x05, 0x02,
+  0x0A, 0x05, 0x02, 0x02, 0x06, 0x02, 0x0A, 0x06, 0x02, 0x02, 0x07, 0x02,
+  0x0A, 0x07, 0x02, 0x03, 0x08, 0x02, 0x09, 0x08, 0x02, 0x04, 0x09, 0x06,
+  0x03, 0x0A, 0x08, 0x02, 0x0B, 0x03, 0x09, 0x0B, 0x03, 0x01, 0x0C, 0x02,
+  0x0B, 0x0C, 0x02, 0x01, 0x0D, 0x02, 0x0B, 0x0D, 0x02, 0x01, 0x0E, 0x02,
+  0x0B, 0x0E, 0x02, 0x01, 0x0F, 0x02, 0x0B, 0x0F, 0x02, 0x02, 0x10, 0x03,
+  0x09, 0x10, 0x03, 0x02, 0x11, 0x0A, 0x04, 0x12, 0x06, 0x04, 0x02, 0x06,
+  0x02, 0x03, 0x09, 0x02, 0x04, 0x03, 0x09, 0x04, 0x03, 0x01, 0x05, 0x03,
+  0x0A, 0x05, 0x02, 0x01, 0x06, 0x02, 0x0B, 0x06, 0x02, 0x01, 0x07, 0x02,
+  0x0B, 0x07, 0x02, 0x01, 0x08, 0x02, 0x0B, 0x08, 0x02, 0x01, 0x09, 0x03,
+  0x0A, 0x09, 0x03, 0x02, 0x0A, 0x03, 0x09, 0x0A, 0x04, 0x02, 0x0B, 0x0B,
+  0x04, 0x0C, 0x05, 0x0B, 0x0C, 0x02, 0x0B, 0x0D, 0x02, 0x01, 0x0E, 0x02,
+  0x0A, 0x0E, 0x02, 0x01, 0x0F, 0x02, 0x0A, 0x0F, 0x02, 0x02, 0x10, 0x02,
+  0x09, 0x10, 0x03, 0x02, 0x11, 0x09, 0x03, 0x12, 0x07, 0x02, 0x06, 0x03,
+  0x02, 0x07, 0x03, 0x02, 0x08, 0x03, 0x02, 0x10, 0x03, 0x02, 0x11, 0x03,
+  0x02, 0x12, 0x03, 0x02, 0x06, 0x03, 0x02, 0x07, 0x03, 0x02, 0x08, 0x03,
+  0x02, 0x10, 0x03, 0x02, 0x11, 0x03, 0x02, 0x12, 0x03, 0x04, 0x13, 0x01,
+  0x03, 0x14, 0x02, 0x03, 0x15, 0x01, 0x02, 0x16, 0x02, 0x0A, 0x07, 0x03,
+  0x08, 0x08, 0x03, 0x05, 0x09, 0x04, 0x03, 0x0A, 0x03, 0x01, 0x0B, 0x02,
+  0x03, 0x0C, 0x03, 0x06, 0x0D, 0x03, 0x08, 0x0E, 0x03, 0x0A, 0x0F, 0x03,
+  0x01, 0x09, 0x07, 0x01, 0x0A, 0x07, 0x01, 0x0D, 0x07, 0x01, 0x0E, 0x07,
+  0x01, 0x07, 0x03, 0x03, 0x08, 0x03, 0x05, 0x09, 0x04, 0x08, 0x0A, 0x03,
+  0x0B, 0x0B, 0x02, 0x08, 0x0C, 0x03, 0x05, 0x0D, 0x04, 0x03, 0x0E, 0x03,
+  0x01, 0x0F, 0x03, 0x04, 0x01, 0x06, 0x02, 0x02, 0x09, 0x02, 0x03, 0x03,
+  0x09, 0x03, 0x03, 0x01, 0x04, 0x03, 0x0A, 0x04, 0x02, 0x01, 0x05, 0x02,
+  0x0A, 0x05, 0x02, 0x01, 0x06, 0x02, 0x0A, 0x06, 0x02, 0x09, 0x07, 0x03,
+  0x08, 0x08, 0x03, 0x07, 0x09, 0x03, 0x06, 0x0A, 0x03, 0x06, 0x0B, 0x02,
+  0x05, 0x0C, 0x03, 0x05, 0x0D, 0x03, 0x05, 0x10, 0x03, 0x05, 0x11, 0x03,
+  0x05, 0x12, 0x03, 0x09, 0x01, 0x09, 0x07, 0x02, 0x03, 0x11, 0x02, 0x03,
+  0x05, 0x03, 0x03, 0x13, 0x03, 0x02, 0x04, 0x04, 0x02, 0x14, 0x04, 0x02,
+  0x03, 0x05, 0x02, 0x15, 0x05, 0x02, 0x03, 0x06, 0x01, 0x0B, 0x06, 0x04,
+  0x11, 0x06, 0x01, 0x16, 0x06, 0x02, 0x02, 0x07, 0x02, 0x09, 0x07, 0x02,
+  0x0E, 0x07, 0x04, 0x16, 0x07, 0x02, 0x02, 0x08, 0x02, 0x08, 0x08, 0x02,
+  0x0F, 0x08, 0x02, 0x16, 0x08, 0x02, 0x01, 0x09, 0x02, 0x08, 0x09, 0x02,
+  0x0F, 0x09, 0x02, 0x16, 0x09, 0x02, 0x01, 0x0A, 0x02, 0x07, 0x0A, 0x02,
+  0x0F, 0x0A, 0x02, 0x16, 0x0A, 0x02, 0x01, 0x0B, 0x02, 0x07, 0x0B, 0x02,
+  0x0F, 0x0B, 0x02, 0x16, 0x0B, 0x02, 0x01, 0x0C, 0x02, 0x07, 0x0C, 0x02,
+  0x0E, 0x0C, 0x02, 0x15, 0x0C, 0x02, 0x01, 0x0D, 0x02, 0x07, 0x0D, 0x02,
+  0x0E, 0x0D, 0x02, 0x15, 0x0D, 0x02, 0x01, 0x0E, 0x02, 0x07, 0x0E, 0x02,
+  0x0E, 0x0E, 0x02, 0x14, 0x0E, 0x02, 0x02, 0x0F, 0x02, 0x08, 0x0F, 0x02,
+  0x0D, 0x0F, 0x03, 0x13, 0x0F, 0x02, 0x02, 0x10, 0x02, 0x09, 0x10, 0x04,
+  0x0F, 0x10, 0x05, 0x03, 0x11, 0x02, 0x04, 0x12, 0x02, 0x05, 0x13, 0x02,
+  0x13, 0x13, 0x02, 0x06, 0x14, 0x03, 0x0F, 0x14, 0x04, 0x08, 0x15, 0x08,
+  0x06, 0x01, 0x04, 0x06, 0x02, 0x04, 0x06, 0x03, 0x04, 0x05, 0x04, 0x02,
+  0x09, 0x04, 0x02, 0x05, 0x05, 0x02, 0x09, 0x05, 0x02, 0x05, 0x06, 0x02,
+  0x09, 0x06, 0x02, 0x04, 0x07, 0x02, 0x0A, 0x07, 0x02, 0x04, 0x08, 0x02,
+  0x0A, 0x08, 0x02, 0x04, 0x09, 0x02, 0x0A, 0x09, 0x02, 0x03, 0x0A, 0x02,
+  0x0B, 0x0A, 0x02, 0x03, 0x0B, 0x02, 0x0B, 0x0B, 0x02, 0x03, 0x0C, 0x0A,
+  0x02, 0x0D, 0x0C, 0x02, 0x0E, 0x02, 0x0C, 0x0E, 0x02, 0x02, 0x0F, 0x02,
+  0x0C, 0x0F, 0x02, 0x01, 0x10, 0x02, 0x0D, 0x10, 0x02, 0x01, 0x11, 0x02,
+  0x0D, 0x11, 0x02, 0x00, 0x12, 0x03, 0x0D, 0x12, 0x03, 0x02, 0x01, 0x0B,
+  0x02, 0x02, 0x0D, 0x02, 0x03, 0x02, 0x0C, 0x03, 0x03, 0x02, 0x04, 0x02,
+  0x0D, 0x04, 0x02, 0x02, 0x05, 0x02, 0x0D, 0x05, 0x02, 0x02, 0x06, 0x02,
+  0x0D, 0x06, 0x02, 0x02, 0x07, 0x02, 0x0D, 0x07, 0x02, 0x02, 0x08, 0x02,
+  0x0C, 0x08, 0x03, 0x02, 0x09, 0x0B, 0x02, 0x0A, 0x0D, 0x02, 0x0B, 0x02,
+  0x0C, 0x0B, 0x03, 0x02, 0x0C, 0x02, 0x0E, 0x0C, 0x02, 0x02, 0x0D, 0x02,
+  0x0E, 0x0D, 0x02, 0x02, 0x0E, 0x02, 0x0E, 0x0E, 0x02, 0x02, 0x0F, 0x02,
+  0x0E, 0x0F, 0x02, 0x02, 0x10, 0x02, 0x0C, 0x10, 0x03, 0x02, 0x11, 0x0D,
+  0x02, 0x12, 0x0B, 0x06, 0x01, 0x07, 0x04, 0x02, 0x0B, 0x03, 0x03, 0x04,
+  0x0C, 0x03, 0x04, 0x02, 0x04, 0x03, 0x0E, 0x04, 0x02, 0x02, 0x05, 0x02,
+  0x0F, 0x05, 0x02, 0x01, 0x06, 0x03, 0x0F, 0x06, 0x02, 0x01, 0x07, 0x02,
+  0x01, 0x08, 0x02, 0x01, 0x09, 0x02, 0x01, 0x0A, 0x02, 0x01, 0x0B, 0x02,
+  0x01, 0x0C, 0x02, 0x0F, 0x0C, 0x02, 0x01, 0x0D, 0x03, 0x0F, 0x0D, 0x02,
+  0x02, 0x0E, 0x02, 0x0E, 0x0E, 0x03, 0x02, 0x0F, 0x03, 0x0E, 0x0F, 0x02,
+  0x03, 0x10, 0x04, 0x0C, 0x10, 0x04, 0x04, 0x11, 0x0B, 0x06, 0x12, 0x07,
+  0x02, 0x01, 0x0A, 0x02, 0x02, 0x0C, 0x02, 0x03, 0x02, 0x0B, 0x03, 0x04,
+  0x02, 0x04, 0x02, 0x0D, 0x04, 0x03, 0x02, 0x05, 0x02, 0x0E, 0x05, 0x02,
+  0x02, 0x06, 0x02, 0x0E, 0x06, 0x03, 0x02, 0x07, 0x02, 0x0F, 0x07, 0x02,
+  0x02, 0x08, 0x02, 0x0F, 0x08, 0x02, 0x02, 0x09, 0x02, 0x0F, 0x09, 0x02,
+  0x02, 0x0A, 0x02, 0x0F, 0x0A, 0x02, 0x02, 0x0B, 0x02, 0x0F, 0x0B, 0x02,
+  0x02, 0x0C, 0x02, 0x0F, 0x0C, 0x02, 0x02, 0x0D, 0x02, 0x0E, 0x0D, 0x03,
+  0x02, 0x0E, 0x02, 0x0E, 0x0E, 0x02, 0x02, 0x0F, 0x02, 0x0D, 0x0F, 0x03,
+  0x02, 0x10, 0x02, 0x0B, 0x10, 0x04, 0x02, 0x11, 0x0C, 0x02, 0x12, 0x0A,
+  0x02, 0x01, 0x0D, 0x02, 0x02, 0x0D, 0x02, 0x03, 0x02, 0x02, 0x04, 0x02,
+  0x02, 0x05, 0x02, 0x02, 0x06, 0x02, 0x02, 0x07, 0x02, 0x02, 0x08, 0x02,
+  0x02, 0x09, 0x0C, 0x02, 0x0A, 0x0C, 0x02, 0x0B, 0x02, 0x02, 0x0C, 0x02,
+  0x02, 0x0D, 0x02, 0x02, 0x0E, 0x02, 0x02, 0x0F, 0x02, 0x02, 0x10, 0x02,
+  0x02, 0x11, 0x0D, 0x02, 0x12, 0x0D, 0x02, 0x01, 0x0C, 0x02, 0x02, 0x0C,
+  0x02, 0x03, 0x02, 0x02, 0x04, 0x02, 0x02, 0x05, 0x02, 0x02, 0x06, 0x02,
+  0x02, 0x07, 0x02, 0x02, 0x08, 0x02, 0x02, 0x09, 0x0B, 0x02, 0x0A, 0x0B,
+  0x02, 0x0B, 0x02, 0x02, 0x0C, 0x02, 0x02, 0x0D, 0x02, 0x02, 0x0E, 0x02,
+  0x02, 0x0F, 0x02, 0x02, 0x10, 0x02, 0x02, 0x11, 0x02, 0x02, 0x12, 0x02,
+  0x06, 0x01, 0x07, 0x04, 0x02, 0x0B, 0x03, 0x03, 0x03, 0x0C, 0x03, 0x04,
+  0x02, 0x04, 0x03, 0x0E, 0x04, 0x02, 0x02, 0x05, 0x02, 0x0E, 0x05, 0x03,
+  0x01, 0x06, 0x03, 0x01, 0x07, 0x02, 0x01, 0x08, 0x02, 0x01, 0x09, 0x02,
+  0x09, 0x09, 0x08, 0x01, 0x0A, 0x02, 0x09, 0x0A, 0x08, 0x01, 0x0B, 0x02,
+  0x0F, 0x0B, 0x02, 0x01, 0x0C, 0x02, 0x0F, 0x0C, 0x02, 0x01, 0x0D, 0x03,
+  0x0F, 0x0D, 0x02, 0x02, 0x0E, 0x02, 0x0E, 0x0E, 0x03, 0x02, 0x0F, 0x03,
+  0x0D, 0x0F, 0x04, 0x03, 0x10, 0x04, 0x0C, 0x10, 0x05, 0x04, 0x11, 0x0A,
+  0x0F, 0x11, 0x02, 0x06, 0x12, 0x06, 0x10, 0x12, 0x01, 0x02, 0x01, 0x02,
+  0x0E, 0x01, 0x02, 0x02, 0x02, 0x02, 0x0E, 0x02, 0x02, 0x02, 0x03, 0x02,
+  0x0E, 0x03, 0x02, 0x02, 0x04, 0x02, 0x0E, 0x04, 0x02, 0x02, 0x05, 0x02,
+  0x0E, 0x05, 0x02, 0x02, 0x06, 0x02, 0x0E, 0x06, 0x02, 0x02, 0x07, 0x02,
+  0x0E, 0x07, 0x02, 0x02, 0x08, 0x0E, 0x02, 0x09, 0x0E, 0x02, 0x0A, 0x02,
+  0x0E, 0x0A, 0x02, 0x02, 0x0B, 0x02, 0x0E, 0x0B, 0x02, 0x02, 0x0C, 0x02,
+  0x0E, 0x0C, 0x02, 0x02, 0x0D, 0x02, 0x0E, 0x0D, 0x02, 0x02, 0x0E, 0x02,
+  0x0E, 0x0E, 0x02, 0x02, 0x0F, 0x02, 0x0E, 0x0F, 0x02, 0x02, 0x10, 0x02,
+  0x0E, 0x10, 0x02, 0x02, 0x11, 0x02, 0x0E, 0x11, 0x02, 0x02, 0x12, 0x02,
+  0x0E, 0x12, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x02,
+  0x02, 0x04, 0x02, 0x02, 0x05, 0x02, 0x02, 0x06, 0x02, 0x02, 0x07, 0x02,
+  0x02, 0x08, 0x02, 0x02, 0x09, 0x02, 0x02, 0x0A, 0x02, 0x02, 0x0B, 0x02,
+  0x02, 0x0C, 0x02, 0x02, 0x0D, 0x02, 0x02, 0x0E, 0x02, 0x02, 0x0F, 0x02,
+  0x02, 0x10, 0x02, 0x02, 0x11, 0x02, 0x02, 0x12, 0x02, 0x09, 0x01, 0x02,
+  0x09, 0x02, 0x02, 0x09, 0x03, 0x02, 0x09, 0x04, 0x02, 0x09, 0x05, 0x02,
+  0x09, 0x06, 0x02, 0x09, 0x07, 0x02, 0x09, 0x08, 0x02, 0x09, 0x09, 0x02,
+  0x09, 0x0A, 0x02, 0x09, 0x0B, 0x02, 0x09, 0x0C, 0x02, 0x00, 0x0D, 0x02,
+  0x09, 0x0D, 0x02, 0x00, 0x0E, 0x02, 0x09, 0x0E, 0x02, 0x00, 0x0F, 0x02,
+  0x09, 0x0F, 0x02, 0x00, 0x10, 0x03, 0x08, 0x10, 0x03, 0x01, 0x11, 0x09,
+  0x02, 0x12, 0x07, 0x02, 0x01, 0x02, 0x0D, 0x01, 0x03, 0x02, 0x02, 0x02,
+  0x0C, 0x02, 0x03, 0x02, 0x03, 0x02, 0x0B, 0x03, 0x03, 0x02, 0x04, 0x02,
+  0x0A, 0x04, 0x03, 0x02, 0x05, 0x02, 0x09, 0x05, 0x03, 0x02, 0x06, 0x02,
+  0x08, 0x06, 0x03, 0x02, 0x07, 0x02, 0x07, 0x07, 0x03, 0x02, 0x08, 0x02,
+  0x06, 0x08, 0x03, 0x02, 0x09, 0x02, 0x05, 0x09, 0x04, 0x02, 0x0A, 0x08,
+  0x02, 0x0B, 0x04, 0x08, 0x0B, 0x03, 0x02, 0x0C, 0x03, 0x09, 0x0C, 0x03,
+  0x02, 0x0D, 0x02, 0x0A, 0x0D, 0x02, 0x02, 0x0E, 0x02, 0x0A, 0x0E, 0x03,
+  0x02, 0x0F, 0x02, 0x0B, 0x0F, 0x03, 0x02, 0x10, 0x02, 0x0C, 0x10, 0x03,
+  0x02, 0x11, 0x02, 0x0D, 0x11, 0x03, 0x02, 0x12, 0x02, 0x0E, 0x12, 0x03,
+  0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x02, 0x02, 0x04, 0x02,
+  0x02, 0x05, 0x02, 0x02, 0x06, 0x02, 0x02, 0x07, 0x02, 0x02, 0x08, 0x02,
+  0x02, 0x09, 0x02, 0x02, 0x0A, 0x02, 0x02, 0x0B, 0x02, 0x02, 0x0C, 0x02,
+  0x02, 0x0D, 0x02, 0x02, 0x0E, 0x02, 0x02, 0x0F, 0x02, 0x02, 0x10, 0x02,
+  0x02, 0x11, 0x0B, 0x02, 0x12, 0x0B, 0x02, 0x01, 0x03, 0x10, 0x01, 0x03,
+  0x02, 0x02, 0x04, 0x0F, 0x02, 0x04, 0x02, 0x03, 0x04, 0x0F, 0x03, 0x04,
+  0x02, 0x04, 0x04, 0x0F, 0x04, 0x04, 0x02, 0x05, 0x02, 0x05, 0x05, 0x02,
+  0x0E, 0x05, 0x02, 0x11, 0x05, 0x02, 0x02, 0x06, 0x02, 0x05, 0x06, 0x02,
+  0x0E, 0x06, 0x02, 0x11, 0x06, 0x02, 0x02, 0x07, 0x02, 0x05, 0x07, 0x02,
+  0x0E, 0x07, 0x02, 0x11, 0x07, 0x02, 0x02, 0x08, 0x02, 0x06, 0x08, 0x02,
+  0x0D, 0x08, 0x02, 0x11, 0x08, 0x02, 0x02, 0x09, 0x02, 0x06, 0x09, 0x02,
+  0x0D, 0x09, 0x02, 0x11, 0x09, 0x02, 0x02, 0x0A, 0x02, 0x06, 0x0A, 0x02,
+  0x0D, 0x0A, 0x02, 0x11, 0x0A, 0x02, 0x02, 0x0B, 0x02, 0x07, 0x0B, 0x02,
+  0x0C, 0x0B, 0x02, 0x11, 0x0B, 0x02, 0x02, 0x0C, 0x02, 0x07, 0x0C, 0x02,
+  0x0C, 0x0C, 0x02, 0x11, 0x0C, 0x02, 0x02, 0x0D, 0x02, 0x07, 0x0D, 0x02,
+  0x0C, 0x0D, 0x02, 0x11, 0x0D, 0x02, 0x02, 0x0E, 0x02, 0x08, 0x0E, 0x02,
+  0x0B, 0x0E, 0x02, 0x11, 0x0E, 0x02, 0x02, 0x0F, 0x02, 0x08, 0x0F, 0x02,
+  0x0B, 0x0F, 0x02, 0x11, 0x0F, 0x02, 0x02, 0x10, 0x02, 0x08, 0x10, 0x05,
+  0x11, 0x10, 0x02, 0x02, 0x11, 0x02, 0x09, 0x11, 0x03, 0x11, 0x11, 0x02,
+  0x02, 0x12, 0x02, 0x09, 0x12, 0x03, 0x11, 0x12, 0x02, 0x02, 0x01, 0x03,
+  0x0E, 0x01, 0x02, 0x02, 0x02, 0x03, 0x0E, 0x02, 0x02, 0x02, 0x03, 0x04,
+  0x0E, 0x03, 0x02, 0x02, 0x04, 0x05, 0x0E, 0x04, 0x02, 0x02, 0x05, 0x02,
+  0x05, 0x05, 0x02, 0x0E, 0x05, 0x02, 0x02, 0x06, 0x02, 0x05, 0x06, 0x03,
+  0x0E, 0x06, 0x02, 0x02, 0x07, 0x02, 0x06, 0x07, 0x03, 0x0E, 0x07, 0x02,
+  0x02, 0x08, 0x02, 0x07, 0x08, 0x02, 0x0E, 0x08, 0x02, 0x02, 0x09, 0x02,
+  0x07, 0x09, 0x03, 0x0E, 0x09, 0x02, 0x02, 0x0A, 0x02, 0x08, 0x0A, 0x03,
+  0x0E, 0x0A, 0x02, 0x02, 0x0B, 0x02, 0x09, 0x0B, 0x02, 0x0E, 0x0B, 0x02,
+  0x02, 0x0C, 0x02, 0x09, 0x0C, 0x03, 0x0E, 0x0C, 0x02, 0x02, 0x0D, 0x02,
+  0x0A, 0x0D, 0x03, 0x0E, 0x0D, 0x02, 0x02, 0x0E, 0x02, 0x0B, 0x0E, 0x02,
+  0x0E, 0x0E, 0x02, 0x02, 0x0F, 0x02, 0x0B, 0x0F, 0x05, 0x02, 0x10, 0x02,
+  0x0C, 0x10, 0x04, 0x02, 0x11, 0x02, 0x0D, 0x11, 0x03, 0x02, 0x12, 0x02,
+  0x0D, 0x12, 0x03, 0x06, 0x01, 0x07, 0x04, 0x02, 0x0B, 0x03, 0x03, 0x04,
+  0x0C, 0x03, 0x04, 0x02, 0x04, 0x03, 0x0E, 0x04, 0x03, 0x02, 0x05, 0x02,
+  0x0F, 0x05, 0x02, 0x01, 0x06, 0x03, 0x0F, 0x06, 0x03, 0x01, 0x07, 0x02,
+  0x10, 0x07, 0x02, 0x01, 0x08, 0x02, 0x10, 0x08, 0x02, 0x01, 0x09, 0x02,
+  0x10, 0x09, 0x02, 0x01, 0x0A, 0x02, 0x10, 0x0A, 0x02, 0x01, 0x0B, 0x02,
+  0x10, 0x0B, 0x02, 0x01, 0x0C, 0x02, 0x10, 0x0C, 0x02, 0x01, 0x0D, 0x03,
+  0x0F, 0x0D, 0x03, 0x02, 0x0E, 0x02, 0x0F, 0x0E, 0x02, 0x02, 0x0F, 0x03,
+  0x0E, 0x0F, 0x03, 0x03, 0x10, 0x04, 0x0C, 0x10, 0x04, 0x04, 0x11, 0x0B,
+  0x06, 0x12, 0x07, 0x02, 0x01, 0x0B, 0x02, 0x02, 0x0C, 0x02, 0x03, 0x02,
+  0x0C, 0x03, 0x03, 0x02, 0x04, 0x02, 0x0D, 0x04, 0x02, 0x02, 0x05, 0x02,
+  0x0D, 0x05, 0x02, 0x02, 0x06, 0x02, 0x0D, 0x06, 0x02, 0x02, 0x07, 0x02,
+  0x0D, 0x07, 0x02, 0x02, 0x08, 0x02, 0x0C, 0x08, 0x03, 0x02, 0x09, 0x0C,
+  0x02, 0x0A, 0x0B, 0x02, 0x0B, 0x02, 0x02, 0x0C, 0x02, 0x02, 0x0D, 0x02,
+  0x02, 0x0E, 0x02, 0x02, 0x0F, 0x02, 0x02, 0x10, 0x02, 0x02, 0x11, 0x02,
+  0x02, 0x12, 0x02, 0x06, 0x01, 0x07, 0x04, 0x02, 0x0B, 0x03, 0x03, 0x04,
+  0x0C, 0x03, 0x04, 0x02, 0x04, 0x03, 0x0E, 0x04, 0x03, 0x02, 0x05, 0x02,
+  0x0F, 0x05, 0x02, 0x01, 0x06, 0x03, 0x0F, 0x06, 0x03, 0x01, 0x07, 0x02,
+  0x10, 0x07, 0x02, 0x01, 0x08, 0x02, 0x10, 0x08, 0x02, 0x01, 0x09, 0x02,
+  0x10, 0x09, 0x02, 0x01, 0x0A, 0x02, 0x10, 0x0A, 0x02, 0x01, 0x0B, 0x02,
+  0x10, 0x0B, 0x02, 0x01, 0x0C, 0x02, 0x10, 0x0C, 0x02, 0x01, 0x0D, 0x03,
+  0x0B, 0x0D, 0x01, 0x0F, 0x0D, 0x03, 0x02, 0x0E, 0x02, 0x0A, 0x0E, 0x03,
+  0x0F, 0x0E, 0x02, 0x02, 0x0F, 0x03, 0x0B, 0x0F, 0x06, 0x03, 0x10, 0x04,
+  0x0C, 0x10, 0x04, 0x04, 0x11, 0x0D, 0x06, 0x12, 0x07, 0x0F, 0x12, 0x03,
+  0x10, 0x13, 0x01, 0x02, 0x01, 0x0C, 0x02, 0x02, 0x0D, 0x02, 0x03, 0x02,
+  0x0D, 0x03, 0x03, 0x02, 0x04, 0x02, 0x0E, 0x04, 0x02, 0x02, 0x05, 0x02,
+  0x0E, 0x05, 0x02, 0x02, 0x06, 0x02, 0x0E, 0x06, 0x02, 0x02, 0x07, 0x02,
+  0x0E, 0x07, 0x02, 0x02, 0x08, 0x02, 0x0D, 0x08, 0x02, 0x02, 0x09, 0x0D,
+  0x02, 0x0A, 0x0C, 0x02, 0x0B, 0x02, 0x0C, 0x0B, 0x03, 0x02, 0x0C, 0x02,
+  0x0D, 0x0C, 0x02, 0x02, 0x0D, 0x02, 0x0D, 0x0D, 0x03, 0x02, 0x0E, 0x02,
+  0x0E, 0x0E, 0x02, 0x02, 0x0F, 0x02, 0x0E, 0x0F, 0x02, 0x02, 0x10, 0x02,
+  0x0E, 0x10, 0x02, 0x02, 0x11, 0x02, 0x0E, 0x11, 0x02, 0x02, 0x12, 0x02,
+  0x0E, 0x12, 0x02, 0x05, 0x01, 0x06, 0x03, 0x02, 0x0A, 0x02, 0x03, 0x03,
+  0x0B, 0x03, 0x03, 0x02, 0x04, 0x02, 0x0C, 0x04, 0x02, 0x02, 0x05, 0x02,
+  0x0C, 0x05, 0x02, 0x02, 0x06, 0x02, 0x0C, 0x06, 0x03, 0x02, 0x07, 0x03,
+  0x03, 0x08, 0x05, 0x04, 0x09, 0x07, 0x07, 0x0A, 0x06, 0x0A, 0x0B, 0x04,
+  0x0C, 0x0C, 0x03, 0x01, 0x0D, 0x03, 0x0D, 0x0D, 0x02, 0x02, 0x0E, 0x02,
+  0x0D, 0x0E, 0x02, 0x02, 0x0F, 0x02, 0x0D, 0x0F, 0x02, 0x02, 0x10, 0x04,
+  0x0C, 0x10, 0x03, 0x03, 0x11, 0x0B, 0x05, 0x12, 0x07, 0x00, 0x01, 0x0E,
+  0x00, 0x02, 0x0E, 0x06, 0x03, 0x02, 0x06, 0x04, 0x02, 0x06, 0x05, 0x02,
+  0x06, 0x06, 0x02, 0x06, 0x07, 0x02, 0x06, 0x08, 0x02, 0x06, 0x09, 0x02,
+  0x06, 0x0A, 0x02, 0x06, 0x0B, 0x02, 0x06, 0x0C, 0x02, 0x06, 0x0D, 0x02,
+  0x06, 0x0E, 0x02, 0x06, 0x0F, 0x02, 0x06, 0x10, 0x02, 0x06, 0x11, 0x02,
+  0x06, 0x12, 0x02, 0x02, 0x01, 0x02, 0x0E, 0x01, 0x02, 0x02, 0x02, 0x02,
+  0x0E, 0x02, 0x02, 0x02, 0x03, 0x02, 0x0E, 0x03, 0x02, 0x02, 0x04, 0x02,
+  0x0E, 0x04, 0x02, 0x02, 0x05, 0x02, 0x0E, 0x05, 0x02, 0x02, 0x06, 0x02,
+  0x0E, 0x06, 0x02, 0x02, 0x07, 0x02, 0x0E, 0x07, 0x02, 0x02, 0x08, 0x02,
+  0x0E, 0x08, 0x02, 0x02, 0x09, 0x02, 0x0E, 0x09, 0x02, 0x02, 0x0A, 0x02,
+  0x0E, 0x0A, 0x02, 0x02, 0x0B, 0x02, 0x0E, 0x0B, 0x02, 0x02, 0x0C, 0x02,
+  0x0E, 0x0C, 0x02, 0x02, 0x0D, 0x02, 0x0E, 0x0D, 0x02, 0x02, 0x0E, 0x02,
+  0x0E, 0x0E, 0x02, 0x02, 0x0F, 0x03, 0x0D, 0x0F, 0x03, 0x03, 0x10, 0x03,
+  0x0C, 0x10, 0x03, 0x04, 0x11, 0x0A, 0x05, 0x12, 0x08, 0x00, 0x01, 0x03,
+  0x0C, 0x01, 0x03, 0x01, 0x02, 0x02, 0x0C, 0x02, 0x02, 0x01, 0x03, 0x02,
+  0x0C, 0x03, 0x02, 0x01, 0x04, 0x02, 0x0C, 0x04, 0x02, 0x02, 0x05, 0x02,
+  0x0B, 0x05, 0x02, 0x02, 0x06, 0x02, 0x0B, 0x06, 0x02, 0x02, 0x07, 0x02,
+  0x0B, 0x07, 0x02, 0x03, 0x08, 0x02, 0x0A, 0x08, 0x02, 0x03, 0x09, 0x02,
+  0x0A, 0x09, 0x02, 0x03, 0x0A, 0x02, 0x0A, 0x0A, 0x02, 0x04, 0x0B, 0x02,
+  0x09, 0x0B, 0x02, 0x04, 0x0C, 0x02, 0x09, 0x0C, 0x02, 0x04, 0x0D, 0x02,
+  0x09, 0x0D, 0x02, 0x05, 0x0E, 0x02, 0x08, 0x0E, 0x02, 0x05, 0x0F, 0x02,
+  0x08, 0x0F, 0x02, 0x05, 0x10, 0x05, 0x06, 0x11, 0x03, 0x06, 0x12, 0x03,
+  0x00, 0x01, 0x03, 0x0A, 0x01, 0x03, 0x14, 0x01, 0x03, 0x01, 0x02, 0x02,
+  0x0A, 0x02, 0x03, 0x14, 0x02, 0x02, 0x01, 0x03, 0x02, 0x0A, 0x03, 0x03,
+  0x14, 0x03, 0x02, 0x01, 0x04, 0x03, 0x09, 0x04, 0x02, 0x0C, 0x04, 0x02,
+  0x13, 0x04, 0x03, 0x02, 0x05, 0x02, 0x09, 0x05, 0x02, 0x0C, 0x05, 0x02,
+  0x13, 0x05, 0x02, 0x02, 0x06, 0x02, 0x09, 0x06, 0x02, 0x0C, 0x06, 0x02,
+  0x13, 0x06, 0x02, 0x02, 0x07, 0x02, 0x09, 0x07, 0x02, 0x0C, 0x07, 0x02,
+  0x13, 0x07, 0x02, 0x02, 0x08, 0x03, 0x08, 0x08, 0x02, 0x0D, 0x08, 0x02,
+  0x12, 0x08, 0x03, 0x03, 0x09, 0x02, 0x08, 0x09, 0x02, 0x0D, 0x09, 0x02,
+  0x12, 0x09, 0x02, 0x03, 0x0A, 0x02, 0x08, 0x0A, 0x02, 0x0D, 0x0A, 0x02,
+  0x12, 0x0A, 0x02, 0x03, 0x0B, 0x02, 0x08, 0x0B, 0x02, 0x0D, 0x0B, 0x02,
+  0x12, 0x0B, 0x02, 0x03, 0x0C, 0x03, 0x07, 0x0C, 0x02, 0x0E, 0x0C, 0x02,
+  0x11, 0x0C, 0x03, 0x04, 0x0D, 0x02, 0x07, 0x0D, 0x02, 0x0E, 0x0D, 0x02,
+  0x11, 0x0D, 0x02, 0x04, 0x0E, 0x02, 0x07, 0x0E, 0x02, 0x0E, 0x0E, 0x02,
+  0x11, 0x0E, 0x02, 0x04, 0x0F, 0x02, 0x07, 0x0F, 0x02, 0x0E, 0x0F, 0x02,
+  0x11, 0x0F, 0x02, 0x04, 0x10, 0x04, 0x0F, 0x10, 0x04, 0x05, 0x11, 0x03,
+  0x0F, 0x11, 0x03, 0x05, 0x12, 0x03, 0x0F, 0x12, 0x03, 0x01, 0x01, 0x02,
+  0x0C, 0x01, 0x02, 0x01, 0x02, 0x03, 0x0B, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x0B, 0x03, 0x02, 0x03, 0x04, 0x02, 0x0A, 0x04, 0x02, 0x03, 0x05, 0x03,
+  0x09, 0x05, 0x03, 0x04, 0x06, 0x02, 0x09, 0x06, 0x02, 0x05, 0x07, 0x02,
+  0x08, 0x07, 0x02, 0x05, 0x08, 0x05, 0x06, 0x09, 0x03, 0x06, 0x0A, 0x03,
+  0x05, 0x0B, 0x02, 0x08, 0x0B, 0x02, 0x04, 0x0C, 0x03, 0x08, 0x0C, 0x03,
+  0x04, 0x0D, 0x02, 0x09, 0x0D, 0x02, 0x03, 0x0E, 0x02, 0x0A, 0x0E, 0x02,
+  0x02, 0x0F, 0x03, 0x0A, 0x0F, 0x03, 0x02, 0x10, 0x02, 0x0B, 0x10, 0x02,
+  0x01, 0x11, 0x03, 0x0B, 0x11, 0x03, 0x00, 0x12, 0x03, 0x0C, 0x12, 0x03,
+  0x00, 0x01, 0x03, 0x0D, 0x01, 0x03, 0x01, 0x02, 0x03, 0x0C, 0x02, 0x03,
+  0x02, 0x03, 0x02, 0x0C, 0x03, 0x02, 0x02, 0x04, 0x03, 0x0B, 0x04, 0x03,
+  0x03, 0x05, 0x02, 0x0B, 0x05, 0x02, 0x04, 0x06, 0x02, 0x0A, 0x06, 0x02,
+  0x04, 0x07, 0x03, 0x09, 0x07, 0x03, 0x05, 0x08, 0x02, 0x09, 0x08, 0x02,
+  0x06, 0x09, 0x04, 0x06, 0x0A, 0x04, 0x07, 0x0B, 0x02, 0x07, 0x0C, 0x02,
+  0x07, 0x0D, 0x02, 0x07, 0x0E, 0x02, 0x07, 0x0F, 0x02, 0x07, 0x10, 0x02,
+  0x07, 0x11, 0x02, 0x07, 0x12, 0x02, 0x02, 0x01, 0x0D, 0x02, 0x02, 0x0D,
+  0x0C, 0x03, 0x03, 0x0B, 0x04, 0x03, 0x0A, 0x05, 0x03, 0x0A, 0x06, 0x02,
+  0x09, 0x07, 0x02, 0x08, 0x08, 0x03, 0x07, 0x09, 0x03, 0x06, 0x0A, 0x03,
+  0x06, 0x0B, 0x02, 0x05, 0x0C, 0x02, 0x04, 0x0D, 0x03, 0x03, 0x0E, 0x03,
+  0x02, 0x0F, 0x03, 0x01, 0x10, 0x03, 0x01, 0x11, 0x0E, 0x01, 0x12, 0x0E,
+  0x03, 0x01, 0x05, 0x03, 0x02, 0x05, 0x03, 0x03, 0x02, 0x03, 0x04, 0x02,
+  0x03, 0x05, 0x02, 0x03, 0x06, 0x02, 0x03, 0x07, 0x02, 0x03, 0x08, 0x02,
+  0x03, 0x09, 0x02, 0x03, 0x0A, 0x02, 0x03, 0x0B, 0x02, 0x03, 0x0C, 0x02,
+  0x03, 0x0D, 0x02, 0x03, 0x0E, 0x02, 0x03, 0x0F, 0x02, 0x03, 0x10, 0x02,
+  0x03, 0x11, 0x02, 0x03, 0x12, 0x02, 0x03, 0x13, 0x02, 0x03, 0x14, 0x02,
+  0x03, 0x15, 0x02, 0x03, 0x16, 0x05, 0x03, 0x17, 0x05, 0x02, 0x00, 0x01,
+  0x02, 0x01, 0x01, 0x02, 0x02, 0x02, 0x03, 0x03, 0x01, 0x03, 0x04, 0x01,
+  0x03, 0x05, 0x02, 0x04, 0x06, 0x01, 0x04, 0x07, 0x01, 0x04, 0x08, 0x02,
+  0x05, 0x09, 0x01, 0x05, 0x0A, 0x01, 0x05, 0x0B, 0x02, 0x06, 0x0C, 0x01,
+  0x06, 0x0D, 0x01, 0x06, 0x0E, 0x02, 0x07, 0x0F, 0x01, 0x07, 0x10, 0x01,
+  0x07, 0x11, 0x02, 0x08, 0x12, 0x01, 0x08, 0x13, 0x01, 0x08, 0x14, 0x02,
+  0x09, 0x15, 0x01, 0x09, 0x16, 0x01, 0x09, 0x17, 0x02, 0x0A, 0x18, 0x01,
+  0x01, 0x01, 0x05, 0x01, 0x02, 0x05, 0x04, 0x03, 0x02, 0x04, 0x04, 0x02,
+  0x04, 0x05, 0x02, 0x04, 0x06, 0x02, 0x04, 0x07, 0x02, 0x04, 0x08, 0x02,
+  0x04, 0x09, 0x02, 0x04, 0x0A, 0x02, 0x04, 0x0B, 0x02, 0x04, 0x0C, 0x02,
+  0x04, 0x0D, 0x02, 0x04, 0x0E, 0x02, 0x04, 0x0F, 0x02, 0x04, 0x10, 0x02,
+  0x04, 0x11, 0x02, 0x04, 0x12, 0x02, 0x04, 0x13, 0x02, 0x04, 0x14, 0x02,
+  0x04, 0x15, 0x02, 0x01, 0x16, 0x05, 0x01, 0x17, 0x05, 0x05, 0x01, 0x03,
+  0x04, 0x02, 0x02, 0x07, 0x02, 0x02, 0x03, 0x03, 0x02, 0x08, 0x03, 0x02,
+  0x02, 0x04, 0x02, 0x09, 0x04, 0x02, 0x01, 0x05, 0x02, 0x0A, 0x05, 0x02,
+  0x00, 0x16, 0x0D, 0x03, 0x01, 0x04, 0x02, 0x02, 0x06, 0x01, 0x03, 0x03,
+  0x06, 0x03, 0x03, 0x01, 0x04, 0x02, 0x07, 0x04, 0x02, 0x01, 0x05, 0x02,
+  0x07, 0x05, 0x02, 0x01, 0x06, 0x03, 0x06, 0x06, 0x03, 0x02, 0x07, 0x06,
+  0x03, 0x08, 0x04, 0x04, 0x06, 0x06, 0x02, 0x07, 0x09, 0x02, 0x08, 0x02,
+  0x09, 0x08, 0x03, 0x02, 0x09, 0x02, 0x0A, 0x09, 0x02, 0x0A, 0x0A, 0x02,
+  0x04, 0x0B, 0x08, 0x02, 0x0C, 0x0A, 0x01, 0x0D, 0x03, 0x0A, 0x0D, 0x02,
+  0x01, 0x0E, 0x02, 0x0A, 0x0E, 0x02, 0x01, 0x0F, 0x02, 0x0A, 0x0F, 0x02,
+  0x01, 0x10, 0x03, 0x08, 0x10, 0x04, 0x02, 0x11, 0x07, 0x0A, 0x11, 0x04,
+  0x03, 0x12, 0x05, 0x0B, 0x12, 0x03, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02,
+  0x02, 0x03, 0x02, 0x02, 0x04, 0x02, 0x02, 0x05, 0x02, 0x02, 0x06, 0x02,
+  0x06, 0x06, 0x04, 0x02, 0x07, 0x02, 0x05, 0x07, 0x07, 0x02, 0x08, 0x05,
+  0x09, 0x08, 0x04, 0x02, 0x09, 0x03, 0x0B, 0x09, 0x02, 0x02, 0x0A, 0x02,
+  0x0B, 0x0A, 0x03, 0x02, 0x0B, 0x02, 0x0C, 0x0B, 0x02, 0x02, 0x0C, 0x02,
+  0x0C, 0x0C, 0x02, 0x02, 0x0D, 0x02, 0x0C, 0x0D, 0x02, 0x02, 0x0E, 0x02,
+  0x0B, 0x0E, 0x03, 0x02, 0x0F, 0x03, 0x0B, 0x0F, 0x02, 0x02, 0x10, 0x05,
+  0x09, 0x10, 0x04, 0x02, 0x11, 0x02, 0x05, 0x11, 0x07, 0x02, 0x12, 0x02,
+  0x06, 0x12, 0x04, 0x05, 0x06, 0x04, 0x03, 0x07, 0x08, 0x02, 0x08, 0x04,
+  0x08, 0x08, 0x03, 0x02, 0x09, 0x02, 0x0A, 0x09, 0x02, 0x01, 0x0A, 0x03,
+  0x01, 0x0B, 0x02, 0x01, 0x0C, 0x02, 0x01, 0x0D, 0x02, 0x01, 0x0E, 0x03,
+  0x0A, 0x0E, 0x02, 0x02, 0x0F, 0x02, 0x0A, 0x0F, 0x02, 0x02, 0x10, 0x04,
+  0x08, 0x10, 0x03, 0x03, 0x11, 0x08, 0x05, 0x12, 0x04, 0x0B, 0x01, 0x02,
+  0x0B, 0x02, 0x02, 0x0B, 0x03, 0x02, 0x0B, 0x04, 0x02, 0x0B, 0x05, 0x02,
+  0x05, 0x06, 0x04, 0x0B, 0x06, 0x02, 0x03, 0x07, 0x07, 0x0B, 0x07, 0x02,
+  0x02, 0x08, 0x04, 0x08, 0x08, 0x05, 0x02, 0x09, 0x02, 0x0A, 0x09, 0x03,
+  0x01, 0x0A, 0x03, 0x0B, 0x0A, 0x02, 0x01, 0x0B, 0x02, 0x0B, 0x0B, 0x02,
+  0x01, 0x0C, 0x02, 0x0B, 0x0C, 0x02, 0x01, 0x0D, 0x02, 0x0B, 0x0D, 0x02,
+  0x01, 0x0E, 0x03, 0x0B, 0x0E, 0x02, 0x02, 0x0F, 0x02, 0x0A, 0x0F, 0x03,
+  0x02, 0x10, 0x04, 0x08, 0x10, 0x05, 0x03, 0x11, 0x07, 0x0B, 0x11, 0x02,
+  0x05, 0x12, 0x04, 0x0B, 0x12, 0x02, 0x05, 0x06, 0x04, 0x03, 0x07, 0x08,
+  0x02, 0x08, 0x04, 0x08, 0x08, 0x04, 0x02, 0x09, 0x02, 0x0A, 0x09, 0x02,
+  0x01, 0x0A, 0x03, 0x0B, 0x0A, 0x02, 0x01, 0x0B, 0x0C, 0x01, 0x0C, 0x0C,
+  0x01, 0x0D, 0x02, 0x01, 0x0E, 0x03, 0x02, 0x0F, 0x02, 0x0A, 0x0F, 0x03,
+  0x02, 0x10, 0x04, 0x08, 0x10, 0x04, 0x03, 0x11, 0x08, 0x05, 0x12, 0x04,
+  0x03, 0x01, 0x04, 0x02, 0x02, 0x05, 0x02, 0x03, 0x02, 0x02, 0x04, 0x02,
+  0x02, 0x05, 0x02, 0x00, 0x06, 0x07, 0x00, 0x07, 0x07, 0x02, 0x08, 0x02,
+  0x02, 0x09, 0x02, 0x02, 0x0A, 0x02, 0x02, 0x0B, 0x02, 0x02, 0x0C, 0x02,
+  0x02, 0x0D, 0x02, 0x02, 0x0E, 0x02, 0x02, 0x0F, 0x02, 0x02, 0x10, 0x02,
+  0x02, 0x11, 0x02, 0x02, 0x12, 0x02, 0x05, 0x06, 0x04, 0x0B, 0x06, 0x02,
+  0x03, 0x07, 0x07, 0x0B, 0x07, 0x02, 0x02, 0x08, 0x04, 0x08, 0x08, 0x05,
+  0x02, 0x09, 0x02, 0x0A, 0x09, 0x03, 0x01, 0x0A, 0x02, 0x0B, 0x0A, 0x02,
+  0x01, 0x0B, 0x02, 0x0B, 0x0B, 0x02, 0x01, 0x0C, 0x02, 0x0B, 0x0C, 0x02,
+  0x01, 0x0D, 0x02, 0x0B, 0x0D, 0x02, 0x01, 0x0E, 0x03, 0x0B, 0x0E, 0x02,
+  0x02, 0x0F, 0x02, 0x0A, 0x0F, 0x03, 0x02, 0x10, 0x04, 0x08, 0x10, 0x05,
+  0x03, 0x11, 0x07, 0x0B, 0x11, 0x02, 0x05, 0x12, 0x04, 0x0B, 0x12, 0x02,
+  0x0B, 0x13, 0x02, 0x01, 0x14, 0x02, 0x0B, 0x14, 0x02, 0x01, 0x15, 0x02,
+  0x0A, 0x15, 0x03, 0x02, 0x16, 0x03, 0x09, 0x16, 0x03, 0x02, 0x17, 0x0A,
+  0x04, 0x18, 0x06, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x02,
+  0x02, 0x04, 0x02, 0x02, 0x05, 0x02, 0x02, 0x06, 0x02, 0x06, 0x06, 0x05,
+  0x02, 0x07, 0x02, 0x05, 0x07, 0x07, 0x02, 0x08, 0x04, 0x0A, 0x08, 0x03,
+  0x02, 0x09, 0x03, 0x0B, 0x09, 0x02, 0x02, 0x0A, 0x02, 0x0B, 0x0A, 0x02,
+  0x02, 0x0B, 0x02, 0x0B, 0x0B, 0x02, 0x02, 0x0C, 0x02, 0x0B, 0x0C, 0x02,
+  0x02, 0x0D, 0x02, 0x0B, 0x0D, 0x02, 0x02, 0x0E, 0x02, 0x0B, 0x0E, 0x02,
+  0x02, 0x0F, 0x02, 0x0B, 0x0F, 0x02, 0x02, 0x10, 0x02, 0x0B, 0x10, 0x02,
+  0x02, 0x11, 0x02, 0x0B, 0x11, 0x02, 0x02, 0x12, 0x02, 0x0B, 0x12, 0x02,
+  0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x02, 0x02, 0x06, 0x02,
+  0x02, 0x07, 0x02, 0x02, 0x08, 0x02, 0x02, 0x09, 0x02, 0x02, 0x0A, 0x02,
+  0x02, 0x0B, 0x02, 0x02, 0x0C, 0x02, 0x02, 0x0D, 0x02, 0x02, 0x0E, 0x02,
+  0x02, 0x0F, 0x02, 0x02, 0x10, 0x02, 0x02, 0x11, 0x02, 0x02, 0x12, 0x02,
+  0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x02, 0x02, 0x06, 0x02,
+  0x02, 0x07, 0x02, 0x02, 0x08, 0x02, 0x02, 0x09, 0x02, 0x02, 0x0A, 0x02,
+  0x02, 0x0B, 0x02, 0x02, 0x0C, 0x02, 0x02, 0x0D, 0x02, 0x02, 0x0E, 0x02,
+  0x02, 0x0F, 0x02, 0x02, 0x10, 0x02, 0x02, 0x11, 0x02, 0x02, 0x12, 0x02,
+  0x02, 0x13, 0x02, 0x02, 0x14, 0x02, 0x02, 0x15, 0x02, 0x02, 0x16, 0x02,
+  0x00, 0x17, 0x04, 0x00, 0x18, 0x03, 0x02, 0x02, 0x02, 0x02, 0x03, 0x02,
+  0x02, 0x04, 0x02, 0x02, 0x05, 0x02, 0x02, 0x06, 0x02, 0x09, 0x06, 0x03,
+  0x02, 0x07, 0x02, 0x08, 0x07, 0x03, 0x02, 0x08, 0x02, 0x07, 0x08, 0x03,
+  0x02, 0x09, 0x02, 0x06, 0x09, 0x03, 0x02, 0x0A, 0x02, 0x05, 0x0A, 0x03,
+  0x02, 0x0B, 0x06, 0x02, 0x0C, 0x07, 0x02, 0x0D, 0x03, 0x07, 0x0D, 0x02,
+  0x02, 0x0E, 0x02, 0x07, 0x0E, 0x03, 0x02, 0x0F, 0x02, 0x08, 0x0F, 0x02,
+  0x02, 0x10, 0x02, 0x08, 0x10, 0x03, 0x02, 0x11, 0x02, 0x09, 0x11, 0x02,
+  0x02, 0x12, 0x02, 0x09, 0x12, 0x03, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02,
+  0x02, 0x03, 0x02, 0x02, 0x04, 0x02, 0x02, 0x05, 0x02, 0x02, 0x06, 0x02,
+  0x02, 0x07, 0x02, 0x02, 0x08, 0x02, 0x02, 0x09, 0x02, 0x02, 0x0A, 0x02,
+  0x02, 0x0B, 0x02, 0x02, 0x0C, 0x02, 0x02, 0x0D, 0x02, 0x02, 0x0E, 0x02,
+  0x02, 0x0F, 0x02, 0x02, 0x10, 0x02, 0x02, 0x11, 0x02, 0x02, 0x12, 0x02,
+  0x02, 0x06, 0x02, 0x06, 0x06, 0x04, 0x0E, 0x06, 0x04, 0x02, 0x07, 0x02,
+  0x05, 0x07, 0x06, 0x0C, 0x07, 0x07, 0x02, 0x08, 0x04, 0x09, 0x08, 0x05,
+  0x11, 0x08, 0x03, 0x02, 0x09, 0x03, 0x0A, 0x09, 0x03, 0x12, 0x09, 0x02,
+  0x02, 0x0A, 0x02, 0x0A, 0x0A, 0x02, 0x12, 0x0A, 0x02, 0x02, 0x0B, 0x02,
+  0x0A, 0x0B, 0x02, 0x12, 0x0B, 0x02, 0x02, 0x0C, 0x02, 0x0A, 0x0C, 0x02,
+  0x12, 0x0C, 0x02, 0x02, 0x0D, 0x02, 0x0A, 0x0D, 0x02, 0x12, 0x0D, 0x02,
+  0x02, 0x0E, 0x02, 0x0A, 0x0E, 0x02, 0x12, 0x0E, 0x02, 0x02, 0x0F, 0x02,
+  0x0A, 0x0F, 0x02, 0x12, 0x0F, 0x02, 0x02, 0x10, 0x02, 0x0A, 0x10, 0x02,
+  0x12, 0x10, 0x02, 0x02, 0x11, 0x02, 0x0A, 0x11, 0x02, 0x12, 0x11, 0x02,
+  0x02, 0x12, 0x02, 0x0A, 0x12, 0x02, 0x12, 0x12, 0x02, 0x02, 0x06, 0x02,
+  0x06, 0x06, 0x05, 0x02, 0x07, 0x02, 0x05, 0x07, 0x07, 0x02, 0x08, 0x04,
+  0x0A, 0x08, 0x03, 0x02, 0x09, 0x03, 0x0B, 0x09, 0x02, 0x02, 0x0A, 0x02,
+  0x0B, 0x0A, 0x02, 0x02, 0x0B, 0x02, 0x0B, 0x0B, 0x02, 0x02, 0x0C, 0x02,
+  0x0B, 0x0C, 0x02, 0x02, 0x0D, 0x02, 0x0B, 0x0D, 0x02, 0x02, 0x0E, 0x02,
+  0x0B, 0x0E, 0x02, 0x02, 0x0F, 0x02, 0x0B, 0x0F, 0x02, 0x02, 0x10, 0x02,
+  0x0B, 0x10, 0x02, 0x02, 0x11, 0x02, 0x0B, 0x11, 0x02, 0x02, 0x12, 0x02,
+  0x0B, 0x12, 0x02, 0x05, 0x06, 0x05, 0x03, 0x07, 0x09, 0x02, 0x08, 0x04,
+  0x09, 0x08, 0x04, 0x02, 0x09, 0x02, 0x0B, 0x09, 0x02, 0x01, 0x0A, 0x03,
+  0x0B, 0x0A, 0x03, 0x01, 0x0B, 0x02, 0x0C, 0x0B, 0x02, 0x01, 0x0C, 0x02,
+  0x0C, 0x0C, 0x02, 0x01, 0x0D, 0x02, 0x0C, 0x0D, 0x02, 0x01, 0x0E, 0x03,
+  0x0B, 0x0E, 0x03, 0x02, 0x0F, 0x02, 0x0B, 0x0F, 0x02, 0x02, 0x10, 0x04,
+  0x09, 0x10, 0x04, 0x03, 0x11, 0x09, 0x05, 0x12, 0x05, 0x02, 0x06, 0x02,
+  0x06, 0x06, 0x04, 0x02, 0x07, 0x02, 0x05, 0x07, 0x07, 0x02, 0x08, 0x05,
+  0x09, 0x08, 0x04, 0x02, 0x09, 0x03, 0x0B, 0x09, 0x02, 0x02, 0x0A, 0x02,
+  0x0B, 0x0A, 0x03, 0x02, 0x0B, 0x02, 0x0C, 0x0B, 0x02, 0x02, 0x0C, 0x02,
+  0x0C, 0x0C, 0x02, 0x02, 0x0D, 0x02, 0x0C, 0x0D, 0x02, 0x02, 0x0E, 0x02,
+  0x0B, 0x0E, 0x03, 0x02, 0x0F, 0x03, 0x0B, 0x0F, 0x02, 0x02, 0x10, 0x05,
+  0x09, 0x10, 0x04, 0x02, 0x11, 0x02, 0x05, 0x11, 0x07, 0x02, 0x12, 0x02,
+  0x06, 0x12, 0x04, 0x02, 0x13, 0x02, 0x02, 0x14, 0x02, 0x02, 0x15, 0x02,
+  0x02, 0x16, 0x02, 0x02, 0x17, 0x02, 0x05, 0x06, 0x04, 0x0B, 0x06, 0x02,
+  0x03, 0x07, 0x07, 0x0B, 0x07, 0x02, 0x02, 0x08, 0x04, 0x08, 0x08, 0x05,
+  0x02, 0x09, 0x02, 0x0A, 0x09, 0x03, 0x01, 0x0A, 0x03, 0x0B, 0x0A, 0x02,
+  0x01, 0x0B, 0x02, 0x0B, 0x0B, 0x02, 0x01, 0x0C, 0x02, 0x0B, 0x0C, 0x02,
+  0x01, 0x0D, 0x02, 0x0B, 0x0D, 0x02, 0x01, 0x0E, 0x03, 0x0B, 0x0E, 0x02,
+  0x02, 0x0F, 0x02, 0x0A, 0x0F, 0x03, 0x02, 0x10, 0x04, 0x08, 0x10, 0x05,
+  0x03, 0x11, 0x07, 0x0B, 0x11, 0x02, 0x05, 0x12, 0x04, 0x0B, 0x12, 0x02,
+  0x0B, 0x13, 0x02, 0x0B, 0x14, 0x02, 0x0B, 0x15, 0x02, 0x0B, 0x16, 0x02,
+  0x0B, 0x17, 0x02, 0x02, 0x06, 0x02, 0x05, 0x06, 0x03, 0x02, 0x07, 0x06,
+  0x02, 0x08, 0x03, 0x02, 0x09, 0x02, 0x02, 0x0A, 0x02, 0x02, 0x0B, 0x02,
+  0x02, 0x0C, 0x02, 0x02, 0x0D, 0x02, 0x02, 0x0E, 0x02, 0x02, 0x0F, 0x02,
+  0x02, 0x10, 0x02, 0x02, 0x11, 0x02, 0x02, 0x12, 0x02, 0x03, 0x06, 0x05,
+  0x02, 0x07, 0x08, 0x01, 0x08, 0x03, 0x08, 0x08, 0x02, 0x01, 0x09, 0x02,
+  0x09, 0x09, 0x02, 0x01, 0x0A, 0x02, 0x02, 0x0B, 0x05, 0x03, 0x0C, 0x07,
+  0x06, 0x0D, 0x05, 0x09, 0x0E, 0x02, 0x01, 0x0F, 0x02, 0x09, 0x0F, 0x02,
+  0x01, 0x10, 0x03, 0x08, 0x10, 0x03, 0x02, 0x11, 0x08, 0x03, 0x12, 0x06,
+  0x02, 0x02, 0x02, 0x02, 0x03, 0x02, 0x02, 0x04, 0x02, 0x02, 0x05, 0x02,
+  0x00, 0x06, 0x06, 0x00, 0x07, 0x06, 0x02, 0x08, 0x02, 0x02, 0x09, 0x02,
+  0x02, 0x0A, 0x02, 0x02, 0x0B, 0x02, 0x02, 0x0C, 0x02, 0x02, 0x0D, 0x02,
+  0x02, 0x0E, 0x02, 0x02, 0x0F, 0x02, 0x02, 0x10, 0x02, 0x02, 0x11, 0x04,
+  0x03, 0x12, 0x03, 0x02, 0x06, 0x02, 0x0B, 0x06, 0x02, 0x02, 0x07, 0x02,
+  0x0B, 0x07, 0x02, 0x02, 0x08, 0x02, 0x0B, 0x08, 0x02, 0x02, 0x09, 0x02,
+  0x0B, 0x09, 0x02, 0x02, 0x0A, 0x02, 0x0B, 0x0A, 0x02, 0x02, 0x0B, 0x02,
+  0x0B, 0x0B, 0x02, 0x02, 0x0C, 0x02, 0x0B, 0x0C, 0x02, 0x02, 0x0D, 0x02,
+  0x0B, 0x0D, 0x02, 0x02, 0x0E, 0x02, 0x0B, 0x0E, 0x02, 0x02, 0x0F, 0x02,
+  0x0A, 0x0F, 0x03, 0x02, 0x10, 0x03, 0x09, 0x10, 0x04, 0x03, 0x11, 0x07,
+  0x0B, 0x11, 0x02, 0x04, 0x12, 0x05, 0x0B, 0x12, 0x02, 0x00, 0x06, 0x02,
+  0x09, 0x06, 0x02, 0x00, 0x07, 0x02, 0x09, 0x07, 0x02, 0x01, 0x08, 0x02,
+  0x08, 0x08, 0x02, 0x01, 0x09, 0x02, 0x08, 0x09, 0x02, 0x01, 0x0A, 0x02,
+  0x08, 0x0A, 0x02, 0x02, 0x0B, 0x02, 0x07, 0x0B, 0x02, 0x02, 0x0C, 0x02,
+  0x07, 0x0C, 0x02, 0x02, 0x0D, 0x02, 0x07, 0x0D, 0x02, 0x03, 0x0E, 0x02,
+  0x06, 0x0E, 0x02, 0x03, 0x0F, 0x02, 0x06, 0x0F, 0x02, 0x03, 0x10, 0x05,
+  0x04, 0x11, 0x03, 0x04, 0x12, 0x03, 0x00, 0x06, 0x02, 0x07, 0x06, 0x03,
+  0x0F, 0x06, 0x02, 0x00, 0x07, 0x02, 0x07, 0x07, 0x03, 0x0F, 0x07, 0x02,
+  0x00, 0x08, 0x02, 0x07, 0x08, 0x01, 0x09, 0x08, 0x01, 0x0F, 0x08, 0x02,
+  0x01, 0x09, 0x02, 0x06, 0x09, 0x02, 0x09, 0x09, 0x02, 0x0E, 0x09, 0x02,
+  0x01, 0x0A, 0x02, 0x06, 0x0A, 0x02, 0x09, 0x0A, 0x02, 0x0E, 0x0A, 0x02,
+  0x01, 0x0B, 0x02, 0x06, 0x0B, 0x02, 0x09, 0x0B, 0x02, 0x0E, 0x0B, 0x02,
+  0x01, 0x0C, 0x02, 0x06, 0x0C, 0x01, 0x0A, 0x0C, 0x01, 0x0E, 0x0C, 0x02,
+  0x02, 0x0D, 0x02, 0x05, 0x0D, 0x02, 0x0A, 0x0D, 0x02, 0x0D, 0x0D, 0x02,
+  0x02, 0x0E, 0x02, 0x05, 0x0E, 0x02, 0x0A, 0x0E, 0x02, 0x0D, 0x0E, 0x02,
+  0x02, 0x0F, 0x02, 0x05, 0x0F, 0x02, 0x0A, 0x0F, 0x02, 0x0D, 0x0F, 0x02,
+  0x03, 0x10, 0x03, 0x0B, 0x10, 0x03, 0x03, 0x11, 0x03, 0x0B, 0x11, 0x03,
+  0x03, 0x12, 0x03, 0x0B, 0x12, 0x03, 0x01, 0x06, 0x02, 0x0A, 0x06, 0x02,
+  0x01, 0x07, 0x03, 0x09, 0x07, 0x03, 0x02, 0x08, 0x02, 0x09, 0x08, 0x02,
+  0x03, 0x09, 0x02, 0x08, 0x09, 0x02, 0x03, 0x0A, 0x03, 0x07, 0x0A, 0x03,
+  0x04, 0x0B, 0x05, 0x05, 0x0C, 0x03, 0x04, 0x0D, 0x05, 0x03, 0x0E, 0x03,
+  0x07, 0x0E, 0x03, 0x03, 0x0F, 0x02, 0x08, 0x0F, 0x02, 0x02, 0x10, 0x02,
+  0x09, 0x10, 0x02, 0x01, 0x11, 0x03, 0x09, 0x11, 0x03, 0x01, 0x12, 0x02,
+  0x0A, 0x12, 0x02, 0x00, 0x06, 0x03, 0x0A, 0x06, 0x03, 0x01, 0x07, 0x02,
+  0x0A, 0x07, 0x02, 0x01, 0x08, 0x02, 0x0A, 0x08, 0x02, 0x02, 0x09, 0x02,
+  0x09, 0x09, 0x02, 0x02, 0x0A, 0x02, 0x09, 0x0A, 0x02, 0x02, 0x0B, 0x02,
+  0x09, 0x0B, 0x02, 0x03, 0x0C, 0x02, 0x08, 0x0C, 0x02, 0x03, 0x0D, 0x02,
+  0x08, 0x0D, 0x02, 0x03, 0x0E, 0x02, 0x08, 0x0E, 0x02, 0x04, 0x0F, 0x02,
+  0x07, 0x0F, 0x02, 0x04, 0x10, 0x02, 0x07, 0x10, 0x02, 0x04, 0x11, 0x02,
+  0x07, 0x11, 0x02, 0x05, 0x12, 0x03, 0x05, 0x13, 0x03, 0x05, 0x14, 0x03,
+  0x05, 0x15, 0x02, 0x04, 0x16, 0x03, 0x01, 0x17, 0x05, 0x01, 0x18, 0x04,
+  0x01, 0x06, 0x0A, 0x01, 0x07, 0x0A, 0x08, 0x08, 0x03, 0x07, 0x09, 0x03,
+  0x06, 0x0A, 0x03, 0x05, 0x0B, 0x03, 0x05, 0x0C, 0x02, 0x04, 0x0D, 0x03,
+  0x03, 0x0E, 0x03, 0x02, 0x0F, 0x03, 0x01, 0x10, 0x03, 0x01, 0x11, 0x0A,
+  0x01, 0x12, 0x0A, 0x07, 0x00, 0x04, 0x06, 0x01, 0x03, 0x06, 0x02, 0x02,
+  0x06, 0x03, 0x02, 0x06, 0x04, 0x02, 0x06, 0x05, 0x02, 0x06, 0x06, 0x02,
+  0x06, 0x07, 0x02, 0x06, 0x08, 0x02, 0x06, 0x09, 0x02, 0x06, 0x0A, 0x02,
+  0x05, 0x0B, 0x02, 0x03, 0x0C, 0x03, 0x05, 0x0D, 0x02, 0x06, 0x0E, 0x02,
+  0x06, 0x0F, 0x02, 0x06, 0x10, 0x02, 0x06, 0x11, 0x02, 0x06, 0x12, 0x02,
+  0x06, 0x13, 0x02, 0x06, 0x14, 0x02, 0x06, 0x15, 0x02, 0x06, 0x16, 0x02,
+  0x06, 0x17, 0x03, 0x07, 0x18, 0x04, 0x05, 0x00, 0x02, 0x05, 0x01, 0x02,
+  0x05, 0x02, 0x02, 0x05, 0x03, 0x02, 0x05, 0x04, 0x02, 0x05, 0x05, 0x02,
+  0x05, 0x06, 0x02, 0x05, 0x07, 0x02, 0x05, 0x08, 0x02, 0x05, 0x09, 0x02,
+  0x05, 0x0A, 0x02, 0x05, 0x0B, 0x02, 0x05, 0x0C, 0x02, 0x05, 0x0D, 0x02,
+  0x05, 0x0E, 0x02, 0x05, 0x0F, 0x02, 0x05, 0x10, 0x02, 0x05, 0x11, 0x02,
+  0x05, 0x12, 0x02, 0x05, 0x13, 0x02, 0x05, 0x14, 0x02, 0x05, 0x15, 0x02,
+  0x05, 0x16, 0x02, 0x05, 0x17, 0x02, 0x05, 0x18, 0x02, 0x02, 0x00, 0x04,
+  0x04, 0x01, 0x03, 0x05, 0x02, 0x02, 0x05, 0x03, 0x02, 0x05, 0x04, 0x02,
+  0x05, 0x05, 0x02, 0x05, 0x06, 0x02, 0x05, 0x07, 0x02, 0x05, 0x08, 0x02,
+  0x05, 0x09, 0x02, 0x05, 0x0A, 0x02, 0x06, 0x0B, 0x02, 0x07, 0x0C, 0x03,
+  0x06, 0x0D, 0x02, 0x05, 0x0E, 0x02, 0x05, 0x0F, 0x02, 0x05, 0x10, 0x02,
+  0x05, 0x11, 0x02, 0x05, 0x12, 0x02, 0x05, 0x13, 0x02, 0x05, 0x14, 0x02,
+  0x05, 0x15, 0x02, 0x05, 0x16, 0x02, 0x04, 0x17, 0x03, 0x02, 0x18, 0x04,
+  0x03, 0x01, 0x04, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x01, 0x03, 0x02,
+  0x07, 0x03, 0x03, 0x0E, 0x03, 0x01, 0x01, 0x04, 0x01, 0x09, 0x04, 0x02,
+  0x0D, 0x04, 0x02, 0x01, 0x05, 0x01, 0x0A, 0x05, 0x04,
+};
+
+// Character c has spans spanidx_f32[c - 32] to spanidx_f32[c - 31] - 1
+PROGMEM const unsigned short spanidx_f32[97] =
+{
+      0,     0,    16,    30,    62,    94,   140,   174,
+    180,   204,   228,   243,   251,   258,   260,   263,
+    283,   313,   330,   351,   375,   399,   422,   450,
+    467,   495,   523,   529,   539,   548,   552,   561,
+    581,   640,   671,   701,   728,   760,   778,   796,
+    827,   861,   879,   901,   936,   954,  1015,  1061,
+   1093,  1117,  1153,  1185,  1211,  1229,  1263,  1296,
+   1359,  1392,  1418,  1436,  1459,  1484,  1507,  1516,
+   1517,  1529,  1550,  1581,  1599,  1630,  1648,  1666,
+   1701,  1732,  1748,  1770,  1798,  1816,  1855,  1881,
+   1903,  1934,  1965,  1979,  1996,  2013,  2039,  2062,
+   2106,  2129,  2160,  2173,  2198,  2223,  2248,  2259,
+   2259,
+};
@@ -0,0 +1,205 @@
+// Font 6 as horizontal spans, used if SPAN_FONTS is defined
+//
+// Generated from Font64rle.c by Tools/Host/Span_font_compiler.cpp, do not edit
+
+// Foreground spans as x, y, length in row order
+PROGMEM const unsigned char spans_f64[2139] =
+{
+  0x03, 0x13, 0x0B, 0x03, 0x14, 0x0B, 0x03, 0x15, 0x0B, 0x03, 0x16, 0x0B,
+  0x05, 0x1F, 0x05, 0x05, 0x20, 0x05, 0x05, 0x21, 0x05, 0x05, 0x22, 0x05,
+  0x05, 0x23, 0x05, 0x09, 0x01, 0x08, 0x06, 0x02, 0x0E, 0x05, 0x03, 0x10,
+  0x04, 0x04, 0x12, 0x03, 0x05, 0x07, 0x10, 0x05, 0x07, 0x03, 0x06, 0x05,
+  0x12, 0x06, 0x05, 0x03, 0x07, 0x04, 0x13, 0x07, 0x04, 0x02, 0x08, 0x05,
+  0x13, 0x08, 0x05, 0x02, 0x09, 0x04, 0x14, 0x09, 0x04, 0x02, 0x0A, 0x04,
+  0x14, 0x0A, 0x04, 0x02, 0x0B, 0x04, 0x14, 0x0B, 0x04, 0x01, 0x0C, 0x04,
+  0x15, 0x0C, 0x04, 0x01, 0x0D, 0x04, 0x15, 0x0D, 0x04, 0x01, 0x0E, 0x04,
+  0x15, 0x0E, 0x04, 0x01, 0x0F, 0x04, 0x15, 0x0F, 0x04, 0x01, 0x10, 0x04,
+  0x15, 0x10, 0x04, 0x01, 0x11, 0x04, 0x15, 0x11, 0x04, 0x01, 0x12, 0x04,
+  0x15, 0x12, 0x04, 0x01, 0x13, 0x04, 0x15, 0x13, 0x04, 0x01, 0x14, 0x04,
+  0x15, 0x14, 0x04, 0x01, 0x15, 0x04, 0x15, 0x15, 0x04, 0x01, 0x16, 0x04,
+  0x15, 0x16, 0x04, 0x01, 0x17, 0x04, 0x15, 0x17, 0x04, 0x01, 0x18, 0x04,
+  0x15, 0x18, 0x04, 0x01, 0x19, 0x04, 0x15, 0x19, 0x04, 0x02, 0x1A, 0x04,
+  0x14, 0x1A, 0x04, 0x02, 0x1B, 0x04, 0x14, 0x1B, 0x04, 0x02, 0x1C, 0x04,
+  0x14, 0x1C, 0x04, 0x02, 0x1D, 0x05, 0x13, 0x1D, 0x05, 0x03, 0x1E, 0x04,
+  0x13, 0x1E, 0x04, 0x03, 0x1F, 0x05, 0x12, 0x1F, 0x05, 0x03, 0x20, 0x07,
+  0x10, 0x20, 0x07, 0x04, 0x21, 0x12, 0x05, 0x22, 0x10, 0x06, 0x23, 0x0E,
+  0x09, 0x24, 0x08, 0x0F, 0x01, 0x03, 0x0F, 0x02, 0x03, 0x0E, 0x03, 0x04,
+  0x0E, 0x04, 0x04, 0x0D, 0x05, 0x05, 0x0C, 0x06, 0x06, 0x0A, 0x07, 0x08,
+  0x05, 0x08, 0x0D, 0x05, 0x09, 0x0D, 0x05, 0x0A, 0x08, 0x0E, 0x0A, 0x04,
+  0x05, 0x0B, 0x05, 0x0E, 0x0B, 0x04, 0x0E, 0x0C, 0x04, 0x0E, 0x0D, 0x04,
+  0x0E, 0x0E, 0x04, 0x0E, 0x0F, 0x04, 0x0E, 0x10, 0x04, 0x0E, 0x11, 0x04,
+  0x0E, 0x12, 0x04, 0x0E, 0x13, 0x04, 0x0E, 0x14, 0x04, 0x0E, 0x15, 0x04,
+  0x0E, 0x16, 0x04, 0x0E, 0x17, 0x04, 0x0E, 0x18, 0x04, 0x0E, 0x19, 0x04,
+  0x0E, 0x1A, 0x04, 0x0E, 0x1B, 0x04, 0x0E, 0x1C, 0x04, 0x0E, 0x1D, 0x04,
+  0x0E, 0x1E, 0x04, 0x0E, 0x1F, 0x04, 0x0E, 0x20, 0x04, 0x0E, 0x21, 0x04,
+  0x0E, 0x22, 0x04, 0x0E, 0x23, 0x04, 0x0A, 0x01, 0x08, 0x08, 0x02, 0x0D,
+  0x06, 0x03, 0x10, 0x05, 0x04, 0x12, 0x05, 0x05, 0x06, 0x11, 0x05, 0x07,
+  0x04, 0x06, 0x05, 0x13, 0x06, 0x05, 0x04, 0x07, 0x05, 0x14, 0x07, 0x04,
+  0x04, 0x08, 0x04, 0x14, 0x08, 0x05, 0x03, 0x09, 0x05, 0x15, 0x09, 0x04,
+  0x03, 0x0A, 0x04, 0x15, 0x0A, 0x04, 0x03, 0x0B, 0x04, 0x15, 0x0B, 0x04,
+  0x03, 0x0C, 0x04, 0x15, 0x0C, 0x04, 0x15, 0x0D, 0x04, 0x14, 0x0E, 0x05,
+  0x14, 0x0F, 0x05, 0x13, 0x10, 0x05, 0x12, 0x11, 0x06, 0x11, 0x12, 0x06,
+  0x0F, 0x13, 0x07, 0x0D, 0x14, 0x08, 0x0B, 0x15, 0x09, 0x0A, 0x16, 0x09,
+  0x08, 0x17, 0x09, 0x07, 0x18, 0x08, 0x06, 0x19, 0x07, 0x05, 0x1A, 0x06,
+  0x04, 0x1B, 0x06, 0x04, 0x1C, 0x05, 0x03, 0x1D, 0x05, 0x03, 0x1E, 0x04,
+  0x03, 0x1F, 0x04, 0x02, 0x20, 0x17, 0x02, 0x21, 0x17, 0x02, 0x22, 0x17,
+  0x02, 0x23, 0x17, 0x09, 0x01, 0x08, 0x06, 0x02, 0x0E, 0x05, 0x03, 0x11,
+  0x04, 0x04, 0x12, 0x03, 0x05, 0x07, 0x10, 0x05, 0x07, 0x03, 0x06, 0x05,
+  0x12, 0x06, 0x05, 0x02, 0x07, 0x05, 0x13, 0x07, 0x05, 0x02, 0x08, 0x05,
+  0x13, 0x08, 0x05, 0x02, 0x09, 0x04, 0x14, 0x09, 0x04, 0x02, 0x0A, 0x04,
+  0x14, 0x0A, 0x04, 0x02, 0x0B, 0x04, 0x14, 0x0B, 0x04, 0x13, 0x0C, 0x05,
+  0x13, 0x0D, 0x05, 0x12, 0x0E, 0x05, 0x11, 0x0F, 0x06, 0x0A, 0x10, 0x0C,
+  0x0A, 0x11, 0x0A, 0x0A, 0x12, 0x0C, 0x0A, 0x13, 0x0D, 0x11, 0x14, 0x07,
+  0x13, 0x15, 0x05, 0x14, 0x16, 0x05, 0x14, 0x17, 0x05, 0x01, 0x18, 0x04,
+  0x15, 0x18, 0x04, 0x01, 0x19, 0x04, 0x15, 0x19, 0x04, 0x01, 0x1A, 0x04,
+  0x15, 0x1A, 0x04, 0x01, 0x1B, 0x05, 0x14, 0x1B, 0x05, 0x01, 0x1C, 0x05,
+  0x13, 0x1C, 0x06, 0x02, 0x1D, 0x05, 0x13, 0x1D, 0x05, 0x02, 0x1E, 0x06,
+  0x12, 0x1E, 0x06, 0x03, 0x1F, 0x07, 0x10, 0x1F, 0x07, 0x04, 0x20, 0x12,
+  0x05, 0x21, 0x10, 0x06, 0x22, 0x0E, 0x09, 0x23, 0x08, 0x10, 0x02, 0x04,
+  0x0F, 0x03, 0x05, 0x0E, 0x04, 0x06, 0x0D, 0x05, 0x07, 0x0D, 0x06, 0x07,
+  0x0C, 0x07, 0x08, 0x0B, 0x08, 0x04, 0x10, 0x08, 0x04, 0x0B, 0x09, 0x04,
+  0x10, 0x09, 0x04, 0x0A, 0x0A, 0x04, 0x10, 0x0A, 0x04, 0x09, 0x0B, 0x04,
+  0x10, 0x0B, 0x04, 0x08, 0x0C, 0x05, 0x10, 0x0C, 0x04, 0x08, 0x0D, 0x04,
+  0x10, 0x0D, 0x04, 0x07, 0x0E, 0x04, 0x10, 0x0E, 0x04, 0x06, 0x0F, 0x04,
+  0x10, 0x0F, 0x04, 0x05, 0x10, 0x05, 0x10, 0x10, 0x04, 0x05, 0x11, 0x04,
+  0x10, 0x11, 0x04, 0x04, 0x12, 0x04, 0x10, 0x12, 0x04, 0x03, 0x13, 0x05,
+  0x10, 0x13, 0x04, 0x03, 0x14, 0x04, 0x10, 0x14, 0x04, 0x02, 0x15, 0x04,
+  0x10, 0x15, 0x04, 0x01, 0x16, 0x04, 0x10, 0x16, 0x04, 0x01, 0x17, 0x18,
+  0x01, 0x18, 0x18, 0x01, 0x19, 0x18, 0x01, 0x1A, 0x18, 0x10, 0x1B, 0x04,
+  0x10, 0x1C, 0x04, 0x10, 0x1D, 0x04, 0x10, 0x1E, 0x04, 0x10, 0x1F, 0x04,
+  0x10, 0x20, 0x04, 0x10, 0x21, 0x04, 0x10, 0x22, 0x04, 0x10, 0x23, 0x04,
+  0x05, 0x02, 0x12, 0x05, 0x03, 0x12, 0x05, 0x04, 0x12, 0x05, 0x05, 0x12,
+  0x05, 0x06, 0x03, 0x04, 0x07, 0x04, 0x04, 0x08, 0x04, 0x04, 0x09, 0x04,
+  0x04, 0x0A, 0x03, 0x04, 0x0B, 0x03, 0x04, 0x0C, 0x03, 0x03, 0x0D, 0x04,
+  0x0A, 0x0D, 0x08, 0x03, 0x0E, 0x04, 0x08, 0x0E, 0x0C, 0x03, 0x0F, 0x12,
+  0x03, 0x10, 0x13, 0x03, 0x11, 0x07, 0x10, 0x11, 0x07, 0x03, 0x12, 0x05,
+  0x12, 0x12, 0x06, 0x03, 0x13, 0x04, 0x13, 0x13, 0x05, 0x14, 0x14, 0x04,
+  0x14, 0x15, 0x05, 0x15, 0x16, 0x04, 0x15, 0x17, 0x04, 0x15, 0x18, 0x04,
+  0x15, 0x19, 0x04, 0x15, 0x1A, 0x04, 0x02, 0x1B, 0x04, 0x15, 0x1B, 0x04,
+  0x02, 0x1C, 0x04, 0x14, 0x1C, 0x05, 0x02, 0x1D, 0x04, 0x14, 0x1D, 0x04,
+  0x02, 0x1E, 0x05, 0x13, 0x1E, 0x05, 0x03, 0x1F, 0x05, 0x12, 0x1F, 0x06,
+  0x03, 0x20, 0x07, 0x10, 0x20, 0x07, 0x04, 0x21, 0x12, 0x05, 0x22, 0x10,
+  0x06, 0x23, 0x0E, 0x09, 0x24, 0x08, 0x0A, 0x01, 0x07, 0x08, 0x02, 0x0C,
+  0x06, 0x03, 0x0F, 0x05, 0x04, 0x11, 0x04, 0x05, 0x07, 0x11, 0x05, 0x06,
+  0x03, 0x06, 0x06, 0x13, 0x06, 0x05, 0x03, 0x07, 0x05, 0x14, 0x07, 0x04,
+  0x03, 0x08, 0x04, 0x14, 0x08, 0x05, 0x02, 0x09, 0x05, 0x15, 0x09, 0x04,
+  0x02, 0x0A, 0x04, 0x15, 0x0A, 0x04, 0x02, 0x0B, 0x04, 0x02, 0x0C, 0x04,
+  0x01, 0x0D, 0x04, 0x01, 0x0E, 0x04, 0x0A, 0x0E, 0x07, 0x01, 0x0F, 0x04,
+  0x08, 0x0F, 0x0C, 0x01, 0x10, 0x04, 0x06, 0x10, 0x0F, 0x01, 0x11, 0x15,
+  0x01, 0x12, 0x09, 0x10, 0x12, 0x07, 0x01, 0x13, 0x07, 0x12, 0x13, 0x05,
+  0x01, 0x14, 0x06, 0x13, 0x14, 0x05, 0x01, 0x15, 0x05, 0x14, 0x15, 0x04,
+  0x01, 0x16, 0x05, 0x14, 0x16, 0x05, 0x01, 0x17, 0x04, 0x15, 0x17, 0x04,
+  0x01, 0x18, 0x04, 0x15, 0x18, 0x04, 0x01, 0x19, 0x04, 0x15, 0x19, 0x04,
+  0x01, 0x1A, 0x04, 0x15, 0x1A, 0x04, 0x01, 0x1B, 0x04, 0x15, 0x1B, 0x04,
+  0x02, 0x1C, 0x04, 0x14, 0x1C, 0x05, 0x02, 0x1D, 0x04, 0x14, 0x1D, 0x04,
+  0x02, 0x1E, 0x05, 0x13, 0x1E, 0x05, 0x03, 0x1F, 0x05, 0x12, 0x1F, 0x06,
+  0x03, 0x20, 0x07, 0x10, 0x20, 0x07, 0x04, 0x21, 0x12, 0x05, 0x22, 0x10,
+  0x07, 0x23, 0x0D, 0x09, 0x24, 0x09, 0x02, 0x02, 0x17, 0x02, 0x03, 0x17,
+  0x02, 0x04, 0x17, 0x02, 0x05, 0x17, 0x15, 0x06, 0x04, 0x14, 0x07, 0x04,
+  0x13, 0x08, 0x04, 0x12, 0x09, 0x04, 0x11, 0x0A, 0x05, 0x10, 0x0B, 0x05,
+  0x0F, 0x0C, 0x05, 0x0F, 0x0D, 0x04, 0x0E, 0x0E, 0x05, 0x0D, 0x0F, 0x05,
+  0x0D, 0x10, 0x05, 0x0C, 0x11, 0x05, 0x0C, 0x12, 0x04, 0x0B, 0x13, 0x05,
+  0x0B, 0x14, 0x04, 0x0A, 0x15, 0x05, 0x0A, 0x16, 0x05, 0x0A, 0x17, 0x04,
+  0x09, 0x18, 0x05, 0x09, 0x19, 0x04, 0x09, 0x1A, 0x04, 0x08, 0x1B, 0x05,
+  0x08, 0x1C, 0x04, 0x08, 0x1D, 0x04, 0x08, 0x1E, 0x04, 0x08, 0x1F, 0x04,
+  0x07, 0x20, 0x05, 0x07, 0x21, 0x04, 0x07, 0x22, 0x04, 0x07, 0x23, 0x04,
+  0x0A, 0x01, 0x06, 0x07, 0x02, 0x0C, 0x05, 0x03, 0x10, 0x04, 0x04, 0x12,
+  0x03, 0x05, 0x07, 0x10, 0x05, 0x07, 0x03, 0x06, 0x05, 0x12, 0x06, 0x05,
+  0x02, 0x07, 0x05, 0x13, 0x07, 0x05, 0x02, 0x08, 0x05, 0x13, 0x08, 0x05,
+  0x02, 0x09, 0x04, 0x14, 0x09, 0x04, 0x02, 0x0A, 0x04, 0x14, 0x0A, 0x04,
+  0x02, 0x0B, 0x04, 0x14, 0x0B, 0x04, 0x02, 0x0C, 0x05, 0x13, 0x0C, 0x05,
+  0x03, 0x0D, 0x04, 0x13, 0x0D, 0x04, 0x03, 0x0E, 0x05, 0x12, 0x0E, 0x05,
+  0x04, 0x0F, 0x06, 0x10, 0x0F, 0x06, 0x05, 0x10, 0x10, 0x06, 0x11, 0x0E,
+  0x05, 0x12, 0x10, 0x04, 0x13, 0x12, 0x03, 0x14, 0x06, 0x11, 0x14, 0x06,
+  0x02, 0x15, 0x05, 0x13, 0x15, 0x05, 0x02, 0x16, 0x04, 0x14, 0x16, 0x04,
+  0x01, 0x17, 0x05, 0x14, 0x17, 0x05, 0x01, 0x18, 0x04, 0x15, 0x18, 0x04,
+  0x01, 0x19, 0x04, 0x15, 0x19, 0x04, 0x01, 0x1A, 0x04, 0x15, 0x1A, 0x04,
+  0x01, 0x1B, 0x04, 0x15, 0x1B, 0x04, 0x01, 0x1C, 0x04, 0x15, 0x1C, 0x04,
+  0x01, 0x1D, 0x05, 0x14, 0x1D, 0x05, 0x01, 0x1E, 0x05, 0x14, 0x1E, 0x05,
+  0x02, 0x1F, 0x05, 0x13, 0x1F, 0x05, 0x02, 0x20, 0x07, 0x11, 0x20, 0x07,
+  0x03, 0x21, 0x14, 0x04, 0x22, 0x12, 0x05, 0x23, 0x10, 0x08, 0x24, 0x0A,
+  0x08, 0x01, 0x09, 0x06, 0x02, 0x0D, 0x05, 0x03, 0x10, 0x04, 0x04, 0x12,
+  0x03, 0x05, 0x07, 0x10, 0x05, 0x07, 0x02, 0x06, 0x06, 0x12, 0x06, 0x05,
+  0x02, 0x07, 0x05, 0x13, 0x07, 0x05, 0x02, 0x08, 0x04, 0x14, 0x08, 0x04,
+  0x01, 0x09, 0x05, 0x14, 0x09, 0x04, 0x01, 0x0A, 0x04, 0x15, 0x0A, 0x04,
+  0x01, 0x0B, 0x04, 0x15, 0x0B, 0x04, 0x01, 0x0C, 0x04, 0x15, 0x0C, 0x04,
+  0x01, 0x0D, 0x04, 0x15, 0x0D, 0x04, 0x01, 0x0E, 0x04, 0x15, 0x0E, 0x04,
+  0x01, 0x0F, 0x05, 0x14, 0x0F, 0x05, 0x02, 0x10, 0x04, 0x14, 0x10, 0x05,
+  0x02, 0x11, 0x05, 0x13, 0x11, 0x06, 0x03, 0x12, 0x05, 0x12, 0x12, 0x07,
+  0x03, 0x13, 0x07, 0x10, 0x13, 0x09, 0x04, 0x14, 0x15, 0x05, 0x15, 0x0F,
+  0x15, 0x15, 0x04, 0x06, 0x16, 0x0C, 0x15, 0x16, 0x04, 0x09, 0x17, 0x07,
+  0x15, 0x17, 0x04, 0x15, 0x18, 0x04, 0x14, 0x19, 0x04, 0x14, 0x1A, 0x04,
+  0x01, 0x1B, 0x04, 0x14, 0x1B, 0x04, 0x01, 0x1C, 0x04, 0x13, 0x1C, 0x05,
+  0x01, 0x1D, 0x05, 0x13, 0x1D, 0x04, 0x02, 0x1E, 0x04, 0x12, 0x1E, 0x05,
+  0x02, 0x1F, 0x05, 0x11, 0x1F, 0x06, 0x03, 0x20, 0x06, 0x0F, 0x20, 0x07,
+  0x04, 0x21, 0x11, 0x05, 0x22, 0x0F, 0x06, 0x23, 0x0C, 0x09, 0x24, 0x07,
+  0x05, 0x0A, 0x05, 0x05, 0x0B, 0x05, 0x05, 0x0C, 0x05, 0x05, 0x0D, 0x05,
+  0x05, 0x0E, 0x05, 0x05, 0x1B, 0x05, 0x05, 0x1C, 0x05, 0x05, 0x1D, 0x05,
+  0x05, 0x1E, 0x05, 0x05, 0x1F, 0x05, 0x09, 0x09, 0x09, 0x07, 0x0A, 0x0E,
+  0x05, 0x0B, 0x11, 0x05, 0x0C, 0x12, 0x04, 0x0D, 0x06, 0x11, 0x0D, 0x06,
+  0x03, 0x0E, 0x05, 0x13, 0x0E, 0x05, 0x03, 0x0F, 0x04, 0x14, 0x0F, 0x04,
+  0x03, 0x10, 0x04, 0x14, 0x10, 0x04, 0x03, 0x11, 0x04, 0x14, 0x11, 0x04,
+  0x14, 0x12, 0x04, 0x13, 0x13, 0x05, 0x0C, 0x14, 0x0C, 0x07, 0x15, 0x11,
+  0x05, 0x16, 0x13, 0x04, 0x17, 0x0E, 0x14, 0x17, 0x04, 0x03, 0x18, 0x09,
+  0x14, 0x18, 0x04, 0x03, 0x19, 0x05, 0x14, 0x19, 0x04, 0x02, 0x1A, 0x05,
+  0x14, 0x1A, 0x04, 0x02, 0x1B, 0x04, 0x14, 0x1B, 0x04, 0x02, 0x1C, 0x04,
+  0x14, 0x1C, 0x04, 0x02, 0x1D, 0x04, 0x13, 0x1D, 0x05, 0x02, 0x1E, 0x04,
+  0x12, 0x1E, 0x06, 0x02, 0x1F, 0x05, 0x11, 0x1F, 0x07, 0x03, 0x20, 0x05,
+  0x0F, 0x20, 0x0B, 0x03, 0x21, 0x10, 0x15, 0x21, 0x05, 0x04, 0x22, 0x0E,
+  0x15, 0x22, 0x05, 0x05, 0x23, 0x0B, 0x16, 0x23, 0x04, 0x07, 0x24, 0x07,
+  0x0C, 0x09, 0x07, 0x1B, 0x09, 0x07, 0x03, 0x0A, 0x04, 0x0A, 0x0A, 0x0A,
+  0x19, 0x0A, 0x0B, 0x03, 0x0B, 0x04, 0x08, 0x0B, 0x0D, 0x18, 0x0B, 0x0D,
+  0x03, 0x0C, 0x04, 0x08, 0x0C, 0x0E, 0x17, 0x0C, 0x0F, 0x03, 0x0D, 0x08,
+  0x11, 0x0D, 0x0A, 0x21, 0x0D, 0x05, 0x03, 0x0E, 0x06, 0x12, 0x0E, 0x07,
+  0x22, 0x0E, 0x05, 0x03, 0x0F, 0x05, 0x13, 0x0F, 0x05, 0x23, 0x0F, 0x04,
+  0x03, 0x10, 0x05, 0x13, 0x10, 0x05, 0x23, 0x10, 0x04, 0x03, 0x11, 0x04,
+  0x13, 0x11, 0x04, 0x23, 0x11, 0x04, 0x03, 0x12, 0x04, 0x13, 0x12, 0x04,
+  0x23, 0x12, 0x04, 0x03, 0x13, 0x04, 0x13, 0x13, 0x04, 0x23, 0x13, 0x04,
+  0x03, 0x14, 0x04, 0x13, 0x14, 0x04, 0x23, 0x14, 0x04, 0x03, 0x15, 0x04,
+  0x13, 0x15, 0x04, 0x23, 0x15, 0x04, 0x03, 0x16, 0x04, 0x13, 0x16, 0x04,
+  0x23, 0x16, 0x04, 0x03, 0x17, 0x04, 0x13, 0x17, 0x04, 0x23, 0x17, 0x04,
+  0x03, 0x18, 0x04, 0x13, 0x18, 0x04, 0x23, 0x18, 0x04, 0x03, 0x19, 0x04,
+  0x13, 0x19, 0x04, 0x23, 0x19, 0x04, 0x03, 0x1A, 0x04, 0x13, 0x1A, 0x04,
+  0x23, 0x1A, 0x04, 0x03, 0x1B, 0x04, 0x13, 0x1B, 0x04, 0x23, 0x1B, 0x04,
+  0x03, 0x1C, 0x04, 0x13, 0x1C, 0x04, 0x23, 0x1C, 0x04, 0x03, 0x1D, 0x04,
+  0x13, 0x1D, 0x04, 0x23, 0x1D, 0x04, 0x03, 0x1E, 0x04, 0x13, 0x1E, 0x04,
+  0x23, 0x1E, 0x04, 0x03, 0x1F, 0x04, 0x13, 0x1F, 0x04, 0x23, 0x1F, 0x04,
+  0x03, 0x20, 0x04, 0x13, 0x20, 0x04, 0x23, 0x20, 0x04, 0x03, 0x21, 0x04,
+  0x13, 0x21, 0x04, 0x23, 0x21, 0x04, 0x03, 0x22, 0x04, 0x13, 0x22, 0x04,
+  0x23, 0x22, 0x04, 0x03, 0x23, 0x04, 0x13, 0x23, 0x04, 0x23, 0x23, 0x04,
+  0x0C, 0x09, 0x07, 0x03, 0x0A, 0x04, 0x0A, 0x0A, 0x0C, 0x03, 0x0B, 0x04,
+  0x09, 0x0B, 0x0E, 0x03, 0x0C, 0x04, 0x08, 0x0C, 0x10, 0x03, 0x0D, 0x09,
+  0x12, 0x0D, 0x07, 0x03, 0x0E, 0x07, 0x14, 0x0E, 0x05, 0x03, 0x0F, 0x06,
+  0x15, 0x0F, 0x05, 0x03, 0x10, 0x05, 0x16, 0x10, 0x04, 0x03, 0x11, 0x05,
+  0x16, 0x11, 0x04, 0x03, 0x12, 0x05, 0x16, 0x12, 0x05, 0x03, 0x13, 0x04,
+  0x17, 0x13, 0x04, 0x03, 0x14, 0x04, 0x17, 0x14, 0x04, 0x03, 0x15, 0x04,
+  0x17, 0x15, 0x04, 0x03, 0x16, 0x04, 0x17, 0x16, 0x04, 0x03, 0x17, 0x04,
+  0x17, 0x17, 0x04, 0x03, 0x18, 0x04, 0x17, 0x18, 0x04, 0x03, 0x19, 0x04,
+  0x17, 0x19, 0x04, 0x03, 0x1A, 0x04, 0x17, 0x1A, 0x04, 0x03, 0x1B, 0x04,
+  0x16, 0x1B, 0x05, 0x03, 0x1C, 0x05, 0x16, 0x1C, 0x04, 0x03, 0x1D, 0x05,
+  0x15, 0x1D, 0x05, 0x03, 0x1E, 0x06, 0x15, 0x1E, 0x05, 0x03, 0x1F, 0x07,
+  0x14, 0x1F, 0x05, 0x03, 0x20, 0x09, 0x12, 0x20, 0x07, 0x03, 0x21, 0x04,
+  0x08, 0x21, 0x10, 0x03, 0x22, 0x04, 0x09, 0x22, 0x0E, 0x03, 0x23, 0x04,
+  0x0A, 0x23, 0x0C, 0x03, 0x24, 0x04, 0x0C, 0x24, 0x07, 0x03, 0x25, 0x04,
+  0x03, 0x26, 0x04, 0x03, 0x27, 0x04, 0x03, 0x28, 0x04, 0x03, 0x29, 0x04,
+  0x03, 0x2A, 0x04, 0x03, 0x2B, 0x04, 0x03, 0x2C, 0x04, 0x03, 0x2D, 0x04,
+  0x03, 0x2E, 0x04,
+};
+
+// Character c has spans spanidx_f64[c - 32] to spanidx_f64[c - 31] - 1
+PROGMEM const unsigned short spanidx_f64[97] =
+{
+      0,     0,     0,     0,     0,     0,     0,     0,
+      0,     0,     0,     0,     0,     0,     4,     9,
+      9,    73,   110,   153,   203,   252,   298,   358,
+    392,   452,   512,   522,   522,   522,   522,   522,
+    522,   522,   522,   522,   522,   522,   522,   522,
+    522,   522,   522,   522,   522,   522,   522,   522,
+    522,   522,   522,   522,   522,   522,   522,   522,
+    522,   522,   522,   522,   522,   522,   522,   522,
+    522,   522,   568,   568,   568,   568,   568,   568,
+    568,   568,   568,   568,   568,   568,   648,   648,
+    648,   713,   713,   713,   713,   713,   713,   713,
+    713,   713,   713,   713,   713,   713,   713,   713,
+    713,
+};
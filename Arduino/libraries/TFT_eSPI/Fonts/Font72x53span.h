@@ -0,0 +1,281 @@
+// Font 8N as horizontal spans, used if SPAN_FONTS is defined
+//
+// Generated from Font72x53rle.c by Tools/Host/Span_font_compiler.cpp, do not edit
+
+// Foreground spans as x, y, length in row order
+PROGMEM const unsigned char spans_f72[3051] =
+{
+  0x06, 0x25, 0x12, 0x06, 0x26, 0x12, 0x06, 0x27, 0x12, 0x06, 0x28, 0x12,
+  0x06, 0x29, 0x12, 0x06, 0x2A, 0x12, 0x06, 0x2B, 0x12, 0x09, 0x40, 0x09,
+  0x09, 0x41, 0x09, 0x09, 0x42, 0x09, 0x09, 0x43, 0x09, 0x09, 0x44, 0x09,
+  0x09, 0x45, 0x09, 0x09, 0x46, 0x09, 0x09, 0x47, 0x09, 0x09, 0x48, 0x09,
+  0x15, 0x04, 0x0B, 0x12, 0x05, 0x11, 0x10, 0x06, 0x15, 0x0E, 0x07, 0x19,
+  0x0D, 0x08, 0x1B, 0x0C, 0x09, 0x1D, 0x0B, 0x0A, 0x1F, 0x0A, 0x0B, 0x21,
+  0x0A, 0x0C, 0x0D, 0x1E, 0x0C, 0x0D, 0x09, 0x0D, 0x0C, 0x20, 0x0D, 0x0C,
+  0x08, 0x0E, 0x0B, 0x22, 0x0E, 0x0A, 0x08, 0x0F, 0x0A, 0x23, 0x0F, 0x0A,
+  0x08, 0x10, 0x09, 0x24, 0x10, 0x09, 0x07, 0x11, 0x0A, 0x24, 0x11, 0x0A,
+  0x07, 0x12, 0x09, 0x25, 0x12, 0x09, 0x06, 0x13, 0x0A, 0x25, 0x13, 0x09,
+  0x06, 0x14, 0x09, 0x26, 0x14, 0x09, 0x06, 0x15, 0x09, 0x26, 0x15, 0x09,
+  0x06, 0x16, 0x09, 0x26, 0x16, 0x09, 0x05, 0x17, 0x09, 0x27, 0x17, 0x09,
+  0x05, 0x18, 0x09, 0x27, 0x18, 0x09, 0x05, 0x19, 0x09, 0x27, 0x19, 0x09,
+  0x05, 0x1A, 0x09, 0x27, 0x1A, 0x09, 0x05, 0x1B, 0x09, 0x27, 0x1B, 0x09,
+  0x05, 0x1C, 0x09, 0x27, 0x1C, 0x09, 0x04, 0x1D, 0x09, 0x28, 0x1D, 0x09,
+  0x04, 0x1E, 0x09, 0x28, 0x1E, 0x09, 0x04, 0x1F, 0x09, 0x28, 0x1F, 0x09,
+  0x04, 0x20, 0x09, 0x28, 0x20, 0x09, 0x04, 0x21, 0x09, 0x28, 0x21, 0x09,
+  0x04, 0x22, 0x09, 0x28, 0x22, 0x09, 0x04, 0x23, 0x09, 0x28, 0x23, 0x09,
+  0x04, 0x24, 0x09, 0x28, 0x24, 0x09, 0x04, 0x25, 0x09, 0x28, 0x25, 0x09,
+  0x04, 0x26, 0x09, 0x28, 0x26, 0x09, 0x04, 0x27, 0x09, 0x28, 0x27, 0x09,
+  0x04, 0x28, 0x09, 0x28, 0x28, 0x09, 0x04, 0x29, 0x09, 0x28, 0x29, 0x09,
+  0x04, 0x2A, 0x09, 0x28, 0x2A, 0x09, 0x04, 0x2B, 0x09, 0x28, 0x2B, 0x09,
+  0x04, 0x2C, 0x09, 0x28, 0x2C, 0x09, 0x04, 0x2D, 0x09, 0x28, 0x2D, 0x09,
+  0x04, 0x2E, 0x09, 0x28, 0x2E, 0x09, 0x04, 0x2F, 0x09, 0x28, 0x2F, 0x09,
+  0x04, 0x30, 0x09, 0x28, 0x30, 0x09, 0x05, 0x31, 0x09, 0x27, 0x31, 0x09,
+  0x05, 0x32, 0x09, 0x27, 0x32, 0x09, 0x05, 0x33, 0x09, 0x27, 0x33, 0x09,
+  0x05, 0x34, 0x09, 0x27, 0x34, 0x09, 0x05, 0x35, 0x09, 0x27, 0x35, 0x09,
+  0x05, 0x36, 0x09, 0x27, 0x36, 0x09, 0x06, 0x37, 0x09, 0x26, 0x37, 0x09,
+  0x06, 0x38, 0x09, 0x26, 0x38, 0x09, 0x06, 0x39, 0x09, 0x26, 0x39, 0x09,
+  0x06, 0x3A, 0x0A, 0x25, 0x3A, 0x0A, 0x07, 0x3B, 0x09, 0x25, 0x3B, 0x09,
+  0x07, 0x3C, 0x0A, 0x24, 0x3C, 0x0A, 0x08, 0x3D, 0x09, 0x24, 0x3D, 0x09,
+  0x08, 0x3E, 0x0A, 0x23, 0x3E, 0x0A, 0x08, 0x3F, 0x0B, 0x22, 0x3F, 0x0B,
+  0x09, 0x40, 0x0C, 0x20, 0x40, 0x0C, 0x0A, 0x41, 0x0D, 0x1E, 0x41, 0x0D,
+  0x0A, 0x42, 0x21, 0x0B, 0x43, 0x1F, 0x0C, 0x44, 0x1D, 0x0D, 0x45, 0x1B,
+  0x0E, 0x46, 0x19, 0x10, 0x47, 0x15, 0x12, 0x48, 0x11, 0x15, 0x49, 0x0B,
+  0x1D, 0x04, 0x06, 0x1C, 0x05, 0x07, 0x1C, 0x06, 0x07, 0x1B, 0x07, 0x08,
+  0x1A, 0x08, 0x09, 0x1A, 0x09, 0x09, 0x19, 0x0A, 0x0A, 0x18, 0x0B, 0x0B,
+  0x17, 0x0C, 0x0C, 0x16, 0x0D, 0x0D, 0x14, 0x0E, 0x0F, 0x13, 0x0F, 0x10,
+  0x12, 0x10, 0x11, 0x11, 0x11, 0x12, 0x0F, 0x12, 0x14, 0x0D, 0x13, 0x16,
+  0x0B, 0x14, 0x0E, 0x1A, 0x14, 0x09, 0x0A, 0x15, 0x0D, 0x1A, 0x15, 0x09,
+  0x0A, 0x16, 0x0C, 0x1A, 0x16, 0x09, 0x0A, 0x17, 0x0B, 0x1A, 0x17, 0x09,
+  0x0A, 0x18, 0x09, 0x1A, 0x18, 0x09, 0x0A, 0x19, 0x08, 0x1A, 0x19, 0x09,
+  0x0A, 0x1A, 0x06, 0x1A, 0x1A, 0x09, 0x0A, 0x1B, 0x04, 0x1A, 0x1B, 0x09,
+  0x0A, 0x1C, 0x02, 0x1A, 0x1C, 0x09, 0x1A, 0x1D, 0x09, 0x1A, 0x1E, 0x09,
+  0x1A, 0x1F, 0x09, 0x1A, 0x20, 0x09, 0x1A, 0x21, 0x09, 0x1A, 0x22, 0x09,
+  0x1A, 0x23, 0x09, 0x1A, 0x24, 0x09, 0x1A, 0x25, 0x09, 0x1A, 0x26, 0x09,
+  0x1A, 0x27, 0x09, 0x1A, 0x28, 0x09, 0x1A, 0x29, 0x09, 0x1A, 0x2A, 0x09,
+  0x1A, 0x2B, 0x09, 0x1A, 0x2C, 0x09, 0x1A, 0x2D, 0x09, 0x1A, 0x2E, 0x09,
+  0x1A, 0x2F, 0x09, 0x1A, 0x30, 0x09, 0x1A, 0x31, 0x09, 0x1A, 0x32, 0x09,
+  0x1A, 0x33, 0x09, 0x1A, 0x34, 0x09, 0x1A, 0x35, 0x09, 0x1A, 0x36, 0x09,
+  0x1A, 0x37, 0x09, 0x1A, 0x38, 0x09, 0x1A, 0x39, 0x09, 0x1A, 0x3A, 0x09,
+  0x1A, 0x3B, 0x09, 0x1A, 0x3C, 0x09, 0x1A, 0x3D, 0x09, 0x1A, 0x3E, 0x09,
+  0x1A, 0x3F, 0x09, 0x1A, 0x40, 0x09, 0x1A, 0x41, 0x09, 0x1A, 0x42, 0x09,
+  0x1A, 0x43, 0x09, 0x1A, 0x44, 0x09, 0x1A, 0x45, 0x09, 0x1A, 0x46, 0x09,
+  0x1A, 0x47, 0x09, 0x1A, 0x48, 0x09, 0x14, 0x04, 0x0B, 0x10, 0x05, 0x13,
+  0x0E, 0x06, 0x17, 0x0C, 0x07, 0x1B, 0x0B, 0x08, 0x1D, 0x0A, 0x09, 0x1F,
+  0x09, 0x0A, 0x21, 0x08, 0x0B, 0x23, 0x07, 0x0C, 0x0F, 0x1E, 0x0C, 0x0E,
+  0x07, 0x0D, 0x0C, 0x20, 0x0D, 0x0D, 0x06, 0x0E, 0x0B, 0x22, 0x0E, 0x0B,
+  0x06, 0x0F, 0x0A, 0x23, 0x0F, 0x0B, 0x05, 0x10, 0x0A, 0x24, 0x10, 0x0A,
+  0x05, 0x11, 0x0A, 0x24, 0x11, 0x0A, 0x05, 0x12, 0x09, 0x25, 0x12, 0x0A,
+  0x05, 0x13, 0x09, 0x25, 0x13, 0x0A, 0x04, 0x14, 0x09, 0x26, 0x14, 0x09,
+  0x04, 0x15, 0x09, 0x26, 0x15, 0x09, 0x04, 0x16, 0x09, 0x26, 0x16, 0x09,
+  0x08, 0x17, 0x05, 0x26, 0x17, 0x09, 0x26, 0x18, 0x09, 0x26, 0x19, 0x09,
+  0x26, 0x1A, 0x09, 0x25, 0x1B, 0x0A, 0x25, 0x1C, 0x09, 0x24, 0x1D, 0x0A,
+  0x24, 0x1E, 0x0A, 0x23, 0x1F, 0x0A, 0x23, 0x20, 0x0A, 0x22, 0x21, 0x0A,
+  0x21, 0x22, 0x0B, 0x20, 0x23, 0x0B, 0x1F, 0x24, 0x0C, 0x1E, 0x25, 0x0C,
+  0x1D, 0x26, 0x0C, 0x1C, 0x27, 0x0C, 0x1B, 0x28, 0x0C, 0x1A, 0x29, 0x0D,
+  0x19, 0x2A, 0x0D, 0x18, 0x2B, 0x0D, 0x17, 0x2C, 0x0D, 0x16, 0x2D, 0x0D,
+  0x14, 0x2E, 0x0D, 0x13, 0x2F, 0x0D, 0x12, 0x30, 0x0D, 0x11, 0x31, 0x0D,
+  0x10, 0x32, 0x0D, 0x0E, 0x33, 0x0E, 0x0D, 0x34, 0x0E, 0x0C, 0x35, 0x0D,
+  0x0B, 0x36, 0x0D, 0x0A, 0x37, 0x0D, 0x0A, 0x38, 0x0C, 0x09, 0x39, 0x0C,
+  0x08, 0x3A, 0x0B, 0x07, 0x3B, 0x0B, 0x07, 0x3C, 0x0A, 0x06, 0x3D, 0x0B,
+  0x06, 0x3E, 0x0A, 0x05, 0x3F, 0x0A, 0x05, 0x40, 0x2B, 0x04, 0x41, 0x2C,
+  0x04, 0x42, 0x2C, 0x04, 0x43, 0x2C, 0x03, 0x44, 0x2D, 0x03, 0x45, 0x2D,
+  0x03, 0x46, 0x2D, 0x03, 0x47, 0x2D, 0x03, 0x48, 0x2D, 0x14, 0x04, 0x0A,
+  0x11, 0x05, 0x11, 0x0F, 0x06, 0x15, 0x0D, 0x07, 0x18, 0x0C, 0x08, 0x1B,
+  0x0B, 0x09, 0x1D, 0x0A, 0x0A, 0x1F, 0x09, 0x0B, 0x21, 0x09, 0x0C, 0x0D,
+  0x1D, 0x0C, 0x0D, 0x08, 0x0D, 0x0C, 0x1F, 0x0D, 0x0C, 0x07, 0x0E, 0x0B,
+  0x21, 0x0E, 0x0A, 0x07, 0x0F, 0x0A, 0x22, 0x0F, 0x0A, 0x07, 0x10, 0x09,
+  0x23, 0x10, 0x09, 0x06, 0x11, 0x0A, 0x23, 0x11, 0x0A, 0x06, 0x12, 0x09,
+  0x24, 0x12, 0x09, 0x06, 0x13, 0x09, 0x24, 0x13, 0x09, 0x05, 0x14, 0x0A,
+  0x24, 0x14, 0x09, 0x05, 0x15, 0x09, 0x24, 0x15, 0x09, 0x09, 0x16, 0x05,
+  0x24, 0x16, 0x09, 0x24, 0x17, 0x09, 0x24, 0x18, 0x09, 0x23, 0x19, 0x09,
+  0x23, 0x1A, 0x09, 0x22, 0x1B, 0x0A, 0x21, 0x1C, 0x0A, 0x20, 0x1D, 0x0A,
+  0x1E, 0x1E, 0x0C, 0x1C, 0x1F, 0x0D, 0x16, 0x20, 0x12, 0x16, 0x21, 0x10,
+  0x16, 0x22, 0x0E, 0x16, 0x23, 0x10, 0x15, 0x24, 0x13, 0x15, 0x25, 0x15,
+  0x15, 0x26, 0x16, 0x15, 0x27, 0x02, 0x1F, 0x27, 0x0D, 0x21, 0x28, 0x0C,
+  0x23, 0x29, 0x0B, 0x24, 0x2A, 0x0A, 0x25, 0x2B, 0x0A, 0x26, 0x2C, 0x0A,
+  0x26, 0x2D, 0x0A, 0x27, 0x2E, 0x09, 0x27, 0x2F, 0x0A, 0x28, 0x30, 0x09,
+  0x28, 0x31, 0x09, 0x28, 0x32, 0x09, 0x28, 0x33, 0x09, 0x28, 0x34, 0x09,
+  0x28, 0x35, 0x09, 0x08, 0x36, 0x05, 0x28, 0x36, 0x09, 0x04, 0x37, 0x09,
+  0x28, 0x37, 0x09, 0x04, 0x38, 0x0A, 0x27, 0x38, 0x0A, 0x04, 0x39, 0x0A,
+  0x27, 0x39, 0x09, 0x05, 0x3A, 0x09, 0x27, 0x3A, 0x09, 0x05, 0x3B, 0x0A,
+  0x26, 0x3B, 0x0A, 0x05, 0x3C, 0x0A, 0x25, 0x3C, 0x0A, 0x06, 0x3D, 0x0A,
+  0x25, 0x3D, 0x0A, 0x06, 0x3E, 0x0B, 0x24, 0x3E, 0x0A, 0x07, 0x3F, 0x0B,
+  0x23, 0x3F, 0x0B, 0x07, 0x40, 0x0C, 0x21, 0x40, 0x0C, 0x08, 0x41, 0x0E,
+  0x1E, 0x41, 0x0E, 0x09, 0x42, 0x23, 0x0A, 0x43, 0x21, 0x0B, 0x44, 0x1E,
+  0x0C, 0x45, 0x1C, 0x0D, 0x46, 0x1A, 0x0F, 0x47, 0x16, 0x11, 0x48, 0x12,
+  0x15, 0x49, 0x0A, 0x22, 0x05, 0x07, 0x21, 0x06, 0x08, 0x20, 0x07, 0x09,
+  0x1F, 0x08, 0x0A, 0x1F, 0x09, 0x0A, 0x1E, 0x0A, 0x0B, 0x1D, 0x0B, 0x0C,
+  0x1C, 0x0C, 0x0D, 0x1B, 0x0D, 0x0E, 0x1B, 0x0E, 0x0E, 0x1A, 0x0F, 0x0F,
+  0x19, 0x10, 0x10, 0x18, 0x11, 0x11, 0x18, 0x12, 0x11, 0x17, 0x13, 0x12,
+  0x16, 0x14, 0x13, 0x15, 0x15, 0x14, 0x15, 0x16, 0x14, 0x14, 0x17, 0x0B,
+  0x20, 0x17, 0x09, 0x13, 0x18, 0x0B, 0x20, 0x18, 0x09, 0x12, 0x19, 0x0B,
+  0x20, 0x19, 0x09, 0x11, 0x1A, 0x0C, 0x20, 0x1A, 0x09, 0x11, 0x1B, 0x0B,
+  0x20, 0x1B, 0x09, 0x10, 0x1C, 0x0B, 0x20, 0x1C, 0x09, 0x0F, 0x1D, 0x0B,
+  0x20, 0x1D, 0x09, 0x0E, 0x1E, 0x0B, 0x20, 0x1E, 0x09, 0x0E, 0x1F, 0x0B,
+  0x20, 0x1F, 0x09, 0x0D, 0x20, 0x0B, 0x20, 0x20, 0x09, 0x0C, 0x21, 0x0B,
+  0x20, 0x21, 0x09, 0x0B, 0x22, 0x0B, 0x20, 0x22, 0x09, 0x0B, 0x23, 0x0B,
+  0x20, 0x23, 0x09, 0x0A, 0x24, 0x0B, 0x20, 0x24, 0x09, 0x09, 0x25, 0x0B,
+  0x20, 0x25, 0x09, 0x08, 0x26, 0x0B, 0x20, 0x26, 0x09, 0x08, 0x27, 0x0B,
+  0x20, 0x27, 0x09, 0x07, 0x28, 0x0B, 0x20, 0x28, 0x09, 0x06, 0x29, 0x0B,
+  0x20, 0x29, 0x09, 0x05, 0x2A, 0x0B, 0x20, 0x2A, 0x09, 0x04, 0x2B, 0x0C,
+  0x20, 0x2B, 0x09, 0x04, 0x2C, 0x0B, 0x20, 0x2C, 0x09, 0x03, 0x2D, 0x0B,
+  0x20, 0x2D, 0x09, 0x02, 0x2E, 0x0B, 0x20, 0x2E, 0x09, 0x01, 0x2F, 0x0B,
+  0x20, 0x2F, 0x09, 0x01, 0x30, 0x30, 0x01, 0x31, 0x30, 0x01, 0x32, 0x30,
+  0x01, 0x33, 0x30, 0x01, 0x34, 0x30, 0x01, 0x35, 0x30, 0x01, 0x36, 0x30,
+  0x01, 0x37, 0x30, 0x01, 0x38, 0x30, 0x20, 0x39, 0x09, 0x20, 0x3A, 0x09,
+  0x20, 0x3B, 0x09, 0x20, 0x3C, 0x09, 0x20, 0x3D, 0x09, 0x20, 0x3E, 0x09,
+  0x20, 0x3F, 0x09, 0x20, 0x40, 0x09, 0x20, 0x41, 0x09, 0x20, 0x42, 0x09,
+  0x20, 0x43, 0x09, 0x20, 0x44, 0x09, 0x20, 0x45, 0x09, 0x20, 0x46, 0x09,
+  0x20, 0x47, 0x09, 0x20, 0x48, 0x09, 0x0C, 0x05, 0x21, 0x0C, 0x06, 0x21,
+  0x0B, 0x07, 0x22, 0x0B, 0x08, 0x22, 0x0B, 0x09, 0x22, 0x0B, 0x0A, 0x22,
+  0x0B, 0x0B, 0x22, 0x0A, 0x0C, 0x23, 0x0A, 0x0D, 0x23, 0x0A, 0x0E, 0x09,
+  0x0A, 0x0F, 0x09, 0x0A, 0x10, 0x09, 0x09, 0x11, 0x0A, 0x09, 0x12, 0x09,
+  0x09, 0x13, 0x09, 0x09, 0x14, 0x09, 0x09, 0x15, 0x09, 0x08, 0x16, 0x0A,
+  0x08, 0x17, 0x09, 0x08, 0x18, 0x09, 0x08, 0x19, 0x09, 0x08, 0x1A, 0x09,
+  0x07, 0x1B, 0x0A, 0x18, 0x1B, 0x09, 0x07, 0x1C, 0x0A, 0x15, 0x1C, 0x0F,
+  0x07, 0x1D, 0x09, 0x13, 0x1D, 0x13, 0x07, 0x1E, 0x09, 0x11, 0x1E, 0x17,
+  0x07, 0x1F, 0x22, 0x06, 0x20, 0x24, 0x06, 0x21, 0x25, 0x06, 0x22, 0x26,
+  0x06, 0x23, 0x10, 0x1E, 0x23, 0x0F, 0x06, 0x24, 0x0D, 0x21, 0x24, 0x0D,
+  0x05, 0x25, 0x0C, 0x23, 0x25, 0x0B, 0x05, 0x26, 0x0B, 0x24, 0x26, 0x0B,
+  0x05, 0x27, 0x0A, 0x25, 0x27, 0x0A, 0x09, 0x28, 0x05, 0x26, 0x28, 0x0A,
+  0x26, 0x29, 0x0A, 0x27, 0x2A, 0x09, 0x27, 0x2B, 0x09, 0x27, 0x2C, 0x0A,
+  0x28, 0x2D, 0x09, 0x28, 0x2E, 0x09, 0x28, 0x2F, 0x09, 0x28, 0x30, 0x09,
+  0x28, 0x31, 0x09, 0x28, 0x32, 0x09, 0x28, 0x33, 0x09, 0x28, 0x34, 0x09,
+  0x28, 0x35, 0x09, 0x08, 0x36, 0x05, 0x28, 0x36, 0x09, 0x04, 0x37, 0x09,
+  0x27, 0x37, 0x09, 0x04, 0x38, 0x0A, 0x27, 0x38, 0x09, 0x04, 0x39, 0x0A,
+  0x27, 0x39, 0x09, 0x05, 0x3A, 0x09, 0x26, 0x3A, 0x0A, 0x05, 0x3B, 0x0A,
+  0x26, 0x3B, 0x09, 0x05, 0x3C, 0x0A, 0x25, 0x3C, 0x0A, 0x06, 0x3D, 0x0A,
+  0x24, 0x3D, 0x0A, 0x06, 0x3E, 0x0B, 0x23, 0x3E, 0x0B, 0x06, 0x3F, 0x0C,
+  0x22, 0x3F, 0x0B, 0x07, 0x40, 0x0C, 0x21, 0x40, 0x0B, 0x08, 0x41, 0x0E,
+  0x1E, 0x41, 0x0E, 0x08, 0x42, 0x23, 0x09, 0x43, 0x21, 0x0A, 0x44, 0x1F,
+  0x0C, 0x45, 0x1C, 0x0D, 0x46, 0x19, 0x0F, 0x47, 0x16, 0x11, 0x48, 0x11,
+  0x14, 0x49, 0x0B, 0x17, 0x04, 0x0A, 0x13, 0x05, 0x11, 0x11, 0x06, 0x16,
+  0x0F, 0x07, 0x19, 0x0E, 0x08, 0x1B, 0x0D, 0x09, 0x1D, 0x0C, 0x0A, 0x1F,
+  0x0B, 0x0B, 0x21, 0x0A, 0x0C, 0x0E, 0x1F, 0x0C, 0x0E, 0x09, 0x0D, 0x0C,
+  0x21, 0x0D, 0x0C, 0x09, 0x0E, 0x0B, 0x23, 0x0E, 0x0B, 0x08, 0x0F, 0x0A,
+  0x24, 0x0F, 0x0A, 0x07, 0x10, 0x0B, 0x25, 0x10, 0x0A, 0x07, 0x11, 0x0A,
+  0x25, 0x11, 0x0A, 0x07, 0x12, 0x09, 0x26, 0x12, 0x09, 0x06, 0x13, 0x0A,
+  0x26, 0x13, 0x0A, 0x06, 0x14, 0x09, 0x26, 0x14, 0x0A, 0x05, 0x15, 0x0A,
+  0x27, 0x15, 0x09, 0x05, 0x16, 0x09, 0x27, 0x16, 0x05, 0x05, 0x17, 0x09,
+  0x05, 0x18, 0x08, 0x04, 0x19, 0x09, 0x04, 0x1A, 0x09, 0x04, 0x1B, 0x09,
+  0x04, 0x1C, 0x09, 0x18, 0x1C, 0x09, 0x04, 0x1D, 0x08, 0x15, 0x1D, 0x0F,
+  0x04, 0x1E, 0x08, 0x13, 0x1E, 0x13, 0x03, 0x1F, 0x09, 0x11, 0x1F, 0x17,
+  0x03, 0x20, 0x09, 0x10, 0x20, 0x19, 0x03, 0x21, 0x09, 0x0F, 0x21, 0x1B,
+  0x03, 0x22, 0x09, 0x0E, 0x22, 0x1D, 0x03, 0x23, 0x09, 0x0D, 0x23, 0x1F,
+  0x03, 0x24, 0x13, 0x1E, 0x24, 0x0F, 0x03, 0x25, 0x11, 0x21, 0x25, 0x0D,
+  0x03, 0x26, 0x0F, 0x23, 0x26, 0x0B, 0x03, 0x27, 0x0E, 0x24, 0x27, 0x0B,
+  0x03, 0x28, 0x0D, 0x25, 0x28, 0x0A, 0x03, 0x29, 0x0C, 0x26, 0x29, 0x0A,
+  0x03, 0x2A, 0x0B, 0x26, 0x2A, 0x0A, 0x03, 0x2B, 0x0A, 0x27, 0x2B, 0x09,
+  0x03, 0x2C, 0x0A, 0x27, 0x2C, 0x09, 0x03, 0x2D, 0x0A, 0x27, 0x2D, 0x0A,
+  0x03, 0x2E, 0x09, 0x28, 0x2E, 0x09, 0x03, 0x2F, 0x09, 0x28, 0x2F, 0x09,
+  0x03, 0x30, 0x09, 0x28, 0x30, 0x09, 0x03, 0x31, 0x09, 0x28, 0x31, 0x09,
+  0x04, 0x32, 0x08, 0x28, 0x32, 0x09, 0x04, 0x33, 0x08, 0x28, 0x33, 0x09,
+  0x04, 0x34, 0x08, 0x28, 0x34, 0x09, 0x04, 0x35, 0x08, 0x28, 0x35, 0x09,
+  0x04, 0x36, 0x09, 0x28, 0x36, 0x09, 0x05, 0x37, 0x08, 0x27, 0x37, 0x0A,
+  0x05, 0x38, 0x08, 0x27, 0x38, 0x09, 0x05, 0x39, 0x09, 0x27, 0x39, 0x09,
+  0x05, 0x3A, 0x09, 0x26, 0x3A, 0x0A, 0x06, 0x3B, 0x09, 0x26, 0x3B, 0x09,
+  0x06, 0x3C, 0x09, 0x25, 0x3C, 0x0A, 0x07, 0x3D, 0x09, 0x25, 0x3D, 0x0A,
+  0x07, 0x3E, 0x0A, 0x24, 0x3E, 0x0A, 0x08, 0x3F, 0x0A, 0x23, 0x3F, 0x0B,
+  0x08, 0x40, 0x0C, 0x21, 0x40, 0x0C, 0x09, 0x41, 0x0D, 0x1E, 0x41, 0x0E,
+  0x0A, 0x42, 0x22, 0x0B, 0x43, 0x20, 0x0C, 0x44, 0x1E, 0x0D, 0x45, 0x1C,
+  0x0F, 0x46, 0x18, 0x10, 0x47, 0x16, 0x13, 0x48, 0x10, 0x16, 0x49, 0x0A,
+  0x05, 0x05, 0x2C, 0x05, 0x06, 0x2C, 0x05, 0x07, 0x2C, 0x05, 0x08, 0x2C,
+  0x05, 0x09, 0x2C, 0x05, 0x0A, 0x2C, 0x05, 0x0B, 0x2C, 0x05, 0x0C, 0x2C,
+  0x05, 0x0D, 0x2B, 0x28, 0x0E, 0x07, 0x27, 0x0F, 0x07, 0x26, 0x10, 0x08,
+  0x25, 0x11, 0x08, 0x24, 0x12, 0x08, 0x23, 0x13, 0x08, 0x23, 0x14, 0x08,
+  0x22, 0x15, 0x08, 0x21, 0x16, 0x08, 0x21, 0x17, 0x08, 0x20, 0x18, 0x08,
+  0x1F, 0x19, 0x09, 0x1F, 0x1A, 0x08, 0x1E, 0x1B, 0x08, 0x1D, 0x1C, 0x09,
+  0x1D, 0x1D, 0x08, 0x1C, 0x1E, 0x09, 0x1C, 0x1F, 0x08, 0x1B, 0x20, 0x09,
+  0x1A, 0x21, 0x09, 0x1A, 0x22, 0x09, 0x19, 0x23, 0x09, 0x19, 0x24, 0x09,
+  0x18, 0x25, 0x09, 0x18, 0x26, 0x09, 0x17, 0x27, 0x09, 0x17, 0x28, 0x09,
+  0x17, 0x29, 0x09, 0x16, 0x2A, 0x09, 0x16, 0x2B, 0x09, 0x15, 0x2C, 0x09,
+  0x15, 0x2D, 0x09, 0x15, 0x2E, 0x09, 0x14, 0x2F, 0x09, 0x14, 0x30, 0x09,
+  0x14, 0x31, 0x09, 0x13, 0x32, 0x09, 0x13, 0x33, 0x09, 0x13, 0x34, 0x09,
+  0x12, 0x35, 0x09, 0x12, 0x36, 0x09, 0x12, 0x37, 0x09, 0x12, 0x38, 0x09,
+  0x11, 0x39, 0x09, 0x11, 0x3A, 0x09, 0x11, 0x3B, 0x09, 0x11, 0x3C, 0x09,
+  0x10, 0x3D, 0x09, 0x10, 0x3E, 0x09, 0x10, 0x3F, 0x09, 0x10, 0x40, 0x09,
+  0x10, 0x41, 0x09, 0x10, 0x42, 0x09, 0x0F, 0x43, 0x0A, 0x0F, 0x44, 0x09,
+  0x0F, 0x45, 0x09, 0x0F, 0x46, 0x09, 0x0F, 0x47, 0x09, 0x0F, 0x48, 0x09,
+  0x15, 0x04, 0x0A, 0x11, 0x05, 0x12, 0x0F, 0x06, 0x16, 0x0D, 0x07, 0x1A,
+  0x0C, 0x08, 0x1C, 0x0B, 0x09, 0x1E, 0x0A, 0x0A, 0x20, 0x09, 0x0B, 0x22,
+  0x08, 0x0C, 0x0E, 0x1E, 0x0C, 0x0D, 0x08, 0x0D, 0x0C, 0x20, 0x0D, 0x0C,
+  0x07, 0x0E, 0x0B, 0x22, 0x0E, 0x0B, 0x07, 0x0F, 0x0A, 0x23, 0x0F, 0x0A,
+  0x07, 0x10, 0x09, 0x24, 0x10, 0x09, 0x06, 0x11, 0x0A, 0x24, 0x11, 0x0A,
+  0x06, 0x12, 0x09, 0x25, 0x12, 0x09, 0x06, 0x13, 0x09, 0x25, 0x13, 0x09,
+  0x06, 0x14, 0x09, 0x25, 0x14, 0x09, 0x06, 0x15, 0x09, 0x25, 0x15, 0x09,
+  0x06, 0x16, 0x09, 0x25, 0x16, 0x09, 0x06, 0x17, 0x09, 0x25, 0x17, 0x09,
+  0x06, 0x18, 0x09, 0x25, 0x18, 0x09, 0x07, 0x19, 0x09, 0x24, 0x19, 0x09,
+  0x07, 0x1A, 0x09, 0x24, 0x1A, 0x09, 0x07, 0x1B, 0x0A, 0x23, 0x1B, 0x0A,
+  0x08, 0x1C, 0x0A, 0x22, 0x1C, 0x0A, 0x09, 0x1D, 0x0A, 0x21, 0x1D, 0x0A,
+  0x0A, 0x1E, 0x0C, 0x1E, 0x1E, 0x0D, 0x0B, 0x1F, 0x1E, 0x0C, 0x20, 0x1C,
+  0x0E, 0x21, 0x18, 0x10, 0x22, 0x14, 0x0E, 0x23, 0x17, 0x0C, 0x24, 0x1B,
+  0x0B, 0x25, 0x1E, 0x0A, 0x26, 0x20, 0x09, 0x27, 0x0D, 0x1E, 0x27, 0x0D,
+  0x08, 0x28, 0x0B, 0x20, 0x28, 0x0C, 0x07, 0x29, 0x0B, 0x22, 0x29, 0x0B,
+  0x06, 0x2A, 0x0B, 0x23, 0x2A, 0x0A, 0x06, 0x2B, 0x0A, 0x24, 0x2B, 0x0A,
+  0x05, 0x2C, 0x0A, 0x25, 0x2C, 0x09, 0x05, 0x2D, 0x0A, 0x25, 0x2D, 0x0A,
+  0x05, 0x2E, 0x09, 0x26, 0x2E, 0x09, 0x05, 0x2F, 0x09, 0x26, 0x2F, 0x09,
+  0x04, 0x30, 0x09, 0x27, 0x30, 0x09, 0x04, 0x31, 0x09, 0x27, 0x31, 0x09,
+  0x04, 0x32, 0x09, 0x27, 0x32, 0x09, 0x04, 0x33, 0x09, 0x27, 0x33, 0x09,
+  0x04, 0x34, 0x09, 0x27, 0x34, 0x09, 0x04, 0x35, 0x09, 0x27, 0x35, 0x09,
+  0x04, 0x36, 0x09, 0x27, 0x36, 0x09, 0x04, 0x37, 0x09, 0x27, 0x37, 0x09,
+  0x04, 0x38, 0x09, 0x27, 0x38, 0x09, 0x04, 0x39, 0x0A, 0x26, 0x39, 0x0A,
+  0x05, 0x3A, 0x09, 0x26, 0x3A, 0x09, 0x05, 0x3B, 0x0A, 0x25, 0x3B, 0x0A,
+  0x05, 0x3C, 0x0A, 0x25, 0x3C, 0x0A, 0x06, 0x3D, 0x0A, 0x24, 0x3D, 0x0A,
+  0x06, 0x3E, 0x0B, 0x23, 0x3E, 0x0B, 0x07, 0x3F, 0x0B, 0x22, 0x3F, 0x0B,
+  0x07, 0x40, 0x0D, 0x21, 0x40, 0x0C, 0x08, 0x41, 0x0E, 0x1E, 0x41, 0x0E,
+  0x09, 0x42, 0x22, 0x0A, 0x43, 0x20, 0x0B, 0x44, 0x1E, 0x0C, 0x45, 0x1C,
+  0x0D, 0x46, 0x1A, 0x0F, 0x47, 0x16, 0x11, 0x48, 0x12, 0x15, 0x49, 0x0A,
+  0x15, 0x04, 0x09, 0x11, 0x05, 0x11, 0x0F, 0x06, 0x15, 0x0E, 0x07, 0x18,
+  0x0C, 0x08, 0x1B, 0x0B, 0x09, 0x1D, 0x0A, 0x0A, 0x1F, 0x09, 0x0B, 0x21,
+  0x08, 0x0C, 0x0F, 0x1F, 0x0C, 0x0C, 0x08, 0x0D, 0x0D, 0x21, 0x0D, 0x0B,
+  0x07, 0x0E, 0x0C, 0x23, 0x0E, 0x09, 0x07, 0x0F, 0x0B, 0x24, 0x0F, 0x09,
+  0x06, 0x10, 0x0B, 0x25, 0x10, 0x09, 0x06, 0x11, 0x0A, 0x25, 0x11, 0x09,
+  0x05, 0x12, 0x0A, 0x26, 0x12, 0x08, 0x05, 0x13, 0x0A, 0x27, 0x13, 0x08,
+  0x05, 0x14, 0x09, 0x27, 0x14, 0x08, 0x05, 0x15, 0x09, 0x27, 0x15, 0x08,
+  0x04, 0x16, 0x0A, 0x28, 0x16, 0x08, 0x04, 0x17, 0x09, 0x28, 0x17, 0x08,
+  0x04, 0x18, 0x09, 0x28, 0x18, 0x08, 0x04, 0x19, 0x09, 0x28, 0x19, 0x08,
+  0x04, 0x1A, 0x09, 0x28, 0x1A, 0x08, 0x04, 0x1B, 0x09, 0x28, 0x1B, 0x08,
+  0x04, 0x1C, 0x09, 0x28, 0x1C, 0x09, 0x04, 0x1D, 0x09, 0x28, 0x1D, 0x09,
+  0x04, 0x1E, 0x09, 0x28, 0x1E, 0x09, 0x04, 0x1F, 0x09, 0x28, 0x1F, 0x09,
+  0x04, 0x20, 0x0A, 0x27, 0x20, 0x0A, 0x05, 0x21, 0x09, 0x27, 0x21, 0x0A,
+  0x05, 0x22, 0x09, 0x27, 0x22, 0x0A, 0x05, 0x23, 0x0A, 0x26, 0x23, 0x0B,
+  0x05, 0x24, 0x0A, 0x26, 0x24, 0x0B, 0x06, 0x25, 0x0A, 0x25, 0x25, 0x0C,
+  0x06, 0x26, 0x0B, 0x24, 0x26, 0x0D, 0x07, 0x27, 0x0B, 0x23, 0x27, 0x0E,
+  0x07, 0x28, 0x0D, 0x21, 0x28, 0x10, 0x08, 0x29, 0x0F, 0x1F, 0x29, 0x12,
+  0x09, 0x2A, 0x1E, 0x28, 0x2A, 0x09, 0x0A, 0x2B, 0x1C, 0x28, 0x2B, 0x09,
+  0x0B, 0x2C, 0x1A, 0x28, 0x2C, 0x09, 0x0C, 0x2D, 0x18, 0x28, 0x2D, 0x09,
+  0x0D, 0x2E, 0x16, 0x28, 0x2E, 0x09, 0x0E, 0x2F, 0x13, 0x28, 0x2F, 0x08,
+  0x10, 0x30, 0x0F, 0x28, 0x30, 0x08, 0x13, 0x31, 0x09, 0x27, 0x31, 0x09,
+  0x27, 0x32, 0x09, 0x27, 0x33, 0x09, 0x27, 0x34, 0x09, 0x27, 0x35, 0x08,
+  0x26, 0x36, 0x09, 0x09, 0x37, 0x05, 0x26, 0x37, 0x09, 0x05, 0x38, 0x09,
+  0x26, 0x38, 0x09, 0x05, 0x39, 0x0A, 0x25, 0x39, 0x09, 0x05, 0x3A, 0x0A,
+  0x25, 0x3A, 0x09, 0x06, 0x3B, 0x09, 0x24, 0x3B, 0x0A, 0x06, 0x3C, 0x0A,
+  0x24, 0x3C, 0x09, 0x06, 0x3D, 0x0A, 0x23, 0x3D, 0x0A, 0x07, 0x3E, 0x0A,
+  0x22, 0x3E, 0x0A, 0x07, 0x3F, 0x0B, 0x21, 0x3F, 0x0B, 0x07, 0x40, 0x0C,
+  0x1F, 0x40, 0x0C, 0x08, 0x41, 0x0D, 0x1D, 0x41, 0x0D, 0x09, 0x42, 0x20,
+  0x09, 0x43, 0x1F, 0x0A, 0x44, 0x1D, 0x0B, 0x45, 0x1B, 0x0D, 0x46, 0x18,
+  0x0E, 0x47, 0x15, 0x10, 0x48, 0x11, 0x13, 0x49, 0x0A, 0x09, 0x17, 0x09,
+  0x09, 0x18, 0x09, 0x09, 0x19, 0x09, 0x09, 0x1A, 0x09, 0x09, 0x1B, 0x09,
+  0x09, 0x1C, 0x09, 0x09, 0x1D, 0x09, 0x09, 0x1E, 0x09, 0x09, 0x1F, 0x09,
+  0x09, 0x40, 0x09, 0x09, 0x41, 0x09, 0x09, 0x42, 0x09, 0x09, 0x43, 0x09,
+  0x09, 0x44, 0x09, 0x09, 0x45, 0x09, 0x09, 0x46, 0x09, 0x09, 0x47, 0x09,
+  0x09, 0x48, 0x09,
+};
+
+// Character c has spans spanidx_f72[c - 32] to spanidx_f72[c - 31] - 1
+PROGMEM const unsigned short spanidx_f72[97] =
+{
+      0,     0,     0,     0,     0,     0,     0,     0,
+      0,     0,     0,     0,     0,     0,     7,    16,
+     16,   140,   218,   299,   393,   486,   577,   696,
+    764,   880,   999,  1017,  1017,  1017,  1017,  1017,
+   1017,  1017,  1017,  1017,  1017,  1017,  1017,  1017,
+   1017,  1017,  1017,  1017,  1017,  1017,  1017,  1017,
+   1017,  1017,  1017,  1017,  1017,  1017,  1017,  1017,
+   1017,  1017,  1017,  1017,  1017,  1017,  1017,  1017,
+   1017,  1017,  1017,  1017,  1017,  1017,  1017,  1017,
+   1017,  1017,  1017,  1017,  1017,  1017,  1017,  1017,
+   1017,  1017,  1017,  1017,  1017,  1017,  1017,  1017,
+   1017,  1017,  1017,  1017,  1017,  1017,  1017,  1017,
+   1017,
+};
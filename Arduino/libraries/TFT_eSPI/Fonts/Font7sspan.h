@@ -0,0 +1,183 @@
+// Font 7 as horizontal spans, used if SPAN_FONTS is defined
+//
+// Generated from Font7srle.c by Tools/Host/Span_font_compiler.cpp, do not edit
+
+// Foreground spans as x, y, length in row order
+PROGMEM const unsigned char spans_f7s[1884] =
+{
+  0x08, 0x15, 0x0F, 0x06, 0x16, 0x13, 0x04, 0x17, 0x17, 0x05, 0x18, 0x15,
+  0x07, 0x19, 0x11, 0x04, 0x2A, 0x03, 0x03, 0x2B, 0x05, 0x03, 0x2C, 0x05,
+  0x03, 0x2D, 0x05, 0x04, 0x2E, 0x03, 0x08, 0x01, 0x0F, 0x07, 0x02, 0x11,
+  0x06, 0x03, 0x13, 0x07, 0x04, 0x11, 0x1A, 0x04, 0x01, 0x04, 0x05, 0x02,
+  0x08, 0x05, 0x0F, 0x19, 0x05, 0x03, 0x03, 0x06, 0x04, 0x18, 0x06, 0x05,
+  0x02, 0x07, 0x06, 0x17, 0x07, 0x06, 0x02, 0x08, 0x06, 0x17, 0x08, 0x06,
+  0x02, 0x09, 0x06, 0x17, 0x09, 0x06, 0x02, 0x0A, 0x06, 0x17, 0x0A, 0x06,
+  0x02, 0x0B, 0x06, 0x17, 0x0B, 0x06, 0x02, 0x0C, 0x06, 0x17, 0x0C, 0x06,
+  0x02, 0x0D, 0x06, 0x17, 0x0D, 0x06, 0x02, 0x0E, 0x06, 0x17, 0x0E, 0x06,
+  0x02, 0x0F, 0x06, 0x17, 0x0F, 0x06, 0x02, 0x10, 0x06, 0x17, 0x10, 0x06,
+  0x02, 0x11, 0x06, 0x17, 0x11, 0x06, 0x02, 0x12, 0x06, 0x17, 0x12, 0x06,
+  0x02, 0x13, 0x06, 0x17, 0x13, 0x06, 0x02, 0x14, 0x05, 0x18, 0x14, 0x05,
+  0x02, 0x15, 0x03, 0x1A, 0x15, 0x03, 0x02, 0x16, 0x01, 0x1C, 0x16, 0x01,
+  0x02, 0x18, 0x01, 0x02, 0x19, 0x03, 0x1B, 0x19, 0x02, 0x02, 0x1A, 0x05,
+  0x19, 0x1A, 0x04, 0x02, 0x1B, 0x06, 0x17, 0x1B, 0x06, 0x02, 0x1C, 0x06,
+  0x17, 0x1C, 0x06, 0x02, 0x1D, 0x06, 0x17, 0x1D, 0x06, 0x02, 0x1E, 0x06,
+  0x17, 0x1E, 0x06, 0x02, 0x1F, 0x06, 0x17, 0x1F, 0x06, 0x02, 0x20, 0x06,
+  0x17, 0x20, 0x06, 0x02, 0x21, 0x06, 0x17, 0x21, 0x06, 0x02, 0x22, 0x06,
+  0x17, 0x22, 0x06, 0x02, 0x23, 0x06, 0x17, 0x23, 0x06, 0x02, 0x24, 0x06,
+  0x17, 0x24, 0x06, 0x02, 0x25, 0x06, 0x17, 0x25, 0x06, 0x02, 0x26, 0x06,
+  0x17, 0x26, 0x06, 0x02, 0x27, 0x06, 0x17, 0x27, 0x06, 0x02, 0x28, 0x06,
+  0x17, 0x28, 0x06, 0x03, 0x29, 0x04, 0x18, 0x29, 0x04, 0x04, 0x2A, 0x02,
+  0x08, 0x2A, 0x0F, 0x19, 0x2A, 0x02, 0x07, 0x2B, 0x11, 0x06, 0x2C, 0x13,
+  0x07, 0x2D, 0x11, 0x08, 0x2E, 0x0F, 0x1A, 0x04, 0x01, 0x19, 0x05, 0x03,
+  0x18, 0x06, 0x05, 0x17, 0x07, 0x06, 0x17, 0x08, 0x06, 0x17, 0x09, 0x06,
+  0x17, 0x0A, 0x06, 0x17, 0x0B, 0x06, 0x17, 0x0C, 0x06, 0x17, 0x0D, 0x06,
+  0x17, 0x0E, 0x06, 0x17, 0x0F, 0x06, 0x17, 0x10, 0x06, 0x17, 0x11, 0x06,
+  0x17, 0x12, 0x06, 0x17, 0x13, 0x06, 0x18, 0x14, 0x05, 0x1A, 0x15, 0x03,
+  0x1C, 0x16, 0x01, 0x1B, 0x19, 0x02, 0x19, 0x1A, 0x04, 0x17, 0x1B, 0x06,
+  0x17, 0x1C, 0x06, 0x17, 0x1D, 0x06, 0x17, 0x1E, 0x06, 0x17, 0x1F, 0x06,
+  0x17, 0x20, 0x06, 0x17, 0x21, 0x06, 0x17, 0x22, 0x06, 0x17, 0x23, 0x06,
+  0x17, 0x24, 0x06, 0x17, 0x25, 0x06, 0x17, 0x26, 0x06, 0x17, 0x27, 0x06,
+  0x17, 0x28, 0x06, 0x18, 0x29, 0x04, 0x19, 0x2A, 0x02, 0x08, 0x01, 0x0F,
+  0x07, 0x02, 0x11, 0x06, 0x03, 0x13, 0x07, 0x04, 0x11, 0x1A, 0x04, 0x01,
+  0x08, 0x05, 0x0F, 0x19, 0x05, 0x03, 0x18, 0x06, 0x05, 0x17, 0x07, 0x06,
+  0x17, 0x08, 0x06, 0x17, 0x09, 0x06, 0x17, 0x0A, 0x06, 0x17, 0x0B, 0x06,
+  0x17, 0x0C, 0x06, 0x17, 0x0D, 0x06, 0x17, 0x0E, 0x06, 0x17, 0x0F, 0x06,
+  0x17, 0x10, 0x06, 0x17, 0x11, 0x06, 0x17, 0x12, 0x06, 0x17, 0x13, 0x06,
+  0x18, 0x14, 0x05, 0x08, 0x15, 0x0F, 0x1A, 0x15, 0x03, 0x06, 0x16, 0x13,
+  0x1C, 0x16, 0x01, 0x04, 0x17, 0x17, 0x02, 0x18, 0x01, 0x05, 0x18, 0x15,
+  0x02, 0x19, 0x03, 0x07, 0x19, 0x11, 0x02, 0x1A, 0x05, 0x02, 0x1B, 0x06,
+  0x02, 0x1C, 0x06, 0x02, 0x1D, 0x06, 0x02, 0x1E, 0x06, 0x02, 0x1F, 0x06,
+  0x02, 0x20, 0x06, 0x02, 0x21, 0x06, 0x02, 0x22, 0x06, 0x02, 0x23, 0x06,
+  0x02, 0x24, 0x06, 0x02, 0x25, 0x06, 0x02, 0x26, 0x06, 0x02, 0x27, 0x06,
+  0x02, 0x28, 0x06, 0x03, 0x29, 0x04, 0x04, 0x2A, 0x02, 0x08, 0x2A, 0x0F,
+  0x07, 0x2B, 0x11, 0x06, 0x2C, 0x13, 0x07, 0x2D, 0x11, 0x08, 0x2E, 0x0F,
+  0x08, 0x01, 0x0F, 0x07, 0x02, 0x11, 0x06, 0x03, 0x13, 0x07, 0x04, 0x11,
+  0x1A, 0x04, 0x01, 0x08, 0x05, 0x0F, 0x19, 0x05, 0x03, 0x18, 0x06, 0x05,
+  0x17, 0x07, 0x06, 0x17, 0x08, 0x06, 0x17, 0x09, 0x06, 0x17, 0x0A, 0x06,
+  0x17, 0x0B, 0x06, 0x17, 0x0C, 0x06, 0x17, 0x0D, 0x06, 0x17, 0x0E, 0x06,
+  0x17, 0x0F, 0x06, 0x17, 0x10, 0x06, 0x17, 0x11, 0x06, 0x17, 0x12, 0x06,
+  0x17, 0x13, 0x06, 0x18, 0x14, 0x05, 0x08, 0x15, 0x0F, 0x1A, 0x15, 0x03,
+  0x06, 0x16, 0x13, 0x1C, 0x16, 0x01, 0x04, 0x17, 0x17, 0x05, 0x18, 0x15,
+  0x07, 0x19, 0x11, 0x1B, 0x19, 0x02, 0x19, 0x1A, 0x04, 0x17, 0x1B, 0x06,
+  0x17, 0x1C, 0x06, 0x17, 0x1D, 0x06, 0x17, 0x1E, 0x06, 0x17, 0x1F, 0x06,
+  0x17, 0x20, 0x06, 0x17, 0x21, 0x06, 0x17, 0x22, 0x06, 0x17, 0x23, 0x06,
+  0x17, 0x24, 0x06, 0x17, 0x25, 0x06, 0x17, 0x26, 0x06, 0x17, 0x27, 0x06,
+  0x17, 0x28, 0x06, 0x18, 0x29, 0x04, 0x08, 0x2A, 0x0F, 0x19, 0x2A, 0x02,
+  0x07, 0x2B, 0x11, 0x06, 0x2C, 0x13, 0x07, 0x2D, 0x11, 0x08, 0x2E, 0x0F,
+  0x1A, 0x04, 0x01, 0x04, 0x05, 0x02, 0x19, 0x05, 0x03, 0x03, 0x06, 0x04,
+  0x18, 0x06, 0x05, 0x02, 0x07, 0x06, 0x17, 0x07, 0x06, 0x02, 0x08, 0x06,
+  0x17, 0x08, 0x06, 0x02, 0x09, 0x06, 0x17, 0x09, 0x06, 0x02, 0x0A, 0x06,
+  0x17, 0x0A, 0x06, 0x02, 0x0B, 0x06, 0x17, 0x0B, 0x06, 0x02, 0x0C, 0x06,
+  0x17, 0x0C, 0x06, 0x02, 0x0D, 0x06, 0x17, 0x0D, 0x06, 0x02, 0x0E, 0x06,
+  0x17, 0x0E, 0x06, 0x02, 0x0F, 0x06, 0x17, 0x0F, 0x06, 0x02, 0x10, 0x06,
+  0x17, 0x10, 0x06, 0x02, 0x11, 0x06, 0x17, 0x11, 0x06, 0x02, 0x12, 0x06,
+  0x17, 0x12, 0x06, 0x02, 0x13, 0x06, 0x17, 0x13, 0x06, 0x02, 0x14, 0x05,
+  0x18, 0x14, 0x05, 0x02, 0x15, 0x03, 0x08, 0x15, 0x0F, 0x1A, 0x15, 0x03,
+  0x02, 0x16, 0x01, 0x06, 0x16, 0x13, 0x1C, 0x16, 0x01, 0x04, 0x17, 0x17,
+  0x05, 0x18, 0x15, 0x07, 0x19, 0x11, 0x1B, 0x19, 0x02, 0x19, 0x1A, 0x04,
+  0x17, 0x1B, 0x06, 0x17, 0x1C, 0x06, 0x17, 0x1D, 0x06, 0x17, 0x1E, 0x06,
+  0x17, 0x1F, 0x06, 0x17, 0x20, 0x06, 0x17, 0x21, 0x06, 0x17, 0x22, 0x06,
+  0x17, 0x23, 0x06, 0x17, 0x24, 0x06, 0x17, 0x25, 0x06, 0x17, 0x26, 0x06,
+  0x17, 0x27, 0x06, 0x17, 0x28, 0x06, 0x18, 0x29, 0x04, 0x19, 0x2A, 0x02,
+  0x08, 0x01, 0x0F, 0x07, 0x02, 0x11, 0x06, 0x03, 0x13, 0x07, 0x04, 0x11,
+  0x04, 0x05, 0x02, 0x08, 0x05, 0x0F, 0x03, 0x06, 0x04, 0x02, 0x07, 0x06,
+  0x02, 0x08, 0x06, 0x02, 0x09, 0x06, 0x02, 0x0A, 0x06, 0x02, 0x0B, 0x06,
+  0x02, 0x0C, 0x06, 0x02, 0x0D, 0x06, 0x02, 0x0E, 0x06, 0x02, 0x0F, 0x06,
+  0x02, 0x10, 0x06, 0x02, 0x11, 0x06, 0x02, 0x12, 0x06, 0x02, 0x13, 0x06,
+  0x02, 0x14, 0x05, 0x02, 0x15, 0x03, 0x08, 0x15, 0x0F, 0x02, 0x16, 0x01,
+  0x06, 0x16, 0x13, 0x04, 0x17, 0x17, 0x05, 0x18, 0x15, 0x07, 0x19, 0x11,
+  0x1B, 0x19, 0x02, 0x19, 0x1A, 0x04, 0x17, 0x1B, 0x06, 0x17, 0x1C, 0x06,
+  0x17, 0x1D, 0x06, 0x17, 0x1E, 0x06, 0x17, 0x1F, 0x06, 0x17, 0x20, 0x06,
+  0x17, 0x21, 0x06, 0x17, 0x22, 0x06, 0x17, 0x23, 0x06, 0x17, 0x24, 0x06,
+  0x17, 0x25, 0x06, 0x17, 0x26, 0x06, 0x17, 0x27, 0x06, 0x17, 0x28, 0x06,
+  0x18, 0x29, 0x04, 0x08, 0x2A, 0x0F, 0x19, 0x2A, 0x02, 0x07, 0x2B, 0x11,
+  0x06, 0x2C, 0x13, 0x07, 0x2D, 0x11, 0x08, 0x2E, 0x0F, 0x08, 0x01, 0x0F,
+  0x07, 0x02, 0x11, 0x06, 0x03, 0x13, 0x07, 0x04, 0x11, 0x04, 0x05, 0x02,
+  0x08, 0x05, 0x0F, 0x03, 0x06, 0x04, 0x02, 0x07, 0x06, 0x02, 0x08, 0x06,
+  0x02, 0x09, 0x06, 0x02, 0x0A, 0x06, 0x02, 0x0B, 0x06, 0x02, 0x0C, 0x06,
+  0x02, 0x0D, 0x06, 0x02, 0x0E, 0x06, 0x02, 0x0F, 0x06, 0x02, 0x10, 0x06,
+  0x02, 0x11, 0x06, 0x02, 0x12, 0x06, 0x02, 0x13, 0x06, 0x02, 0x14, 0x05,
+  0x02, 0x15, 0x03, 0x08, 0x15, 0x0F, 0x02, 0x16, 0x01, 0x06, 0x16, 0x13,
+  0x04, 0x17, 0x17, 0x02, 0x18, 0x01, 0x05, 0x18, 0x15, 0x02, 0x19, 0x03,
+  0x07, 0x19, 0x11, 0x1B, 0x19, 0x02, 0x02, 0x1A, 0x05, 0x19, 0x1A, 0x04,
+  0x02, 0x1B, 0x06, 0x17, 0x1B, 0x06, 0x02, 0x1C, 0x06, 0x17, 0x1C, 0x06,
+  0x02, 0x1D, 0x06, 0x17, 0x1D, 0x06, 0x02, 0x1E, 0x06, 0x17, 0x1E, 0x06,
+  0x02, 0x1F, 0x06, 0x17, 0x1F, 0x06, 0x02, 0x20, 0x06, 0x17, 0x20, 0x06,
+  0x02, 0x21, 0x06, 0x17, 0x21, 0x06, 0x02, 0x22, 0x06, 0x17, 0x22, 0x06,
+  0x02, 0x23, 0x06, 0x17, 0x23, 0x06, 0x02, 0x24, 0x06, 0x17, 0x24, 0x06,
+  0x02, 0x25, 0x06, 0x17, 0x25, 0x06, 0x02, 0x26, 0x06, 0x17, 0x26, 0x06,
+  0x02, 0x27, 0x06, 0x17, 0x27, 0x06, 0x02, 0x28, 0x06, 0x17, 0x28, 0x06,
+  0x03, 0x29, 0x04, 0x18, 0x29, 0x04, 0x04, 0x2A, 0x02, 0x08, 0x2A, 0x0F,
+  0x19, 0x2A, 0x02, 0x07, 0x2B, 0x11, 0x06, 0x2C, 0x13, 0x07, 0x2D, 0x11,
+  0x08, 0x2E, 0x0F, 0x08, 0x01, 0x0F, 0x07, 0x02, 0x11, 0x06, 0x03, 0x13,
+  0x07, 0x04, 0x11, 0x1A, 0x04, 0x01, 0x08, 0x05, 0x0F, 0x19, 0x05, 0x03,
+  0x18, 0x06, 0x05, 0x17, 0x07, 0x06, 0x17, 0x08, 0x06, 0x17, 0x09, 0x06,
+  0x17, 0x0A, 0x06, 0x17, 0x0B, 0x06, 0x17, 0x0C, 0x06, 0x17, 0x0D, 0x06,
+  0x17, 0x0E, 0x06, 0x17, 0x0F, 0x06, 0x17, 0x10, 0x06, 0x17, 0x11, 0x06,
+  0x17, 0x12, 0x06, 0x17, 0x13, 0x06, 0x18, 0x14, 0x05, 0x1A, 0x15, 0x03,
+  0x1C, 0x16, 0x01, 0x1B, 0x19, 0x02, 0x19, 0x1A, 0x04, 0x17, 0x1B, 0x06,
+  0x17, 0x1C, 0x06, 0x17, 0x1D, 0x06, 0x17, 0x1E, 0x06, 0x17, 0x1F, 0x06,
+  0x17, 0x20, 0x06, 0x17, 0x21, 0x06, 0x17, 0x22, 0x06, 0x17, 0x23, 0x06,
+  0x17, 0x24, 0x06, 0x17, 0x25, 0x06, 0x17, 0x26, 0x06, 0x17, 0x27, 0x06,
+  0x17, 0x28, 0x06, 0x18, 0x29, 0x04, 0x19, 0x2A, 0x02, 0x08, 0x01, 0x0F,
+  0x07, 0x02, 0x11, 0x06, 0x03, 0x13, 0x07, 0x04, 0x11, 0x1A, 0x04, 0x01,
+  0x04, 0x05, 0x02, 0x08, 0x05, 0x0F, 0x19, 0x05, 0x03, 0x03, 0x06, 0x04,
+  0x18, 0x06, 0x05, 0x02, 0x07, 0x06, 0x17, 0x07, 0x06, 0x02, 0x08, 0x06,
+  0x17, 0x08, 0x06, 0x02, 0x09, 0x06, 0x17, 0x09, 0x06, 0x02, 0x0A, 0x06,
+  0x17, 0x0A, 0x06, 0x02, 0x0B, 0x06, 0x17, 0x0B, 0x06, 0x02, 0x0C, 0x06,
+  0x17, 0x0C, 0x06, 0x02, 0x0D, 0x06, 0x17, 0x0D, 0x06, 0x02, 0x0E, 0x06,
+  0x17, 0x0E, 0x06, 0x02, 0x0F, 0x06, 0x17, 0x0F, 0x06, 0x02, 0x10, 0x06,
+  0x17, 0x10, 0x06, 0x02, 0x11, 0x06, 0x17, 0x11, 0x06, 0x02, 0x12, 0x06,
+  0x17, 0x12, 0x06, 0x02, 0x13, 0x06, 0x17, 0x13, 0x06, 0x02, 0x14, 0x05,
+  0x18, 0x14, 0x05, 0x02, 0x15, 0x03, 0x08, 0x15, 0x0F, 0x1A, 0x15, 0x03,
+  0x02, 0x16, 0x01, 0x06, 0x16, 0x13, 0x1C, 0x16, 0x01, 0x04, 0x17, 0x17,
+  0x02, 0x18, 0x01, 0x05, 0x18, 0x15, 0x02, 0x19, 0x03, 0x07, 0x19, 0x11,
+  0x1B, 0x19, 0x02, 0x02, 0x1A, 0x05, 0x19, 0x1A, 0x04, 0x02, 0x1B, 0x06,
+  0x17, 0x1B, 0x06, 0x02, 0x1C, 0x06, 0x17, 0x1C, 0x06, 0x02, 0x1D, 0x06,
+  0x17, 0x1D, 0x06, 0x02, 0x1E, 0x06, 0x17, 0x1E, 0x06, 0x02, 0x1F, 0x06,
+  0x17, 0x1F, 0x06, 0x02, 0x20, 0x06, 0x17, 0x20, 0x06, 0x02, 0x21, 0x06,
+  0x17, 0x21, 0x06, 0x02, 0x22, 0x06, 0x17, 0x22, 0x06, 0x02, 0x23, 0x06,
+  0x17, 0x23, 0x06, 0x02, 0x24, 0x06, 0x17, 0x24, 0x06, 0x02, 0x25, 0x06,
+  0x17, 0x25, 0x06, 0x02, 0x26, 0x06, 0x17, 0x26, 0x06, 0x02, 0x27, 0x06,
+  0x17, 0x27, 0x06, 0x02, 0x28, 0x06, 0x17, 0x28, 0x06, 0x03, 0x29, 0x04,
+  0x18, 0x29, 0x04, 0x04, 0x2A, 0x02, 0x08, 0x2A, 0x0F, 0x19, 0x2A, 0x02,
+  0x07, 0x2B, 0x11, 0x06, 0x2C, 0x13, 0x07, 0x2D, 0x11, 0x08, 0x2E, 0x0F,
+  0x08, 0x01, 0x0F, 0x07, 0x02, 0x11, 0x06, 0x03, 0x13, 0x07, 0x04, 0x11,
+  0x1A, 0x04, 0x01, 0x04, 0x05, 0x02, 0x08, 0x05, 0x0F, 0x19, 0x05, 0x03,
+  0x03, 0x06, 0x04, 0x18, 0x06, 0x05, 0x02, 0x07, 0x06, 0x17, 0x07, 0x06,
+  0x02, 0x08, 0x06, 0x17, 0x08, 0x06, 0x02, 0x09, 0x06, 0x17, 0x09, 0x06,
+  0x02, 0x0A, 0x06, 0x17, 0x0A, 0x06, 0x02, 0x0B, 0x06, 0x17, 0x0B, 0x06,
+  0x02, 0x0C, 0x06, 0x17, 0x0C, 0x06, 0x02, 0x0D, 0x06, 0x17, 0x0D, 0x06,
+  0x02, 0x0E, 0x06, 0x17, 0x0E, 0x06, 0x02, 0x0F, 0x06, 0x17, 0x0F, 0x06,
+  0x02, 0x10, 0x06, 0x17, 0x10, 0x06, 0x02, 0x11, 0x06, 0x17, 0x11, 0x06,
+  0x02, 0x12, 0x06, 0x17, 0x12, 0x06, 0x02, 0x13, 0x06, 0x17, 0x13, 0x06,
+  0x02, 0x14, 0x05, 0x18, 0x14, 0x05, 0x02, 0x15, 0x03, 0x08, 0x15, 0x0F,
+  0x1A, 0x15, 0x03, 0x02, 0x16, 0x01, 0x06, 0x16, 0x13, 0x1C, 0x16, 0x01,
+  0x04, 0x17, 0x17, 0x05, 0x18, 0x15, 0x07, 0x19, 0x11, 0x1B, 0x19, 0x02,
+  0x19, 0x1A, 0x04, 0x17, 0x1B, 0x06, 0x17, 0x1C, 0x06, 0x17, 0x1D, 0x06,
+  0x17, 0x1E, 0x06, 0x17, 0x1F, 0x06, 0x17, 0x20, 0x06, 0x17, 0x21, 0x06,
+  0x17, 0x22, 0x06, 0x17, 0x23, 0x06, 0x17, 0x24, 0x06, 0x17, 0x25, 0x06,
+  0x17, 0x26, 0x06, 0x17, 0x27, 0x06, 0x17, 0x28, 0x06, 0x18, 0x29, 0x04,
+  0x08, 0x2A, 0x0F, 0x19, 0x2A, 0x02, 0x07, 0x2B, 0x11, 0x06, 0x2C, 0x13,
+  0x07, 0x2D, 0x11, 0x08, 0x2E, 0x0F, 0x04, 0x0D, 0x03, 0x03, 0x0E, 0x05,
+  0x03, 0x0F, 0x05, 0x03, 0x10, 0x05, 0x04, 0x11, 0x03, 0x04, 0x1E, 0x03,
+  0x03, 0x1F, 0x05, 0x03, 0x20, 0x05, 0x03, 0x21, 0x05, 0x04, 0x22, 0x03,
+};
+
+// Character c has spans spanidx_f7s[c - 32] to spanidx_f7s[c - 31] - 1
+PROGMEM const unsigned short spanidx_f7s[97] =
+{
+      0,     0,     0,     0,     0,     0,     0,     0,
+      0,     0,     0,     0,     0,     0,     5,    10,
+     10,    94,   131,   184,   236,   296,   347,   417,
+    459,   548,   618,   628,   628,   628,   628,   628,
+    628,   628,   628,   628,   628,   628,   628,   628,
+    628,   628,   628,   628,   628,   628,   628,   628,
+    628,   628,   628,   628,   628,   628,   628,   628,
+    628,   628,   628,   628,   628,   628,   628,   628,
+    628,   628,   628,   628,   628,   628,   628,   628,
+    628,   628,   628,   628,   628,   628,   628,   628,
+    628,   628,   628,   628,   628,   628,   628,   628,
+    628,   628,   628,   628,   628,   628,   628,   628,
+    628,
+};
@@ -0,0 +1,698 @@
+        ////////////////////////////////////////////////////
+        //    TFT_eSPI host (PC) emulated panel driver    //
+        ////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////
+// Global variables
+////////////////////////////////////////////////////////////////////////////////////////
+
+// Select the SPI port to use (placeholder, see Tools/Host/SPI.h)
+#ifdef TFT_SPI_PORT
+  SPIClass& spi = TFT_SPI_PORT;
+#else
+  SPIClass& spi = SPI;
+#endif
+
+// The emulated panel
+TFT_eSPI_HostPanel tft_host;
+
+// MIPI DCS commands decoded by the panel model
+#define HOST_CASET  0x2A
+#define HOST_RASET  0x2B
+#define HOST_RAMWR  0x2C
+#define HOST_RAMRD  0x2E
+#define HOST_MADCTL 0x36
+#define HOST_RAMWRC 0x3C // Memory write continue
+
+#define HOST_MAD_MY 0x80
+#define HOST_MAD_MX 0x40
+#define HOST_MAD_MV 0x20
+
+// TE output of the panel for digitalRead()
+static int readPin(uint8_t pin)
+{
+  if (pin != tft_host.tePin || !tft_host.scanPeriod) return -1;
+  return tft_host.te() ? HIGH : LOW;
+}
+
+/***************************************************************************************
+** Function name:           TFT_eSPI_HostPanel
+** Description:             Constructor
+***************************************************************************************/
+TFT_eSPI_HostPanel::TFT_eSPI_HostPanel(void)
+{
+  fb = nullptr;
+  fbWidth = fbHeight = 0;
+  cs = false; dc = true;
+  cmd = 0; paramCount = 0;
+  highByte = false; pixelHigh = 0;
+  madctl = 0;
+  xs = ys = 0; xe = ye = 0;
+  col = row = 0;
+  readPhase = 0;
+  dmaEnd = 0;
+  memset(&stats, 0, sizeof(stats));
+
+  attachPinReader(readPin);
+}
+
+TFT_eSPI_HostPanel::~TFT_eSPI_HostPanel(void)
+{
+  free(fb);
+}
+
+/***************************************************************************************
+** Function name:           begin
+** Description:             Allocate and clear the frame buffer
+***************************************************************************************/
+void TFT_eSPI_HostPanel::begin(int32_t w, int32_t h)
+{
+  if (fb == nullptr || w != fbWidth || h != fbHeight) {
+    free(fb);
+    fb = (uint16_t*)calloc(w * h, sizeof(uint16_t));
+    fbWidth  = w;
+    fbHeight = h;
+  }
+  else memset(fb, 0, w * h * sizeof(uint16_t));
+
+  xs = ys = 0;
+  xe = w - 1; ye = h - 1;
+  col = row = 0;
+  madctl = 0;
+}
+
+/***************************************************************************************
+** Function name:           write8
+** Description:             Decode a byte clocked out on the bus
+***************************************************************************************/
+void TFT_eSPI_HostPanel::write8(uint8_t data)
+{
+  if (!dc) {
+    stats.commands++;
+    stats.cmdBytes++;
+    command(data);
+    return;
+  }
+
+  if (cmd == HOST_RAMWR || cmd == HOST_RAMWRC) {
+    stats.pixelBytes++;
+    if (highByte) { highByte = false; pixel(pixelHigh << 8 | data); }
+    else          { highByte = true;  pixelHigh = data; }
+    return;
+  }
+
+  stats.cmdBytes++;
+  parameter(data);
+}
+
+/***************************************************************************************
+** Function name:           write16
+** Description:             Decode 16 bits clocked out on the bus, MS byte first
+***************************************************************************************/
+void TFT_eSPI_HostPanel::write16(uint16_t data)
+{
+  if (dc && !highByte && (cmd == HOST_RAMWR || cmd == HOST_RAMWRC)) {
+    stats.pixelBytes += 2;
+    pixel(data);
+    return;
+  }
+  write8(data >> 8);
+  write8(data);
+}
+
+/***************************************************************************************
+** Function name:           writeBlock
+** Description:             Decode len repeats of a 16 bit value
+***************************************************************************************/
+void TFT_eSPI_HostPanel::writeBlock(uint16_t color, uint32_t len)
+{
+  while (len--) write16(color);
+}
+
+/***************************************************************************************
+** Function name:           writePixels
+** Description:             Decode a block of pixels held in memory
+***************************************************************************************/
+// As for TFT_eSPI::pushPixels(), swap = true sends each 16 bit value MS byte first,
+// swap = false sends the bytes in memory order (i.e. data is already big-endian)
+void TFT_eSPI_HostPanel::writePixels(const uint16_t* data, uint32_t len, bool swap)
+{
+  if (discardPixels && dc && cmd == HOST_RAMWR && !highByte) {
+    stats.pixelBytes += len * 2;
+    return;
+  }
+
+  if (swap) while (len--) { write16(*data++); }
+  else      while (len--) { uint16_t c = *data++; write16(c << 8 | c >> 8); }
+}
+
+/***************************************************************************************
+** Function name:           read8
+** Description:             Return the next byte of a RAMRD (18 bit RGB) read
+***************************************************************************************/
+uint8_t TFT_eSPI_HostPanel::read8(void)
+{
+  stats.readBytes++;
+
+  if (cmd != HOST_RAMRD || fb == nullptr) return 0;
+
+  if (readPhase == 0) { readPhase = 1; return 0; } // Dummy byte
+
+  uint32_t index = pixelIndex();
+  uint16_t color = (index < (uint32_t)(fbWidth * fbHeight)) ? fb[index] : 0;
+
+  uint8_t data;
+  if      (readPhase == 1) data = (color >> 8) & 0xF8;
+  else if (readPhase == 2) data = (color >> 3) & 0xFC;
+  else                     data = (color << 3) & 0xF8;
+
+  if (++readPhase > 3) {
+    readPhase = 1;
+    if (++col > xe) { col = xs; if (++row > ye) row = ys; }
+  }
+
+  return data;
+}
+
+/***************************************************************************************
+** Function name:           command
+** Description:             Start a new command
+***************************************************************************************/
+void TFT_eSPI_HostPanel::command(uint8_t c)
+{
+  cmd = c;
+  paramCount = 0;
+  highByte = false;
+
+  switch (c) {
+    case HOST_CASET:
+    case HOST_RASET:
+      stats.windows++;
+      break;
+    case HOST_RAMWR:
+    case HOST_RAMRD:
+      col = xs;
+      row = ys;
+      readPhase = 0;
+      break;
+  }
+}
+
+/***************************************************************************************
+** Function name:           parameter
+** Description:             Collect command parameters
+***************************************************************************************/
+void TFT_eSPI_HostPanel::parameter(uint8_t data)
+{
+  if (paramCount < sizeof(param)) param[paramCount] = data;
+  paramCount++;
+
+  switch (cmd) {
+    case HOST_CASET:
+      if (paramCount == 4) {
+        xs = param[0] << 8 | param[1];
+        xe = param[2] << 8 | param[3];
+      }
+      break;
+    case HOST_RASET:
+      if (paramCount == 4) {
+        ys = param[0] << 8 | param[1];
+        ye = param[2] << 8 | param[3];
+      }
+      break;
+    case HOST_MADCTL:
+      if (paramCount == 1) madctl = data & (HOST_MAD_MY | HOST_MAD_MX | HOST_MAD_MV);
+      break;
+  }
+}
+
+/***************************************************************************************
+** Function name:           pixelIndex
+** Description:             Map the memory pointer to a frame buffer index
+***************************************************************************************/
+// Out of range addresses return an index past the end of the frame buffer
+inline uint32_t TFT_eSPI_HostPanel::pixelIndex(void)
+{
+  int32_t px = col, py = row;
+
+  if (madctl & HOST_MAD_MV) { px = row; py = col; }
+  if (madctl & HOST_MAD_MX) px = fbWidth  - 1 - px;
+  if (madctl & HOST_MAD_MY) py = fbHeight - 1 - py;
+
+  if ((uint32_t)px >= (uint32_t)fbWidth || (uint32_t)py >= (uint32_t)fbHeight) return UINT32_MAX;
+
+  return px + py * fbWidth;
+}
+
+/***************************************************************************************
+** Function name:           pixel
+** Description:             Write a pixel at the memory pointer and advance the pointer
+***************************************************************************************/
+inline void TFT_eSPI_HostPanel::pixel(uint16_t color)
+{
+  uint32_t index = pixelIndex();
+  if (index != UINT32_MAX && fb) fb[index] = color;
+
+  if (++col > xe) { col = xs; if (++row > ye) row = ys; }
+}
+
+/***************************************************************************************
+** Function name:           getPixel
+** Description:             Read a frame buffer pixel (panel native orientation)
+***************************************************************************************/
+uint16_t TFT_eSPI_HostPanel::getPixel(int32_t x, int32_t y)
+{
+  if (fb == nullptr || x < 0 || y < 0 || x >= fbWidth || y >= fbHeight) return 0;
+  return fb[x + y * fbWidth];
+}
+
+/***************************************************************************************
+** Function name:           dmaStart
+** Description:             Start a timed DMA transfer and check it for tearing
+***************************************************************************************/
+// Pixels are stored at once, the transfer only sets the time dmaBusy() is true
+void TFT_eSPI_HostPanel::dmaStart(uint32_t len)
+{
+  stats.dmaTransfers++;
+  if (!dmaBitRate) return;
+
+  dmaWait(); // One transfer at a time
+  uint32_t start = micros();
+  uint32_t time  = (uint64_t)len * 16 * 1000000 / dmaBitRate;
+  dmaEnd = start + time;
+
+  if (scanPeriod && torn(start, time, len)) stats.dmaTears++;
+}
+
+/***************************************************************************************
+** Function name:           dmaBusy
+** Description:             True until the last DMA transfer time has passed
+***************************************************************************************/
+bool TFT_eSPI_HostPanel::dmaBusy(void)
+{
+  return dmaBitRate && (int32_t)(dmaEnd - micros()) > 0;
+}
+
+/***************************************************************************************
+** Function name:           dmaWait
+** Description:             Wait for the last DMA transfer to end
+***************************************************************************************/
+void TFT_eSPI_HostPanel::dmaWait(void)
+{
+  while (dmaBusy()) {
+    int32_t left = dmaEnd - micros();
+    if (left > 200) delayMicroseconds(left - 100); // Sleep, then spin for the last part
+  }
+}
+
+/***************************************************************************************
+** Function name:           scanLine
+** Description:             Row scanned out at a time, -1 during blanking
+***************************************************************************************/
+int32_t TFT_eSPI_HostPanel::scanLine(uint32_t time)
+{
+  if (!scanPeriod) return 0;
+
+  uint32_t blank = scanBlank ? scanBlank : scanPeriod / 16;
+  uint32_t phase = time % scanPeriod;
+  if (phase < blank) return -1;
+  return (uint64_t)(phase - blank) * fbHeight / (scanPeriod - blank);
+}
+
+/***************************************************************************************
+** Function name:           torn
+** Description:             Check if the scan out crosses a transfer
+***************************************************************************************/
+// A transfer tears if one refresh shows some of its rows new and some old. Rows are
+// written in order at a constant rate, so for each refresh the time from the write of
+// a row to its scan changes linearly from the first row to the last: if it changes
+// sign the scan crossed the write.
+bool TFT_eSPI_HostPanel::torn(uint32_t start, uint32_t time, uint32_t len)
+{
+  int32_t ww = xe - xs + 1;
+  int32_t r0 = row, r1 = row + (col - xs + (int32_t)len - 1) / ww;
+  if (r1 > ye) r1 = ye;
+
+  double  p = scanPeriod, b = scanBlank ? scanBlank : scanPeriod / 16;
+  double  line = (p - b) / fbHeight;
+  int64_t k0 = start / scanPeriod - 1, k1 = ((uint64_t)start + time) / scanPeriod + 1;
+
+  if (madctl & HOST_MAD_MV) {
+    // Window rows are panel columns, so all panel rows change during the transfer
+    int32_t lo = xs, hi = xe;
+    if (madctl & HOST_MAD_MY) { lo = fbHeight - 1 - xe; hi = fbHeight - 1 - xs; }
+    for (int64_t k = k0; k <= k1; k++) {
+      double s0 = k * p + b + lo * line, s1 = k * p + b + (hi + 1) * line;
+      if (s0 < (double)start + time && s1 > start) return true;
+    }
+    return false;
+  }
+
+  int32_t n = r1 - r0 + 1, first = r0, dir = 1;
+  if (n < 2) return false;
+  if (madctl & HOST_MAD_MY) { first = fbHeight - 1 - r0; dir = -1; }
+  int32_t last = first + dir * (n - 1);
+
+  for (int64_t k = k0; k <= k1; k++) {
+    double g0 = k * p + b + first * line - (start + (double)time / n);
+    double g1 = k * p + b + last  * line - ((double)start + time);
+    if ((g0 < 0) != (g1 < 0)) return true;
+  }
+  return false;
+}
+
+/***************************************************************************************
+** Function name:           savePPM
+** Description:             Save the frame buffer as a binary PPM image
+***************************************************************************************/
+bool TFT_eSPI_HostPanel::savePPM(const char* filename)
+{
+  if (fb == nullptr) return false;
+
+  FILE* f = fopen(filename, "wb");
+  if (f == nullptr) return false;
+
+  fprintf(f, "P6\n%d %d\n255\n", (int)fbWidth, (int)fbHeight);
+
+  for (int32_t i = 0; i < fbWidth * fbHeight; i++) {
+    uint16_t c = fb[i];
+    uint8_t rgb[3] = { (uint8_t)((c >> 8) & 0xF8), (uint8_t)((c >> 3) & 0xFC), (uint8_t)((c << 3) & 0xF8) };
+    rgb[0] |= rgb[0] >> 5; rgb[1] |= rgb[1] >> 6; rgb[2] |= rgb[2] >> 5;
+    fwrite(rgb, 1, 3, f);
+  }
+
+  return fclose(f) == 0;
+}
+
+/***************************************************************************************
+** Function name:           savePNG
+** Description:             Save the frame buffer as a PNG image
+***************************************************************************************/
+// Deflate "stored" blocks are used so no compression library is needed
+
+static uint32_t host_crc32(uint32_t crc, const uint8_t* data, uint32_t len)
+{
+  static uint32_t table[256];
+  if (table[1] == 0) {
+    for (uint32_t n = 0; n < 256; n++) {
+      uint32_t c = n;
+      for (uint8_t k = 0; k < 8; k++) c = (c & 1) ? 0xEDB88320 ^ (c >> 1) : c >> 1;
+      table[n] = c;
+    }
+  }
+  crc = ~crc;
+  while (len--) crc = table[(crc ^ *data++) & 0xFF] ^ (crc >> 8);
+  return ~crc;
+}
+
+static void host_put32(uint8_t* p, uint32_t v)
+{
+  p[0] = v >> 24; p[1] = v >> 16; p[2] = v >> 8; p[3] = v;
+}
+
+static void host_png_chunk(FILE* f, const char* type, const uint8_t* data, uint32_t len)
+{
+  uint8_t hdr[8];
+  host_put32(hdr, len);
+  memcpy(hdr + 4, type, 4);
+  fwrite(hdr, 1, 8, f);
+  if (len) fwrite(data, 1, len, f);
+  uint32_t crc = host_crc32(0, hdr + 4, 4);
+  crc = host_crc32(crc, data, len);
+  host_put32(hdr, crc);
+  fwrite(hdr, 1, 4, f);
+}
+
+bool TFT_eSPI_HostPanel::savePNG(const char* filename)
+{
+  if (fb == nullptr) return false;
+
+  return savePNG(filename, fb, fbWidth, fbHeight);
+}
+
+bool TFT_eSPI_HostPanel::savePNG(const char* filename, const uint16_t* image, int32_t w, int32_t h)
+{
+  // Raw scanlines, filter byte 0 then RGB triplets
+  uint32_t lineLen = 1 + w * 3;
+  uint32_t rawLen  = lineLen * h;
+  uint8_t* raw = (uint8_t*)malloc(rawLen);
+  if (raw == nullptr) return false;
+
+  uint8_t* p = raw;
+  for (int32_t y = 0; y < h; y++) {
+    *p++ = 0;
+    for (int32_t x = 0; x < w; x++) {
+      uint16_t c = image[x + y * w];
+      uint8_t r = (c >> 8) & 0xF8, g = (c >> 3) & 0xFC, b = (c << 3) & 0xF8;
+      *p++ = r | r >> 5; *p++ = g | g >> 6; *p++ = b | b >> 5;
+    }
+  }
+
+  // zlib stream: header, stored blocks of up to 65535 bytes, Adler-32
+  uint32_t blocks = (rawLen + 65534) / 65535;
+  uint32_t zLen = 2 + blocks * 5 + rawLen + 4;
+  uint8_t* z = (uint8_t*)malloc(zLen);
+  if (z == nullptr) { free(raw); return false; }
+
+  uint8_t* q = z;
+  *q++ = 0x78; *q++ = 0x01;
+  uint32_t s1 = 1, s2 = 0;
+  for (uint32_t pos = 0; pos < rawLen; ) {
+    uint32_t n = rawLen - pos;
+    if (n > 65535) n = 65535;
+    *q++ = (pos + n == rawLen) ? 1 : 0; // BFINAL on last block, BTYPE = 00
+    *q++ = n; *q++ = n >> 8; *q++ = ~n; *q++ = (~n) >> 8;
+    memcpy(q, raw + pos, n);
+    for (uint32_t i = 0; i < n; i++) { s1 = (s1 + raw[pos + i]) % 65521; s2 = (s2 + s1) % 65521; }
+    q += n; pos += n;
+  }
+  host_put32(q, s2 << 16 | s1);
+
+  FILE* f = fopen(filename, "wb");
+  if (f == nullptr) { free(raw); free(z); return false; }
+
+  static const uint8_t signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+  fwrite(signature, 1, 8, f);
+
+  uint8_t ihdr[13];
+  host_put32(ihdr, w);
+  host_put32(ihdr + 4, h);
+  ihdr[8] = 8;  // Bit depth
+  ihdr[9] = 2;  // Colour type RGB
+  ihdr[10] = 0; // Compression
+  ihdr[11] = 0; // Filter
+  ihdr[12] = 0; // Interlace
+  host_png_chunk(f, "IHDR", ihdr, 13);
+  host_png_chunk(f, "IDAT", z, zLen);
+  host_png_chunk(f, "IEND", nullptr, 0);
+
+  free(raw);
+  free(z);
+
+  return fclose(f) == 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////
+// TFT_eSPI class functions for the host
+////////////////////////////////////////////////////////////////////////////////////////
+
+/***************************************************************************************
+** Function name:           pushBlock - for host
+** Description:             Write a block of pixels of the same colour
+***************************************************************************************/
+void TFT_eSPI::pushBlock(uint16_t color, uint32_t len){
+
+  tft_host.writeBlock(color, len);
+}
+
+/***************************************************************************************
+** Function name:           pushPixels - for host
+** Description:             Write a sequence of pixels
+***************************************************************************************/
+void TFT_eSPI::pushPixels(const void* data_in, uint32_t len){
+
+  tft_host.writePixels((const uint16_t*)data_in, len, _swapBytes);
+}
+
+/***************************************************************************************
+** Function name:           pushSwapBytePixels - for host
+** Description:             Write a sequence of pixels with swapped bytes
+***************************************************************************************/
+void TFT_eSPI::pushSwapBytePixels(const void* data_in, uint32_t len){
+
+  tft_host.writePixels((const uint16_t*)data_in, len, true);
+}
+
+/***************************************************************************************
+** Function name:           getBusStats
+** Description:             Copy the emulated bus traffic counters
+***************************************************************************************/
+void TFT_eSPI::getBusStats(bus_stats_t& stats)
+{
+  stats = tft_host.stats;
+}
+
+/***************************************************************************************
+** Function name:           resetBusStats
+** Description:             Clear the emulated bus traffic counters
+***************************************************************************************/
+void TFT_eSPI::resetBusStats(void)
+{
+  memset(&tft_host.stats, 0, sizeof(bus_stats_t));
+}
+
+/***************************************************************************************
+** Function name:           getFrameBuffer
+** Description:             Return pointer to emulated panel memory (rotation 0 layout)
+***************************************************************************************/
+uint16_t* TFT_eSPI::getFrameBuffer(void)
+{
+  return tft_host.frameBuffer();
+}
+
+/***************************************************************************************
+** Function name:           saveScreen
+** Description:             Save emulated panel memory, ".ppm" extension selects PPM
+***************************************************************************************/
+bool TFT_eSPI::saveScreen(const char* filename)
+{
+  size_t len = strlen(filename);
+  if (len > 4 && strcmp(filename + len - 4, ".ppm") == 0) return tft_host.savePPM(filename);
+  return tft_host.savePNG(filename);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////
+//                                DMA FUNCTIONS
+////////////////////////////////////////////////////////////////////////////////////////
+// The emulated DMA engine stores the pixels before returning. Transfers are counted in
+// bus_stats_t so DMA use can be checked, and with tft_host.dmaBitRate set dmaBusy()
+// stays true for the bus time of the transfer (see TFT_eSPI_HostPanel::dmaStart()).
+
+/***************************************************************************************
+** Function name:           dmaBusy
+** Description:             Check if DMA is busy
+***************************************************************************************/
+bool TFT_eSPI::dmaBusy(void)
+{
+  return tft_host.dmaBusy();
+}
+
+/***************************************************************************************
+** Function name:           dmaWait
+** Description:             Wait until DMA is over (blocking!)
+***************************************************************************************/
+void TFT_eSPI::dmaWait(void)
+{
+  tft_host.dmaWait();
+  spiBusyCheck = 0;
+}
+
+/***************************************************************************************
+** Function name:           pushPixelsDMA
+** Description:             Push pixels to TFT
+***************************************************************************************/
+// This will byte swap the original image if setSwapBytes(true) was called by sketch.
+void TFT_eSPI::pushPixelsDMA(uint16_t* image, uint32_t len)
+{
+  if ((len == 0) || (!DMA_Enabled)) return;
+
+  if(_swapBytes) {
+    for (uint32_t i = 0; i < len; i++) (image[i] = image[i] << 8 | image[i] >> 8);
+  }
+
+  tft_host.dmaStart(len);
+  tft_host.writePixels(image, len, false);
+}
+
+/***************************************************************************************
+** Function name:           pushImageDMA
+** Description:             Push image to a window
+***************************************************************************************/
+// Fixed const data assumed, will NOT clip or swap bytes
+void TFT_eSPI::pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t const* image)
+{
+  if ((w == 0) || (h == 0) || (!DMA_Enabled)) return;
+
+  setAddrWindow(x, y, w, h);
+
+  tft_host.dmaStart(w * h);
+  tft_host.writePixels(image, w * h, false);
+}
+
+/***************************************************************************************
+** Function name:           pushImageDMA
+** Description:             Push image to a window
+***************************************************************************************/
+// This will clip and also swap bytes if setSwapBytes(true) was called by sketch
+void TFT_eSPI::pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* image, uint16_t* buffer)
+{
+  if ((x >= _vpW) || (y >= _vpH) || (!DMA_Enabled)) return;
+
+  int32_t dx = 0;
+  int32_t dy = 0;
+  int32_t dw = w;
+  int32_t dh = h;
+
+  if (x < _vpX) { dx = _vpX - x; dw -= dx; x = _vpX; }
+  if (y < _vpY) { dy = _vpY - y; dh -= dy; y = _vpY; }
+
+  if ((x + dw) > _vpW ) dw = _vpW - x;
+  if ((y + dh) > _vpH ) dh = _vpH - y;
+
+  if (dw < 1 || dh < 1) return;
+
+  uint32_t len = dw*dh;
+
+  if (buffer == nullptr) buffer = image;
+
+  // If image is clipped, copy pixels into a contiguous block
+  if ( (dw != w) || (dh != h) ) {
+    if(_swapBytes) {
+      for (int32_t yb = 0; yb < dh; yb++) {
+        for (int32_t xb = 0; xb < dw; xb++) {
+          uint32_t src = xb + dx + w * (yb + dy);
+          (buffer[xb + yb * dw] = image[src] << 8 | image[src] >> 8);
+        }
+      }
+    }
+    else {
+      for (int32_t yb = 0; yb < dh; yb++) {
+        memmove((uint8_t*) (buffer + yb * dw), (uint8_t*) (image + dx + w * (yb + dy)), dw << 1);
+      }
+    }
+  }
+  // else, if a buffer pointer has been provided copy whole image to the buffer
+  else if (buffer != image || _swapBytes) {
+    if(_swapBytes) {
+      for (uint32_t i = 0; i < len; i++) (buffer[i] = image[i] << 8 | image[i] >> 8);
+    }
+    else {
+      memcpy(buffer, image, len*2);
+    }
+  }
+
+  setAddrWindow(x, y, dw, dh);
+
+  tft_host.dmaStart(len);
+  tft_host.writePixels(buffer, len, false);
+}
+
+/***************************************************************************************
+** Function name:           initDMA
+** Description:             Initialise the emulated DMA engine
+***************************************************************************************/
+bool TFT_eSPI::initDMA(bool ctrl_cs)
+{
+  (void)ctrl_cs;
+  DMA_Enabled = true;
+  return true;
+}
+
+/***************************************************************************************
+** Function name:           deInitDMA
+** Description:             Disconnect the emulated DMA engine
+***************************************************************************************/
+void TFT_eSPI::deInitDMA(void)
+{
+  DMA_Enabled = false;
+}
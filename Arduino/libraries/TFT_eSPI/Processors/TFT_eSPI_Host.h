@@ -0,0 +1,200 @@
+        ////////////////////////////////////////////////////
+        //    TFT_eSPI host (PC) emulated panel driver    //
+        ////////////////////////////////////////////////////
+
+// This backend is used when the library is compiled on a PC with the minimal Arduino
+// core in Tools/Host. Nothing is sent to hardware: bytes that would be clocked out on
+// the SPI bus are decoded by a software model of a MIPI DCS panel which renders into an
+// in-memory RGB565 frame buffer. Every byte is counted so the bus cost of drawing
+// functions can be measured, and the frame buffer can be saved as a PNG or PPM image.
+
+#ifndef _TFT_eSPI_HOSTH_
+#define _TFT_eSPI_HOSTH_
+
+// Processor ID reported by getSetup()
+#define PROCESSOR_ID 0x8086
+
+// To be safe, SUPPORT_TRANSACTIONS is assumed mandatory
+#if !defined (SUPPORT_TRANSACTIONS)
+  #define SUPPORT_TRANSACTIONS
+#endif
+
+// Processor specific code used by SPI bus transaction startWrite and endWrite functions
+#define SET_BUS_WRITE_MODE // Not used
+#define SET_BUS_READ_MODE  // Not used
+
+// Code to check if DMA is busy, used by SPI bus transaction startWrite and endWrite functions
+#define DMA_BUSY_CHECK  dmaWait()
+
+// Initialise processor specific SPI functions, used by init()
+#define INIT_TFT_DATA_BUS tft_host.begin(TFT_WIDTH, TFT_HEIGHT)
+
+// The emulated panel has no parallel or 18 bit modes
+#if defined (TFT_PARALLEL_8_BIT) || defined (SPI_18BIT_DRIVER) || defined (RPI_DISPLAY_TYPE)
+  #error >>>>------>> The host backend only emulates a 16 bit colour SPI panel
+#endif
+
+// Smooth fonts are loaded from FLASH (PROGMEM) arrays, no filing system is available
+
+////////////////////////////////////////////////////////////////////////////////////////
+// Emulated panel
+////////////////////////////////////////////////////////////////////////////////////////
+
+// Bus traffic counters, a "byte" is one 8 bit transfer on the SPI bus
+typedef struct
+{
+  uint32_t transactions; // Number of chip select low periods
+  uint32_t commands;     // Command bytes (DC low)
+  uint32_t windows;      // Address window commands (CASET or RASET)
+  uint32_t cmdBytes;     // Command and parameter bytes, i.e. all overhead bytes
+  uint32_t pixelBytes;   // Bytes written to panel memory after a RAMWR command
+  uint32_t readBytes;    // Bytes read back from the panel
+  uint32_t dmaTransfers; // Number of DMA transfers started
+  uint32_t dmaTears;     // DMA transfers crossed by the panel scan out (scan model on)
+} bus_stats_t;
+
+class TFT_eSPI_HostPanel {
+
+ public:
+
+  TFT_eSPI_HostPanel(void);
+  ~TFT_eSPI_HostPanel(void);
+
+           // Called by TFT_eSPI::init(), allocates a frame buffer of the panel native size
+  void     begin(int32_t w, int32_t h);
+
+           // Bus signals, used by the CS_L/H, DC_C/D, tft_Write_xx and tft_Read_8 macros
+  inline void csLow(void)  { if (!cs) { cs = true; stats.transactions++; } }
+  inline void csHigh(void) { cs = false; }
+  inline void dcCommand(void) { dc = false; }
+  inline void dcData(void)    { dc = true; }
+
+  void     write8(uint8_t data);
+  void     write16(uint16_t data);
+  void     writeBlock(uint16_t color, uint32_t len);   // Same big-endian 16 bit value len times
+  void     writePixels(const uint16_t* data, uint32_t len, bool swap);
+  uint8_t  read8(void);
+
+           // Frame buffer in panel native orientation (rotation 0), RGB565 host byte order
+  uint16_t* frameBuffer(void) { return fb; }
+  int32_t  width(void)  { return fbWidth; }
+  int32_t  height(void) { return fbHeight; }
+  uint16_t getPixel(int32_t x, int32_t y);
+
+           // Save frame buffer as a binary PPM (P6) or PNG (uncompressed deflate) image
+  bool     savePPM(const char* filename);
+  bool     savePNG(const char* filename);
+           // Save any RGB565 (host byte order) image as a PNG
+  static bool savePNG(const char* filename, const uint16_t* image, int32_t w, int32_t h);
+
+  bus_stats_t stats;
+
+  bool     discardPixels = false; // Count but do not store RAMWR pixels (times pixel generation only)
+
+           // Timed DMA and scan out model, off by default so DMA transfers take no time.
+           // With dmaBitRate set a transfer keeps dmaBusy() true for its bus time. With
+           // scanPeriod set the panel scans rows 0 to height - 1 after a blanking time at
+           // the start of each period, TE is high during blanking and a transfer that the
+           // scan crosses (new and old rows shown in one refresh) is counted in dmaTears.
+  uint32_t dmaBitRate = 0;        // DMA bus clock, bits per second
+  uint32_t scanPeriod = 0;        // Refresh period, microseconds (micros() 0 starts a period)
+  uint32_t scanBlank  = 0;        // Blanking time, microseconds, scanPeriod / 16 if 0
+  uint8_t  tePin = 255;           // digitalRead() of this pin returns TE
+
+  void     dmaStart(uint32_t len); // Start a transfer of len pixels at the memory pointer
+  bool     dmaBusy(void);
+  void     dmaWait(void);
+  int32_t  scanLine(uint32_t time); // Row scanned out at a micros() time, -1 during blanking
+  bool     te(void) { return scanPeriod && scanLine(micros()) < 0; }
+
+ private:
+
+  void     command(uint8_t cmd);
+  void     parameter(uint8_t data);
+  inline void pixel(uint16_t color);
+  inline uint32_t pixelIndex(void);
+
+  uint16_t* fb;
+  int32_t  fbWidth, fbHeight;
+
+  bool     cs, dc;
+
+  uint8_t  cmd;       // Current command
+  uint8_t  param[4];  // Command parameter bytes
+  uint8_t  paramCount;
+  bool     highByte;  // A pixel high byte is waiting for the low byte
+  uint8_t  pixelHigh;
+
+  uint8_t  madctl;    // MADCTL MY, MX and MV bits
+  int32_t  xs, xe, ys, ye; // Address window (logical coordinates)
+  int32_t  col, row;  // Memory write/read pointer
+
+  uint8_t  readPhase; // RAMRD: 0 = dummy byte, then R, G and B
+
+  uint32_t dmaEnd;    // micros() time the last DMA transfer ends
+  bool     torn(uint32_t start, uint32_t time, uint32_t len);
+};
+
+// The one emulated panel
+extern TFT_eSPI_HostPanel tft_host;
+
+////////////////////////////////////////////////////////////////////////////////////////
+// Define the DC (TFT Data/Command or Register Select (RS))pin drive code
+////////////////////////////////////////////////////////////////////////////////////////
+#define DC_C tft_host.dcCommand()
+#define DC_D tft_host.dcData()
+
+////////////////////////////////////////////////////////////////////////////////////////
+// Define the CS (TFT chip select) pin drive code
+////////////////////////////////////////////////////////////////////////////////////////
+#define CS_L tft_host.csLow()
+#define CS_H tft_host.csHigh()
+
+////////////////////////////////////////////////////////////////////////////////////////
+// Make sure TFT_RD is defined if not used to avoid an error message
+////////////////////////////////////////////////////////////////////////////////////////
+#ifndef TFT_RD
+  #define TFT_RD -1
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////
+// Define the touch screen chip select pin drive code
+////////////////////////////////////////////////////////////////////////////////////////
+#define T_CS_L // No macro allocated so it generates no code
+#define T_CS_H // No macro allocated so it generates no code
+
+////////////////////////////////////////////////////////////////////////////////////////
+// Make sure TFT_MISO is defined if not used to avoid an error message
+////////////////////////////////////////////////////////////////////////////////////////
+#ifndef TFT_MISO
+  #define TFT_MISO -1
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////
+// Macros to write commands/pixel colour data to the emulated panel
+////////////////////////////////////////////////////////////////////////////////////////
+// Write 8 bits to TFT
+#define tft_Write_8(C)   tft_host.write8(C)
+
+// Write 16 bits, MS byte first as on the SPI bus
+#define tft_Write_16(C)  tft_host.write16(C)
+#define tft_Write_16N(C) tft_host.write16(C)
+
+// Write 16 bits with the bytes swapped
+#define tft_Write_16S(C) tft_host.write16((uint16_t)((C)<<8 | (C)>>8))
+
+// Write 32 bits
+#define tft_Write_32(C)  tft_host.write16((uint16_t)((C)>>16)); tft_host.write16((uint16_t)(C))
+
+// Write two address coordinates
+#define tft_Write_32C(C,D) tft_host.write16((uint16_t)(C)); tft_host.write16((uint16_t)(D))
+
+// Write same value twice
+#define tft_Write_32D(C) tft_host.write16((uint16_t)(C)); tft_host.write16((uint16_t)(C))
+
+////////////////////////////////////////////////////////////////////////////////////////
+// Macros to read from the emulated panel
+////////////////////////////////////////////////////////////////////////////////////////
+#define tft_Read_8() tft_host.read8()
+
+#endif // Header end
@@ -29,6 +29,8 @@
   #include "Processors/TFT_eSPI_STM32.c"
 #elif defined (ARDUINO_ARCH_RP2040)  || defined (ARDUINO_ARCH_MBED) // Raspberry Pi Pico
   #include "Processors/TFT_eSPI_RP2040.c"
+#elif defined (ARDUINO_ARCH_HOST) // PC build with Tools/Host Arduino core
+  #include "Processors/TFT_eSPI_Host.c"
 #else
   #include "Processors/TFT_eSPI_Generic.c"
 #endif
@@ -37,6 +39,38 @@
   #define SPI_BUSY_CHECK
 #endif
 
+// Send any pixels held in the write combining buffer, CS must be low
+#ifdef WRITE_COMBINE_PIXELS
+  #define WRITE_COMBINE_FLUSH if (wcLen) writeCombineFlush()
+  // Run directions
+  #define WC_ANY        0 // Single pixel, can be extended in either direction
+  #define WC_HORIZONTAL 1
+  #define WC_VERTICAL   2
+#else
+  #define WRITE_COMBINE_FLUSH
+#endif
+
+// Processors where pushPixelsDMA() and pushImageDMA() can send double buffered lines
+#if (defined (ESP32_DMA) && !defined (TFT_PARALLEL_8_BIT)) || defined (RP2040_DMA) || \
+    (defined (STM32_DMA) && !defined (TFT_PARALLEL_8_BIT)) || defined (ARDUINO_ARCH_HOST)
+  #define DMA_LINE_BUFFERS
+#endif
+
+// DMA line buffers must be in memory the DMA controller can read (internal RAM on ESP32)
+#if defined (ESP32)
+  #include "esp_heap_caps.h"
+  #define DMA_LINE_MALLOC(bytes) heap_caps_malloc(bytes, MALLOC_CAP_DMA)
+  #define DMA_LINE_FREE(ptr)     heap_caps_free(ptr)
+#else
+  #define DMA_LINE_MALLOC(bytes) malloc(bytes)
+  #define DMA_LINE_FREE(ptr)     free(ptr)
+#endif
+
+// Palette image expansion by pushPaletteImage()
+#define PALETTE_LUT_PIXELS 512  // Smaller images are expanded without building a lookup table
+#define PALETTE_DMA_PIXELS 1024 // Size of each DMA line buffer
+#define PALETTE_LINE_PIXELS 64  // Size of the line buffer on the stack if DMA is not used
+
 // Clipping macro for pushImage
 #define PI_CLIP                                        \
   if (_vpOoB) return;                                  \
@@ -58,6 +92,21 @@
                                                        \
   if (dw < 1 || dh < 1) return;
 
+// Round clip macro, if area x,y,w,h crosses the edge of the round clip area the viewport
+// is set to each band inside it in turn and the drawing function is called again
+#define ROUND_CLIP(x, y, w, h, call)                   \
+  if (_roundSpan && !_roundBand) {                     \
+    round_band_t band;                                 \
+    if (roundBegin(&band, x, y, w, h)) {               \
+      begin_nin_write();                               \
+      inTransaction = true;                            \
+      while (roundNext(&band)) call;                   \
+      inTransaction = lockTransaction;                 \
+      end_nin_write();                                 \
+      return;                                          \
+    }                                                  \
+  }
+
 /***************************************************************************************
 ** Function name:           Legacy - deprecated
 ** Description:             Start/end transaction
@@ -101,6 +150,7 @@ void TFT_eSPI::begin_nin_write(void){
 inline void TFT_eSPI::end_tft_write(void){
   if(!inTransaction) {      // Flag to stop ending transaction during multiple graphics calls
     if (!locked) {          // Locked when beginTransaction has been called
+      WRITE_COMBINE_FLUSH;  // Send buffered pixels before releasing the bus
       locked = true;        // Flag to show SPI access now locked
       SPI_BUSY_CHECK;       // Check send complete and clean out unused rx data
       CS_H;
@@ -116,6 +166,7 @@ inline void TFT_eSPI::end_tft_write(void){
 inline void TFT_eSPI::end_nin_write(void){
   if(!inTransaction) {      // Flag to stop ending transaction during multiple graphics calls
     if (!locked) {          // Locked when beginTransaction has been called
+      WRITE_COMBINE_FLUSH;  // Send buffered pixels before releasing the bus
       locked = true;        // Flag to show SPI access now locked
       SPI_BUSY_CHECK;       // Check send complete and clean out unused rx data
       CS_H;
@@ -133,6 +184,7 @@ inline void TFT_eSPI::end_nin_write(void){
 ***************************************************************************************/
 // Reads require a lower SPI clock rate than writes
 inline void TFT_eSPI::begin_tft_read(void){
+  WRITE_COMBINE_FLUSH; // Buffered pixels must be written before reading
   DMA_BUSY_CHECK; // Wait for any DMA transfer to complete before changing SPI settings
 #if defined (SPI_HAS_TRANSACTION) && defined (SUPPORT_TRANSACTIONS) && !defined(TFT_PARALLEL_8_BIT) && !defined(RP2040_PIO_INTERFACE)
   if (locked) {
@@ -432,6 +484,200 @@ bool TFT_eSPI::clipWindow(int32_t *xs, int32_t *ys, int32_t *xe, int32_t *ye)
   return true;  // Area is wholly or partially inside viewport
 }
 
+/***************************************************************************************
+** Function name:           setRoundClip
+** Description:             Clip drawing to the ellipse that fits in area x,y,w,h
+***************************************************************************************/
+bool TFT_eSPI::setRoundClip(int32_t x, int32_t y, int32_t w, int32_t h)
+{
+  if (w < 1 || h < 1) return false;
+
+  int32_t cols, rows;
+  roundSize(&cols, &rows);
+  if (!_roundSpan || _roundRows != rows) {
+    resetRoundClip();
+    _roundSpan = (int16_t*)malloc(rows * 2 * sizeof(int16_t));
+    if (!_roundSpan) return false;
+    _roundRows = rows;
+  }
+
+  _roundX = x;
+  _roundY = y;
+  _roundW = w;
+  _roundH = h;
+
+  // A pixel is visible if any part of it is inside the ellipse. The distance of the row
+  // edge nearest the centre gives the half width, in units of half a pixel.
+  for (int32_t yp = 0; yp < rows; yp++) {
+    int32_t xs = 1, xe = 0; // Empty span
+    int32_t j = yp - y;
+    if (j >= 0 && j < h) {
+      int32_t e = abs(2 * j + 1 - h) - 1;
+      if (e < 0) e = 0;
+      float hw = w * sqrtf((float)h * h - (float)e * e) / h;
+      xs = x + (int32_t)floorf((w - hw) * 0.5f);
+      xe = x + (int32_t)ceilf((w + hw) * 0.5f) - 1;
+      if (xs < 0) xs = 0;
+      if (xe >= cols) xe = cols - 1;
+      if (xs > xe) { xs = 1; xe = 0; }
+    }
+    _roundSpan[2 * yp]     = xs;
+    _roundSpan[2 * yp + 1] = xe;
+  }
+
+  return true;
+}
+
+bool TFT_eSPI::setRoundClip(void)
+{
+  int32_t w, h;
+  roundSize(&w, &h);
+  return setRoundClip(0, 0, w, h);
+}
+
+/***************************************************************************************
+** Function name:           roundSize
+** Description:             Get the screen or Sprite size, not the viewport size
+***************************************************************************************/
+void TFT_eSPI::roundSize(int32_t *w, int32_t *h)
+{
+  bool vpDatum = _vpDatum;
+  _vpDatum = false;
+  *w = width();
+  *h = height();
+  _vpDatum = vpDatum;
+}
+
+/***************************************************************************************
+** Function name:           resetRoundClip
+** Description:             Remove the round clip area and free the span table
+***************************************************************************************/
+void TFT_eSPI::resetRoundClip(void)
+{
+  if (_roundSpan) free(_roundSpan);
+  _roundSpan = nullptr;
+  _roundRows = 0;
+}
+
+/***************************************************************************************
+** Function name:           getRoundClip
+** Description:             Return true if a round clip area is set
+***************************************************************************************/
+bool TFT_eSPI::getRoundClip(void)
+{
+  return _roundSpan != nullptr;
+}
+
+/***************************************************************************************
+** Function name:           getRoundSpan
+** Description:             Get the visible x range of screen row y
+***************************************************************************************/
+bool TFT_eSPI::getRoundSpan(int32_t y, int32_t *xs, int32_t *xe)
+{
+  int32_t w, h;
+  roundSize(&w, &h);
+  if (y < 0 || y >= h) return false;
+
+  *xs = 0;
+  *xe = w - 1;
+  if (_roundSpan && y < _roundRows) {
+    *xs = _roundSpan[2 * y];
+    *xe = _roundSpan[2 * y + 1];
+  }
+
+  return *xs <= *xe;
+}
+
+/***************************************************************************************
+** Function name:           roundInside
+** Description:             Check if a screen area is wholly inside the round clip area
+***************************************************************************************/
+bool TFT_eSPI::roundInside(int32_t x, int32_t y, int32_t w, int32_t h)
+{
+  if (!_roundSpan) return true;
+
+  int32_t xe = x + w - 1, ye = y + h - 1;
+  if (y < 0 || ye >= _roundRows) return false;
+
+  // The clip area is convex so the rows at each end are the narrowest
+  return x >= _roundSpan[2 * y]  && xe <= _roundSpan[2 * y + 1] &&
+         x >= _roundSpan[2 * ye] && xe <= _roundSpan[2 * ye + 1];
+}
+
+/***************************************************************************************
+** Function name:           roundBegin
+** Description:             Start drawing an area in bands inside the round clip area
+***************************************************************************************/
+// x,y are relative to the viewport datum. Returns false if the area is wholly inside
+// the round clip area or outside the viewport, so no bands are needed.
+bool TFT_eSPI::roundBegin(round_band_t *band, int32_t x, int32_t y, int32_t w, int32_t h)
+{
+  if (_vpOoB) return false;
+
+  x += _xDatum;
+  y += _yDatum;
+
+  // Clip to the viewport
+  int32_t xe = x + w - 1, ye = y + h - 1;
+  if (x < _vpX) x = _vpX;
+  if (y < _vpY) y = _vpY;
+  if (xe >= _vpW) xe = _vpW - 1;
+  if (ye >= _vpH) ye = _vpH - 1;
+  if (x > xe || y > ye) return false;
+
+  if (roundInside(x, y, xe - x + 1, ye - y + 1)) return false;
+
+  band->x  = x;
+  band->xe = xe;
+  band->y  = y;
+  band->ye = (ye < _roundRows) ? ye : _roundRows - 1;
+
+  band->vpX = _vpX;
+  band->vpY = _vpY;
+  band->vpW = _vpW;
+  band->vpH = _vpH;
+
+  _roundBand = true;
+  return true;
+}
+
+/***************************************************************************************
+** Function name:           roundNext
+** Description:             Set the viewport to the next band of the area
+***************************************************************************************/
+// Each band is a run of rows with the same visible x range
+bool TFT_eSPI::roundNext(round_band_t *band)
+{
+  while (band->y <= band->ye) {
+    int32_t ys = band->y;
+    int32_t xs = band->x, xe = band->xe;
+    if (xs < _roundSpan[2 * ys])     xs = _roundSpan[2 * ys];
+    if (xe > _roundSpan[2 * ys + 1]) xe = _roundSpan[2 * ys + 1];
+
+    // Add following rows that have the same visible range
+    while (++band->y <= band->ye) {
+      const int16_t *span = _roundSpan + 2 * band->y;
+      if ((band->x  < span[0] ? span[0] : band->x)  != xs) break;
+      if ((band->xe > span[1] ? span[1] : band->xe) != xe) break;
+    }
+    if (xs > xe) continue;
+
+    _vpX = xs;
+    _vpY = ys;
+    _vpW = xe + 1;
+    _vpH = band->y;
+    return true;
+  }
+
+  // Restore the viewport
+  _vpX = band->vpX;
+  _vpY = band->vpY;
+  _vpW = band->vpW;
+  _vpH = band->vpH;
+  _roundBand = false;
+  return false;
+}
+
 /***************************************************************************************
 ** Function name:           TFT_eSPI
 ** Description:             Constructor , we must use hardware SPI pins
@@ -444,6 +690,10 @@ TFT_eSPI::TFT_eSPI(int16_t w, int16_t h)
   // Reset the viewport to the whole screen
   resetViewport();
 
+  _roundSpan = nullptr; // No round clip
+  _roundRows = 0;
+  _roundBand = false;
+
   rotation  = 0;
   cursor_y  = cursor_x  = last_cursor_x = bg_cursor_x = 0;
   textfont  = 1;
@@ -480,6 +730,18 @@ TFT_eSPI::TFT_eSPI(int16_t w, int16_t h)
 #endif
   _psram_enable = false;
 
+#ifdef SPAN_FONTS
+  _spanFont = true;
+#endif
+
+#ifdef WRITE_COMBINE_PIXELS
+  _wcEnable = true;
+  wcLen = 0;
+  wcX = wcY = 0;
+  wcDir = WC_ANY;
+  memset(&wcStats, 0, sizeof(wcStats));
+#endif
+
   addr_row = 0xFFFF;  // drawPixel command length optimiser
   addr_col = 0xFFFF;  // drawPixel command length optimiser
 
@@ -881,6 +1143,9 @@ void TFT_eSPI::setRotation(uint8_t m)
 
   // Reset the viewport to the whole screen
   resetViewport();
+
+  // Rebuild the round clip spans for the new width and height
+  if (_roundSpan) setRoundClip(_roundX, _roundY, _roundW, _roundH);
 }
 
 
@@ -981,6 +1246,8 @@ void TFT_eSPI::writecommand(uint8_t c)
 {
   begin_tft_write();
 
+  WRITE_COMBINE_FLUSH;
+
   DC_C;
 
   tft_Write_8(c);
@@ -1044,6 +1311,8 @@ void TFT_eSPI::writedata(uint8_t d)
 {
   begin_tft_write();
 
+  WRITE_COMBINE_FLUSH;
+
   DC_D;        // Play safe, but should already be in data mode
 
   tft_Write_8(d);
@@ -1447,6 +1716,8 @@ void TFT_eSPI::pushRect(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *da
 ***************************************************************************************/
 void TFT_eSPI::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *data)
 {
+  ROUND_CLIP(x, y, w, h, pushImage(x, y, w, h, data));
+
   PI_CLIP;
 
   begin_tft_write();
@@ -1477,6 +1748,8 @@ void TFT_eSPI::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *d
 ***************************************************************************************/
 void TFT_eSPI::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *data, uint16_t transp)
 {
+  ROUND_CLIP(x, y, w, h, pushImage(x, y, w, h, data, transp));
+
   PI_CLIP;
 
   begin_tft_write();
@@ -1536,6 +1809,8 @@ void TFT_eSPI::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *d
 ***************************************************************************************/
 void TFT_eSPI::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *data)
 {
+  ROUND_CLIP(x, y, w, h, pushImage(x, y, w, h, data));
+
   // Requires 32 bit aligned access, so use PROGMEM 16 bit word functions
   PI_CLIP;
 
@@ -1566,6 +1841,8 @@ void TFT_eSPI::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint1
 ***************************************************************************************/
 void TFT_eSPI::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *data, uint16_t transp)
 {
+  ROUND_CLIP(x, y, w, h, pushImage(x, y, w, h, data, transp));
+
   // Requires 32 bit aligned access, so use PROGMEM 16 bit word functions
   PI_CLIP;
 
@@ -1622,6 +1899,8 @@ void TFT_eSPI::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint1
 ***************************************************************************************/
 void TFT_eSPI::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint8_t *data, bool bpp8,  uint16_t *cmap)
 {
+  ROUND_CLIP(x, y, w, h, pushImage(x, y, w, h, data, bpp8, cmap));
+
   PI_CLIP;
 
   begin_tft_write();
@@ -1755,6 +2034,8 @@ void TFT_eSPI::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint8
 ***************************************************************************************/
 void TFT_eSPI::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, uint8_t *data, bool bpp8,  uint16_t *cmap)
 {
+  ROUND_CLIP(x, y, w, h, pushImage(x, y, w, h, data, bpp8, cmap));
+
   PI_CLIP;
 
   begin_tft_write();
@@ -1766,7 +2047,11 @@ void TFT_eSPI::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, uint8_t *da
   // Line buffer makes plotting faster
   uint16_t  lineBuf[dw];
 
-  if (bpp8)
+  if ((bpp8 || cmap != nullptr) && dw * dh >= PALETTE_LUT_PIXELS)
+  {
+    pushPaletteImage(data, w, dx, dy, dw, dh, bpp8, cmap);
+  }
+  else if (bpp8)
   {
     _swapBytes = false;
 
@@ -1882,12 +2167,112 @@ void TFT_eSPI::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, uint8_t *da
 }
 
 
+/***************************************************************************************
+** Function name:           paletteExpand (local)
+** Description:             convert len image pixels from pixel p of a line
+***************************************************************************************/
+static inline void paletteExpand(uint16_t *out, const uint8_t *ptr, uint32_t p, int32_t len, bool bpp8, const uint32_t *lut)
+{
+  if (bpp8) {
+    ptr += p;
+    while (len--) *out++ = lut[*ptr++];
+    return;
+  }
+
+  ptr += p >> 1;
+  if (p & 1) { *out++ = lut[*ptr++] >> 16; len--; } // Odd pixel is in the low nibble
+  while (len > 1) {
+    uint32_t pair = lut[*ptr++];
+    *out++ = pair;
+    *out++ = pair >> 16;
+    len -= 2;
+  }
+  if (len > 0) *out = lut[*ptr];
+}
+
+
+/***************************************************************************************
+** Function name:           pushPaletteImage
+** Description:             expand 8 bit or 4 bit image lines with a lookup table
+***************************************************************************************/
+// Each image byte is converted with one table lookup, to one RGB565 pixel for 8 bit
+// (RGB332) images or to two pixels for 4 bit images. Table entries are in TFT byte order
+// (all supported processors are little-endian). If DMA is enabled, lines are converted
+// into one buffer while the other buffer is being sent.
+void TFT_eSPI::pushPaletteImage(uint8_t *data, int32_t w, int32_t dx, int32_t dy, int32_t dw, int32_t dh, bool bpp8, uint16_t *cmap)
+{
+  uint32_t lut[256];
+
+  if (bpp8) {
+    uint8_t blue[] = {0, 11, 21, 31}; // blue 2 to 5 bit colour lookup table
+    for (uint32_t c = 0; c < 256; c++) {
+      //          =====Green=====     ===============Red==============
+      lut[c]   = (c & 0x1C)>>2 | (c & 0xC0)>>3 | (c & 0xE0);
+      //          =====Green=====    =======Blue======
+      lut[c]  |= ((c & 0x1C)<<3 | blue[c & 0x03]) << 8;
+    }
+    data += dx + dy * w;
+  }
+  else {
+    uint16_t pal[16];
+    for (uint32_t i = 0; i < 16; i++) pal[i] = cmap[i] << 8 | cmap[i] >> 8;
+    for (uint32_t c = 0; c < 256; c++) lut[c] = pal[c >> 4] | (uint32_t)pal[c & 0x0F] << 16;
+    w = (w+1) & 0xFFFE;
+    data += (dx + dy * w) >> 1;
+    w >>= 1; // Source line length in bytes
+  }
+
+  _swapBytes = false;
+
+  // First pixel of a 4 bit line is in the low nibble if dx is odd
+  uint32_t p0 = bpp8 ? 0 : (dx & 1);
+
+#ifdef DMA_LINE_BUFFERS
+  if (DMA_Enabled) {
+    int32_t lines = PALETTE_DMA_PIXELS / dw;
+    if (lines < 1) lines = 1;
+    if (lines > dh) lines = dh;
+    uint16_t* dmaBuf = (uint16_t*)DMA_LINE_MALLOC(2 * lines * dw * sizeof(uint16_t));
+    if (dmaBuf) {
+      uint16_t* buf = dmaBuf;
+      int32_t n = 0; // Lines in buffer
+      while (dh--) {
+        paletteExpand(buf + n * dw, data, p0, dw, bpp8, lut);
+        data += w;
+        if (++n < lines && dh) continue;
+        pushPixelsDMA(buf, n * dw); // Waits for the previous buffer to be sent
+        buf = (buf == dmaBuf) ? dmaBuf + lines * dw : dmaBuf;
+        n = 0;
+      }
+      dmaWait();
+      DMA_LINE_FREE(dmaBuf);
+      return;
+    }
+  }
+#endif
+
+  // Fixed size buffer on the stack, long lines are sent in several parts
+  uint16_t lineBuf[PALETTE_LINE_PIXELS];
+  while (dh--) {
+    for (int32_t p = 0; p < dw; p += PALETTE_LINE_PIXELS) {
+      int32_t len = dw - p;
+      if (len > PALETTE_LINE_PIXELS) len = PALETTE_LINE_PIXELS;
+      paletteExpand(lineBuf, data, p0 + p, len, bpp8, lut);
+      pushPixels(lineBuf, len);
+    }
+    data += w;
+  }
+}
+
+
 /***************************************************************************************
 ** Function name:           pushImage
 ** Description:             plot 8 or 4 or 1 bit image or sprite with a transparent colour
 ***************************************************************************************/
 void TFT_eSPI::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, uint8_t *data, uint8_t transp, bool bpp8, uint16_t *cmap)
 {
+  ROUND_CLIP(x, y, w, h, pushImage(x, y, w, h, data, transp, bpp8, cmap));
+
   PI_CLIP;
 
   begin_tft_write();
@@ -3200,7 +3585,8 @@ void TFT_eSPI::drawChar(int32_t x, int32_t y, uint16_t c, uint32_t color, uint32
     return;
 
   bool fillbg = (bg != color);
-  bool clip = xd < _vpX || xd + 6  * textsize >= _vpW || yd < _vpY || yd + 8 * textsize >= _vpH;
+  bool clip = xd < _vpX || xd + 6  * textsize >= _vpW || yd < _vpY || yd + 8 * textsize >= _vpH ||
+              !roundInside(xd, yd, 6 * textsize, 8 * textsize);
 
   if ((size==1) && fillbg && !clip) {
     uint8_t column[6];
@@ -3356,6 +3742,7 @@ void TFT_eSPI::setAddrWindow(int32_t x0, int32_t y0, int32_t w, int32_t h)
 void TFT_eSPI::setWindow(int32_t x0, int32_t y0, int32_t x1, int32_t y1)
 {
   //begin_tft_write(); // Must be called before setWindow
+  WRITE_COMBINE_FLUSH;
   addr_row = 0xFFFF;
   addr_col = 0xFFFF;
 
@@ -3584,6 +3971,16 @@ void TFT_eSPI::drawPixel(int32_t x, int32_t y, uint32_t color)
 
   // Range checking
   if ((x < _vpX) || (y < _vpY) ||(x >= _vpW) || (y >= _vpH)) return;
+  if (_roundSpan && (x < _roundSpan[2 * y] || x > _roundSpan[2 * y + 1])) return;
+
+#ifdef WRITE_COMBINE_PIXELS
+  if (_wcEnable) {
+    begin_tft_write();
+    combineWrite(x, y, 1, WC_ANY, color);
+    end_tft_write(); // Flushes buffer if not in a transaction
+    return;
+  }
+#endif
 
 #ifdef CGRAM_OFFSET
   x+=colstart;
@@ -3830,6 +4227,107 @@ void TFT_eSPI::endWrite(void)
   end_tft_write();         // Release SPI bus
 }
 
+#ifdef WRITE_COMBINE_PIXELS
+/***************************************************************************************
+** Function name:           combineWrite
+** Description:             add a single colour run to the write combining buffer
+***************************************************************************************/
+// Runs that continue the buffered run along the same row or column are appended so
+// they share one address window. Returns false if the run is too long to buffer, the
+// caller must then send it, setWindow() will flush the buffer first. CS must be low.
+bool TFT_eSPI::combineWrite(int32_t x, int32_t y, int32_t len, uint8_t dir, uint16_t color)
+{
+  if (wcLen) {
+    bool append = false;
+    if (wcLen + len <= WRITE_COMBINE_PIXELS) {
+      if (dir != WC_VERTICAL && wcDir != WC_VERTICAL && y == wcY && x == wcX + wcLen) {
+        wcDir = WC_HORIZONTAL;
+        append = true;
+      }
+      else if (dir != WC_HORIZONTAL && wcDir != WC_HORIZONTAL && x == wcX && y == wcY + wcLen) {
+        wcDir = WC_VERTICAL;
+        append = true;
+      }
+    }
+    if (!append) writeCombineFlush();
+  }
+
+  if (wcLen == 0) {
+    // Long runs gain little from buffering so are sent directly
+    if (len > WRITE_COMBINE_PIXELS / 2) return false;
+    wcX = x;
+    wcY = y;
+    wcDir = dir;
+  }
+
+  wcStats.calls++;
+
+  color = color << 8 | color >> 8;
+  while (len--) wcBuffer[wcLen++] = color;
+
+  if (wcLen == WRITE_COMBINE_PIXELS) writeCombineFlush();
+
+  return true;
+}
+
+/***************************************************************************************
+** Function name:           writeCombineFlush
+** Description:             send the write combining buffer, CS must be low
+***************************************************************************************/
+void TFT_eSPI::writeCombineFlush(void)
+{
+  uint16_t len = wcLen;
+  wcLen = 0; // Clear first as setWindow() flushes the buffer
+
+  if (wcDir == WC_VERTICAL) setWindow(wcX, wcY, wcX, wcY + len - 1);
+  else                      setWindow(wcX, wcY, wcX + len - 1, wcY);
+
+  // Buffer is already in TFT byte order
+  bool swap = _swapBytes;
+  _swapBytes = false;
+  pushPixels(wcBuffer, len);
+  _swapBytes = swap;
+
+  wcStats.windows++;
+  wcStats.pixels += len;
+}
+
+/***************************************************************************************
+** Function name:           flushWrites
+** Description:             send any pixels held in the write combining buffer
+***************************************************************************************/
+void TFT_eSPI::flushWrites(void)
+{
+  if (wcLen == 0) return;
+
+  begin_tft_write();
+
+  writeCombineFlush();
+
+  end_tft_write();
+}
+
+/***************************************************************************************
+** Function name:           getWriteCombineStats
+** Description:             copy the write combining counters
+***************************************************************************************/
+// The command to pixel byte ratio for the combined writes is approximately
+// (windows * 11) / (pixels * 2) for a SPI TFT with 16 bit CASET/PASET parameters
+void TFT_eSPI::getWriteCombineStats(wc_stats_t& stats)
+{
+  stats = wcStats;
+}
+
+/***************************************************************************************
+** Function name:           resetWriteCombineStats
+** Description:             clear the write combining counters
+***************************************************************************************/
+void TFT_eSPI::resetWriteCombineStats(void)
+{
+  memset(&wcStats, 0, sizeof(wcStats));
+}
+#endif
+
 /***************************************************************************************
 ** Function name:           writeColor (use startWrite() and endWrite() before & after)
 ** Description:             raw write of "len" pixels avoiding transaction check
@@ -3946,6 +4444,27 @@ void TFT_eSPI::drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t
 constexpr float PixelAlphaGain   = 255.0;
 constexpr float LoAlphaTheshold  = 1.0/32.0;
 constexpr float HiAlphaTheshold  = 1.0 - LoAlphaTheshold;
+
+// Wedge line geometry and row values for the drawWedgeLine() helper functions
+typedef struct {
+  float   ax, ay, bx, by; // Centres of the line ends
+  float   vx, vy, vxi;    // b - a, 1 / vx
+  float   l2, l2i, leni;  // Squared length, 1 / l2 and 1 / length
+  float   dr;             // Radius delta, ar - br
+  float   t;              // ar + 0.5
+  float   k[4], ki[4];    // Slopes of the linear limits between the ends, and 1 / slope
+  int64_t p1, h1;         // Change of p and h per pixel, 32 bit fraction
+  int64_t t32;            // t, 32 bit fraction
+  int64_t dr24;           // dr, 24 bit fraction
+  // Row values set by wedgeRow()
+  float   dy, dyb;        // y - ay and y - by
+  float   c, p0f, h0f;    // h = (c + x * vx) / l2, p and h at x = 0
+  int64_t p0, h0;         // p and h at x = 0, 32 bit fraction
+} wedge_t;
+
+static void wedgeRow(wedge_t *w, int32_t y);
+static bool wedgeSpan(const wedge_t *w, float t, float *xl, float *xr);
+static inline int32_t wedgeAlpha(const wedge_t *w, int32_t x);
 constexpr float deg2rad      = 3.14159265359/180.0;
 
 /***************************************************************************************
@@ -4469,6 +4988,12 @@ void TFT_eSPI::drawWideLine(float ax, float ay, float bx, float by, float wd, ui
 ** Function name:           drawWedgeLine - background colour specified or pixel read
 ** Description:             draw an anti-aliased line with different width radiused ends
 ***************************************************************************************/
+// The distance of a pixel from the line is the distance from the nearest point on the
+// centre line plus h * (ar - br), where h is 0 at a and 1 at b. On each row the pixels
+// that are drawn, and the pixels that are drawn without blending, are found from this
+// distance analytically. Only the pixels between the two spans, plus one pixel either
+// side as the limits can be a rounding error out, are checked with wedgeAlpha(). Each row
+// is drawn as a single window.
 void TFT_eSPI::drawWedgeLine(float ax, float ay, float bx, float by, float ar, float br, uint32_t fg_color, uint32_t bg_color)
 {
   if ( (ar < 0.0) || (br < 0.0) )return;
@@ -4482,92 +5007,100 @@ void TFT_eSPI::drawWedgeLine(float ax, float ay, float bx, float by, float ar, f
 
   if (!clipWindow(&x0, &y0, &x1, &y1)) return;
 
-  // Establish x start and y start
-  int32_t ys = ay;
-  if ((ax-ar)>(bx-br)) ys = by;
-
-  float rdt = ar - br; // Radius delta
-  float alpha = 1.0f;
-  ar += 0.5;
-
+  wedge_t w;
+  w.ax = ax; w.ay = ay; w.bx = bx; w.by = by;
+  w.vx = bx - ax; w.vy = by - ay;
+  w.vxi = (w.vx != 0.0f) ? 1.0f / w.vx : 0.0f;
+  w.l2 = w.vx * w.vx + w.vy * w.vy;
+  w.l2i = 1.0f / w.l2;
+  w.leni = 1.0f / sqrtf(w.l2);
+  w.dr = ar - br;
+  w.t = ar + 0.5f;
+
+  // Between the ends the distance is |p| + h * dr, p and h are linear in x on each row
+  float p1 = w.vy * w.leni, h1 = w.vx * w.l2i;
+  w.k[0] =  p1 + h1 * w.dr;
+  w.k[1] = -p1 + h1 * w.dr;
+  w.k[2] = -h1;
+  w.k[3] =  h1;
+  for (uint8_t i = 0; i < 4; i++) w.ki[i] = (w.k[i] != 0.0f) ? 1.0f / w.k[i] : 0.0f;
+  w.p1 = (int64_t)(p1 * 4294967296.0f);
+  w.h1 = (int64_t)(h1 * 4294967296.0f);
+  w.t32  = (int64_t)(w.t * 4294967296.0f);
+  w.dr24 = (int64_t)(w.dr * 16777216.0f);
+
+  // Distance limits for pixels that are drawn and pixels that are drawn without blending
+  float tOut = w.t - LoAlphaTheshold;
+  float tIn  = w.t - HiAlphaTheshold;
+  const int32_t lo24 = (int32_t)(LoAlphaTheshold * 16777216.0f);
+  const int32_t hi24 = (int32_t)(HiAlphaTheshold * 16777216.0f);
+
+  bool readBg = (bg_color == 0x00FFFFFF);
   uint16_t bg = bg_color;
-  float xpax, ypay, bax = bx - ax, bay = by - ay;
 
   begin_nin_write();
   inTransaction = true;
 
-  int32_t xs = x0;
-  // Scan bounding box from ys down, calculate pixel intensity from distance to line
-  for (int32_t yp = ys; yp <= y1; yp++) {
-    bool swin = true;  // Flag to start new window area
-    bool endX = false; // Flag to skip pixels
-    ypay = yp - ay;
-    for (int32_t xp = xs; xp <= x1; xp++) {
-      if (endX) if (alpha <= LoAlphaTheshold) break;  // Skip right side
-      xpax = xp - ax;
-      alpha = ar - wedgeLineDistance(xpax, ypay, bax, bay, rdt);
-      if (alpha <= LoAlphaTheshold ) continue;
-      // Track edge to minimise calculations
-      if (!endX) { endX = true; xs = xp; }
-      if (alpha > HiAlphaTheshold) {
-        #ifdef GC9A01_DRIVER
-          drawPixel(xp, yp, fg_color);
-        #else
-          if (swin) { setWindow(xp, yp, x1, yp); swin = false; }
-          pushColor(fg_color);
-        #endif
-        continue;
-      }
-      //Blend color with background and plot
-      if (bg_color == 0x00FFFFFF) {
-        bg = readPixel(xp, yp); swin = true;
-      }
-      #ifdef GC9A01_DRIVER
-        uint16_t pcol = fastBlend((uint8_t)(alpha * PixelAlphaGain), fg_color, bg);
-        drawPixel(xp, yp, pcol);
-        swin = swin;
-      #else
-        if (swin) { setWindow(xp, yp, x1, yp); swin = false; }
-        pushColor(fastBlend((uint8_t)(alpha * PixelAlphaGain), fg_color, bg));
-      #endif
+  for (int32_t yp = y0; yp <= y1; yp++) {
+    float l, r;
+    wedgeRow(&w, yp);
+    if (!wedgeSpan(&w, tOut, &l, &r)) continue;
+
+    // Row limits, clipped to the round clip area span
+    int32_t rx0 = x0, rx1 = x1;
+    if (_roundSpan && yp < _roundRows) {
+      if (rx0 < _roundSpan[2 * yp])     rx0 = _roundSpan[2 * yp];
+      if (rx1 > _roundSpan[2 * yp + 1]) rx1 = _roundSpan[2 * yp + 1];
     }
-  }
 
-  // Reset x start to left side of box
-  xs = x0;
-  // Scan bounding box from ys-1 up, calculate pixel intensity from distance to line
-  for (int32_t yp = ys-1; yp >= y0; yp--) {
-    bool swin = true;  // Flag to start new window area
-    bool endX = false; // Flag to skip pixels
-    ypay = yp - ay;
-    for (int32_t xp = xs; xp <= x1; xp++) {
-      if (endX) if (alpha <= LoAlphaTheshold) break;  // Skip right side of drawn line
-      xpax = xp - ax;
-      alpha = ar - wedgeLineDistance(xpax, ypay, bax, bay, rdt);
-      if (alpha <= LoAlphaTheshold ) continue;
-      // Track line boundary
-      if (!endX) { endX = true; xs = xp; }
-      if (alpha > HiAlphaTheshold) {
-        #ifdef GC9A01_DRIVER
-          drawPixel(xp, yp, fg_color);
-        #else
-          if (swin) { setWindow(xp, yp, x1, yp); swin = false; }
-          pushColor(fg_color);
-        #endif
+    int32_t xs = (int32_t)floorf(l) - 1, xe = (int32_t)ceilf(r) + 1;
+    if (xs < rx0) xs = rx0;
+    if (xe > rx1) xe = rx1;
+    if (xs > xe) continue;
+
+    // Solid span ss to se, ss > se if there is none. It is one pixel inside the analytic
+    // limits, so the pixels in it do not need to be checked
+    int32_t ss = xe + 1, se = xe;
+    if (wedgeSpan(&w, tIn, &l, &r)) {
+      ss = (int32_t)ceilf(l) + 1;
+      se = (int32_t)floorf(r) - 1;
+      if (ss < xs) ss = xs;
+      if (se > xe) se = xe;
+      if (ss > se) { ss = xe + 1; se = xe; }
+    }
+
+    // Trim pixels that are not drawn from the ends of the row
+    int32_t le = (ss <= se) ? ss - 1 : xe;
+    while (xs <= le && wedgeAlpha(&w, xs) <= lo24) xs++;
+    int32_t rs = (ss <= se) ? se + 1 : xs;
+    while (xe >= rs && wedgeAlpha(&w, xe) <= lo24) xe--;
+    if (xs > xe) continue;
+
+    bool swin = true; // Flag to start new window area
+    for (int32_t xp = xs; xp <= xe; xp++) {
+      if (xp == ss) {
+        if (readBg) drawFastHLine(ss, yp, se - ss + 1, fg_color);
+        else {
+          if (swin) { setWindow(xp, yp, xe, yp); swin = false; }
+          pushColor(fg_color, se - ss + 1);
+        }
+        xp = se;
         continue;
       }
-      //Blend colour with background and plot
-      if (bg_color == 0x00FFFFFF) {
-        bg = readPixel(xp, yp); swin = true;
+
+      int32_t alpha = wedgeAlpha(&w, xp);
+      if (alpha <= lo24) { swin = true; continue; }  // Skip, restart the window
+      uint16_t pcol = fg_color;
+      if (alpha <= hi24) {
+        if (readBg) bg = readPixel(xp, yp);
+        pcol = fastBlend((uint8_t)(((uint32_t)alpha * 255) >> 24), fg_color, bg);
+      }
+
+      if (readBg) drawPixel(xp, yp, pcol);
+      else {
+        if (swin) { setWindow(xp, yp, xe, yp); swin = false; }
+        pushColor(pcol);
       }
-      #ifdef GC9A01_DRIVER
-        uint16_t pcol = fastBlend((uint8_t)(alpha * PixelAlphaGain), fg_color, bg);
-        drawPixel(xp, yp, pcol);
-        swin = swin;
-      #else
-        if (swin) { setWindow(xp, yp, x1, yp); swin = false; }
-        pushColor(fastBlend((uint8_t)(alpha * PixelAlphaGain), fg_color, bg));
-      #endif
     }
   }
 
@@ -4575,16 +5108,97 @@ void TFT_eSPI::drawWedgeLine(float ax, float ay, float bx, float by, float ar, f
   end_nin_write();
 }
 
+/***************************************************************************************
+** Function name:           wedgeRow - helper function for drawWedgeLine
+** Description:             set the row values for row y
+***************************************************************************************/
+static void wedgeRow(wedge_t *w, int32_t y)
+{
+  w->dy  = y - w->ay;
+  w->dyb = y - w->by;
+  w->c   = w->dy * w->vy - w->ax * w->vx;
+  w->h0f = w->c * w->l2i;
+  w->p0f = (-w->dy * w->vx - w->ax * w->vy) * w->leni;
+  w->h0  = (int64_t)(w->h0f * 4294967296.0f);
+  w->p0  = (int64_t)(w->p0f * 4294967296.0f);
+}
 
 /***************************************************************************************
-** Function name:           lineDistance - private helper function for drawWedgeLine
-** Description:             returns distance of px,py to closest part of a to b wedge
+** Function name:           wedgeSpan - helper function for drawWedgeLine
+** Description:             find the x interval on the row where the distance is below t
 ***************************************************************************************/
-inline float TFT_eSPI::wedgeLineDistance(float xpax, float ypay, float bax, float bay, float dr)
+// Clip interval lo to hi to where c0 + c1 * x <= 0, c1i is 1 / c1
+static inline void clipLinear(float c0, float c1, float c1i, float *lo, float *hi)
 {
-  float h = fmaxf(fminf((xpax * bax + ypay * bay) / (bax * bax + bay * bay), 1.0f), 0.0f);
-  float dx = xpax - bax * h, dy = ypay - bay * h;
-  return sqrtf(dx * dx + dy * dy) + h * dr;
+  if      (c1 > 0.0f) *hi = fminf(*hi, -c0 * c1i);
+  else if (c1 < 0.0f) *lo = fmaxf(*lo, -c0 * c1i);
+  else if (c0 > 0.0f) *hi = *lo - 1.0f; // Empty
+}
+
+// The interval is the union of the pixels nearest to end a (h <= 0), nearest to end b
+// (h >= 1) and nearest to the line between, returns false if it is empty
+static bool wedgeSpan(const wedge_t *w, float t, float *xl, float *xr)
+{
+  float lo = 1.0f, hi = 0.0f; // Empty
+  float l, r;
+
+  // Circle radius t centred on a, where h <= 0
+  if (t > fabsf(w->dy)) {
+    float s = sqrtf(t * t - w->dy * w->dy);
+    l = w->ax - s; r = w->ax + s;
+    clipLinear(w->c, w->vx, w->vxi, &l, &r);
+    if (l <= r) { lo = l; hi = r; }
+  }
+
+  // Circle radius t - dr centred on b, where h >= 1
+  float tb = t - w->dr;
+  if (tb > fabsf(w->dyb)) {
+    float s = sqrtf(tb * tb - w->dyb * w->dyb);
+    l = w->bx - s; r = w->bx + s;
+    clipLinear(w->l2 - w->c, -w->vx, -w->vxi, &l, &r);
+    if (l <= r) {
+      if (lo > hi) { lo = l; hi = r; }
+      else { lo = fminf(lo, l); hi = fmaxf(hi, r); }
+    }
+  }
+
+  // Between the ends |p| + h * dr <= t, 0 <= h <= 1
+  l = -1.0e9f; r = 1.0e9f;
+  clipLinear( w->p0f + w->h0f * w->dr - t, w->k[0], w->ki[0], &l, &r);
+  clipLinear(-w->p0f + w->h0f * w->dr - t, w->k[1], w->ki[1], &l, &r);
+  clipLinear(-w->h0f,                      w->k[2], w->ki[2], &l, &r);
+  clipLinear( w->h0f - 1.0f,               w->k[3], w->ki[3], &l, &r);
+  if (l <= r) {
+    if (lo > hi) { lo = l; hi = r; }
+    else { lo = fminf(lo, l); hi = fmaxf(hi, r); }
+  }
+
+  *xl = lo;
+  *xr = hi;
+  return lo <= hi;
+}
+
+/***************************************************************************************
+** Function name:           wedgeAlpha - helper function for drawWedgeLine
+** Description:             return pixel coverage with a 24 bit fraction
+***************************************************************************************/
+// Between the ends p and h are linear in x, so they are found with 64 bit integer maths.
+// Pixels nearest to an end need the distance from its centre. Coverage is limited to +/-2.
+static inline int32_t wedgeAlpha(const wedge_t *w, int32_t x)
+{
+  int64_t h = w->h0 + x * w->h1;
+  if (h <= 0) {
+    float dx = x - w->ax;
+    return (int32_t)(fmaxf(fminf(w->t - sqrtf(dx * dx + w->dy * w->dy), 2.0f), -2.0f) * 16777216.0f);
+  }
+  if (h >= ((int64_t)1 << 32)) {
+    float dx = x - w->bx;
+    return (int32_t)(fmaxf(fminf(w->t - w->dr - sqrtf(dx * dx + w->dyb * w->dyb), 2.0f), -2.0f) * 16777216.0f);
+  }
+  int64_t p = w->p0 + x * w->p1;
+  if (p < 0) p = -p;
+  int64_t a = (w->t32 - p - (((h >> 8) * w->dr24) >> 16)) >> 8;
+  return (int32_t)(a > (2 << 24) ? (2 << 24) : a < -(2 << 24) ? -(2 << 24) : a);
 }
 
 
@@ -4596,6 +5210,8 @@ void TFT_eSPI::drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color)
 {
   if (_vpOoB) return;
 
+  ROUND_CLIP(x, y, 1, h, drawFastVLine(x, y, h, color));
+
   x+= _xDatum;
   y+= _yDatum;
 
@@ -4610,9 +5226,14 @@ void TFT_eSPI::drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color)
 
   begin_tft_write();
 
-  setWindow(x, y, x, y + h - 1);
+#ifdef WRITE_COMBINE_PIXELS
+  if (!_wcEnable || !combineWrite(x, y, h, (h > 1) ? WC_VERTICAL : WC_ANY, color))
+#endif
+  {
+    setWindow(x, y, x, y + h - 1);
 
-  pushBlock(color, h);
+    pushBlock(color, h);
+  }
 
   end_tft_write();
 }
@@ -4626,6 +5247,8 @@ void TFT_eSPI::drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color)
 {
   if (_vpOoB) return;
 
+  ROUND_CLIP(x, y, w, 1, drawFastHLine(x, y, w, color));
+
   x+= _xDatum;
   y+= _yDatum;
 
@@ -4640,9 +5263,14 @@ void TFT_eSPI::drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color)
 
   begin_tft_write();
 
-  setWindow(x, y, x + w - 1, y);
+#ifdef WRITE_COMBINE_PIXELS
+  if (!_wcEnable || !combineWrite(x, y, w, (w > 1) ? WC_HORIZONTAL : WC_ANY, color))
+#endif
+  {
+    setWindow(x, y, x + w - 1, y);
 
-  pushBlock(color, w);
+    pushBlock(color, w);
+  }
 
   end_tft_write();
 }
@@ -4656,6 +5284,8 @@ void TFT_eSPI::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t col
 {
   if (_vpOoB) return;
 
+  ROUND_CLIP(x, y, w, h, fillRect(x, y, w, h, color));
+
   x+= _xDatum;
   y+= _yDatum;
 
@@ -4828,6 +5458,177 @@ uint32_t TFT_eSPI::color24to16(uint32_t color888)
   return (r | g | b);
 }
 
+// Bulk colour conversion helpers, the 32 bit word holds two 16 bit colours and the
+// first colour in memory is in the low half (all supported processors are little-endian)
+
+// Swap the byte order of both colours in a word
+static inline uint32_t swapPair(uint32_t w)
+{
+  return ((w & 0x00FF00FF) << 8) | ((w >> 8) & 0x00FF00FF);
+}
+
+// Aligned 32 bit load and store of two 16 bit colours. The may_alias type keeps to the
+// strict aliasing rules for the uint16_t buffers.
+typedef uint32_t __attribute__((__may_alias__)) uint32_alias_t;
+
+static inline uint32_t load32(const uint16_t *p)
+{
+  return *(const uint32_alias_t *)p;
+}
+
+static inline void store32(uint16_t *p, uint32_t w)
+{
+  *(uint32_alias_t *)p = w;
+}
+
+// Same as color8to16()
+static inline uint32_t rgb332to565(uint32_t c)
+{
+  static const uint8_t blue[] = {0, 11, 21, 31}; // blue 2 to 5 bit colour lookup table
+  //      =====Green=====     ===============Red==============
+  return (c & 0x1C)<<6 | (c & 0xC0)<<5 | (c & 0xE0)<<8 |
+  //      =====Green=====    =======Blue======
+         (c & 0x1C)<<3 | blue[c & 0x03];
+}
+
+// Same as color24to16()
+static inline uint32_t rgb888to565(uint32_t r, uint32_t g, uint32_t b)
+{
+  return (r & 0xF8) << 8 | (g & 0xFC) << 3 | (b & 0xFF) >> 3;
+}
+
+/***************************************************************************************
+** Function name:           swapBytes16
+** Description:             swap the byte order of a block of 16 bit colours
+***************************************************************************************/
+void TFT_eSPI::swapBytes16(uint16_t *dst, const uint16_t *src, uint32_t len)
+{
+  // Align the destination to a 32 bit boundary
+  if (((uintptr_t)dst & 2) && len) { *dst++ = *src << 8 | *src >> 8; src++; len--; }
+
+  // Swap two colours per word if the source is aligned too
+  if (((uintptr_t)src & 2) == 0) {
+    uint32_t n = len >> 1;
+
+    for (uint32_t i = 0; i < n; i++) store32(dst + 2 * i, swapPair(load32(src + 2 * i)));
+
+    dst += n << 1;
+    src += n << 1;
+    len &= 1;
+  }
+
+  while (len--) { *dst++ = *src << 8 | *src >> 8; src++; }
+}
+
+/***************************************************************************************
+** Function name:           color8to16
+** Description:             convert a block of 8 bit colours to 16 bit 565 colours
+***************************************************************************************/
+void TFT_eSPI::color8to16(uint16_t *dst, const uint8_t *src332, uint32_t len, bool swap)
+{
+  if (((uintptr_t)dst & 2) && len) {
+    uint16_t color = rgb332to565(*src332++);
+    *dst++ = swap ? color << 8 | color >> 8 : color;
+    len--;
+  }
+
+  // Four colours per 32 bit source word, written as two words
+  uint32_t n = len >> 2;
+  while (n--) {
+    uint32_t c;
+    memcpy(&c, src332, 4); // Source may not be aligned
+    src332 += 4;
+    uint32_t w0 = rgb332to565(c & 0xFF)         | rgb332to565((c >>  8) & 0xFF) << 16;
+    uint32_t w1 = rgb332to565((c >> 16) & 0xFF) | rgb332to565(c >> 24) << 16;
+    if (swap) { w0 = swapPair(w0); w1 = swapPair(w1); }
+    store32(dst, w0);
+    store32(dst + 2, w1);
+    dst += 4;
+  }
+  len &= 3;
+
+  while (len--) {
+    uint16_t color = rgb332to565(*src332++);
+    *dst++ = swap ? color << 8 | color >> 8 : color;
+  }
+}
+
+/***************************************************************************************
+** Function name:           color24to16
+** Description:             convert a block of 24 bit colours to 16 bit 565 colours
+***************************************************************************************/
+// src888 holds red, green and blue bytes for each colour
+void TFT_eSPI::color24to16(uint16_t *dst, const uint8_t *src888, uint32_t len, bool swap)
+{
+  if (((uintptr_t)dst & 2) && len) {
+    uint16_t color = rgb888to565(src888[0], src888[1], src888[2]);
+    *dst++ = swap ? color << 8 | color >> 8 : color;
+    src888 += 3;
+    len--;
+  }
+
+  // Four colours per three 32 bit source words, written as two words
+  uint32_t n = len >> 2;
+  while (n--) {
+    uint32_t c[3];
+    memcpy(c, src888, 12); // Source may not be aligned
+    src888 += 12;
+    uint32_t w0 = rgb888to565(c[0],       c[0] >>  8, c[0] >> 16) | rgb888to565(c[0] >> 24, c[1],       c[1] >>  8) << 16;
+    uint32_t w1 = rgb888to565(c[1] >> 16, c[1] >> 24, c[2])       | rgb888to565(c[2] >>  8, c[2] >> 16, c[2] >> 24) << 16;
+    if (swap) { w0 = swapPair(w0); w1 = swapPair(w1); }
+    store32(dst, w0);
+    store32(dst + 2, w1);
+    dst += 4;
+  }
+  len &= 3;
+
+  while (len--) {
+    uint16_t color = rgb888to565(src888[0], src888[1], src888[2]);
+    *dst++ = swap ? color << 8 | color >> 8 : color;
+    src888 += 3;
+  }
+}
+
+/***************************************************************************************
+** Function name:           alphaBlend
+** Description:             Blend blocks of 16bit foreground and background colours
+***************************************************************************************/
+void TFT_eSPI::alphaBlend(uint16_t *dst, const uint16_t *fgc, const uint16_t *bgc, uint8_t alpha, uint32_t len)
+{
+  if (alpha == 0) { memmove(dst, bgc, len * 2); return; } // Same result as alphaBlend()
+
+  if (((uintptr_t)dst & 2) && len) { *dst++ = fastBlend(alpha, *fgc++, *bgc++); len--; }
+
+  // Two colours per 32 bit word if all the buffers are aligned
+  if ((((uintptr_t)fgc | (uintptr_t)bgc) & 2) == 0) {
+    uint32_t a6 = alpha >> 2; // Red and blue use 6 bit alpha
+    uint32_t n = len >> 1;
+
+    while (n--) {
+      uint32_t f = load32(fgc), b = load32(bgc);
+      fgc += 2; bgc += 2;
+
+      uint32_t rxb0 = b & 0xF81F;
+      rxb0 += ((f & 0xF81F) - rxb0) * a6 >> 6;
+      uint32_t xgx0 = b & 0x07E0;
+      xgx0 += ((f & 0x07E0) - xgx0) * alpha >> 8;
+
+      f >>= 16; b >>= 16;
+      uint32_t rxb1 = b & 0xF81F;
+      rxb1 += ((f & 0xF81F) - rxb1) * a6 >> 6;
+      uint32_t xgx1 = b & 0x07E0;
+      xgx1 += ((f & 0x07E0) - xgx1) * alpha >> 8;
+
+      store32(dst, ((rxb0 & 0xF81F) | (xgx0 & 0x07E0)) | ((rxb1 & 0xF81F) | (xgx1 & 0x07E0)) << 16);
+      dst += 2;
+    }
+
+    len &= 1;
+  }
+
+  while (len--) *dst++ = fastBlend(alpha, *fgc++, *bgc++);
+}
+
 /***************************************************************************************
 ** Function name:           invertDisplay
 ** Description:             invert the display colours i = 1 invert, i = 0 normal
@@ -4863,7 +5664,18 @@ void TFT_eSPI::setAttribute(uint8_t attr_id, uint8_t param) {
 #endif
             _psram_enable = false;
             break;
-        //case 4: // TBD future feature control
+#ifdef WRITE_COMBINE_PIXELS
+        case WRITE_COMBINE:
+            flushWrites();
+            _wcEnable = param;
+            break;
+#endif
+#ifdef SPAN_FONTS
+        case SPAN_FONT:
+            _spanFont = param;
+            break;
+#endif
+        //case 5: // TBD future feature control
         //    _tbd = param;
         //    break;
     }
@@ -4882,6 +5694,14 @@ uint8_t TFT_eSPI::getAttribute(uint8_t attr_id) {
             return _utf8;
         case PSRAM_ENABLE:
             return _psram_enable;
+#ifdef WRITE_COMBINE_PIXELS
+        case WRITE_COMBINE:
+            return _wcEnable;
+#endif
+#ifdef SPAN_FONTS
+        case SPAN_FONT:
+            return _spanFont;
+#endif
         //case 3: // TBD future feature control
         //    return _tbd;
         //    break;
@@ -5170,6 +5990,26 @@ size_t TFT_eSPI::write(uint8_t utf8)
 }
 
 
+#ifdef SPAN_FONTS
+/***************************************************************************************
+** Function name:           charSpans
+** Description:             Get the span list of a RLE font character
+***************************************************************************************/
+// c is the character code - 32. Spans are 3 bytes: x, y, length in character pixels.
+bool TFT_eSPI::charSpans(uint8_t font, uint16_t c, const uint8_t **spans, const uint8_t **end)
+{
+  if (font > 8) return false;
+
+  const uint8_t*  sp  = (const uint8_t *)pgm_read_dword( &(spanfontdata[font].spans) );
+  const uint16_t* idx = (const uint16_t *)pgm_read_dword( &(spanfontdata[font].spanidx) );
+  if (!sp) return false;
+
+  *spans = sp + 3 * pgm_read_word(idx + c);
+  *end   = sp + 3 * pgm_read_word(idx + c + 1);
+  return true;
+}
+#endif
+
 /***************************************************************************************
 ** Function name:           drawChar
 ** Description:             draw a Unicode glyph onto the screen
@@ -5226,6 +6066,9 @@ int16_t TFT_eSPI::drawChar(uint16_t uniCode, int32_t x, int32_t y, uint8_t font)
   int32_t height = 0;
   uint32_t flash_address = 0;
   uniCode -= 32;
+#ifdef SPAN_FONTS
+  const uint8_t *sp = nullptr, *se = nullptr; // Span list start and end
+#endif
 
 #ifdef LOAD_FONT2
   if (font == 2) {
@@ -5257,7 +6100,8 @@ int16_t TFT_eSPI::drawChar(uint16_t uniCode, int32_t x, int32_t y, uint8_t font)
   int32_t pX      = 0;
   int32_t pY      = y;
   uint8_t line = 0;
-  bool clip = xd < _vpX || xd + width  * textsize >= _vpW || yd < _vpY || yd + height * textsize >= _vpH;
+  bool clip = xd < _vpX || xd + width  * textsize >= _vpW || yd < _vpY || yd + height * textsize >= _vpH ||
+              !roundInside(xd, yd, width * textsize, height * textsize);
 
 #ifdef LOAD_FONT2 // chop out code if we do not need it
   if (font == 2) {
@@ -5336,6 +6180,63 @@ int16_t TFT_eSPI::drawChar(uint16_t uniCode, int32_t x, int32_t y, uint8_t font)
 #endif  //FONT2
 
 #ifdef LOAD_RLE  //674 bytes of code
+#ifdef SPAN_FONTS
+  // Font has a precompiled span list, see Tools/Host/Span_font_compiler.cpp
+  if (_spanFont && charSpans(font, uniCode, &sp, &se)) {
+    begin_tft_write();
+    inTransaction = true;
+
+    int32_t cw   = width * textsize;                      // Character cell width
+    int32_t rows = SPAN_FONT_BUFFER / (cw * textsize);    // Character rows in the line buffer
+
+    if (textcolor == textbgcolor || !rows) {
+      // One line (or block if textsize > 1) per span
+      if (textcolor != textbgcolor) fillRect(x, y, cw, height * textsize, textbgcolor);
+      while (sp < se) {
+        int32_t sx = pgm_read_byte(sp++);
+        int32_t sy = pgm_read_byte(sp++);
+        int32_t sl = pgm_read_byte(sp++);
+        if (textsize == 1) drawFastHLine(x + sx, y + sy, sl, textcolor);
+        else fillRect(x + sx * textsize, y + sy * textsize, sl * textsize, textsize, textcolor);
+      }
+    }
+    else {
+      // Character and background built in a line buffer in TFT byte order then pushed
+      uint16_t buf[SPAN_FONT_BUFFER];
+      uint16_t fg = textcolor >> 8 | textcolor << 8;
+      uint16_t bg = textbgcolor >> 8 | textbgcolor << 8;
+      bool swap = _swapBytes;
+      _swapBytes = false;
+
+      // One window for the whole character if it needs no clipping
+      if (!clip) setWindow(xd, yd, xd + cw - 1, yd + height * textsize - 1);
+
+      for (int32_t row = 0; row < height; row += rows) {
+        int32_t  n   = height - row < rows ? height - row : rows;
+        uint32_t len = cw * n * textsize;
+        for (uint32_t i = 0; i < len; i++) buf[i] = bg;
+
+        while (sp < se && pgm_read_byte(sp + 1) < row + n) {
+          int32_t sx = pgm_read_byte(sp) * textsize;
+          int32_t sy = (pgm_read_byte(sp + 1) - row) * textsize;
+          int32_t sl = pgm_read_byte(sp + 2) * textsize;
+          sp += 3;
+          uint16_t* p = buf + sy * cw + sx;
+          for (int32_t i = 0; i < sl; i++) p[i] = fg;
+          for (int32_t i = 1; i < textsize; i++) memcpy(p + i * cw, p, sl * sizeof(uint16_t));
+        }
+
+        if (clip) pushImage(x, y + row * textsize, cw, n * textsize, buf);
+        else pushPixels(buf, len);
+      }
+      _swapBytes = swap;
+    }
+
+    inTransaction = lockTransaction;
+    end_tft_write();
+  }
+  else
+#endif
   // Font is not 2 and hence is RLE encoded
   {
     begin_tft_write();
@@ -6136,6 +7037,20 @@ void TFT_eSPI::getSetup(setup_t &tft_settings)
 
 #include "Extensions/Sprite.cpp"
 
+#include "Extensions/Display_list.cpp"
+
+#include "Extensions/Gradient.cpp"
+
+#include "Extensions/Screen_capture.cpp"
+
+#include "Extensions/Jpeg.cpp"
+
+#include "Extensions/Sprite_atlas.cpp"
+
+#include "Extensions/Touch_filter.cpp"
+
+#include "Extensions/Frame_scheduler.cpp"
+
 #ifdef SMOOTH_FONT
   #include "Extensions/Smooth_font.cpp"
 #endif
@@ -105,6 +105,8 @@
   #include "Processors/TFT_eSPI_STM32.h"
 #elif defined(ARDUINO_ARCH_RP2040)
   #include "Processors/TFT_eSPI_RP2040.h"
+#elif defined (ARDUINO_ARCH_HOST)
+  #include "Processors/TFT_eSPI_Host.h"
 #else
   #include "Processors/TFT_eSPI_Generic.h"
   #define GENERIC_PROCESSOR
@@ -180,6 +182,9 @@
 #ifdef LOAD_FONT4
   #include <Fonts/Font32rle.h>
   #define LOAD_RLE
+  #ifdef SPAN_FONTS
+    #include <Fonts/Font32span.h>
+  #endif
 #endif
 
 #ifdef LOAD_FONT6
@@ -187,6 +192,9 @@
   #ifndef LOAD_RLE
     #define LOAD_RLE
   #endif
+  #ifdef SPAN_FONTS
+    #include <Fonts/Font64span.h>
+  #endif
 #endif
 
 #ifdef LOAD_FONT7
@@ -194,6 +202,9 @@
   #ifndef LOAD_RLE
     #define LOAD_RLE
   #endif
+  #ifdef SPAN_FONTS
+    #include <Fonts/Font7sspan.h>
+  #endif
 #endif
 
 #ifdef LOAD_FONT8
@@ -201,12 +212,18 @@
   #ifndef LOAD_RLE
     #define LOAD_RLE
   #endif
+  #ifdef SPAN_FONTS
+    #include <Fonts/Font72span.h>
+  #endif
 #elif defined LOAD_FONT8N // Optional narrower version
   #define LOAD_FONT8
   #include <Fonts/Font72x53rle.h>
   #ifndef LOAD_RLE
     #define LOAD_RLE
   #endif
+  #ifdef SPAN_FONTS
+    #include <Fonts/Font72x53span.h>
+  #endif
 #endif
 
 #ifdef LOAD_GFXFF
@@ -278,6 +295,52 @@ const PROGMEM fontinfo fontdata [] = {
   #endif
 };
 
+#if defined (SPAN_FONTS) && defined (LOAD_RLE)
+#define SPAN_FONT_BUFFER 512 // Pixels in the line buffer (on the stack) for opaque span font text
+
+// Span versions of the RLE fonts, see Tools/Host/Span_font_compiler.cpp
+// Stores pointers to the span and character index tables of each font number
+typedef struct {
+    const uint8_t  *spans;
+    const uint16_t *spanidx;
+    } spanfontinfo;
+
+const PROGMEM spanfontinfo spanfontdata [] = {
+   { nullptr, nullptr }, // Fonts 0 to 3 are not RLE encoded
+   { nullptr, nullptr },
+   { nullptr, nullptr },
+   { nullptr, nullptr },
+
+  #ifdef LOAD_FONT4
+   { spans_f32, spanidx_f32 },
+  #else
+   { nullptr, nullptr },
+  #endif
+
+   { nullptr, nullptr }, // Font 5 unused
+
+  #ifdef LOAD_FONT6
+   { spans_f64, spanidx_f64 },
+  #else
+   { nullptr, nullptr },
+  #endif
+
+  #ifdef LOAD_FONT7
+   { spans_f7s, spanidx_f7s },
+  #else
+   { nullptr, nullptr },
+  #endif
+
+  #ifdef LOAD_FONT8
+   { spans_f72, spanidx_f72 }
+  #else
+   { nullptr, nullptr }
+  #endif
+};
+#else
+  #undef SPAN_FONTS
+#endif
+
 /***************************************************************************************
 **                         Section 5: Font datum enumeration
 ***************************************************************************************/
@@ -420,9 +483,29 @@ int16_t tch_spi_freq;// Touch controller read/write SPI frequency
 **                         Section 8: Class member and support functions
 ***************************************************************************************/
 
+#ifdef WRITE_COMBINE_PIXELS
+// Write combining counters, see getWriteCombineStats()
+typedef struct
+{
+  uint32_t calls;   // Pixels and short lines passed to the write combining buffer
+  uint32_t windows; // Address windows sent when the buffer is flushed
+  uint32_t pixels;  // Pixels sent when the buffer is flushed
+} wc_stats_t;
+#endif
+
+// Area being drawn in bands inside the round clip area, see setRoundClip()
+typedef struct
+{
+  int32_t x, xe, y, ye;           // Area left in screen coordinates
+  int32_t vpX, vpY, vpW, vpH;     // Saved viewport
+} round_band_t;
+
 // Callback prototype for smooth font pixel colour read
 typedef uint16_t (*getColorCallback)(uint16_t x, uint16_t y);
 
+// Touch sample filter and event queue, see Extensions/Touch_filter.h
+class TFT_eTouchFilter;
+
 // Class functions and variables
 class TFT_eSPI : public Print { friend class TFT_eSprite; // Sprite class has access to protected members
 
@@ -454,7 +537,8 @@ class TFT_eSPI : public Print { friend class TFT_eSprite; // Sprite class has ac
   virtual void     setWindow(int32_t xs, int32_t ys, int32_t xe, int32_t ye);   // Note: start + end coordinates
 
                    // Push (aka write pixel) colours to the set window
-  virtual void     pushColor(uint16_t color);
+  virtual void     pushColor(uint16_t color),
+                   pushColor(uint16_t color, uint32_t len); // Same colour len times
 
                    // These are non-inlined to enable override
   virtual void     begin_nin_write();
@@ -491,9 +575,20 @@ class TFT_eSPI : public Print { friend class TFT_eSprite; // Sprite class has ac
            // Clip input window area to viewport bounds, return false if whole area is out of bounds
   bool     clipWindow(int32_t* xs, int32_t* ys, int32_t* xe, int32_t* ye);
 
+  // Round clip for round displays, drawing is also clipped to the ellipse (a circle if
+  // w == h) that fits in the screen area x,y,w,h. Pixels wholly outside it are not drawn
+  // or sent, areas that cross the edge are drawn with one window per row span.
+  // Note: x,y are not relative to a viewport, the area is kept by setRotation(). The clip
+  // does not apply to pushImageDMA() or to pixels sent after setAddrWindow().
+  bool     setRoundClip(int32_t x, int32_t y, int32_t w, int32_t h);
+  bool     setRoundClip(void); // Fit the whole screen or Sprite
+  void     resetRoundClip(void);
+  bool     getRoundClip(void);
+           // Get the visible x range xs to xe of screen row y, returns false if none
+  bool     getRoundSpan(int32_t y, int32_t *xs, int32_t *xe);
+
            // Push (aka write pixel) colours to the TFT (use setAddrWindow() first)
-  void     pushColor(uint16_t color, uint32_t len),  // Deprecated, use pushBlock()
-           pushColors(uint16_t  *data, uint32_t len, bool swap = true), // With byte swap option
+  void     pushColors(uint16_t  *data, uint32_t len, bool swap = true), // With byte swap option
            pushColors(uint8_t  *data, uint32_t len); // Deprecated, use pushPixels()
 
            // Write a solid block of a single colour
@@ -739,6 +834,17 @@ class TFT_eSPI : public Print { friend class TFT_eSprite; // Sprite class has ac
            // 24 bit colour alphaBlend with optional alpha dither
   uint32_t alphaBlend24(uint8_t alpha, uint32_t fgc, uint32_t bgc, uint8_t dither = 0);
 
+           // Bulk conversion of len colours, 32 bits at a time where the buffers are aligned
+           // Swap the byte order of 16 bit colours, dst may be the same as src
+  void     swapBytes16(uint16_t *dst, const uint16_t *src, uint32_t len);
+           // Convert 8 bit (RGB332) or 24 bit (R, G, B byte) colours to 16 bits, set swap true
+           // for TFT byte order, ready for pushPixels() with setSwapBytes(false)
+  void     color8to16(uint16_t *dst, const uint8_t *src332, uint32_t len, bool swap = false);
+  void     color24to16(uint16_t *dst, const uint8_t *src888, uint32_t len, bool swap = false);
+           // Alpha blend with a constant alpha, same result as alphaBlend(alpha, fgc[i], bgc[i])
+           // dst may be the same as fgc or bgc
+  void     alphaBlend(uint16_t *dst, const uint16_t *fgc, const uint16_t *bgc, uint8_t alpha, uint32_t len);
+
   // Direct Memory Access (DMA) support functions
   // These can be used for SPI writes when using the ESP32 (original) or STM32 processors.
   // DMA also works on a RP2040 processor with PIO based SPI and parallel (8 and 16 bit) interfaces
@@ -784,7 +890,7 @@ class TFT_eSPI : public Print { friend class TFT_eSprite; // Sprite class has ac
            // in progress, this simplifies the sketch and helps avoid "gotchas".
   void     pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* data, uint16_t* buffer = nullptr);
 
-#if defined (ESP32) // ESP32 only at the moment
+#if defined (ESP32) || defined (ARDUINO_ARCH_HOST) // ESP32 and host only at the moment
            // For case where pointer is a const and the image data must not be modified (clipped or byte swapped)
   void     pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t const* data);
 #endif
@@ -798,11 +904,27 @@ class TFT_eSPI : public Print { friend class TFT_eSprite; // Sprite class has ac
   bool     DMA_Enabled = false;   // Flag for DMA enabled state
   uint8_t  spiBusyCheck = 0;      // Number of ESP32 transfer buffers to check
 
+#if defined (ARDUINO_ARCH_HOST)
+           // Host (PC) build only, see Tools/Host/README.md
+  void     getBusStats(bus_stats_t& stats); // Copy emulated SPI bus traffic counters
+  void     resetBusStats(void);             // Clear the counters
+  uint16_t* getFrameBuffer(void);           // Emulated panel memory, TFT_WIDTH x TFT_HEIGHT, rotation 0
+  bool     saveScreen(const char* filename); // Save panel memory as PNG, or PPM if filename ends ".ppm"
+#endif
+
   // Bare metal functions
   void     startWrite(void);                         // Begin SPI transaction
   void     writeColor(uint16_t color, uint32_t len); // Deprecated, use pushBlock()
   void     endWrite(void);                           // End SPI transaction
 
+#ifdef WRITE_COMBINE_PIXELS
+           // Write combining, see User_Setup.h. Adjacent pixels and short lines on the same row or column
+           // are buffered and sent with one address window when the buffer is full or at endWrite()
+  void     flushWrites(void);                       // Send buffered pixels now
+  void     getWriteCombineStats(wc_stats_t& stats); // Copy the write combining counters
+  void     resetWriteCombineStats(void);            // Clear the counters
+#endif
+
   // Set/get an arbitrary library configuration attribute or option
   //       Use to switch ON/OFF capabilities such as UTF8 decoding - each attribute has a unique ID
   //       id = 0: reserved - may be used in future to reset all attributes to a default state
@@ -812,6 +934,8 @@ class TFT_eSPI : public Print { friend class TFT_eSprite; // Sprite class has ac
            #define CP437_SWITCH 1
            #define UTF8_SWITCH  2
            #define PSRAM_ENABLE 3
+           #define WRITE_COMBINE 4 // Only if WRITE_COMBINE_PIXELS is defined, default ON
+           #define SPAN_FONT     5 // Only if SPAN_FONTS is defined, default ON
   void     setAttribute(uint8_t id = 0, uint8_t a = 0); // Set attribute value
   uint8_t  getAttribute(uint8_t id = 0);                // Get attribute value
 
@@ -876,8 +1000,20 @@ class TFT_eSPI : public Print { friend class TFT_eSprite; // Sprite class has ac
            // Smooth graphics helper
   uint8_t  sqrt_fraction(uint32_t num);
 
-           // Helper function: calculate distance of a point from a finite length line between two points
-  float    wedgeLineDistance(float pax, float pay, float bax, float bay, float dr);
+           // Expand a clipped 8 bit or 4 bit (cmap) image in RAM to RGB565 lines and push them, called with CS low
+  void     pushPaletteImage(uint8_t *data, int32_t w, int32_t dx, int32_t dy, int32_t dw, int32_t dh, bool bpp8, uint16_t *cmap);
+
+#ifdef WRITE_COMBINE_PIXELS
+           // Write combining helpers, called with CS low
+  bool     combineWrite(int32_t x, int32_t y, int32_t len, uint8_t dir, uint16_t color);
+  void     writeCombineFlush(void);
+
+  uint16_t wcBuffer[WRITE_COMBINE_PIXELS]; // Buffered colours, byte swapped ready for pushPixels()
+  int32_t  wcX, wcY;                       // Run start coordinate
+  uint16_t wcLen;                          // Number of pixels in buffer
+  uint8_t  wcDir;                          // Run direction
+  wc_stats_t wcStats;
+#endif
 
            // Display variant settings
   uint8_t  tabcolor,                   // ST7735 screen protector "tab" colour (now invalid)
@@ -923,6 +1059,26 @@ class TFT_eSPI : public Print { friend class TFT_eSprite; // Sprite class has ac
   bool     _vpDatum;
   bool     _vpOoB;
 
+  // Round clip variables, see setRoundClip()
+  int16_t *_roundSpan;                // Visible xs, xe for each screen row, nullptr if not set
+  int32_t  _roundRows;                // Number of rows in _roundSpan
+  int32_t  _roundX, _roundY, _roundW, _roundH; // Round clip area
+  bool     _roundBand;                // Set while an area is drawn in bands
+
+           // Screen (or Sprite) size, width() and height() give the viewport size with a datum
+  void     roundSize(int32_t *w, int32_t *h);
+           // True if the screen area is wholly inside the round clip area (or there is none)
+  bool     roundInside(int32_t x, int32_t y, int32_t w, int32_t h);
+           // Start drawing area x,y,w,h in bands, false if it needs no round clipping
+  bool     roundBegin(round_band_t *band, int32_t x, int32_t y, int32_t w, int32_t h);
+           // Set the viewport to the next band, false (viewport restored) when done
+  bool     roundNext(round_band_t *band);
+
+#ifdef SPAN_FONTS
+           // Span list of character c (uniCode - 32) of a RLE font, false if there is no span table
+  bool     charSpans(uint8_t font, uint16_t c, const uint8_t **spans, const uint8_t **end);
+#endif
+
   int32_t  cursor_x, cursor_y, padX;       // Text cursor x,y and padding setting
   int32_t  bg_cursor_x;                    // Background fill cursor
   int32_t  last_cursor_x;                  // Previous text cursor position when fill used
@@ -942,6 +1098,12 @@ class TFT_eSPI : public Print { friend class TFT_eSprite; // Sprite class has ac
   bool     _cp437;        // If set, use correct CP437 charset (default is ON)
   bool     _utf8;         // If set, use UTF-8 decoder in print stream 'write()' function (default ON)
   bool     _psram_enable; // Enable PSRAM use for library functions (TBD) and Sprites
+#ifdef WRITE_COMBINE_PIXELS
+  bool     _wcEnable;     // Buffer adjacent pixels/lines to reduce address window commands (default ON)
+#endif
+#ifdef SPAN_FONTS
+  bool     _spanFont;     // Draw RLE fonts from the span tables (default ON)
+#endif
 
   uint32_t _lastColor; // Buffered value of last colour used
 
@@ -1008,4 +1170,25 @@ fastBlend(A alpha, F fgc, B bgc)
 // Load the Sprite Class
 #include "Extensions/Sprite.h"
 
+// Load the display list Class
+#include "Extensions/Display_list.h"
+
+// Load the gradient and pattern fill Class
+#include "Extensions/Gradient.h"
+
+// Load the screen capture Class
+#include "Extensions/Screen_capture.h"
+
+// Load the JPEG decoder Class
+#include "Extensions/Jpeg.h"
+
+// Load the sprite atlas and compositor Classes
+#include "Extensions/Sprite_atlas.h"
+
+// Load the touch filter Class
+#include "Extensions/Touch_filter.h"
+
+// Load the frame scheduler Class
+#include "Extensions/Frame_scheduler.h"
+
 #endif // ends #ifndef _TFT_eSPIH_
@@ -0,0 +1,211 @@
+        ////////////////////////////////////////////////////
+        //   Minimal Arduino core for host (PC) builds    //
+        ////////////////////////////////////////////////////
+
+#include "Arduino.h"
+#include "SPI.h"
+
+#include <chrono>
+#include <thread>
+#include <random>
+#include <stdarg.h>
+
+HostSerial Serial;
+SPIClass   SPI;
+
+////////////////////////////////////////////////////////////////////////////////////////
+// Timing
+////////////////////////////////////////////////////////////////////////////////////////
+
+static std::chrono::steady_clock::time_point startTime(void)
+{
+  static const std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+  return t0;
+}
+
+uint32_t millis(void)
+{
+  return (uint32_t)std::chrono::duration_cast<std::chrono::milliseconds>(
+                   std::chrono::steady_clock::now() - startTime()).count();
+}
+
+uint32_t micros(void)
+{
+  return (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(
+                   std::chrono::steady_clock::now() - startTime()).count();
+}
+
+void delay(uint32_t ms)
+{
+  std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+void delayMicroseconds(uint32_t us)
+{
+  std::this_thread::sleep_for(std::chrono::microseconds(us));
+}
+
+void yield(void)
+{
+  std::this_thread::yield();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////
+// GPIO (no hardware, calls are ignored)
+////////////////////////////////////////////////////////////////////////////////////////
+
+static int (*pinReader)(uint8_t pin) = nullptr;
+
+void attachPinReader(int (*reader)(uint8_t pin)) { pinReader = reader; }
+
+void pinMode(uint8_t pin, uint8_t mode)     { (void)pin; (void)mode; }
+void digitalWrite(uint8_t pin, uint8_t val) { (void)pin; (void)val;  }
+
+int digitalRead(uint8_t pin)
+{
+  int val = pinReader ? pinReader(pin) : -1;
+  return val < 0 ? HIGH : val;
+}
+
+int  analogRead(uint8_t pin)                { (void)pin; return 0;    }
+void analogWrite(uint8_t pin, int val)      { (void)pin; (void)val;   }
+
+////////////////////////////////////////////////////////////////////////////////////////
+// Maths, a fixed default seed makes benchmark runs repeatable
+////////////////////////////////////////////////////////////////////////////////////////
+
+static std::minstd_rand rng(1);
+
+void randomSeed(unsigned long seed) { if (seed) rng.seed(seed); }
+
+long random(long howbig)
+{
+  if (howbig <= 0) return 0;
+  return rng() % howbig;
+}
+
+long random(long howsmall, long howbig)
+{
+  if (howsmall >= howbig) return howsmall;
+  return random(howbig - howsmall) + howsmall;
+}
+
+long map(long x, long in_min, long in_max, long out_min, long out_max)
+{
+  return (x - in_min) * (out_max - out_min) / (in_max - in_min) + out_min;
+}
+
+// Non standard C library functions provided by the Arduino cores
+char* ultoa(unsigned long value, char* str, int radix)
+{
+  char  tmp[33];
+  char* p = tmp;
+  if (radix < 2 || radix > 36) radix = 10;
+  do {
+    int d = value % radix;
+    *p++ = d < 10 ? '0' + d : 'a' + d - 10;
+    value /= radix;
+  } while (value);
+  char* s = str;
+  while (p > tmp) *s++ = *--p;
+  *s = 0;
+  return str;
+}
+
+char* ltoa(long value, char* str, int radix)
+{
+  if (value < 0 && radix == 10) {
+    *str = '-';
+    ultoa(-(unsigned long)value, str + 1, radix);
+    return str;
+  }
+  return ultoa((unsigned long)value, str, radix);
+}
+
+char* itoa(int value, char* str, int radix)
+{
+  return ltoa(value, str, radix);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////
+// String
+////////////////////////////////////////////////////////////////////////////////////////
+
+String::String(double v, unsigned char dp)
+{
+  char buf[40];
+  snprintf(buf, sizeof(buf), "%.*f", dp, v);
+  str = buf;
+}
+
+void String::fromLong(long v, unsigned char base)
+{
+  char buf[72];
+  if (base == 10) snprintf(buf, sizeof(buf), "%ld", v);
+  else if (base == 16) snprintf(buf, sizeof(buf), "%lx", (unsigned long)v);
+  else if (base == 8) snprintf(buf, sizeof(buf), "%lo", (unsigned long)v);
+  else {
+    unsigned long n = (unsigned long)v;
+    char *p = &buf[sizeof(buf) - 1];
+    *p = 0;
+    do { *--p = '0' + (n % base); n /= base; } while (n);
+    str = p;
+    return;
+  }
+  str = buf;
+}
+
+void String::toCharArray(char *buf, unsigned int bufsize, unsigned int index) const
+{
+  if (!bufsize || !buf) return;
+  if (index >= str.length()) { buf[0] = 0; return; }
+  unsigned int n = str.length() - index;
+  if (n > bufsize - 1) n = bufsize - 1;
+  memcpy(buf, str.c_str() + index, n);
+  buf[n] = 0;
+}
+
+bool String::endsWith(const String &suffix) const
+{
+  if (suffix.str.length() > str.length()) return false;
+  return str.compare(str.length() - suffix.str.length(), suffix.str.length(), suffix.str) == 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////
+// Print
+////////////////////////////////////////////////////////////////////////////////////////
+
+size_t Print::write(const uint8_t *buffer, size_t size)
+{
+  size_t n = 0;
+  while (size--) n += write(*buffer++);
+  return n;
+}
+
+size_t Print::printNumber(unsigned long n, int base)
+{
+  return print(String(n, (unsigned char)base));
+}
+
+size_t Print::printSigned(long n, int base)
+{
+  if (base == 10) return print(String(n, (unsigned char)base));
+  return printNumber((unsigned long)n, base);
+}
+
+size_t Print::print(double n, int digits)
+{
+  return print(String(n, (unsigned char)digits));
+}
+
+size_t Print::printf(const char *format, ...)
+{
+  char buf[256];
+  va_list args;
+  va_start(args, format);
+  int len = vsnprintf(buf, sizeof(buf), format, args);
+  va_end(args);
+  if (len < 0) return 0;
+  if (len >= (int)sizeof(buf)) len = sizeof(buf) - 1;
+  return write((const uint8_t *)buf, len);
+}
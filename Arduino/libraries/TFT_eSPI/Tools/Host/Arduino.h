@@ -0,0 +1,128 @@
+        ////////////////////////////////////////////////////
+        //   Minimal Arduino core for host (PC) builds    //
+        ////////////////////////////////////////////////////
+
+// This is NOT a full Arduino core. It provides just enough of the Arduino API for
+// TFT_eSPI to compile and run on a Linux/macOS/Windows PC with the host processor
+// backend (Processors/TFT_eSPI_Host.c), so the graphics code can be profiled and
+// regression tested without hardware. See Tools/Host/README.md
+
+#ifndef _HOST_ARDUINO_H_
+#define _HOST_ARDUINO_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+
+// Architecture flag used by TFT_eSPI.h to select Processors/TFT_eSPI_Host.h
+#ifndef ARDUINO_ARCH_HOST
+  #define ARDUINO_ARCH_HOST
+#endif
+
+#define ARDUINO 10819
+
+#define HIGH 0x1
+#define LOW  0x0
+
+#define INPUT         0x01
+#define OUTPUT        0x03
+#define INPUT_PULLUP  0x05
+
+#define LSBFIRST 0
+#define MSBFIRST 1
+
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
+#ifndef PI
+  #define PI 3.1415926535897932384626433832795
+#endif
+#define DEG_TO_RAD 0.017453292519943295769236907684886
+#define RAD_TO_DEG 57.295779513082320876798154814105
+
+typedef uint8_t  byte;
+typedef bool     boolean;
+typedef uint16_t word;
+
+// FLASH storage is ordinary memory on a PC
+#define PROGMEM
+#define PSTR(s) (s)
+#define F(s)    (s)
+#define pgm_read_byte(addr)  host_pgm_read_byte((const void *)(addr))
+#define pgm_read_word(addr)  host_pgm_read_word((const void *)(addr))
+#define pgm_read_dword(addr) host_pgm_read_dword((const void *)(addr))
+#define pgm_read_ptr(addr)   host_pgm_read_ptr((const void *)(addr))
+
+// The tables are read with memcpy() so the pointer type of the table does not matter
+// (no strict aliasing or alignment issues), the compiler turns it into a plain load
+static inline uint8_t  host_pgm_read_byte(const void * addr)  { uint8_t  v; memcpy(&v, addr, sizeof(v)); return v; }
+static inline uint16_t host_pgm_read_word(const void * addr)  { uint16_t v; memcpy(&v, addr, sizeof(v)); return v; }
+static inline uint32_t host_pgm_read_dword(const void * addr) { uint32_t v; memcpy(&v, addr, sizeof(v)); return v; }
+static inline void *   host_pgm_read_ptr(const void * addr)   { void *   v; memcpy(&v, addr, sizeof(v)); return v; }
+
+#ifdef __cplusplus
+
+#include <algorithm>
+
+using std::min;
+using std::max;
+using std::abs;
+
+template <typename T, typename L, typename H> static inline T
+constrain(T x, L lo, H hi) { return x < (T)lo ? (T)lo : (x > (T)hi ? (T)hi : x); }
+
+#define sq(x) ((x)*(x))
+#define bitRead(value, bit) (((value) >> (bit)) & 0x01)
+
+// Timing, millis() and micros() count from the first call
+uint32_t millis(void);
+uint32_t micros(void);
+void     delay(uint32_t ms);
+void     delayMicroseconds(uint32_t us);
+void     yield(void);
+
+// GPIO is not available, pin functions are accepted and ignored. An emulated device can
+// drive input pins with a reader that returns HIGH, LOW or -1 for pins it does not drive.
+void     attachPinReader(int (*reader)(uint8_t pin));
+void     pinMode(uint8_t pin, uint8_t mode);
+void     digitalWrite(uint8_t pin, uint8_t val);
+int      digitalRead(uint8_t pin);
+int      analogRead(uint8_t pin);
+void     analogWrite(uint8_t pin, int val);
+#define  digitalPinToBitMask(P) (1UL << ((P) & 0x1F))
+
+long     random(long howbig);
+long     random(long howsmall, long howbig);
+void     randomSeed(unsigned long seed);
+long     map(long x, long in_min, long in_max, long out_min, long out_max);
+
+char*    itoa(int value, char* str, int radix);
+char*    ltoa(long value, char* str, int radix);
+char*    ultoa(unsigned long value, char* str, int radix);
+
+#include "WString.h"
+#include "Print.h"
+
+// Serial output goes to stdout
+class HostSerial : public Print {
+ public:
+  void   begin(unsigned long baud) { (void)baud; }
+  void   end(void) {}
+  int    available(void) { return 0; }
+  int    read(void) { return -1; }
+  void   flush(void) { fflush(stdout); }
+  size_t write(uint8_t c) { return fputc(c, stdout) == EOF ? 0 : 1; }
+  using  Print::write;
+  operator bool() { return true; }
+};
+
+extern HostSerial Serial;
+
+#endif // __cplusplus
+
+#endif // _HOST_ARDUINO_H_
@@ -0,0 +1,726 @@
+/*
+  Host benchmark for TFT_eSPI graphics primitives, sprites and smooth fonts
+
+  Each test is run against the emulated GC9A01 240 x 240 panel. The report gives:
+    host_us : time taken by the PC, useful to compare code changes (not absolute speed)
+    cmd     : number of commands sent (DC low bytes)
+    windows : number of address window commands (CASET or RASET)
+    overhead: command and parameter bytes
+    pixels  : pixel bytes written to panel memory
+    ratio   : command to pixel byte ratio (overhead / pixels)
+    spi_ms  : estimated bus time at SPI_FREQUENCY (bus bytes * 8 / SPI_FREQUENCY)
+
+  The sprite expansion test times full screen 16, 8 and 4 bit Sprite pushes with the
+  panel model discarding the pixels, to give the RGB565 expansion rate (Mpixel/s).
+
+  The colour kernel test compares the bulk colour conversion functions with per pixel
+  loops calling the single colour functions, and checks the results are the same.
+
+  The wide line test compares drawWideLine() and drawWedgeLine() with the original
+  floating point version (kept here as a reference) for time, bus bytes and pixels.
+  float_ex and fixed_ex are the largest green level errors of each against a double
+  precision scan of every pixel. The float version skips the odd pixel at the start of
+  a row, and its rounding moves some pixels to the next level.
+
+  The gradient test compares fillRectVGradient() and fillRectHGradient() with the
+  TFT_eGradient line buffer fills, then times the radial, conic and pattern fills.
+  Times are per full screen fill with the panel model discarding pixels.
+
+  If WRITE_COMBINE_PIXELS is defined the tests are run twice, with write combining
+  off and then on, and the change in bus bytes is reported.
+
+  Usage: TFT_eSPI_benchmark [output_directory]
+  A PNG image of the screen is saved after each test if an output directory is given.
+*/
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include <chrono>
+
+#include "../../examples/Smooth Fonts/FLASH_Array/Smooth_font_reading_TFT/NotoSansBold36.h"
+
+TFT_eSPI tft = TFT_eSPI();
+TFT_eSprite spr = TFT_eSprite(&tft);
+
+static const char* outDir = nullptr;
+static const char* suffix = "";
+static uint64_t totalBytes;
+
+// Run a test, print the bus traffic and optionally save the screen
+template <typename F> static void bench(const char* name, F test)
+{
+  tft.resetBusStats();
+
+  auto t0 = std::chrono::steady_clock::now();
+  test();
+  auto t1 = std::chrono::steady_clock::now();
+
+  bus_stats_t stats;
+  tft.getBusStats(stats);
+
+  double us = std::chrono::duration<double, std::micro>(t1 - t0).count();
+  double spiMs = (stats.cmdBytes + stats.pixelBytes) * 8000.0 / SPI_FREQUENCY;
+  double ratio = stats.pixelBytes ? (double)stats.cmdBytes / stats.pixelBytes : 0;
+
+  totalBytes += stats.cmdBytes + stats.pixelBytes;
+
+  Serial.printf("%-22s %10.0f %8u %8u %9u %10u %7.3f %8.2f\n", name, us,
+                stats.commands, stats.windows, stats.cmdBytes, stats.pixelBytes, ratio, spiMs);
+
+  if (outDir) {
+    char filename[256];
+    snprintf(filename, sizeof(filename), "%s/%s%s.png", outDir, name, suffix);
+    tft.saveScreen(filename);
+  }
+}
+
+static void runTests(void)
+{
+  Serial.printf("%-22s %10s %8s %8s %9s %10s %7s %8s\n", "test", "host_us", "cmd", "windows", "overhead", "pixels", "ratio", "spi_ms");
+
+  totalBytes = 0;
+
+  bench("fillScreen", []() {
+    for (uint8_t i = 0; i < 8; i++) tft.fillScreen(i & 1 ? TFT_BLUE : TFT_RED);
+  });
+
+  bench("pixels", []() {
+    randomSeed(1);
+    for (uint16_t i = 0; i < 5000; i++) tft.drawPixel(random(240), random(240), random(0x10000));
+  });
+
+  bench("lines", []() {
+    tft.fillScreen(TFT_BLACK);
+    for (int16_t i = 0; i < 240; i += 6) {
+      tft.drawLine(0, 0, 239, i, TFT_CYAN);
+      tft.drawLine(239, 239, 0, i, TFT_YELLOW);
+    }
+  });
+
+  bench("fast_lines", []() {
+    tft.fillScreen(TFT_BLACK);
+    for (int16_t i = 0; i < 240; i += 3) {
+      tft.drawFastHLine(0, i, 240, TFT_GREEN);
+      tft.drawFastVLine(i, 0, 240, TFT_MAGENTA);
+    }
+  });
+
+  bench("rects", []() {
+    tft.fillScreen(TFT_BLACK);
+    for (int16_t i = 4; i < 120; i += 4) tft.drawRect(120 - i, 120 - i, 2 * i, 2 * i, TFT_WHITE);
+    for (int16_t i = 4; i < 120; i += 8) tft.fillRect(120 - i / 2, 120 - i / 2, i, i, tft.color565(i * 2, 0, 255 - i * 2));
+  });
+
+  bench("circles", []() {
+    tft.fillScreen(TFT_BLACK);
+    for (int16_t r = 4; r < 120; r += 6) tft.drawCircle(120, 120, r, TFT_ORANGE);
+    for (int16_t r = 60; r > 0; r -= 10) tft.fillCircle(120, 120, r, tft.color565(r * 4, 255 - r * 4, 0));
+  });
+
+  bench("smooth_shapes", []() {
+    tft.fillScreen(TFT_BLACK);
+    tft.fillSmoothCircle(120, 120, 60, TFT_SKYBLUE, TFT_BLACK);
+    tft.drawSmoothArc(120, 120, 110, 90, 30, 330, TFT_GREEN, TFT_BLACK, true);
+    tft.drawWideLine(20, 200, 220, 40, 6, TFT_WHITE, TFT_BLACK);
+    tft.drawWedgeLine(20, 40, 220, 200, 1, 10, TFT_RED, TFT_BLACK);
+  });
+
+  bench("text_font2_4", []() {
+    tft.fillScreen(TFT_BLACK);
+    tft.setTextColor(TFT_WHITE, TFT_BLACK);
+    for (int16_t y = 20; y < 220; y += 40) {
+      tft.drawString("Font 2 text 0123", 30, y, 2);
+      tft.drawString("Font 4", 60, y + 16, 4);
+    }
+  });
+
+  bench("text_transparent", []() {
+    tft.fillScreen(TFT_BLACK);
+    tft.setTextColor(TFT_YELLOW); // No background, characters are drawn pixel by pixel
+    tft.setTextFont(1);
+    tft.setTextSize(1);
+    for (int16_t y = 30; y < 210; y += 10) {
+      tft.setCursor(30, y);
+      tft.print("Transparent text 0123456");
+    }
+    tft.setTextSize(2);
+    tft.setCursor(30, 210);
+    tft.print("Size 2");
+    tft.setTextSize(1);
+  });
+
+  bench("triangles_rrects", []() {
+    tft.fillScreen(TFT_BLACK);
+    for (int16_t i = 0; i < 120; i += 10) tft.drawTriangle(120, 120 - i, 120 - i, 120 + i, 120 + i, 120 + i, TFT_CYAN);
+    for (int16_t i = 0; i < 100; i += 12) tft.drawRoundRect(20 + i / 2, 20 + i / 2, 200 - i, 200 - i, 10, TFT_PINK);
+    tft.fillRoundRect(80, 80, 80, 80, 16, TFT_PURPLE);
+  });
+
+  bench("wedge_lines", []() {
+    tft.fillScreen(TFT_BLACK);
+    for (int16_t a = 0; a < 360; a += 30) {
+      float r = a * DEG_TO_RAD;
+      tft.drawWedgeLine(120, 120, 120 + 100 * cos(r), 120 + 100 * sin(r), 6, 1, TFT_WHITE, TFT_BLACK);
+    }
+  });
+
+  bench("text_font7", []() {
+    tft.fillScreen(TFT_BLACK);
+    tft.setTextColor(TFT_GREEN, TFT_BLACK);
+    tft.drawString("12:34", 40, 70, 7);
+    tft.drawString("56.78", 40, 130, 7);
+  });
+
+  bench("smooth_font", []() {
+    tft.fillScreen(TFT_BLACK);
+    tft.loadFont(NotoSansBold36);
+    tft.setTextColor(TFT_WHITE, TFT_BLACK, true);
+    tft.drawString("Smooth", 50, 60);
+    tft.drawString("Fonts 123", 40, 110);
+    tft.unloadFont();
+  });
+
+  bench("sprite_push", []() {
+    spr.createSprite(120, 120);
+    spr.fillSprite(TFT_NAVY);
+    spr.fillCircle(60, 60, 50, TFT_GOLD);
+    spr.drawString("Sprite", 30, 52, 2);
+    for (int16_t i = 0; i < 4; i++) spr.pushSprite((i & 1) * 120, (i >> 1) * 120);
+    spr.deleteSprite();
+  });
+
+  bench("sprite_8bit", []() {
+    spr.setColorDepth(8);
+    spr.createSprite(240, 60);
+    for (int16_t i = 0; i < 4; i++) {
+      spr.fillSprite(TFT_DARKGREY);
+      spr.fillRoundRect(10, 10, 220, 40, 8, i & 1 ? TFT_RED : TFT_BLUE);
+      spr.pushSprite(0, i * 60);
+    }
+    spr.deleteSprite();
+    spr.setColorDepth(16);
+  });
+
+  bench("dma_image", []() {
+    static uint16_t image[60 * 60];
+    for (uint16_t i = 0; i < 60 * 60; i++) image[i] = i;
+    tft.initDMA();
+    tft.startWrite();
+    for (int16_t y = 0; y < 240; y += 60)
+      for (int16_t x = 0; x < 240; x += 60) tft.pushImageDMA(x, y, 60, 60, (const uint16_t*)image);
+    tft.endWrite();
+    tft.deInitDMA();
+  });
+
+  bench("read_rect", []() {
+    static uint16_t block[40 * 40];
+    tft.readRect(100, 100, 40, 40, block);
+    tft.pushRect(0, 0, 40, 40, block);
+  });
+
+  bench("rotation", []() {
+    tft.fillScreen(TFT_BLACK);
+    for (uint8_t r = 0; r < 4; r++) {
+      tft.setRotation(r);
+      tft.setTextColor(TFT_WHITE, TFT_BLACK);
+      tft.drawString("Rotation " + String(r), 70, 10, 2);
+      tft.fillTriangle(120, 30, 110, 50, 130, 50, TFT_RED);
+    }
+    tft.setRotation(0);
+  });
+}
+
+// Time full screen Sprite pushes, with and without DMA. The panel model discards the
+// pixels so the time is that taken to expand (or copy) the Sprite to RGB565 lines.
+static void paletteThroughput(void)
+{
+  const uint16_t frames = 20;
+  const uint8_t  depth[] = {16, 8, 4};
+
+  Serial.printf("\n%-22s %10s %10s %8s\n", "sprite_expansion", "host_us", "Mpixel/s", "dma");
+
+  for (uint8_t bpp : depth) {
+    spr.setColorDepth(bpp);
+    spr.createSprite(TFT_WIDTH, TFT_HEIGHT);
+    for (int16_t i = 0; i < 16; i++) {
+      uint16_t color = bpp == 4 ? i : (bpp == 8 ? i * 16 + 7 : i * 0x1111);
+      spr.fillRect(0, i * TFT_HEIGHT / 16, TFT_WIDTH, TFT_HEIGHT / 16, color);
+    }
+    spr.fillCircle(TFT_WIDTH / 2, TFT_HEIGHT / 2, TFT_WIDTH / 3, bpp == 4 ? 15 : TFT_WHITE);
+
+    for (uint8_t dma = 0; dma < (bpp == 16 ? 1 : 2); dma++) {
+      if (dma) tft.initDMA();
+      tft_host.discardPixels = true;
+
+      double us = 1e12;
+      for (uint8_t run = 0; run < 5; run++) { // Fastest of 5 runs to reduce timing noise
+        tft.resetBusStats();
+        auto t0 = std::chrono::steady_clock::now();
+        tft.startWrite();
+        for (uint16_t f = 0; f < frames; f++) spr.pushSprite(0, 0);
+        tft.endWrite();
+        auto t1 = std::chrono::steady_clock::now();
+        us = std::min(us, std::chrono::duration<double, std::micro>(t1 - t0).count());
+      }
+
+      tft_host.discardPixels = false;
+      bus_stats_t stats;
+      tft.getBusStats(stats);
+
+      char name[24];
+      snprintf(name, sizeof(name), "sprite_%dbit%s", bpp, dma ? "_dma" : "");
+      Serial.printf("%-22s %10.0f %10.1f %8u\n", name, us, (double)frames * TFT_WIDTH * TFT_HEIGHT / us, stats.dmaTransfers);
+
+      if (dma) tft.deInitDMA();
+    }
+
+    if (outDir) {
+      char filename[256];
+      spr.pushSprite(0, 0);
+      snprintf(filename, sizeof(filename), "%s/sprite_%dbit_full.png", outDir, bpp);
+      tft.saveScreen(filename);
+    }
+    spr.deleteSprite();
+  }
+  spr.setColorDepth(16);
+}
+
+// Floating point drawWedgeLine() from TFT_eSPI 2.5.34, used as a reference
+static float wedgeLineDistance(float xpax, float ypay, float bax, float bay, float dr)
+{
+  float h = fmaxf(fminf((xpax * bax + ypay * bay) / (bax * bax + bay * bay), 1.0f), 0.0f);
+  float dx = xpax - bax * h, dy = ypay - bay * h;
+  return sqrtf(dx * dx + dy * dy) + h * dr;
+}
+
+static void drawWedgeLineFloat(float ax, float ay, float bx, float by, float ar, float br, uint32_t fg_color, uint32_t bg_color)
+{
+  const float PixelAlphaGain  = 255.0;
+  const float LoAlphaTheshold = 1.0/32.0;
+  const float HiAlphaTheshold = 1.0 - LoAlphaTheshold;
+
+  if ( (ar < 0.0) || (br < 0.0) )return;
+  if ( (fabsf(ax - bx) < 0.01f) && (fabsf(ay - by) < 0.01f) ) bx += 0.01f;  // Avoid divide by zero
+
+  // Find line bounding box
+  int32_t x0 = (int32_t)floorf(fminf(ax-ar, bx-br));
+  int32_t x1 = (int32_t) ceilf(fmaxf(ax+ar, bx+br));
+  int32_t y0 = (int32_t)floorf(fminf(ay-ar, by-br));
+  int32_t y1 = (int32_t) ceilf(fmaxf(ay+ar, by+br));
+
+  if (!tft.clipWindow(&x0, &y0, &x1, &y1)) return;
+
+  // Establish x start and y start
+  int32_t ys = ay;
+  if ((ax-ar)>(bx-br)) ys = by;
+
+  float rdt = ar - br; // Radius delta
+  float alpha = 1.0f;
+  ar += 0.5;
+
+  uint16_t bg = bg_color;
+  float xpax, ypay, bax = bx - ax, bay = by - ay;
+
+  tft.startWrite();
+
+  int32_t xs = x0;
+  // Scan bounding box from ys down, calculate pixel intensity from distance to line
+  for (int32_t yp = ys; yp <= y1; yp++) {
+    bool swin = true;  // Flag to start new window area
+    bool endX = false; // Flag to skip pixels
+    ypay = yp - ay;
+    for (int32_t xp = xs; xp <= x1; xp++) {
+      if (endX) if (alpha <= LoAlphaTheshold) break;  // Skip right side
+      xpax = xp - ax;
+      alpha = ar - wedgeLineDistance(xpax, ypay, bax, bay, rdt);
+      if (alpha <= LoAlphaTheshold ) continue;
+      // Track edge to minimise calculations
+      if (!endX) { endX = true; xs = xp; }
+      if (alpha > HiAlphaTheshold) {
+        #ifdef GC9A01_DRIVER
+          tft.drawPixel(xp, yp, fg_color);
+        #else
+          if (swin) { tft.setWindow(xp, yp, x1, yp); swin = false; }
+          tft.pushColor(fg_color);
+        #endif
+        continue;
+      }
+      //Blend color with background and plot
+      if (bg_color == 0x00FFFFFF) {
+        bg = tft.readPixel(xp, yp); swin = true;
+      }
+      #ifdef GC9A01_DRIVER
+        uint16_t pcol = fastBlend((uint8_t)(alpha * PixelAlphaGain), fg_color, bg);
+        tft.drawPixel(xp, yp, pcol);
+        swin = swin;
+      #else
+        if (swin) { tft.setWindow(xp, yp, x1, yp); swin = false; }
+        tft.pushColor(fastBlend((uint8_t)(alpha * PixelAlphaGain), fg_color, bg));
+      #endif
+    }
+  }
+
+  // Reset x start to left side of box
+  xs = x0;
+  // Scan bounding box from ys-1 up, calculate pixel intensity from distance to line
+  for (int32_t yp = ys-1; yp >= y0; yp--) {
+    bool swin = true;  // Flag to start new window area
+    bool endX = false; // Flag to skip pixels
+    ypay = yp - ay;
+    for (int32_t xp = xs; xp <= x1; xp++) {
+      if (endX) if (alpha <= LoAlphaTheshold) break;  // Skip right side of drawn line
+      xpax = xp - ax;
+      alpha = ar - wedgeLineDistance(xpax, ypay, bax, bay, rdt);
+      if (alpha <= LoAlphaTheshold ) continue;
+      // Track line boundary
+      if (!endX) { endX = true; xs = xp; }
+      if (alpha > HiAlphaTheshold) {
+        #ifdef GC9A01_DRIVER
+          tft.drawPixel(xp, yp, fg_color);
+        #else
+          if (swin) { tft.setWindow(xp, yp, x1, yp); swin = false; }
+          tft.pushColor(fg_color);
+        #endif
+        continue;
+      }
+      //Blend colour with background and plot
+      if (bg_color == 0x00FFFFFF) {
+        bg = tft.readPixel(xp, yp); swin = true;
+      }
+      #ifdef GC9A01_DRIVER
+        uint16_t pcol = fastBlend((uint8_t)(alpha * PixelAlphaGain), fg_color, bg);
+        tft.drawPixel(xp, yp, pcol);
+        swin = swin;
+      #else
+        if (swin) { tft.setWindow(xp, yp, x1, yp); swin = false; }
+        tft.pushColor(fastBlend((uint8_t)(alpha * PixelAlphaGain), fg_color, bg));
+      #endif
+    }
+  }
+
+  tft.endWrite();
+}
+
+// Double precision distance for every pixel in the bounding box, so without the rounding
+// errors of the float version or the pixels its row tracking skips
+static void drawWedgeLineExact(uint16_t* fb, double ax, double ay, double bx, double by, double ar, double br, uint16_t fg_color, uint16_t bg_color)
+{
+  double vx = bx - ax, vy = by - ay, l2 = vx * vx + vy * vy;
+  int32_t x0 = std::max(0, (int32_t)floor(std::min(ax - ar, bx - br)));
+  int32_t x1 = std::min(TFT_WIDTH - 1, (int32_t)ceil(std::max(ax + ar, bx + br)));
+  int32_t y0 = std::max(0, (int32_t)floor(std::min(ay - ar, by - br)));
+  int32_t y1 = std::min(TFT_HEIGHT - 1, (int32_t)ceil(std::max(ay + ar, by + br)));
+
+  for (int32_t yp = y0; yp <= y1; yp++) {
+    for (int32_t xp = x0; xp <= x1; xp++) {
+      double px = xp - ax, py = yp - ay;
+      double h = std::max(std::min((px * vx + py * vy) / l2, 1.0), 0.0);
+      double dx = px - vx * h, dy = py - vy * h;
+      double alpha = ar + 0.5 - (sqrt(dx * dx + dy * dy) + h * (ar - br));
+      if (alpha <= 1.0 / 32.0) continue;
+      fb[xp + yp * TFT_WIDTH] = (alpha > 1.0 - 1.0 / 32.0) ? fg_color : fastBlend((uint8_t)(alpha * 255), fg_color, bg_color);
+    }
+  }
+}
+
+// Largest green (6 bit) difference between two screens
+static int32_t maxGreenError(const uint16_t* a, const uint16_t* b)
+{
+  int32_t maxErr = 0;
+  for (uint32_t i = 0; i < TFT_WIDTH * TFT_HEIGHT; i++) {
+    maxErr = std::max(maxErr, abs(((a[i] >> 5) & 0x3F) - ((b[i] >> 5) & 0x3F)));
+  }
+  return maxErr;
+}
+
+// Compare drawWideLine() with the floating point version for several widths and angles
+static void wideLines(void)
+{
+  const float widths[] = {1, 2, 3, 5, 8, 15, 30};
+  static uint16_t ref[TFT_WIDTH * TFT_HEIGHT];
+  static uint16_t exact[TFT_WIDTH * TFT_HEIGHT];
+
+#ifdef WRITE_COMBINE_PIXELS
+  tft.setAttribute(WRITE_COMBINE, false); // Default setting
+#endif
+
+  Serial.printf("\n%-10s %10s %10s %10s %10s %8s %8s %8s %8s %8s\n", "wide_line", "float_us", "fixed_us", "float_B", "fixed_B",
+                "speedup", "differ", "max_err", "float_ex", "fixed_ex");
+
+  for (float wd : widths) {
+    double us[2];
+    uint32_t bytes[2];
+    for (uint32_t i = 0; i < TFT_WIDTH * TFT_HEIGHT; i++) exact[i] = TFT_BLACK;
+    for (int16_t a = 0; a < 360; a += 15) {
+      float s = sinf(a * DEG_TO_RAD), c = cosf(a * DEG_TO_RAD);
+      float ax = 120.3f + 12 * c, ay = 119.6f + 12 * s, bx = 120.3f + 110 * c, by = 119.6f + 110 * s;
+      drawWedgeLineExact(exact, ax, ay, bx, by, wd / 2, wd / 2, TFT_WHITE, TFT_BLACK);
+    }
+    for (uint8_t fixed = 0; fixed < 2; fixed++) {
+      tft.fillScreen(TFT_BLACK);
+      tft.resetBusStats();
+      auto t0 = std::chrono::steady_clock::now();
+      for (int16_t a = 0; a < 360; a += 15) { // 24 angles, lines from near the centre
+        float s = sinf(a * DEG_TO_RAD), c = cosf(a * DEG_TO_RAD);
+        float ax = 120.3f + 12 * c, ay = 119.6f + 12 * s, bx = 120.3f + 110 * c, by = 119.6f + 110 * s;
+        if (fixed) tft.drawWideLine(ax, ay, bx, by, wd, TFT_WHITE, TFT_BLACK);
+        else drawWedgeLineFloat(ax, ay, bx, by, wd / 2, wd / 2, TFT_WHITE, TFT_BLACK);
+      }
+      auto t1 = std::chrono::steady_clock::now();
+      us[fixed] = std::chrono::duration<double, std::micro>(t1 - t0).count();
+      bus_stats_t stats;
+      tft.getBusStats(stats);
+      bytes[fixed] = stats.cmdBytes + stats.pixelBytes;
+      if (!fixed) memcpy(ref, tft.getFrameBuffer(), sizeof(ref));
+    }
+
+    // Count pixels that differ and the largest green (6 bit) difference
+    uint32_t differ = 0;
+    int32_t maxErr = 0;
+    for (uint32_t i = 0; i < TFT_WIDTH * TFT_HEIGHT; i++) {
+      uint16_t p = tft.getFrameBuffer()[i];
+      if (p == ref[i]) continue;
+      differ++;
+      maxErr = std::max(maxErr, abs(((p >> 5) & 0x3F) - ((ref[i] >> 5) & 0x3F)));
+    }
+
+    char name[16];
+    snprintf(name, sizeof(name), "width_%g", wd);
+    Serial.printf("%-10s %10.0f %10.0f %10u %10u %8.2f %8u %8d %8d %8d\n", name, us[0], us[1], bytes[0], bytes[1], us[0] / us[1], differ, maxErr,
+                  maxGreenError(ref, exact), maxGreenError(tft.getFrameBuffer(), exact));
+  }
+
+  // Wedge lines, radius 1 to 8
+  double us[2];
+  for (uint8_t fixed = 0; fixed < 2; fixed++) {
+    tft.fillScreen(TFT_BLACK);
+    auto t0 = std::chrono::steady_clock::now();
+    for (int16_t a = 0; a < 360; a += 30) {
+      float s = sinf(a * DEG_TO_RAD), c = cosf(a * DEG_TO_RAD);
+      if (fixed) tft.drawWedgeLine(120, 120, 120 + 100 * c, 120 + 100 * s, 8, 1, TFT_RED, TFT_BLACK);
+      else drawWedgeLineFloat(120, 120, 120 + 100 * c, 120 + 100 * s, 8, 1, TFT_RED, TFT_BLACK);
+    }
+    us[fixed] = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count();
+    if (!fixed) memcpy(ref, tft.getFrameBuffer(), sizeof(ref));
+  }
+  uint32_t differ = 0;
+  for (uint32_t i = 0; i < TFT_WIDTH * TFT_HEIGHT; i++) differ += tft.getFrameBuffer()[i] != ref[i];
+  Serial.printf("%-10s %10.0f %10.0f %10s %10s %8.2f %8u\n", "wedge_8_1", us[0], us[1], "", "", us[0] / us[1], differ);
+}
+
+// Time a full screen fill, fastest of 5 runs, and return the bus bytes of the last run
+template <typename F> static double fillTime(F fill, uint32_t* bytes, uint32_t* windows)
+{
+  const uint16_t frames = 10;
+  double us = 1e12;
+  bus_stats_t stats;
+
+  tft_host.discardPixels = true;
+  for (uint8_t run = 0; run < 5; run++) {
+    tft.resetBusStats();
+    auto t0 = std::chrono::steady_clock::now();
+    for (uint16_t f = 0; f < frames; f++) fill();
+    auto t1 = std::chrono::steady_clock::now();
+    us = std::min(us, std::chrono::duration<double, std::micro>(t1 - t0).count());
+  }
+  tft_host.discardPixels = false;
+
+  tft.getBusStats(stats);
+  *bytes = (stats.cmdBytes + stats.pixelBytes) / frames;
+  *windows = stats.windows / frames;
+  fill(); // Leave the result on screen
+  return us / frames;
+}
+
+// Compare the TFT_eGradient fills with fillRectVGradient() and fillRectHGradient()
+static void gradients(void)
+{
+  static uint16_t ref[TFT_WIDTH * TFT_HEIGHT];
+  static uint16_t tile[16 * 16];
+  TFT_eGradient grad = TFT_eGradient(&tft);
+
+#ifdef WRITE_COMBINE_PIXELS
+  tft.setAttribute(WRITE_COMBINE, false); // Default setting
+#endif
+
+  Serial.printf("\n%-22s %10s %10s %10s %8s %8s\n", "gradient", "us/fill", "Mpixel/s", "bus_bytes", "windows", "max_err");
+
+  auto report = [&](const char* name, double us, uint32_t bytes, uint32_t windows, int32_t err) {
+    Serial.printf("%-22s %10.1f %10.1f %10u %8u", name, us, TFT_WIDTH * TFT_HEIGHT / us, bytes, windows);
+    if (err >= 0) Serial.printf(" %8d", err);
+    Serial.println();
+    if (outDir) {
+      char filename[256];
+      snprintf(filename, sizeof(filename), "%s/%s.png", outDir, name);
+      tft.saveScreen(filename);
+    }
+  };
+
+  // Largest green (6 bit) difference from the reference image
+  auto maxErr = [&](void) {
+    int32_t err = 0;
+    for (uint32_t i = 0; i < TFT_WIDTH * TFT_HEIGHT; i++) {
+      uint16_t p = tft.getFrameBuffer()[i];
+      err = std::max(err, abs(((p >> 5) & 0x3F) - ((ref[i] >> 5) & 0x3F)));
+    }
+    return err;
+  };
+
+  uint32_t bytes, windows;
+  double us;
+
+  // Vertical and horizontal two colour gradients, TFT_eSPI functions then the line buffer fills
+  for (int8_t vertical = 1; vertical >= 0; vertical--) {
+    const char* dir = vertical ? "v" : "h";
+    char name[24];
+
+    if (vertical) us = fillTime([]{ tft.fillRectVGradient(0, 0, TFT_WIDTH, TFT_HEIGHT, TFT_NAVY, TFT_ORANGE); }, &bytes, &windows);
+    else us = fillTime([]{ tft.fillRectHGradient(0, 0, TFT_WIDTH, TFT_HEIGHT, TFT_NAVY, TFT_ORANGE); }, &bytes, &windows);
+    memcpy(ref, tft.getFrameBuffer(), sizeof(ref));
+    snprintf(name, sizeof(name), "fillRect%sGradient", vertical ? "V" : "H");
+    report(name, us, bytes, windows, -1);
+
+    grad.setColors(TFT_NAVY, TFT_ORANGE);
+    if (vertical) grad.setLinear(0, 0, 0, TFT_HEIGHT - 1);
+    else grad.setLinear(0, 0, TFT_WIDTH - 1, 0);
+
+    for (uint8_t mode = 0; mode < 3; mode++) {
+      grad.setDither(mode == 1);
+      if (mode == 2) tft.initDMA();
+      us = fillTime([&]{ grad.fillRect(0, 0, TFT_WIDTH, TFT_HEIGHT); }, &bytes, &windows);
+      if (mode == 2) tft.deInitDMA();
+      snprintf(name, sizeof(name), "linear_%s%s", dir, mode == 1 ? "_dither" : (mode == 2 ? "_dma" : ""));
+      report(name, us, bytes, windows, maxErr());
+    }
+  }
+
+  // Other gradients with three colours
+  grad.setColors(TFT_NAVY, TFT_ORANGE);
+  grad.addStop(128, TFT_WHITE);
+  grad.setDither(false);
+
+  grad.setLinear(20, 20, 200, 150);
+  grad.setSpread(GRADIENT_REFLECT);
+  us = fillTime([&]{ grad.fillRect(0, 0, TFT_WIDTH, TFT_HEIGHT); }, &bytes, &windows);
+  report("linear_diagonal", us, bytes, windows, -1);
+  grad.setSpread(GRADIENT_PAD);
+
+  grad.setRadial(TFT_WIDTH / 2, TFT_HEIGHT / 2, TFT_WIDTH / 2);
+  us = fillTime([&]{ grad.fillRect(0, 0, TFT_WIDTH, TFT_HEIGHT); }, &bytes, &windows);
+  report("radial", us, bytes, windows, -1);
+
+  grad.setDither(true);
+  us = fillTime([&]{ grad.fillCircle(TFT_WIDTH / 2, TFT_HEIGHT / 2, TFT_WIDTH / 2 - 1); }, &bytes, &windows);
+  report("radial_circle_dither", us, bytes, windows, -1);
+  grad.setDither(false);
+
+  grad.setConic(TFT_WIDTH / 2, TFT_HEIGHT / 2, 0);
+  us = fillTime([&]{ grad.fillRect(0, 0, TFT_WIDTH, TFT_HEIGHT); }, &bytes, &windows);
+  report("conic", us, bytes, windows, -1);
+
+  // Checker board tile
+  for (uint16_t i = 0; i < 16 * 16; i++) tile[i] = ((i & 8) ^ ((i >> 4) & 8)) ? TFT_DARKGREY : TFT_LIGHTGREY;
+  tft.setSwapBytes(true);
+  grad.setPattern(tile, 16, 16);
+  us = fillTime([&]{ grad.fillRect(0, 0, TFT_WIDTH, TFT_HEIGHT); }, &bytes, &windows);
+  report("pattern", us, bytes, windows, -1);
+  tft.setSwapBytes(false);
+}
+
+// Time a bulk colour conversion, fastest of 5 runs in Mpixels per second
+template <typename F> static double kernelRate(uint32_t len, F kernel)
+{
+  const uint16_t loops = 50;
+  double us = 1e12;
+  for (uint8_t run = 0; run < 5; run++) {
+    auto t0 = std::chrono::steady_clock::now();
+    for (uint16_t i = 0; i < loops; i++) { kernel(); asm volatile("" ::: "memory"); } // Stop loop being optimised away
+    auto t1 = std::chrono::steady_clock::now();
+    us = std::min(us, std::chrono::duration<double, std::micro>(t1 - t0).count());
+  }
+  return (double)loops * len / us;
+}
+
+// Compare the bulk colour conversion functions with the equivalent per pixel loops
+static void colorKernels(void)
+{
+  const uint32_t len = TFT_WIDTH * TFT_HEIGHT;
+  static uint16_t fg[len], bg[len], out1[len], out2[len];
+  static uint8_t  rgb[len * 3];
+
+  randomSeed(2);
+  for (uint32_t i = 0; i < len; i++) { fg[i] = random(0x10000); bg[i] = random(0x10000); }
+  for (uint32_t i = 0; i < len * 3; i++) rgb[i] = random(256);
+
+  Serial.printf("\n%-22s %10s %10s %8s %8s\n", "color_kernel", "loop_Mp/s", "bulk_Mp/s", "speedup", "check");
+
+  auto row = [](const char* name, double loop, double bulk) {
+    bool same = memcmp(out1, out2, sizeof(out1)) == 0;
+    Serial.printf("%-22s %10.1f %10.1f %8.2f %8s\n", name, loop, bulk, bulk / loop, same ? "same" : "DIFFER");
+  };
+
+  double loop = kernelRate(len, []() { for (uint32_t i = 0; i < len; i++) out1[i] = fg[i] << 8 | fg[i] >> 8; });
+  double bulk = kernelRate(len, []() { tft.swapBytes16(out2, fg, len); });
+  row("swapBytes16", loop, bulk);
+
+  loop = kernelRate(len, []() { for (uint32_t i = 0; i < len; i++) out1[i] = tft.color8to16(rgb[i]); });
+  bulk = kernelRate(len, []() { tft.color8to16(out2, rgb, len); });
+  row("color8to16", loop, bulk);
+
+  loop = kernelRate(len, []() {
+    for (uint32_t i = 0; i < len; i++) out1[i] = tft.color24to16(rgb[3 * i] << 16 | rgb[3 * i + 1] << 8 | rgb[3 * i + 2]);
+  });
+  bulk = kernelRate(len, []() { tft.color24to16(out2, rgb, len); });
+  row("color24to16", loop, bulk);
+
+  loop = kernelRate(len, []() {
+    for (uint32_t i = 0; i < len; i++) { uint16_t c = tft.color24to16(rgb[3 * i] << 16 | rgb[3 * i + 1] << 8 | rgb[3 * i + 2]); out1[i] = c << 8 | c >> 8; }
+  });
+  bulk = kernelRate(len, []() { tft.color24to16(out2, rgb, len, true); });
+  row("color24to16_swap", loop, bulk);
+
+  loop = kernelRate(len, []() { for (uint32_t i = 0; i < len; i++) out1[i] = tft.alphaBlend(100, fg[i], bg[i]); });
+  bulk = kernelRate(len, []() { tft.alphaBlend(out2, fg, bg, 100, len); });
+  row("alphaBlend", loop, bulk);
+
+  // Unaligned buffers
+  loop = kernelRate(len - 1, []() { for (uint32_t i = 0; i < len - 1; i++) out1[i + 1] = tft.alphaBlend(200, fg[i + 1], bg[i]); });
+  bulk = kernelRate(len - 1, []() { tft.alphaBlend(out2 + 1, fg + 1, bg, 200, len - 1); });
+  row("alphaBlend_unaligned", loop, bulk);
+}
+
+int main(int argc, char* argv[])
+{
+  if (argc > 1) outDir = argv[1];
+
+  tft.init();
+  tft.fillScreen(TFT_BLACK);
+
+#ifdef WRITE_COMBINE_PIXELS
+  tft.setAttribute(WRITE_COMBINE, false);
+  Serial.println("Write combining OFF");
+  runTests();
+  uint64_t offBytes = totalBytes;
+
+  tft.setAttribute(WRITE_COMBINE, true);
+  tft.resetWriteCombineStats();
+  suffix = "_wc";
+  Serial.printf("\nWrite combining ON (%d pixel buffer)\n", WRITE_COMBINE_PIXELS);
+  runTests();
+
+  wc_stats_t wc;
+  tft.getWriteCombineStats(wc);
+  Serial.printf("\nWrite combining: %u calls sent as %u windows (%u pixels)\n", wc.calls, wc.windows, wc.pixels);
+  Serial.printf("Total bus bytes: %llu off, %llu on (%.1f%% saved)\n", (unsigned long long)offBytes,
+                (unsigned long long)totalBytes, offBytes ? 100.0 * (offBytes - (double)totalBytes) / offBytes : 0.0);
+#else
+  runTests();
+#endif
+
+  paletteThroughput();
+  colorKernels();
+  wideLines();
+  gradients();
+
+  return 0;
+}
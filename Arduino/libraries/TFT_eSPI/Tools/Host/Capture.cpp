@@ -0,0 +1,119 @@
+/*
+  Host benchmark for TFT_eScreenCapture streaming of the animated dashboard.
+
+  The capture stream is written to a memory transport (a Print class), decoded again
+  and checked against the screen after every frame. The report gives:
+    host_us  : capture time per frame on the PC (not absolute speed)
+    bytes/f  : stream bytes per frame, key is the first (key) frame
+    read_ms  : time per frame to read the TFT at SPI_READ_FREQUENCY (0 for a Sprite)
+    fps_link : frames per second the stream allows on a 921600 baud serial link
+  The raw line is a screenServer() style capture: 16 bit pixels read with readRect()
+  8 at a time (the client also sends one request byte per 8 pixels).
+
+  Usage: TFT_eSPI_capture [output_directory]
+  The stream is saved as capture.bin in the output directory, decode it to PNG images
+  with TFT_eSPI_capture_decode.
+*/
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include <chrono>
+#include <vector>
+
+#include "Dashboard_scene.h"
+#include "Capture_decoder.h"
+
+#define FRAMES    60
+#define LINK_BAUD 921600 // 10 bits per byte with start and stop bits
+
+TFT_eSPI tft = TFT_eSPI();
+TFT_eSprite spr = TFT_eSprite(&tft);
+
+// Simulated byte transport, keeps everything written
+class MemoryTransport : public Print {
+ public:
+  size_t write(uint8_t c) override { data.push_back(c); return 1; }
+  size_t write(const uint8_t *buffer, size_t size) override { data.insert(data.end(), buffer, buffer + size); return size; }
+  std::vector<uint8_t> data;
+};
+
+static void report(const char* name, double us, uint32_t keyBytes, double bytes, double readBytes)
+{
+  double readMs = readBytes * 8000.0 / SPI_READ_FREQUENCY;
+  Serial.printf("%-10s %10.1f %10u %10.0f %8.2f %8.2f\n", name, us, keyBytes, bytes, readMs, LINK_BAUD / 10.0 / bytes);
+}
+
+int main(int argc, char* argv[])
+{
+  const char* outDir = argc > 1 ? argv[1] : nullptr;
+
+  tft.init();
+  spr.createSprite(TFT_WIDTH, TFT_HEIGHT);
+
+  Serial.printf("%d frames, %dx%d, %d baud link\n", FRAMES, TFT_WIDTH, TFT_HEIGHT, LINK_BAUD);
+  Serial.printf("%-10s %10s %10s %10s %8s %8s\n", "source", "host_us", "key", "bytes/f", "read_ms", "fps_link");
+
+  // Raw capture: 2 bytes per pixel
+  tft.resetBusStats();
+  static uint16_t line[TFT_WIDTH];
+  for (int32_t y = 0; y < TFT_HEIGHT; y++)
+    for (int32_t x = 0; x < TFT_WIDTH; x += 8) tft.readRect(x, y, 8, 1, line);
+  bus_stats_t stats;
+  tft.getBusStats(stats);
+  double raw = TFT_WIDTH * TFT_HEIGHT * 2;
+  report("raw", 0, raw, raw, stats.readBytes + stats.cmdBytes);
+
+  // Block capture from the TFT, then from a Sprite, with block sizes 16x8 and 32x16
+  for (uint8_t source = 0; source < 2; source++) {
+    for (uint8_t size = 0; size < 2; size++) {
+      TFT_eScreenCapture* cap = source ? new TFT_eScreenCapture(&spr) : new TFT_eScreenCapture(&tft);
+      if (!cap->begin(16 << size, 8 << size)) { Serial.println("Capture begin failed"); return 1; }
+
+      MemoryTransport link;
+      CaptureDecoder dec;
+      uint32_t keyBytes = 0, errors = 0;
+      uint64_t readBytes = 0;
+      double us = 0;
+
+      for (int32_t f = 0; f < FRAMES; f++) {
+        if (source) scene(spr, f * 100 / (FRAMES - 1));
+        else scene(tft, f * 100 / (FRAMES - 1));
+
+        size_t start = link.data.size();
+        tft.resetBusStats();
+        auto t0 = std::chrono::steady_clock::now();
+        uint32_t bytes = cap->capture(link);
+        auto t1 = std::chrono::steady_clock::now();
+        us += std::chrono::duration<double, std::micro>(t1 - t0).count();
+        tft.getBusStats(stats);
+        readBytes += stats.readBytes + stats.cmdBytes;
+        if (f == 0) keyBytes = bytes;
+
+        // Decode and check against the screen or Sprite
+        int32_t used = dec.decode(link.data.data() + start, link.data.size() - start);
+        const uint16_t* image = source ? (uint16_t*)spr.getPointer() : tft.getFrameBuffer();
+        bool same = used == (int32_t)bytes && dec.checksumOk;
+        for (uint32_t i = 0; same && i < TFT_WIDTH * TFT_HEIGHT; i++) {
+          same = dec.frame[i] == (source ? (uint16_t)(image[i] >> 8 | image[i] << 8) : image[i]);
+        }
+        errors += !same;
+      }
+
+      char name[16];
+      snprintf(name, sizeof(name), "%s_%dx%d", source ? "sprite" : "tft", 16 << size, 8 << size);
+      double deltaBytes = (double)(link.data.size() - keyBytes) / (FRAMES - 1);
+      report(name, us / FRAMES, keyBytes, deltaBytes, (double)readBytes / FRAMES);
+      if (errors) Serial.printf("           %u frames decoded incorrectly!\n", errors);
+      delete cap;
+
+      if (outDir && source == 0 && size == 0) {
+        char filename[256];
+        snprintf(filename, sizeof(filename), "%s/capture.bin", outDir);
+        FILE* f = fopen(filename, "wb");
+        if (f) { fwrite(link.data.data(), 1, link.data.size(), f); fclose(f); }
+      }
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,56 @@
+/*
+  Decode a TFT_eScreenCapture stream saved to a file and write each frame as a PNG.
+
+  Usage: TFT_eSPI_capture_decode capture_file output_directory
+*/
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include <vector>
+
+#include "Capture_decoder.h"
+
+int main(int argc, char* argv[])
+{
+  if (argc < 3) {
+    Serial.printf("Usage: %s capture_file output_directory\n", argv[0]);
+    return 1;
+  }
+
+  FILE* f = fopen(argv[1], "rb");
+  if (f == nullptr) {
+    Serial.printf("Cannot open %s\n", argv[1]);
+    return 1;
+  }
+  std::vector<uint8_t> data;
+  uint8_t buf[4096];
+  size_t n;
+  while ((n = fread(buf, 1, sizeof(buf), f)) > 0) data.insert(data.end(), buf, buf + n);
+  fclose(f);
+
+  CaptureDecoder dec;
+  size_t   pos = 0;
+  uint32_t frames = 0, errors = 0;
+
+  while (pos < data.size()) {
+    int32_t used = dec.decode(data.data() + pos, data.size() - pos);
+    if (used <= 0) {
+      Serial.printf("%s at byte %u\n", used ? "Invalid data" : "Incomplete frame", (uint32_t)pos);
+      return 1;
+    }
+
+    char filename[256];
+    snprintf(filename, sizeof(filename), "%s/frame_%05u.png", argv[2], dec.number);
+    TFT_eSPI_HostPanel::savePNG(filename, dec.frame, dec.width, dec.height);
+
+    Serial.printf("frame %5u %s %4u rects %7d bytes %s\n", dec.number, dec.keyFrame ? "key  " : "delta",
+                  dec.rects, used, dec.checksumOk ? "ok" : "CHECKSUM ERROR");
+    errors += !dec.checksumOk;
+    frames++;
+    pos += used;
+  }
+
+  Serial.printf("%u frames, %u checksum errors\n", frames, errors);
+
+  return errors ? 1 : 0;
+}
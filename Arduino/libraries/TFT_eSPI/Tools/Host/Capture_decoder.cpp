@@ -0,0 +1,106 @@
+/*
+  Decoder for the TFT_eScreenCapture stream, see Capture_decoder.h
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include "Capture_decoder.h"
+
+#define FNV_BASIS 2166136261UL
+#define FNV_PRIME 16777619UL
+
+static uint16_t get16(const uint8_t* p) { return p[0] | p[1] << 8; }
+static uint32_t get32(const uint8_t* p) { return get16(p) | (uint32_t)get16(p + 2) << 16; }
+
+CaptureDecoder::CaptureDecoder(void)
+{
+  frame = nullptr;
+  width = 0;
+  height = 0;
+  number = 0;
+  keyFrame = false;
+  checksumOk = false;
+  rects = 0;
+}
+
+CaptureDecoder::~CaptureDecoder(void)
+{
+  free(frame);
+}
+
+// Hash the frame blocks in the same way as the encoder
+uint32_t CaptureDecoder::checksum(uint8_t blockW, uint8_t blockH)
+{
+  uint32_t sum = FNV_BASIS;
+
+  for (int32_t by = 0; by < height; by += blockH) {
+    for (int32_t bx = 0; bx < width; bx += blockW) {
+      uint32_t hash = FNV_BASIS;
+      for (int32_t y = by; y < by + blockH && y < height; y++) {
+        for (int32_t x = bx; x < bx + blockW && x < width; x++) {
+          uint16_t c = frame[x + y * width];
+          hash = (hash ^ (uint16_t)(c >> 8 | c << 8)) * FNV_PRIME; // Word as held in MCU memory
+        }
+      }
+      sum = (sum ^ hash) * FNV_PRIME;
+    }
+  }
+
+  return sum;
+}
+
+int32_t CaptureDecoder::decode(const uint8_t* data, size_t len)
+{
+  const uint8_t* p   = data;
+  const uint8_t* end = data + len;
+
+  if (len < 13) return 0;
+  if (p[0] != 'T' || p[1] != 'F' || p[3] == 0 || p[4] == 0) return -1;
+
+  keyFrame = p[2] & 0x01;
+  uint8_t  blockW = p[3], blockH = p[4];
+  int32_t  w = get16(p + 5), h = get16(p + 7);
+  number = get32(p + 9);
+  p += 13;
+
+  // A new frame buffer is needed for a new screen size, this must be a key frame
+  if (w != width || h != height) {
+    if (!keyFrame) return -1;
+    free(frame);
+    frame = (uint16_t*)calloc(w * h, sizeof(uint16_t));
+    if (frame == nullptr) return -1;
+    width = w;
+    height = h;
+  }
+
+  rects = 0;
+  for (;;) {
+    if (end - p < 8) return 0;
+    int32_t x = get16(p), y = get16(p + 2), rw = get16(p + 4), rh = get16(p + 6);
+    p += 8;
+    if (rw == 0) break;
+    if (x + rw > width || y + rh > height) return -1;
+    rects++;
+
+    // Run length encoded pixels, in rows
+    int32_t pixels = rw * rh, i = 0;
+    while (i < pixels) {
+      if (p >= end) return 0;
+      uint8_t n = *p++;
+      int32_t count = (n < 128) ? n + 1 : n - 126;
+      if (i + count > pixels) return -1;
+      if (end - p < (n < 128 ? 2 * count : 2)) return 0;
+      for (int32_t k = 0; k < count; k++, i++) {
+        frame[x + i % rw + (y + i / rw) * width] = p[0] << 8 | p[1]; // High byte first
+        if (n < 128) p += 2;
+      }
+      if (n >= 128) p += 2;
+    }
+  }
+
+  if (end - p < 4) return 0;
+  checksumOk = get32(p) == checksum(blockW, blockH);
+  p += 4;
+
+  return p - data;
+}
@@ -0,0 +1,35 @@
+/*
+  Decoder for the TFT_eScreenCapture stream, see Extensions/Screen_capture.h for the
+  format. Each frame is decoded into an RGB565 (host byte order) frame buffer.
+*/
+
+#ifndef _CAPTURE_DECODER_H_
+#define _CAPTURE_DECODER_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+class CaptureDecoder {
+
+ public:
+
+  CaptureDecoder(void);
+  ~CaptureDecoder(void);
+
+           // Decode the frame at the start of data. Returns the number of bytes used, 0 if
+           // the frame is incomplete or -1 if the data is not valid.
+  int32_t  decode(const uint8_t* data, size_t len);
+
+  uint16_t* frame;       // Last decoded frame
+  int32_t  width, height;
+  uint32_t number;       // Frame number
+  bool     keyFrame;
+  bool     checksumOk;   // Decoded frame matches the capture checksum
+  uint32_t rects;        // Rectangles in the last frame
+
+ private:
+
+  uint32_t checksum(uint8_t blockW, uint8_t blockH);
+};
+
+#endif // _CAPTURE_DECODER_H_
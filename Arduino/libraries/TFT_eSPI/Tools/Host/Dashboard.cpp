@@ -0,0 +1,81 @@
+/*
+  Host benchmark comparing immediate mode drawing with the TFT_eDisplayList retained
+  mode renderer for an animated dashboard (gauge, needle, value, bar meter, buttons).
+
+  immediate : the whole scene is redrawn on the TFT each frame (fillScreen first)
+  retained  : the scene is recorded in a display list and render() pushes changed tiles
+
+  Usage: TFT_eSPI_dashboard [output_directory]
+*/
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include <chrono>
+
+#include "Dashboard_scene.h"
+
+#define FRAMES 60
+
+TFT_eSPI tft = TFT_eSPI();
+TFT_eDisplayList dl = TFT_eDisplayList(&tft);
+
+static void report(const char* name, double us, uint32_t tiles)
+{
+  bus_stats_t stats;
+  tft.getBusStats(stats);
+  uint32_t bytes = stats.cmdBytes + stats.pixelBytes;
+  Serial.printf("%-10s %10.0f %10.1f %12u %10u %10u %8u %8.2f\n", name, us, us / FRAMES, bytes, stats.cmdBytes,
+                stats.pixelBytes, tiles, bytes * 8000.0 / SPI_FREQUENCY / FRAMES);
+}
+
+int main(int argc, char* argv[])
+{
+  const char* outDir = argc > 1 ? argv[1] : nullptr;
+  char filename[256];
+
+  tft.init();
+
+  Serial.printf("%d frames, %d commands max\n", FRAMES, 64);
+  Serial.printf("%-10s %10s %10s %12s %10s %10s %8s %8s\n", "mode", "host_us", "us/frame", "bus_bytes",
+                "overhead", "pixels", "tiles", "spi_ms/f");
+
+  // Immediate mode
+  tft.resetBusStats();
+  auto t0 = std::chrono::steady_clock::now();
+  for (int32_t f = 0; f < FRAMES; f++) scene(tft, f * 100 / (FRAMES - 1));
+  auto t1 = std::chrono::steady_clock::now();
+  report("immediate", std::chrono::duration<double, std::micro>(t1 - t0).count(), 0);
+
+  static uint16_t immediate[TFT_WIDTH * TFT_HEIGHT];
+  memcpy(immediate, tft.getFrameBuffer(), sizeof(immediate));
+  if (outDir) { snprintf(filename, sizeof(filename), "%s/dashboard_immediate.png", outDir); tft.saveScreen(filename); }
+
+  // Retained mode, tile buffers in DMA mode
+  for (uint8_t dma = 0; dma < 2; dma++) {
+    if (dma) tft.initDMA();
+    if (!dl.begin(64, 256, 16)) { Serial.println("Display list begin failed"); return 1; }
+
+    tft.fillScreen(TFT_BLUE); // Check the first render covers the whole screen
+    tft.resetBusStats();
+    uint32_t tiles = 0;
+    t0 = std::chrono::steady_clock::now();
+    for (int32_t f = 0; f < FRAMES; f++) {
+      scene(dl, f * 100 / (FRAMES - 1));
+      tiles += dl.render();
+    }
+    t1 = std::chrono::steady_clock::now();
+    report(dma ? "retain_dma" : "retained", std::chrono::duration<double, std::micro>(t1 - t0).count(), tiles);
+    if (dl.overflow()) Serial.println("Display list overflow!");
+
+    uint32_t diff = 0;
+    for (uint32_t i = 0; i < TFT_WIDTH * TFT_HEIGHT; i++) diff += tft.getFrameBuffer()[i] != immediate[i];
+    Serial.printf("           %u pixels differ from immediate mode\n", diff);
+
+    dl.end();
+    if (dma) tft.deInitDMA();
+  }
+
+  if (outDir) { snprintf(filename, sizeof(filename), "%s/dashboard_retained.png", outDir); tft.saveScreen(filename); }
+
+  return 0;
+}
@@ -0,0 +1,51 @@
+/*
+  Animated dashboard scene (gauge, needle, value, bar meter, buttons) shared by the
+  host benchmarks. It can be drawn on a TFT_eSPI, TFT_eSprite or TFT_eDisplayList.
+*/
+
+#ifndef _DASHBOARD_SCENE_H_
+#define _DASHBOARD_SCENE_H_
+
+// Draw the dashboard for a value 0-100 on a TFT_eSPI or TFT_eDisplayList
+template <typename T> static void scene(T& g, int32_t value)
+{
+  g.fillScreen(TFT_BLACK);
+
+  // Gauge ring and value arc
+  g.drawSmoothArc(120, 120, 116, 104, 30, 330, TFT_DARKGREY, TFT_BLACK, false);
+  g.drawSmoothArc(120, 120, 116, 104, 30, 30 + value * 3, TFT_GREEN, TFT_BLACK, true);
+
+  // Tick marks, positions are rounded so both renderers use identical coordinates
+  for (int32_t i = 0; i <= 10; i++) {
+    float a = (30 + i * 30) * DEG_TO_RAD;
+    float s = sinf(a), c = cosf(a);
+    g.drawWideLine(roundf(120 - 100 * s), roundf(120 + 100 * c), roundf(120 - 88 * s), roundf(120 + 88 * c), 3, TFT_WHITE, TFT_BLACK);
+  }
+
+  // Needle and hub
+  float a = (30 + value * 3) * DEG_TO_RAD;
+  g.drawWedgeLine(120, 120, roundf(120 - 80 * sinf(a)), roundf(120 + 80 * cosf(a)), 8, 2, TFT_RED, TFT_BLACK);
+  g.fillSmoothCircle(120, 120, 10, TFT_SILVER, TFT_BLACK);
+
+  // Value and units
+  char txt[8];
+  snprintf(txt, sizeof(txt), "%d", (int)value);
+  g.setTextDatum(MC_DATUM);
+  g.setTextColor(TFT_GREEN, TFT_BLACK);
+  g.drawString(txt, 120, 168, 4);
+  g.setTextColor(TFT_LIGHTGREY);
+  g.drawString("km/h", 120, 190, 2);
+
+  // Bar meter
+  g.drawRect(60, 60, 120, 10, TFT_WHITE);
+  g.fillRect(61, 61, value * 118 / 100, 8, TFT_ORANGE);
+
+  // Buttons
+  g.fillRoundRect(50, 205, 60, 22, 6, TFT_NAVY);
+  g.fillRoundRect(130, 205, 60, 22, 6, value > 50 ? TFT_MAROON : TFT_NAVY);
+  g.setTextColor(TFT_WHITE);
+  g.drawString("MODE", 80, 216, 2);
+  g.drawString("ALARM", 160, 216, 2);
+}
+
+#endif // _DASHBOARD_SCENE_H_
@@ -0,0 +1,160 @@
+/*
+  Host test for TFT_eFrameScheduler. The emulated panel is set up with a timed DMA engine
+  (40MHz bus) and a 60Hz scan out model with a TE output, which counts transfers that the
+  scan crosses (tears). An animation of a bouncing ball (64x64), a scrolling chart band
+  (240x40) and a gauge (120x120) is rendered into Sprites each frame and sent:
+    free      : as fast as possible, pushImageDMA() in render order and endWrite()
+    no_te     : TFT_eFrameScheduler at 30 fps without a TE pin, not aligned to the refresh
+    paced+te  : TFT_eFrameScheduler at 30 fps with the TE pin
+    te/60fps  : the same at 60 fps
+    full/60   : a full screen frame at 60 fps with TE, more than the bus can carry, so
+                slots are skipped (throttled)
+
+  The report gives frames per second, the percentage of DMA transfers that tore, the
+  mean render, transfer and idle time per frame and the scheduler counts. Times are
+  real time on the host, the DMA and scan run against micros().
+
+  Usage: TFT_eSPI_frame_scheduler [output_directory]
+*/
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+
+#define RUN_MS   1500     // Time for each test
+#define TE_PIN   40       // Emulated TE pin
+
+TFT_eSPI tft = TFT_eSPI();
+TFT_eSprite ball  = TFT_eSprite(&tft);
+TFT_eSprite chart = TFT_eSprite(&tft);
+TFT_eSprite gauge = TFT_eSprite(&tft);
+TFT_eSprite full  = TFT_eSprite(&tft);
+
+struct Region { int32_t x, y; TFT_eSprite* spr; };
+
+// Render frame n, returns the number of regions
+static uint8_t render(uint32_t n, bool fullScreen, Region* r)
+{
+  if (fullScreen) {
+    full.fillSprite(TFT_BLACK);
+    for (int32_t i = 0; i < 8; i++) {
+      full.fillCircle(120 + 90 * cosf(n * 0.05f + i), 120 + 90 * sinf(n * 0.07f + i), 20, TFT_RED + i * 0x0821);
+    }
+    r[0] = { 0, 0, &full };
+    return 1;
+  }
+
+  // Gauge, drawn first as a sketch might
+  gauge.fillSprite(TFT_NAVY);
+  float a = n * 0.08f;
+  gauge.drawWideLine(60, 60, 60 + 50 * cosf(a), 60 + 50 * sinf(a), 5, TFT_YELLOW, TFT_NAVY);
+  r[0] = { 120, 120, &gauge };
+
+  // Ball bouncing over the top half
+  int32_t bx = (n * 7) % 352, by = (n * 5) % 208;
+  if (bx > 176) bx = 352 - bx;
+  if (by > 104) by = 208 - by;
+  ball.fillSprite(TFT_BLACK);
+  ball.fillCircle(32, 32, 30, TFT_GREEN);
+  r[1] = { bx, by, &ball };
+
+  // Chart band scrolling left
+  chart.scroll(-4, 0);
+  chart.fillRect(236, 0, 4, 40, TFT_BLACK);
+  int32_t v = 20 + 18 * sinf(n * 0.3f);
+  chart.fillRect(236, 40 - v, 4, v, TFT_CYAN);
+  r[2] = { 0, 100, &chart };
+  return 3;
+}
+
+struct Result { uint32_t frames, transfers, tears; double seconds; frame_stats_t stats; };
+
+static Result run(uint8_t mode)
+{
+  Result res;
+  Region r[3];
+  TFT_eFrameScheduler frames = TFT_eFrameScheduler(&tft);
+  bool fullScreen = mode == 4;
+
+  if (mode) {
+    uint16_t fps = mode >= 3 ? 60 : 30;
+    frames.setBusRate(tft_host.dmaBitRate);
+    frames.begin(fps, mode >= 2 ? TE_PIN : -1);
+  }
+
+  tft.resetBusStats();
+  uint32_t n = 0, t0 = micros();
+  while (micros() - t0 < RUN_MS * 1000) {
+    if (mode == 0) {
+      uint8_t count = render(n++, fullScreen, r);
+      tft.startWrite();
+      for (uint8_t i = 0; i < count; i++)
+        tft.pushImageDMA(r[i].x, r[i].y, r[i].spr->width(), r[i].spr->height(), (uint16_t*)r[i].spr->getPointer());
+      tft.endWrite();
+    }
+    else {
+      frames.beginFrame();
+      uint8_t count = render(n++, fullScreen, r);
+      for (uint8_t i = 0; i < count; i++)
+        frames.push(r[i].x, r[i].y, r[i].spr->width(), r[i].spr->height(), (uint16_t*)r[i].spr->getPointer());
+      frames.endFrame();
+    }
+  }
+  if (mode) frames.flush();
+  else tft.dmaWait();
+  res.seconds = (micros() - t0) / 1e6;
+
+  bus_stats_t bus;
+  tft.getBusStats(bus);
+  res.frames = n;
+  res.transfers = bus.dmaTransfers;
+  res.tears = bus.dmaTears;
+  frames.getStats(res.stats);
+  return res;
+}
+
+int main(int argc, char* argv[])
+{
+  const char* outDir = argc > 1 ? argv[1] : nullptr;
+
+  tft.init();
+  tft.fillScreen(TFT_BLACK);
+  tft.initDMA();
+  ball.createSprite(64, 64);
+  chart.createSprite(240, 40);
+  chart.fillSprite(TFT_BLACK);
+  gauge.createSprite(120, 120);
+  full.createSprite(TFT_WIDTH, TFT_HEIGHT);
+
+  tft_host.dmaBitRate = 40000000;
+  tft_host.scanPeriod = 16667;
+  tft_host.tePin = TE_PIN;
+
+  Serial.printf("%dx%d panel, %u Hz DMA bus, %u us refresh, %d ms per test\n", TFT_WIDTH, TFT_HEIGHT,
+                tft_host.dmaBitRate, tft_host.scanPeriod, RUN_MS);
+  Serial.printf("%-10s %7s %7s %9s %9s %8s %9s %5s %7s %7s\n", "mode", "fps", "tears%", "render_ms",
+                "xfer_ms", "idle_ms", "throttled", "late", "delayed", "unsafe");
+
+  const char* names[] = { "free", "no_te", "paced+te", "te/60fps", "full/60" };
+  for (uint8_t mode = 0; mode < 5; mode++) {
+    Result r = run(mode);
+    double fps = r.frames / r.seconds;
+    double tears = r.transfers ? 100.0 * r.tears / r.transfers : 0;
+    if (mode == 0) {
+      Serial.printf("%-10s %7.1f %7.1f %9s %9s %8s %9s %5s %7s %7s\n", names[mode], fps, tears, "-", "-", "-", "-", "-", "-", "-");
+      continue;
+    }
+    const frame_stats_t& s = r.stats;
+    double f = s.frames ? s.frames : 1;
+    Serial.printf("%-10s %7.1f %7.1f %9.2f %9.2f %8.2f %9u %5u %7u %7u\n", names[mode], fps, tears,
+                  s.renderTotal / f / 1000, s.transferTotal / f / 1000, s.idleTotal / f / 1000,
+                  s.throttled, s.late, s.delayed, s.unsafe);
+  }
+
+  if (outDir) {
+    char filename[256];
+    snprintf(filename, sizeof(filename), "%s/frame_scheduler.png", outDir);
+    tft.saveScreen(filename);
+  }
+
+  return 0;
+}
@@ -0,0 +1,134 @@
+/*
+  Host benchmark for TFT_eJpeg, a slideshow of the JPEG images in the examples.
+
+  Each image is drawn centred on the screen at full size and reduced by 2, 4 and 8.
+  The report gives:
+    mcus    : MCUs decoded, decoding stops after the last visible MCU row
+    windows : address windows sent, a decoder that pushes each MCU needs one per MCU
+    host_us : decode and draw time on the PC (not absolute speed)
+    spi_ms  : bus bytes converted to time at SPI_FREQUENCY
+    fps     : slideshow rate if decoding overlaps DMA, so the bus is the limit
+  Then the time per image without and with DMA, with the bus time modelled at
+  SPI_FREQUENCY.
+
+  Usage: TFT_eSPI_jpeg [output_directory]
+  A PNG of the screen after each full size image is saved in the output directory.
+*/
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include <chrono>
+
+// The example arrays are included here, two sets use the same name
+#include "../../examples/480 x 320/TFT_flash_jpg/jpeg1.h"
+#include "../../examples/480 x 320/TFT_flash_jpg/jpeg2.h"
+#include "../../examples/480 x 320/TFT_flash_jpg/jpeg3.h"
+namespace small {
+#include "../../examples/160 x 128/TFT_flash_jpg/jpeg1.h"
+#include "../../examples/160 x 128/TFT_flash_jpg/jpeg2.h"
+#include "../../examples/160 x 128/TFT_flash_jpg/jpeg3.h"
+}
+#include "../../examples/DMA test/Flash_Jpg_DMA/panda.h"
+#include "../../examples/Sprite/Animated_dial/dial.h"
+
+#define REPEATS 20
+
+struct Image {
+  const char*    name;
+  const uint8_t* data;
+  uint32_t       len;
+};
+
+static const Image images[] = {
+  { "Baboon40",  Baboon40,        sizeof(Baboon40) },
+  { "Mouse480",  Mouse480,        sizeof(Mouse480) },
+  { "lena20k",   lena20k,         sizeof(lena20k) },
+  { "panda",     panda,           sizeof(panda) },
+  { "dial",      dial,            sizeof(dial) },
+  { "EagleEye",  small::EagleEye, sizeof(small::EagleEye) },
+  { "Tiger",     small::Tiger,    sizeof(small::Tiger) },
+  { "Baboon",    small::Baboon,   sizeof(small::Baboon) },
+};
+
+TFT_eSPI  tft = TFT_eSPI();
+TFT_eJpeg jpeg = TFT_eJpeg(&tft);
+
+// Draw an image centred on the screen, returns the time per image in microseconds
+static double draw(const Image& img, uint8_t scale)
+{
+  uint16_t w, h;
+  jpeg.getSize(img.data, img.len, &w, &h);
+  w = (w + scale - 1) / scale;
+  h = (h + scale - 1) / scale;
+  int32_t x = (tft.width() - w) / 2;
+  int32_t y = (tft.height() - h) / 2;
+
+  auto t0 = std::chrono::steady_clock::now();
+  for (int32_t i = 0; i < REPEATS; i++) {
+    int8_t result = jpeg.drawJpg(x, y, img.data, img.len, scale);
+    if (result != JPEG_OK) Serial.printf("%s: error %d\n", img.name, result);
+  }
+  auto t1 = std::chrono::steady_clock::now();
+
+  return std::chrono::duration<double, std::micro>(t1 - t0).count() / REPEATS;
+}
+
+int main(int argc, char* argv[])
+{
+  const char* outDir = argc > 1 ? argv[1] : nullptr;
+
+  tft.init();
+  tft.fillScreen(TFT_BLACK);
+
+  Serial.printf("%dx%d screen, %d repeats\n", TFT_WIDTH, TFT_HEIGHT, REPEATS);
+  Serial.printf("%-10s %9s %5s %6s %7s %9s %8s %8s\n", "image", "size", "scale", "mcus", "windows", "host_us", "spi_ms", "fps");
+
+  for (const Image& img : images) {
+    uint16_t w, h;
+    jpeg.getSize(img.data, img.len, &w, &h);
+    char size[16];
+    snprintf(size, sizeof(size), "%dx%d", w, h);
+
+    for (uint8_t scale = 1; scale <= 8; scale <<= 1) {
+      tft.fillScreen(TFT_BLACK);
+      tft.resetBusStats();
+      double us = draw(img, scale);
+      bus_stats_t stats;
+      tft.getBusStats(stats);
+
+      double spiMs = (stats.cmdBytes + stats.pixelBytes) * 8000.0 / SPI_FREQUENCY / REPEATS;
+      Serial.printf("%-10s %9s %5d %6u %7u %9.1f %8.2f %8.1f\n", img.name, size, scale, jpeg.mcus(), jpeg.strips(), us, spiMs, 1000.0 / spiMs);
+
+      if (outDir && scale == 1) {
+        char filename[256];
+        snprintf(filename, sizeof(filename), "%s/jpeg_%s.png", outDir, img.name);
+        tft.saveScreen(filename);
+      }
+    }
+  }
+
+  // Slideshow time without and with DMA, pixels are counted but not stored. The bus is
+  // modelled at SPI_FREQUENCY: without DMA the bus time is added to the decode time as
+  // the CPU sends the pixels, with DMA dmaWait() waits for the transfer time to pass.
+  tft_host.discardPixels = true;
+  const uint32_t count = sizeof(images) / sizeof(images[0]);
+  for (uint8_t dma = 0; dma < 2; dma++) {
+    if (dma) {
+      tft.initDMA();
+      tft_host.dmaBitRate = SPI_FREQUENCY;
+    }
+    double us = 0, busUs = 0;
+    for (const Image& img : images) {
+      tft.resetBusStats();
+      us += draw(img, 1);
+      bus_stats_t stats;
+      tft.getBusStats(stats);
+      if (!dma) busUs += (stats.cmdBytes + stats.pixelBytes) * 8000000.0 / SPI_FREQUENCY / REPEATS;
+    }
+    Serial.printf("Slideshow %s DMA: %.1f us per image\n", dma ? "with" : "without", (us + busUs) / count);
+  }
+  tft_host.dmaBitRate = 0;
+  tft_host.discardPixels = false;
+
+  return 0;
+}
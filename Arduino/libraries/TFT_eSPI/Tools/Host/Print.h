@@ -0,0 +1,46 @@
+        ////////////////////////////////////////////////////
+        //   Minimal Arduino Print class for host builds  //
+        ////////////////////////////////////////////////////
+
+#ifndef _HOST_PRINT_H_
+#define _HOST_PRINT_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include "WString.h"
+
+#ifndef DEC
+  #define DEC 10
+#endif
+
+class Print {
+ public:
+  virtual ~Print() {}
+
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t *buffer, size_t size);
+  size_t write(const char *str) { return str ? write((const uint8_t *)str, strlen(str)) : 0; }
+
+  size_t print(const char str[])  { return write(str); }
+  size_t print(const String &s)   { return write(s.c_str()); }
+  size_t print(char c)            { return write((uint8_t)c); }
+  size_t print(unsigned char n, int base = DEC)  { return printNumber(n, base); }
+  size_t print(int n, int base = DEC)            { return printSigned(n, base); }
+  size_t print(unsigned int n, int base = DEC)   { return printNumber(n, base); }
+  size_t print(long n, int base = DEC)           { return printSigned(n, base); }
+  size_t print(unsigned long n, int base = DEC)  { return printNumber(n, base); }
+  size_t print(double n, int digits = 2);
+
+  size_t println(void) { return write((const uint8_t *)"\r\n", 2); }
+  template <typename T> size_t println(T v) { size_t n = print(v); return n + println(); }
+  template <typename T> size_t println(T v, int fmt) { size_t n = print(v, fmt); return n + println(); }
+
+  size_t printf(const char *format, ...) __attribute__((format(printf, 2, 3)));
+
+ private:
+  size_t printNumber(unsigned long n, int base);
+  size_t printSigned(long n, int base);
+};
+
+#endif // _HOST_PRINT_H_
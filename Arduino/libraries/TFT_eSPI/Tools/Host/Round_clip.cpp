@@ -0,0 +1,158 @@
+/*
+  Host benchmark for the round clip area of a round 240 x 240 display (GC9A01), each
+  frame is drawn with and without setRoundClip(). The frames are:
+    dash        : the animated dashboard
+    image       : a full screen 16 bit image drawn with pushImage()
+  drawn:
+    tft         : straight to the TFT
+    sprite      : in a full screen Sprite, then pushSprite()
+  with the round clip set on:
+    none        : no round clip
+    sprite      : the Sprite only, fewer pixels are drawn
+    tft         : the TFT only, fewer pixels are sent
+    both        : the Sprite and the TFT
+
+  The report gives bus bytes, window commands and pixels per frame, draw_us and push_us,
+  the host times to draw the frame and push the Sprite (not absolute speed). Pixels inside
+  the round area are checked against drawing without a clip, pixels outside it must not
+  be changed.
+
+  Usage: TFT_eSPI_round_clip [output_directory]
+*/
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include <chrono>
+
+#include "Dashboard_scene.h"
+
+#define FRAMES  60
+#define REPEATS 10          // Frames are drawn REPEATS times for the times
+#define OUTSIDE TFT_MAGENTA // Screen colour outside the round area
+
+TFT_eSPI tft = TFT_eSPI();
+TFT_eSprite spr = TFT_eSprite(&tft);
+
+static uint16_t reference[FRAMES][TFT_WIDTH * TFT_HEIGHT]; // Dashboard frames drawn without a clip
+static uint16_t image[TFT_WIDTH * TFT_HEIGHT];             // Full screen image
+static int32_t  spanXs[TFT_HEIGHT], spanXe[TFT_HEIGHT];    // Round area row spans
+
+// Draw frame f of the dashboard or the image
+template <typename T> static void frame(T& g, bool dash, int32_t f)
+{
+  if (dash) scene(g, f * 100 / (FRAMES - 1));
+  else {
+    g.setSwapBytes(true);
+    g.pushImage(0, 0, TFT_WIDTH, TFT_HEIGHT, image);
+    g.setSwapBytes(false);
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  const char* outDir = argc > 1 ? argv[1] : nullptr;
+
+  tft.init();
+  if (!spr.createSprite(TFT_WIDTH, TFT_HEIGHT)) { Serial.println("createSprite failed"); return 1; }
+
+  // Colour wheel image and reference frames
+  for (int32_t y = 0; y < TFT_HEIGHT; y++) {
+    for (int32_t x = 0; x < TFT_WIDTH; x++) {
+      float a = atan2f(y - TFT_HEIGHT / 2, x - TFT_WIDTH / 2);
+      uint8_t r = 127 + 127 * cosf(a), g = 127 + 127 * cosf(a - 2.094f), b = 127 + 127 * cosf(a + 2.094f);
+      image[x + y * TFT_WIDTH] = tft.color565(r, g, b);
+    }
+  }
+  for (int32_t f = 0; f < FRAMES; f++) {
+    scene(tft, f * 100 / (FRAMES - 1));
+    memcpy(reference[f], tft.getFrameBuffer(), sizeof(reference[f]));
+  }
+
+  // Visible pixels of the round area
+  tft.setRoundClip();
+  uint32_t visible = 0;
+  for (int32_t y = 0; y < TFT_HEIGHT; y++) {
+    if (tft.getRoundSpan(y, &spanXs[y], &spanXe[y])) visible += spanXe[y] - spanXs[y] + 1;
+  }
+  tft.resetRoundClip();
+
+  Serial.printf("%d frames, %dx%d, round area %u pixels (%.1f%%)\n", FRAMES, TFT_WIDTH, TFT_HEIGHT,
+                visible, 100.0 * visible / (TFT_WIDTH * TFT_HEIGHT));
+  Serial.printf("%-20s %10s %8s %9s %8s %8s %8s\n", "test", "bytes/f", "windows", "pixels/f", "spi_ms/f", "draw_us", "push_us");
+
+  struct Test { const char* name; bool dash, sprite, sprClip, tftClip; };
+  const Test tests[] = {
+    { "dash/tft/none",       true,  false, false, false },
+    { "dash/tft/tft",        true,  false, false, true  },
+    { "dash/sprite/none",    true,  true,  false, false },
+    { "dash/sprite/sprite",  true,  true,  true,  false },
+    { "dash/sprite/tft",     true,  true,  false, true  },
+    { "dash/sprite/both",    true,  true,  true,  true  },
+    { "image/tft/none",      false, false, false, false },
+    { "image/tft/tft",       false, false, false, true  },
+    { "image/sprite/none",   false, true,  false, false },
+    { "image/sprite/sprite", false, true,  true,  false },
+    { "image/sprite/tft",    false, true,  false, true  },
+    { "image/sprite/both",   false, true,  true,  true  },
+  };
+
+  for (const Test& test : tests) {
+    tft.resetRoundClip();
+    tft.fillScreen(OUTSIDE);
+    spr.fillSprite(OUTSIDE);
+    if (test.tftClip) tft.setRoundClip();
+    if (test.sprClip) spr.setRoundClip();
+    else spr.resetRoundClip();
+
+    uint64_t bytes = 0, windows = 0, pixels = 0;
+    uint32_t errors = 0;
+    double drawUs = 0, pushUs = 0;
+
+    for (int32_t r = 0; r < REPEATS; r++) {
+      for (int32_t f = 0; f < FRAMES; f++) {
+        tft.resetBusStats();
+        auto t0 = std::chrono::steady_clock::now();
+        if (test.sprite) frame(spr, test.dash, f);
+        else frame(tft, test.dash, f);
+        auto t1 = std::chrono::steady_clock::now();
+        if (test.sprite) spr.pushSprite(0, 0);
+        auto t2 = std::chrono::steady_clock::now();
+        drawUs += std::chrono::duration<double, std::micro>(t1 - t0).count();
+        pushUs += std::chrono::duration<double, std::micro>(t2 - t1).count();
+        if (r) continue;
+
+        bus_stats_t stats;
+        tft.getBusStats(stats);
+        bytes += stats.cmdBytes + stats.pixelBytes;
+        windows += stats.windows;
+        pixels += stats.pixelBytes / 2;
+
+        // Check the screen, outside the round area it is unchanged if either has a clip
+        const uint16_t* ref = test.dash ? reference[f] : image;
+        const uint16_t* screen = tft.getFrameBuffer();
+        bool clipped = test.tftClip || test.sprClip;
+        bool same = true;
+        for (int32_t y = 0; same && y < TFT_HEIGHT; y++) {
+          for (int32_t x = 0; same && x < TFT_WIDTH; x++) {
+            bool outside = x < spanXs[y] || x > spanXe[y];
+            uint16_t expected = (clipped && outside) ? OUTSIDE : ref[x + y * TFT_WIDTH];
+            same = screen[x + y * TFT_WIDTH] == expected;
+          }
+        }
+        errors += !same;
+      }
+    }
+
+    Serial.printf("%-20s %10.0f %8.0f %9.0f %8.2f %8.1f %8.1f\n", test.name, (double)bytes / FRAMES, (double)windows / FRAMES,
+                  (double)pixels / FRAMES, bytes * 8000.0 / SPI_FREQUENCY / FRAMES, drawUs / FRAMES / REPEATS, pushUs / FRAMES / REPEATS);
+    if (errors) Serial.printf("                     %u frames differ!\n", errors);
+
+    if (outDir && test.dash && test.tftClip && test.sprClip) {
+      char filename[256];
+      snprintf(filename, sizeof(filename), "%s/round_clip.png", outDir);
+      tft.saveScreen(filename);
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,39 @@
+        ////////////////////////////////////////////////////
+        //   Placeholder SPI class for host builds        //
+        ////////////////////////////////////////////////////
+
+// The host processor backend does not use SPI, the bus is emulated in
+// Processors/TFT_eSPI_Host.c. This class exists so sketches and the
+// TFT_eSPI getSPIinstance() member compile unchanged.
+
+#ifndef _HOST_SPI_H_
+#define _HOST_SPI_H_
+
+#include <stdint.h>
+
+#define SPI_MODE0 0x00
+#define SPI_MODE1 0x01
+#define SPI_MODE2 0x02
+#define SPI_MODE3 0x03
+
+class SPISettings {
+ public:
+  SPISettings(uint32_t clock = 1000000, uint8_t bitOrder = 1, uint8_t dataMode = SPI_MODE0)
+  { (void)clock; (void)bitOrder; (void)dataMode; }
+};
+
+class SPIClass {
+ public:
+  void     begin(int8_t sck = -1, int8_t miso = -1, int8_t mosi = -1, int8_t ss = -1)
+           { (void)sck; (void)miso; (void)mosi; (void)ss; }
+  void     end(void) {}
+  void     beginTransaction(SPISettings settings) { (void)settings; }
+  void     endTransaction(void) {}
+  void     setFrequency(uint32_t freq) { (void)freq; }
+  uint8_t  transfer(uint8_t data)    { (void)data; return 0; }
+  uint16_t transfer16(uint16_t data) { (void)data; return 0; }
+};
+
+extern SPIClass SPI;
+
+#endif // _HOST_SPI_H_
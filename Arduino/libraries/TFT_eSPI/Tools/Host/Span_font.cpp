@@ -0,0 +1,117 @@
+/*
+  Host benchmark for the span fonts (SPAN_FONTS), text in the RLE fonts 4, 6, 7 and 8 is
+  drawn with setAttribute(SPAN_FONT, false), decoding the runs, and then from the span
+  lists. Each font is drawn:
+    trans  : transparent text, textcolor == textbgcolor
+    opaque : text with a background colour
+  at textsize 1 and 2, to the TFT and to a full screen Sprite (then pushSprite()). Lines
+  are drawn across the screen so some characters are clipped at the edges.
+
+  The report gives host glyphs per second without the panel model (not absolute speed)
+  and the bus bytes and windows per glyph. The screen is checked against the RLE result.
+
+  Usage: TFT_eSPI_span_font [output_directory]
+*/
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include <chrono>
+
+#define REPEATS 200
+
+TFT_eSPI tft = TFT_eSPI();
+TFT_eSprite spr = TFT_eSprite(&tft);
+
+static uint16_t reference[TFT_WIDTH * TFT_HEIGHT];
+
+struct Font { uint8_t font; const char* name; const char* text; };
+static const Font fonts[] = {
+  { 4, "Font4", "Clock 12:34 -5.6 pm" },
+  { 6, "Font6", "12:34:56.7-am" },
+  { 7, "Font7", "12:34:56.7-8" },
+  { 8, "Font8", "12:34.5-6" },
+};
+
+// Draw lines of text down the screen, returns the number of glyphs drawn
+template <typename T> static uint32_t draw(T& g, const Font& font, bool opaque, uint8_t size)
+{
+  uint32_t glyphs = 0;
+  g.setTextFont(font.font);
+  g.setTextSize(size);
+  if (opaque) g.setTextColor(TFT_YELLOW, TFT_NAVY);
+  else g.setTextColor(TFT_WHITE);
+
+  int32_t h = g.fontHeight();
+  for (int32_t i = 0, y = -h / 2; y < TFT_HEIGHT; i++, y += h) {
+    g.drawString(font.text, (i % 3) * 20 - 30, y);
+    glyphs += strlen(font.text);
+  }
+  return glyphs;
+}
+
+int main(int argc, char* argv[])
+{
+  const char* outDir = argc > 1 ? argv[1] : nullptr;
+
+  tft.init();
+  if (!spr.createSprite(TFT_WIDTH, TFT_HEIGHT)) { Serial.println("createSprite failed"); return 1; }
+
+  Serial.printf("%dx%d screen, %d repeats\n", TFT_WIDTH, TFT_HEIGHT, REPEATS);
+  Serial.printf("%-24s %10s %10s %7s %9s %8s %9s %8s\n", "test", "rle_gps", "span_gps", "speed",
+                "rle_b/g", "span_b/g", "rle_win/g", "span_win/g");
+
+  for (const Font& font : fonts) {
+    for (uint8_t target = 0; target < 2; target++) {
+      for (uint8_t opaque = 0; opaque < 2; opaque++) {
+        for (uint8_t size = 1; size <= 2; size++) {
+          double   gps[2], bytes[2], windows[2];
+          uint32_t errors = 0;
+
+          for (uint8_t span = 0; span < 2; span++) {
+            tft.setAttribute(SPAN_FONT, span);
+            spr.setAttribute(SPAN_FONT, span);
+
+            // Draw once with the panel model for the bus counts and the check
+            tft.fillScreen(TFT_DARKGREY);
+            spr.fillSprite(TFT_DARKGREY);
+            tft.resetBusStats();
+            uint32_t glyphs = target ? draw(spr, font, opaque, size) : draw(tft, font, opaque, size);
+            if (target) spr.pushSprite(0, 0);
+            bus_stats_t stats;
+            tft.getBusStats(stats);
+            bytes[span]   = (double)(stats.cmdBytes + stats.pixelBytes) / glyphs;
+            windows[span] = (double)stats.windows / glyphs;
+
+            if (!span) memcpy(reference, tft.getFrameBuffer(), sizeof(reference));
+            else errors = memcmp(reference, tft.getFrameBuffer(), sizeof(reference)) != 0;
+
+            // Time the drawing only
+            tft_host.discardPixels = true;
+            auto t0 = std::chrono::steady_clock::now();
+            for (int32_t r = 0; r < REPEATS; r++) {
+              if (target) draw(spr, font, opaque, size);
+              else draw(tft, font, opaque, size);
+            }
+            auto t1 = std::chrono::steady_clock::now();
+            tft_host.discardPixels = false;
+            gps[span] = glyphs * REPEATS / std::chrono::duration<double>(t1 - t0).count();
+          }
+
+          char name[32];
+          snprintf(name, sizeof(name), "%s/%s/%s/x%d", font.name, target ? "sprite" : "tft", opaque ? "opaque" : "trans", size);
+          Serial.printf("%-24s %10.0f %10.0f %6.1fx %9.0f %8.0f %9.1f %8.1f\n", name, gps[0], gps[1], gps[1] / gps[0],
+                        bytes[0], bytes[1], windows[0], windows[1]);
+          if (errors) Serial.printf("                         screen differs from RLE!\n");
+
+          if (outDir && font.font == 7 && !target && opaque && size == 1) {
+            char filename[256];
+            snprintf(filename, sizeof(filename), "%s/span_font.png", outDir);
+            tft.saveScreen(filename);
+          }
+        }
+      }
+    }
+  }
+
+  return 0;
+}
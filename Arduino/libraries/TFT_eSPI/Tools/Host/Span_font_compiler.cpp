@@ -0,0 +1,125 @@
+/*
+  Span font compiler, converts the run length encoded fonts 4, 6, 7, 8 and 8N into
+  horizontal span lists that are used when SPAN_FONTS is defined.
+
+  RLE fonts code each character as alternating background and foreground pixel runs that
+  can wrap from one row to the next, so drawChar() has to track the pixel position.
+  The span lists hold the foreground runs split at row ends as (x, y, length), so
+  transparent text is drawn with one drawFastHLine() per span and opaque text is built
+  in a line buffer.
+
+  The output files are written to the Fonts folder (or the directory given) and need
+  only be regenerated if a RLE font is changed.
+
+  Usage: TFT_eSPI_span_font_compiler [output_directory]
+*/
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include <string>
+#include <vector>
+
+// The narrow Font 8 uses the same names as Font 8
+namespace narrow {
+#include "../../Fonts/Font72x53rle.c"
+}
+
+struct Font {
+  const char*                 file;    // Output file name
+  const char*                 source;  // RLE font file
+  const char*                 suffix;  // Table name suffix
+  const char*                 name;
+  const unsigned char*        widths;
+  const unsigned char* const* chars;
+  uint8_t                     height;
+};
+
+static const Font fonts[] = {
+  { "Font32span.h",    "Font32rle.c",    "f32", "Font 4",  widtbl_f32, chrtbl_f32, chr_hgt_f32 },
+  { "Font64span.h",    "Font64rle.c",    "f64", "Font 6",  widtbl_f64, chrtbl_f64, chr_hgt_f64 },
+  { "Font7sspan.h",    "Font7srle.c",    "f7s", "Font 7",  widtbl_f7s, chrtbl_f7s, chr_hgt_f7s },
+  { "Font72span.h",    "Font72rle.c",    "f72", "Font 8",  widtbl_f72, chrtbl_f72, chr_hgt_f72 },
+  { "Font72x53span.h", "Font72x53rle.c", "f72", "Font 8N", narrow::widtbl_f72, narrow::chrtbl_f72, chr_hgt_f72 },
+};
+
+// Decode a RLE character into spans
+static void compile(const unsigned char* rle, int32_t width, int32_t height, std::vector<uint8_t>& spans)
+{
+  int32_t total = width * height;
+  int32_t pc = 0;
+
+  while (pc < total) {
+    uint8_t line = *rle++;
+    int32_t len = (line & 0x7F) + 1;
+    // Some characters use the space data with a different width, ignore pixels past the end
+    if (pc + len > total) len = total - pc;
+
+    // Foreground run, split at the end of each row
+    if (line & 0x80) {
+      while (len) {
+        int32_t x = pc % width, y = pc / width;
+        int32_t n = len < width - x ? len : width - x;
+        spans.push_back(x);
+        spans.push_back(y);
+        spans.push_back(n);
+        pc += n;
+        len -= n;
+      }
+    }
+    else pc += len;
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  std::string outDir = argc > 1 ? argv[1] : "Fonts";
+
+  Serial.printf("%-8s %-16s %8s %8s %8s\n", "font", "file", "rle", "spans", "bytes");
+
+  for (const Font& font : fonts) {
+    std::vector<uint8_t>  spans;
+    std::vector<uint16_t> index;
+    uint32_t rleBytes = 0;
+
+    for (int32_t c = 0; c < 96; c++) {
+      index.push_back(spans.size() / 3);
+      compile(font.chars[c], font.widths[c], font.height, spans);
+
+      // Size of the RLE data of characters that are not shared (spaces)
+      if (c && font.chars[c] == font.chars[0]) continue;
+      const unsigned char* p = font.chars[c];
+      for (int32_t pc = 0; pc < font.widths[c] * font.height; rleBytes++) pc += (*p++ & 0x7F) + 1;
+    }
+    // The index only grows, so checking the last entry before it is narrowed to 16 bits is enough
+    if (spans.size() / 3 > 0xFFFF) { Serial.printf("%s: too many spans\n", font.name); return 1; }
+    index.push_back(spans.size() / 3);
+
+    std::string path = outDir + "/" + font.file;
+    FILE* f = fopen(path.c_str(), "w");
+    if (!f) { Serial.printf("Cannot write %s\n", path.c_str()); return 1; }
+
+    fprintf(f, "// %s as horizontal spans, used if SPAN_FONTS is defined\n", font.name);
+    fprintf(f, "//\n");
+    fprintf(f, "// Generated from %s by Tools/Host/Span_font_compiler.cpp, do not edit\n\n", font.source);
+    fprintf(f, "// Foreground spans as x, y, length in row order\n");
+    fprintf(f, "PROGMEM const unsigned char spans_%s[%u] =\n{\n", font.suffix, (uint32_t)spans.size());
+    for (size_t i = 0; i < spans.size(); i++) {
+      if (i % 12 == 0) fprintf(f, "  ");
+      fprintf(f, "0x%02X,%s", spans[i], (i % 12 == 11 || i + 1 == spans.size()) ? "\n" : " ");
+    }
+    fprintf(f, "};\n\n");
+    fprintf(f, "// Character c has spans spanidx_%s[c - 32] to spanidx_%s[c - 31] - 1\n", font.suffix, font.suffix);
+    fprintf(f, "PROGMEM const unsigned short spanidx_%s[97] =\n{\n", font.suffix);
+    for (size_t i = 0; i < index.size(); i++) {
+      if (i % 8 == 0) fprintf(f, "  ");
+      fprintf(f, "%5u,%s", index[i], (i % 8 == 7 || i + 1 == index.size()) ? "\n" : " ");
+    }
+    fprintf(f, "};\n");
+    fclose(f);
+
+    uint32_t bytes = spans.size() + index.size() * 2;
+    Serial.printf("%-8s %-16s %8u %8u %8u\n", font.name, font.file, rleBytes, (uint32_t)spans.size() / 3, bytes);
+  }
+
+  return 0;
+}
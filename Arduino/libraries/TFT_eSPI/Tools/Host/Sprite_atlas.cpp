@@ -0,0 +1,200 @@
+/*
+  Host benchmark for TFT_eSpriteAtlas and TFT_eCompositor, a scene of 50 moving 32 x 32
+  transparent images (balls, stars, rings and eyes with 8 animation frames) over a plain
+  background, some partly off the screen.
+
+  The scene is drawn:
+    sprites/sprite : a TFT_eSprite per image, pushToSprite() with the transparent colour
+                     into a full screen Sprite, then pushSprite()
+    sprites/tft    : fillScreen() then pushSprite() with the transparent colour for each
+                     image straight to the TFT (flickers on a real display)
+    atlas/sprite   : the images in one atlas, TFT_eCompositor render() to a full screen
+                     Sprite, then pushSprite()
+    atlas/tft      : TFT_eCompositor render() to the TFT through line buffers
+    atlas/tft/dma  : as atlas/tft after tft.initDMA()
+  The report gives bus bytes and windows per frame, the RAM used for pixels and host_us,
+  the host time per frame without the panel model (not absolute speed). Each frame on
+  the screen is checked against the first test.
+
+  Usage: TFT_eSPI_sprite_atlas [output_directory]
+*/
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include <chrono>
+
+#define FRAMES  60
+#define REPEATS 20          // Frames are drawn REPEATS times for the times
+#define ITEMS   50
+#define SIZE    32          // Image width and height
+#define KEY     TFT_BLACK   // Transparent colour
+#define BG      0x2945      // Background colour
+
+TFT_eSPI tft = TFT_eSPI();
+TFT_eSprite screen = TFT_eSprite(&tft);
+TFT_eSprite images[14] = {
+  TFT_eSprite(&tft), TFT_eSprite(&tft), TFT_eSprite(&tft), TFT_eSprite(&tft), TFT_eSprite(&tft),
+  TFT_eSprite(&tft), TFT_eSprite(&tft), TFT_eSprite(&tft), TFT_eSprite(&tft), TFT_eSprite(&tft),
+  TFT_eSprite(&tft), TFT_eSprite(&tft), TFT_eSprite(&tft), TFT_eSprite(&tft)
+};
+TFT_eSpriteAtlas atlas;
+
+#define IMAGES  (sizeof(images) / sizeof(images[0]))
+#define EYE     6           // First eye frame, 8 frames
+
+static uint16_t reference[FRAMES][TFT_WIDTH * TFT_HEIGHT];
+
+struct Pos { int32_t x, y; uint16_t frame; int16_t z; };
+static Pos pos[FRAMES][ITEMS];
+static uint16_t order[ITEMS]; // Drawing order, by z then item number
+
+// Draw image n in a Sprite, the background is the transparent colour
+static void drawImage(TFT_eSprite& s, uint16_t n)
+{
+  const uint16_t colors[] = { TFT_RED, TFT_GREEN, TFT_ORANGE, TFT_CYAN };
+  s.fillSprite(KEY);
+  if (n < 4) {
+    s.fillCircle(15, 15, 14, colors[n]);
+    s.fillCircle(10, 10, 4, TFT_WHITE);
+  }
+  else if (n == 4) {
+    s.fillTriangle(15, 0, 2, 23, 29, 23, TFT_YELLOW);
+    s.fillTriangle(15, 31, 2, 8, 29, 8, TFT_YELLOW);
+  }
+  else if (n == 5) {
+    s.fillCircle(15, 15, 15, TFT_MAGENTA);
+    s.fillCircle(15, 15, 9, KEY);
+  }
+  else {
+    float a = (n - EYE) * PI / 4;
+    s.fillCircle(15, 15, 15, TFT_WHITE);
+    s.fillCircle(15 + 7 * cosf(a), 15 + 7 * sinf(a), 6, TFT_BLUE);
+    s.fillCircle(15 + 8 * cosf(a), 15 + 8 * sinf(a), 3, TFT_NAVY);
+  }
+}
+
+// Item positions bounce around the screen, eyes look around
+static void makeScene(void)
+{
+  for (int32_t i = 0; i < ITEMS; i++) {
+    int32_t range = TFT_WIDTH; // -SIZE/2 to TFT_WIDTH - SIZE/2
+    int32_t x = (i * 37) % range, y = (i * 71 + 13) % range;
+    int32_t dx = 1 + i % 4, dy = 1 + (i * 3) % 5;
+    for (int32_t f = 0; f < FRAMES; f++) {
+      int32_t px = (x + dx * f) % (2 * range), py = (y + dy * f) % (2 * range);
+      if (px >= range) px = 2 * range - px;
+      if (py >= range) py = 2 * range - py;
+      pos[f][i].x = px - SIZE / 2;
+      pos[f][i].y = py - SIZE / 2;
+      pos[f][i].frame = i % 3 == 2 ? EYE + (i + f / 4) % 8 : i % EYE;
+      pos[f][i].z = i % 3;
+    }
+  }
+
+  for (int32_t i = 0; i < ITEMS; i++) order[i] = i;
+  std::stable_sort(order, order + ITEMS, [](uint16_t a, uint16_t b) { return pos[0][a].z < pos[0][b].z; });
+}
+
+int main(int argc, char* argv[])
+{
+  const char* outDir = argc > 1 ? argv[1] : nullptr;
+
+  tft.init();
+  if (!screen.createSprite(TFT_WIDTH, TFT_HEIGHT)) { Serial.println("createSprite failed"); return 1; }
+
+  // The same images as Sprites and as atlas frames
+  atlas.createAtlas(4 * SIZE, 4 * SIZE, IMAGES, KEY);
+  uint32_t runs = 0;
+  for (uint16_t n = 0; n < IMAGES; n++) {
+    images[n].createSprite(SIZE, SIZE);
+    drawImage(images[n], n);
+    if (atlas.addFrame(&images[n]) != n) { Serial.println("addFrame failed"); return 1; }
+    runs += atlas.opaqueRuns(n);
+  }
+  makeScene();
+
+  TFT_eCompositor toTft = TFT_eCompositor(&tft);
+  TFT_eCompositor toSprite = TFT_eCompositor(&screen);
+  toTft.begin(ITEMS);
+  toSprite.begin(ITEMS);
+  for (int32_t i = 0; i < ITEMS; i++) {
+    toTft.add(&atlas, pos[0][i].frame, pos[0][i].x, pos[0][i].y, pos[0][i].z);
+    toSprite.add(&atlas, pos[0][i].frame, pos[0][i].x, pos[0][i].y, pos[0][i].z);
+  }
+  toTft.setBackground(BG);
+  toSprite.setBackground(BG);
+
+  Serial.printf("%d frames, %d items, %d images %dx%d, %u opaque runs, atlas %u bytes\n", FRAMES, ITEMS, (int)IMAGES,
+                SIZE, SIZE, runs, atlas.memoryUsed());
+  Serial.printf("%-16s %10s %8s %8s %10s %8s\n", "test", "bytes/f", "windows", "spi_ms/f", "ram", "host_us");
+
+  struct Test { const char* name; bool useAtlas, sprite, dma; };
+  const Test tests[] = {
+    { "sprites/sprite", false, true,  false },
+    { "sprites/tft",    false, false, false },
+    { "atlas/sprite",   true,  true,  false },
+    { "atlas/tft",      true,  false, false },
+    { "atlas/tft/dma",  true,  false, true  },
+  };
+
+  for (const Test& test : tests) {
+    if (test.dma) tft.initDMA();
+    uint64_t bytes = 0, windows = 0;
+    uint32_t errors = 0;
+    double us = 0;
+
+    for (int32_t r = 0; r < REPEATS; r++) {
+      tft_host.discardPixels = r > 0; // Time the drawing, not the panel model
+      for (int32_t f = 0; f < FRAMES; f++) {
+        tft.resetBusStats();
+        auto t0 = std::chrono::steady_clock::now();
+        if (test.useAtlas) {
+          TFT_eCompositor& comp = test.sprite ? toSprite : toTft;
+          for (int32_t i = 0; i < ITEMS; i++) comp.setItem(i, pos[f][i].frame, pos[f][i].x, pos[f][i].y);
+          comp.render();
+          if (test.sprite) screen.pushSprite(0, 0);
+        }
+        else if (test.sprite) {
+          screen.fillSprite(BG);
+          for (uint16_t i : order) images[pos[f][i].frame].pushToSprite(&screen, pos[f][i].x, pos[f][i].y, KEY);
+          screen.pushSprite(0, 0);
+        }
+        else {
+          tft.fillScreen(BG);
+          for (uint16_t i : order) images[pos[f][i].frame].pushSprite(pos[f][i].x, pos[f][i].y, KEY);
+        }
+        auto t1 = std::chrono::steady_clock::now();
+        us += std::chrono::duration<double, std::micro>(t1 - t0).count();
+        if (r) continue;
+
+        bus_stats_t stats;
+        tft.getBusStats(stats);
+        bytes += stats.cmdBytes + stats.pixelBytes;
+        windows += stats.windows;
+
+        if (&test == tests) memcpy(reference[f], tft.getFrameBuffer(), sizeof(reference[f]));
+        else errors += memcmp(reference[f], tft.getFrameBuffer(), sizeof(reference[f])) != 0;
+      }
+    }
+    tft_host.discardPixels = false;
+
+    // RAM for pixels: Sprites, or the atlas and line buffers
+    uint32_t ram = test.sprite ? TFT_WIDTH * TFT_HEIGHT * 2 : 0;
+    if (test.useAtlas) ram += atlas.memoryUsed() + (test.dma ? 2 : 1) * TFT_WIDTH * COMPOSITOR_LINES * 2;
+    else ram += IMAGES * SIZE * SIZE * 2;
+
+    Serial.printf("%-16s %10.0f %8.0f %8.2f %10u %8.1f\n", test.name, (double)bytes / FRAMES, (double)windows / FRAMES,
+                  bytes * 8000.0 / SPI_FREQUENCY / FRAMES, ram, us / FRAMES / REPEATS);
+    if (errors) Serial.printf("                 %u frames differ!\n", errors);
+  }
+
+  Serial.printf("Compositor: %u bands, %u runs, %u item pixels in the last frame\n", toTft.bands(), toTft.runs(), toTft.pixels());
+
+  if (outDir) {
+    char filename[256];
+    snprintf(filename, sizeof(filename), "%s/sprite_atlas.png", outDir);
+    tft.saveScreen(filename);
+  }
+
+  return 0;
+}
@@ -0,0 +1,171 @@
+/*
+  Host benchmark for TFT_eSprite delta pushes, an animated analogue clock face drawn in a
+  full screen Sprite with the second hand moving once per frame.
+
+  The clock is drawn in two ways:
+    redraw : fillSprite() then the whole face each frame
+    erase  : the face is drawn once, each frame the old hands are drawn in the face colour,
+             then the numerals, time text and new hands are drawn again
+  and pushed with setDeltaPush() modes:
+    full   : SPRITE_DELTA_OFF, the whole Sprite is sent
+    track  : SPRITE_DELTA_TRACK, blocks written by the drawing functions are sent
+    hash   : SPRITE_DELTA_HASH, blocks with a changed hash are sent
+  The report gives bus bytes, windows and pixels per frame, and push_us, the host time of
+  pushSprite() (includes hashing, not absolute speed). The TFT is checked after each push.
+
+  Usage: TFT_eSPI_sprite_delta [output_directory]
+*/
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include <chrono>
+
+#define FRAMES 120
+
+#define FACE_COLOR TFT_NAVY
+#define HAND_COLOR TFT_WHITE
+#define SEC_COLOR  TFT_RED
+
+TFT_eSPI tft = TFT_eSPI();
+TFT_eSprite spr = TFT_eSprite(&tft);
+
+static const int32_t cx = TFT_WIDTH / 2, cy = TFT_HEIGHT / 2;
+
+// Hand end point for a position of 0-60 around the face
+static void handEnd(float pos, float len, float& x, float& y)
+{
+  float a = pos * (2 * PI / 60);
+  x = cx + len * sinf(a);
+  y = cy - len * cosf(a);
+}
+
+static void drawHands(uint32_t t, uint32_t color, uint32_t secColor, uint32_t bg)
+{
+  float x, y;
+  handEnd((t / 720) % 60 + (t % 720) / 720.0f, 45, x, y); // Hours, 12 positions per 60
+  spr.drawWedgeLine(cx, cy, x, y, 6, 2, color, bg);
+  handEnd((t / 60) % 60 + (t % 60) / 60.0f, 65, x, y);
+  spr.drawWedgeLine(cx, cy, x, y, 4, 1.5, color, bg);
+  handEnd(t % 60, 70, x, y);
+  spr.drawWideLine(cx, cy, x, y, 1.5, secColor, bg);
+  spr.fillSmoothCircle(cx, cy, 4, secColor, bg);
+}
+
+static void drawText(uint32_t t)
+{
+  char text[16];
+  snprintf(text, sizeof(text), "%02u:%02u:%02u", (t / 3600) % 24, (t / 60) % 60, t % 60);
+  spr.setTextColor(TFT_YELLOW, FACE_COLOR, true);
+  spr.setTextDatum(MC_DATUM);
+  spr.drawString(text, cx, cy + 40, 2);
+
+  for (int32_t h = 1; h <= 12; h++) {
+    float x, y;
+    handEnd(h * 5, 88, x, y);
+    snprintf(text, sizeof(text), "%d", h);
+    spr.setTextColor(TFT_WHITE, FACE_COLOR, true);
+    spr.drawString(text, x, y, 2);
+  }
+}
+
+static void drawFace(void)
+{
+  spr.fillSprite(TFT_BLACK);
+  spr.fillSmoothCircle(cx, cy, 118, FACE_COLOR, TFT_BLACK);
+  for (int32_t i = 0; i < 60; i++) {
+    float x0, y0, x1, y1;
+    handEnd(i, 116, x0, y0);
+    handEnd(i, i % 5 ? 110 : 102, x1, y1);
+    spr.drawWideLine(x0, y0, x1, y1, i % 5 ? 1 : 3, TFT_SILVER, FACE_COLOR);
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  const char* outDir = argc > 1 ? argv[1] : nullptr;
+
+  tft.init();
+  spr.createSprite(TFT_WIDTH, TFT_HEIGHT);
+
+  Serial.printf("%d frames, %dx%d Sprite, %d bytes\n", FRAMES, TFT_WIDTH, TFT_HEIGHT, TFT_WIDTH * TFT_HEIGHT * 2);
+  Serial.printf("%-16s %10s %8s %8s %9s %8s %8s\n", "mode", "bytes/f", "cmd/f", "rects/f", "pixels/f", "spi_ms/f", "push_us");
+
+  struct Test { const char* name; bool erase; uint8_t mode; uint8_t bw, bh; };
+  const Test tests[] = {
+    { "full/redraw",     false, SPRITE_DELTA_OFF,   16,  8 },
+    { "track/redraw",    false, SPRITE_DELTA_TRACK, 16,  8 },
+    { "hash/redraw",     false, SPRITE_DELTA_HASH,  16,  8 },
+    { "full/erase",      true,  SPRITE_DELTA_OFF,   16,  8 },
+    { "track/erase",     true,  SPRITE_DELTA_TRACK, 16,  8 },
+    { "hash/erase",      true,  SPRITE_DELTA_HASH,  16,  8 },
+    { "hash8x8/erase",   true,  SPRITE_DELTA_HASH,   8,  8 },
+    { "hash32x16/erase", true,  SPRITE_DELTA_HASH,  32, 16 },
+  };
+
+  for (const Test& test : tests) {
+    if (!spr.setDeltaPush(test.mode, test.bw, test.bh)) { Serial.println("setDeltaPush failed"); return 1; }
+    tft.fillScreen(TFT_BLUE); // The first push must cover the whole screen
+
+    uint32_t t = 10 * 3600 + 8 * 60 + 30;
+    uint64_t bytes = 0, cmdBytes = 0, rects = 0, pixels = 0;
+    uint32_t errors = 0;
+    double us = 0;
+
+    if (test.erase) {
+      drawFace();
+      drawText(t);
+      drawHands(t, HAND_COLOR, SEC_COLOR, FACE_COLOR);
+    }
+
+    for (int32_t f = 0; f < FRAMES; f++) {
+      if (test.erase) {
+        if (f) {
+          drawHands(t - 1, FACE_COLOR, FACE_COLOR, FACE_COLOR);
+          drawText(t);
+          drawHands(t, HAND_COLOR, SEC_COLOR, FACE_COLOR);
+        }
+      }
+      else {
+        drawFace();
+        drawText(t);
+        drawHands(t, HAND_COLOR, SEC_COLOR, FACE_COLOR);
+      }
+
+      tft.resetBusStats();
+      auto t0 = std::chrono::steady_clock::now();
+      spr.pushSprite(0, 0);
+      auto t1 = std::chrono::steady_clock::now();
+      us += std::chrono::duration<double, std::micro>(t1 - t0).count();
+
+      bus_stats_t stats;
+      tft.getBusStats(stats);
+      bytes += stats.cmdBytes + stats.pixelBytes;
+      cmdBytes += stats.cmdBytes;
+      if (f) { // The first frame is a full push
+        rects += test.mode ? spr.deltaRects() : 1;
+        pixels += test.mode ? spr.deltaPixels() : TFT_WIDTH * TFT_HEIGHT;
+      }
+
+      // Check the screen
+      const uint16_t* image = (uint16_t*)spr.getPointer();
+      const uint16_t* screen = tft.getFrameBuffer();
+      for (uint32_t i = 0; i < TFT_WIDTH * TFT_HEIGHT; i++) {
+        if (screen[i] != (uint16_t)(image[i] >> 8 | image[i] << 8)) { errors++; break; }
+      }
+
+      t++;
+    }
+
+    Serial.printf("%-16s %10.0f %8.0f %8.1f %9.0f %8.2f %8.1f\n", test.name, (double)bytes / FRAMES, (double)cmdBytes / FRAMES,
+                  (double)rects / (FRAMES - 1), (double)pixels / (FRAMES - 1), bytes * 8000.0 / SPI_FREQUENCY / FRAMES, us / FRAMES);
+    if (errors) Serial.printf("                 %u frames differ from the Sprite!\n", errors);
+
+    if (outDir && test.mode == SPRITE_DELTA_HASH && test.erase) {
+      char filename[256];
+      snprintf(filename, sizeof(filename), "%s/sprite_delta.png", outDir);
+      tft.saveScreen(filename);
+    }
+  }
+
+  return 0;
+}
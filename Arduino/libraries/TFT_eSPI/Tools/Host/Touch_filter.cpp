@@ -0,0 +1,407 @@
+/*
+  Host test for TFT_eTouchFilter, a noisy resistive touch trace is replayed through the
+  filter and through a model of the blocking getTouch() / validTouch() code.
+
+  The trace has 10 taps, a straight drag, a circular drag and a 1 second hold on a
+  240 x 240 screen. The raw panel axes are swapped, inverted and rotated 1.5 degrees
+  from the screen, each sample has Gaussian noise, 3% of samples have a spike, the
+  pressure ramps up over the first samples and positions drift as it falls at the end.
+
+  Both methods are calibrated from the same 8 sample averages at the targets: getTouch()
+  with the 5 value calibrateTouch() corners, the filter with calibrate() from 3 and 5
+  points. The report gives:
+    cal_err  : mean and maximum calibration error over the screen, pixels (no noise)
+    touches  : touches detected of the 13 in the trace, and false ones
+    press    : mean latency from the touch to the press event, ms
+    release  : mean latency from the end of the touch to the release event, ms
+    pos_rms  : RMS error of the position each frame would draw against the true position
+    jitter   : standard deviation of the position during the hold, pixels
+    wait     : time the sketch is blocked per call (getTouch delays, or the filter time)
+
+  Usage: TFT_eSPI_touch_filter [trace.csv]
+  A CSV file of "ms,rawX,rawY,z" lines is replayed through the filter (calibrated to
+  the test panel) and the events are printed.
+*/
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include <chrono>
+#include <vector>
+
+#define W        240
+#define H        240
+#define PERIOD   5      // Filter sample period, ms
+#define FRAME    10     // Drawing time between getTouch() calls, ms
+#define END      7300   // Trace length, ms
+
+// One touch of the trace, a line from x0,y0 to x1,y1 or a circle if r > 0
+struct Touch { uint32_t start, len; float x0, y0, x1, y1, r; };
+static std::vector<Touch> touches;
+
+struct Sample { bool touched; float x, y; uint16_t rawX, rawY, z; };
+
+// Deterministic noise for each ms and channel
+static float uniform(uint32_t t, uint32_t ch)
+{
+  uint64_t z = (uint64_t)t * 0x9E3779B97F4A7C15ull + ch * 0xBF58476D1CE4E5B9ull + 1;
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+  z ^= z >> 31;
+  return ((z >> 11) + 0.5) / 9007199254740992.0;
+}
+
+static float gauss(uint32_t t, uint32_t ch)
+{
+  return sqrtf(-2 * logf(uniform(t, ch))) * cosf(2 * PI * uniform(t, ch + 1));
+}
+
+// Screen to raw: axes swapped and inverted, rotated 1.5 degrees
+static void toRaw(float x, float y, float* rx, float* ry)
+{
+  const float a = 1.5f * PI / 180;
+  float dx = x - W / 2, dy = y - H / 2;
+  float u = dx * cosf(a) - dy * sinf(a), v = dx * sinf(a) + dy * cosf(a);
+  *rx = 2000 + 14.2f * v;
+  *ry = 2050 - 13.6f * u;
+}
+
+// True position and the raw sample at time t
+static Sample sampleAt(uint32_t t)
+{
+  Sample s = { false, 0, 0, 0, 0, 0 };
+  for (const Touch& c : touches) {
+    if (t < c.start || t >= c.start + c.len) continue;
+    float f = (float)(t - c.start) / c.len;
+    s.touched = true;
+    if (c.r > 0) {
+      s.x = c.x0 + c.r * cosf(2 * PI * f);
+      s.y = c.y0 + c.r * sinf(2 * PI * f);
+    }
+    else {
+      s.x = c.x0 + (c.x1 - c.x0) * f;
+      s.y = c.y0 + (c.y1 - c.y0) * f;
+    }
+
+    float rx, ry;
+    toRaw(s.x, s.y, &rx, &ry);
+    rx += 6 * gauss(t, 0);
+    ry += 6 * gauss(t, 2);
+    if (uniform(t, 4) < 0.03f) { // Spike
+      if (uniform(t, 5) < 0.5f) rx += uniform(t, 6) < 0.5f ? 400 : -400;
+      else ry += uniform(t, 6) < 0.5f ? 400 : -400;
+    }
+
+    // Pressure ramps up, then falls with the position drifting
+    uint32_t in = t - c.start, out = c.start + c.len - t;
+    float z = 1200 + 60 * gauss(t, 8);
+    if (in < 4) z = 150;
+    else if (in < 8) z = 500;
+    if (out <= 12) {
+      z = 100 + 60 * out;
+      rx += 8 * (13 - out);
+      ry -= 6 * (13 - out);
+    }
+    s.rawX = constrain(rx, 0, 4095);
+    s.rawY = constrain(ry, 0, 4095);
+    s.z = z;
+  }
+  return s;
+}
+
+static void makeTrace(void)
+{
+  for (int32_t i = 0; i < 10; i++) {
+    float x = 30 + (i * 53) % 180, y = 30 + (i * 97) % 180;
+    touches.push_back({ 200u + i * 350, 120, x, y, x, y, 0 });
+  }
+  touches.push_back({ 3800, 600,  30, 120, 210, 120, 0 });  // Drag
+  touches.push_back({ 4700, 1000, 120, 120, 0, 0, 80 });    // Circle
+  touches.push_back({ 6000, 1000, 60, 180, 60, 180, 0 });   // Hold
+}
+
+// Average of 8 raw samples at a target, as the calibration functions take
+static void target(float x, float y, uint32_t t, uint16_t* rx, uint16_t* ry)
+{
+  float fx, fy, sx = 0, sy = 0;
+  toRaw(x, y, &fx, &fy);
+  for (int32_t i = 0; i < 8; i++) {
+    sx += fx + 6 * gauss(t + i, 10);
+    sy += fy + 6 * gauss(t + i, 12);
+  }
+  *rx = sx / 8 + 0.5f;
+  *ry = sy / 8 + 0.5f;
+}
+
+/***************************************************************************************
+** Model of the getTouch() code in Extensions/Touch.cpp, delays advance the clock
+***************************************************************************************/
+struct Legacy {
+  uint32_t t = 0, pressTime = 0;
+  uint16_t x0, x1, y0, y1;
+  bool     rotate, invertX, invertY;
+
+  bool validTouch(uint16_t* x, uint16_t* y, uint16_t threshold)
+  {
+    uint16_t z1 = 1, z2 = 0;
+    while (z1 > z2) { z2 = z1; z1 = sampleAt(t).z; t += 1; }
+    if (z1 <= threshold) return false;
+    Sample a = sampleAt(t);
+    t += 1;
+    if (sampleAt(t).z <= threshold) return false;
+    t += 2;
+    Sample b = sampleAt(t);
+    if (abs(a.rawX - b.rawX) > 20 || abs(a.rawY - b.rawY) > 20) return false;
+    *x = a.rawX;
+    *y = a.rawY;
+    return true;
+  }
+
+  bool getTouch(int16_t* x, int16_t* y)
+  {
+    uint16_t threshold = 600, rx = 0, ry = 0;
+    if (pressTime > t) threshold = 20;
+    uint8_t valid = 0;
+    for (int32_t n = 0; n < 5; n++) if (validTouch(&rx, &ry, threshold)) valid++;
+    if (!valid) { pressTime = 0; return false; }
+    pressTime = t + 50;
+    convert(rx, ry, x, y);
+    return *x >= 0 && *x < W && *y >= 0 && *y < H;
+  }
+
+  void convert(uint16_t rx, uint16_t ry, int16_t* x, int16_t* y)
+  {
+    uint16_t xx, yy;
+    xx = ((rotate ? ry : rx) - x0) * W / x1;
+    yy = ((rotate ? rx : ry) - y0) * H / y1;
+    if (invertX) xx = W - xx;
+    if (invertY) yy = H - yy;
+    *x = (int16_t)xx;
+    *y = (int16_t)yy;
+  }
+
+  // calibrateTouch() with targets at the corners
+  void calibrate(uint32_t t)
+  {
+    int32_t v[8];
+    const float cx[4] = { 0, 0, W - 1, W - 1 }, cy[4] = { 0, H - 1, 0, H - 1 };
+    for (int32_t i = 0; i < 4; i++) {
+      uint16_t rx, ry;
+      target(cx[i], cy[i], t + 100 * i, &rx, &ry);
+      v[i * 2] = rx;
+      v[i * 2 + 1] = ry;
+    }
+    rotate = abs(v[0] - v[2]) > abs(v[1] - v[3]);
+    if (rotate) { x0 = (v[1] + v[3]) / 2; x1 = (v[5] + v[7]) / 2; y0 = (v[0] + v[4]) / 2; y1 = (v[2] + v[6]) / 2; }
+    else        { x0 = (v[0] + v[2]) / 2; x1 = (v[4] + v[6]) / 2; y0 = (v[1] + v[5]) / 2; y1 = (v[3] + v[7]) / 2; }
+    invertX = x0 > x1;
+    if (invertX) { uint16_t s = x0; x0 = x1; x1 = s; }
+    invertY = y0 > y1;
+    if (invertY) { uint16_t s = y0; y0 = y1; y1 = s; }
+    x1 -= x0;
+    y1 -= y0;
+  }
+};
+
+// Filter calibration from 3 or 5 targets 1/8 in from the corners
+static void calibrate(TFT_eTouchFilter& filter, uint8_t n, uint32_t t)
+{
+  int16_t  sx[5] = { W / 8, W - W / 8, W / 8, W - W / 8, W / 2 };
+  int16_t  sy[5] = { H / 8, H / 8, H - H / 8, H - H / 8, H / 2 };
+  uint16_t rx[5], ry[5];
+  for (int32_t i = 0; i < 5; i++) target(sx[i], sy[i], t + 100 * i, &rx[i], &ry[i]);
+  filter.calibrate(sx, sy, rx, ry, n);
+}
+
+// Calibration error over a grid of noise free points
+template <typename F> static void calError(F convert, double* mean, double* max)
+{
+  *mean = *max = 0;
+  int32_t n = 0;
+  for (int32_t y = 0; y < H; y += 8) {
+    for (int32_t x = 0; x < W; x += 8) {
+      float fx, fy;
+      int16_t cx, cy;
+      toRaw(x, y, &fx, &fy);
+      convert(fx + 0.5f, fy + 0.5f, &cx, &cy);
+      double e = sqrt((cx - x) * (cx - x) + (cy - y) * (cy - y));
+      *mean += e;
+      if (e > *max) *max = e;
+      n++;
+    }
+  }
+  *mean /= n;
+}
+
+struct Result {
+  uint32_t detected = 0, falsePress = 0;
+  double   pressMs = 0, releaseMs = 0, posErr = 0, jitter = 0, waitUs = 0;
+  uint32_t positions = 0;
+};
+
+// Score press and release events against the trace
+struct Scorer {
+  std::vector<uint32_t> press, release;
+  std::vector<double>   holdX, holdY;
+  double   err2 = 0;
+  uint32_t n = 0;
+
+  // Position the sketch would draw at time t
+  void position(uint32_t t, int16_t x, int16_t y)
+  {
+    Sample s = sampleAt(t);
+    if (!s.touched) return;
+    err2 += (x - s.x) * (x - s.x) + (y - s.y) * (y - s.y);
+    n++;
+    const Touch& hold = touches.back();
+    if (t > hold.start + 100 && t < hold.start + hold.len - 50) { holdX.push_back(x); holdY.push_back(y); }
+  }
+
+  void score(Result& r)
+  {
+    uint32_t matched = 0;
+    for (const Touch& c : touches) {
+      for (uint32_t p : press) {
+        if (p >= c.start && p < c.start + c.len + 60) {
+          r.detected++;
+          r.pressMs += p - c.start;
+          break;
+        }
+      }
+      for (uint32_t p : release) {
+        if (p >= c.start + c.len && p < c.start + c.len + 100) {
+          r.releaseMs += p - c.start - c.len;
+          matched++;
+          break;
+        }
+      }
+    }
+    r.falsePress = press.size() > r.detected ? press.size() - r.detected : 0;
+    if (r.detected) r.pressMs /= r.detected;
+    if (matched) r.releaseMs /= matched;
+    r.posErr = n ? sqrt(err2 / n) : 0;
+    r.positions = n;
+
+    double mx = 0, my = 0, v = 0;
+    for (size_t i = 0; i < holdX.size(); i++) { mx += holdX[i]; my += holdY[i]; }
+    if (holdX.size()) {
+      mx /= holdX.size();
+      my /= holdX.size();
+      for (size_t i = 0; i < holdX.size(); i++) v += (holdX[i] - mx) * (holdX[i] - mx) + (holdY[i] - my) * (holdY[i] - my);
+      r.jitter = sqrt(v / holdX.size());
+    }
+  }
+};
+
+static Result runLegacy(Legacy& legacy)
+{
+  Result r;
+  Scorer s;
+  bool down = false;
+  uint64_t waits = 0, calls = 0;
+  legacy.t = 0;
+
+  while (legacy.t < END) {
+    uint32_t t0 = legacy.t;
+    int16_t x, y;
+    bool pressed = legacy.getTouch(&x, &y);
+    waits += legacy.t - t0;
+    calls++;
+    if (pressed && !down) s.press.push_back(legacy.t);
+    if (!pressed && down) s.release.push_back(t0);
+    if (pressed) s.position(legacy.t, x, y);
+    down = pressed;
+    legacy.t += FRAME;
+  }
+
+  s.score(r);
+  r.waitUs = 1000.0 * waits / calls;
+  return r;
+}
+
+static Result runFilter(TFT_eTouchFilter& filter)
+{
+  Result r;
+  Scorer s;
+  double us = 0;
+  filter.clear();
+
+  for (uint32_t t = 0; t < END; t += PERIOD) {
+    Sample smp = sampleAt(t);
+    auto t0 = std::chrono::steady_clock::now();
+    filter.addSample(t, smp.rawX, smp.rawY, smp.z);
+    auto t1 = std::chrono::steady_clock::now();
+    us += std::chrono::duration<double, std::micro>(t1 - t0).count();
+
+    touch_event_t e;
+    while (filter.getEvent(&e)) {
+      if (e.type == TOUCH_PRESS) s.press.push_back(e.time);
+      if (e.type == TOUCH_RELEASE) s.release.push_back(e.time);
+    }
+
+    // Position drawn by each frame
+    int16_t x, y;
+    if (t % FRAME == 0 && filter.getPoint(&x, &y)) s.position(t, x, y);
+  }
+
+  s.score(r);
+  r.waitUs = us / (END / PERIOD) * (FRAME / PERIOD); // Filter time per frame
+  return r;
+}
+
+static void report(const char* name, const Result& r, double calMean, double calMax)
+{
+  Serial.printf("%-16s %5.2f/%5.2f %5u/%-5u %7.1f %8.1f %8.2f %7.2f %10.1f\n", name, calMean, calMax, r.detected,
+                r.falsePress, r.pressMs, r.releaseMs, r.posErr, r.jitter, r.waitUs);
+}
+
+int main(int argc, char* argv[])
+{
+  makeTrace();
+
+  Legacy legacy;
+  legacy.calibrate(100000);
+
+  TFT_eTouchFilter filter;
+
+  // Replay a trace file
+  if (argc > 1) {
+    FILE* f = fopen(argv[1], "r");
+    if (!f) { Serial.printf("Cannot open %s\n", argv[1]); return 1; }
+    calibrate(filter, 5, 100000);
+    uint32_t t, x, y, z;
+    const char* names[] = { "", "press", "move", "release" };
+    while (fscanf(f, "%u,%u,%u,%u", &t, &x, &y, &z) == 4) {
+      filter.addSample(t, x, y, z);
+      touch_event_t e;
+      while (filter.getEvent(&e)) Serial.printf("%8u %-8s %4d %4d %5u\n", e.time, names[e.type], e.x, e.y, e.z);
+    }
+    fclose(f);
+    return 0;
+  }
+
+  Serial.printf("%d touches, %d ms, filter sample period %d ms, getTouch() every %d ms + call time\n",
+                (int)touches.size(), END, PERIOD, FRAME);
+  Serial.printf("%-16s %11s %11s %7s %8s %8s %7s %10s\n", "method", "cal_err", "touches", "press", "release",
+                "pos_rms", "jitter", "wait_us");
+
+  double mean, max;
+  calError([&](uint16_t rx, uint16_t ry, int16_t* x, int16_t* y) { legacy.convert(rx, ry, x, y); }, &mean, &max);
+  report("getTouch", runLegacy(legacy), mean, max);
+
+  struct Test { const char* name; uint8_t points; uint16_t weight; uint8_t debounce; };
+  const Test tests[] = {
+    { "filter/3pt",     3, 128, 2 },
+    { "filter/5pt",     5, 128, 2 },
+    { "filter/5pt/raw", 5, 256, 1 }, // No IIR smoothing or debounce, median only
+    { "filter/5pt/64",  5,  64, 2 },
+  };
+  for (const Test& test : tests) {
+    calibrate(filter, test.points, 100000);
+    filter.setSmoothing(test.weight);
+    filter.setDebounce(test.debounce);
+    calError([&](uint16_t rx, uint16_t ry, int16_t* x, int16_t* y) { filter.convert(rx, ry, x, y); }, &mean, &max);
+    report(test.name, runFilter(filter), mean, max);
+  }
+
+  return 0;
+}
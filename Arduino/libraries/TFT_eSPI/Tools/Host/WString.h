@@ -0,0 +1,42 @@
+        ////////////////////////////////////////////////////
+        //   Minimal Arduino String class for host builds //
+        ////////////////////////////////////////////////////
+
+#ifndef _HOST_WSTRING_H_
+#define _HOST_WSTRING_H_
+
+#include <string>
+
+// Only the String members used by TFT_eSPI and the host benchmarks are provided
+class String {
+ public:
+  String(const char *s = "") : str(s ? s : "") {}
+  String(const std::string &s) : str(s) {}
+  String(char c) : str(1, c) {}
+  String(int v, unsigned char base = 10)           { fromLong(v, base); }
+  String(unsigned int v, unsigned char base = 10)  { fromLong(v, base); }
+  String(long v, unsigned char base = 10)          { fromLong(v, base); }
+  String(unsigned long v, unsigned char base = 10) { fromLong(v, base); }
+  String(double v, unsigned char dp = 2);
+
+  unsigned int length(void) const { return str.length(); }
+  const char  *c_str(void)  const { return str.c_str(); }
+
+  void toCharArray(char *buf, unsigned int bufsize, unsigned int index = 0) const;
+
+  char operator[](unsigned int i) const { return i < str.length() ? str[i] : 0; }
+  bool operator==(const String &rhs) const { return str == rhs.str; }
+  bool operator!=(const String &rhs) const { return str != rhs.str; }
+
+  String &operator+=(const String &rhs) { str += rhs.str; return *this; }
+  friend String operator+(const String &lhs, const String &rhs) { return String(lhs.str + rhs.str); }
+
+  bool endsWith(const String &suffix) const;
+  bool startsWith(const String &prefix) const { return str.compare(0, prefix.str.length(), prefix.str) == 0; }
+
+ private:
+  void fromLong(long v, unsigned char base);
+  std::string str;
+};
+
+#endif // _HOST_WSTRING_H_
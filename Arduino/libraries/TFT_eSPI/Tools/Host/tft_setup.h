@@ -0,0 +1,39 @@
+// Setup for the host (PC) build, picked up by TFT_eSPI.h through __has_include(<tft_setup.h>)
+// This mirrors the ESP32-S3-Touch-LCD-1.28 board: GC9A01 240 x 240 round panel on SPI
+
+#define USER_SETUP_ID 300
+#define USER_SETUP_INFO "Host_GC9A01"
+
+#define GC9A01_DRIVER
+
+#define TFT_WIDTH  240
+#define TFT_HEIGHT 240
+
+// Pin numbers are not used by the host backend, they are kept to match the board
+#define TFT_MISO 12
+#define TFT_MOSI 11
+#define TFT_SCLK 10
+#define TFT_CS    9  // Chip select control pin
+#define TFT_DC    8  // Data Command control pin
+#define TFT_RST  14  // Reset pin
+#define TFT_BL    2  // LED back-light
+
+#define LOAD_GLCD   // Font 1. Original Adafruit 8 pixel font needs ~1820 bytes in FLASH
+#define LOAD_FONT2  // Font 2. Small 16 pixel high font, needs ~3534 bytes in FLASH, 96 characters
+#define LOAD_FONT4  // Font 4. Medium 26 pixel high font, needs ~5848 bytes in FLASH, 96 characters
+#define LOAD_FONT6  // Font 6. Large 48 pixel font, needs ~2666 bytes in FLASH, only characters 1234567890:-.apm
+#define LOAD_FONT7  // Font 7. 7 segment 48 pixel font, needs ~2438 bytes in FLASH, only characters 1234567890:.
+#define LOAD_FONT8  // Font 8. Large 75 pixel font needs ~3256 bytes in FLASH, only characters 1234567890:-.
+#define LOAD_GFXFF  // FreeFonts. Include access to the 48 Adafruit_GFX free fonts FF1 to FF48 and custom fonts
+#define SPAN_FONTS  // Draw fonts 4, 6, 7 and 8 from span lists
+
+#define SMOOTH_FONT
+
+// Used by the host backend to convert bus byte counts to an estimated transfer time
+#define SPI_FREQUENCY  80000000
+#define SPI_READ_FREQUENCY  20000000
+
+#define DISABLE_ALL_LIBRARY_WARNINGS
+
+// Buffer adjacent pixel runs, the benchmark compares with and without
+#define WRITE_COMBINE_PIXELS 64
@@ -316,6 +316,13 @@
 //#define LOAD_FONT8N // Font 8. Alternative to Font 8 above, slightly narrower, so 3 digits fit a 160 pixel TFT
 #define LOAD_GFXFF  // FreeFonts. Include access to the 48 Adafruit_GFX free fonts FF1 to FF48 and custom fonts
 
+// Uncomment to draw the RLE fonts (4, 6, 7 and 8) from precompiled lists of horizontal
+// spans (Fonts/Font*span.h) instead of decoding the runs pixel by pixel. Transparent text
+// is drawn with one line per span and opaque text is built in a line buffer and pushed.
+// Needs about 1.5 times the FLASH of the RLE fonts loaded, e.g. ~2 kbytes for Font 7.
+// Use tft.setAttribute(SPAN_FONT, false) to turn off at run time.
+//#define SPAN_FONTS
+
 // Comment out the #define below to stop the SPIFFS filing system and smooth font code being loaded
 // this will save ~20kbytes of FLASH
 #define SMOOTH_FONT
@@ -387,3 +394,11 @@
 // so changing it here has no effect
 
 // #define SUPPORT_TRANSACTIONS
+
+// Uncomment to buffer adjacent pixels and short lines on the same row or column so
+// they are sent to the TFT with one address window (CASET/PASET/RAMWR commands).
+// This reduces the command overhead of anti-aliased and pixel by pixel graphics.
+// The buffer is flushed by endWrite(), when full, or before any other TFT access.
+// Each TFT_eSPI and TFT_eSprite instance needs 2 bytes of RAM per buffered pixel.
+// Use tft.setAttribute(WRITE_COMBINE, false) to turn off at run time.
+// #define WRITE_COMBINE_PIXELS 64
@@ -43,6 +43,12 @@ target_include_directories(lvgl_examples SYSTEM
 target_include_directories(lvgl_demos SYSTEM
                            PUBLIC ${LVGL_ROOT_DIR}/demos)
 
+# The parallel refresh (LV_USE_PARALLEL_REFR) needs POSIX threads
+find_package(Threads)
+if(Threads_FOUND)
+  target_link_libraries(lvgl PUBLIC Threads::Threads)
+endif()
+
 target_link_libraries(lvgl_examples PUBLIC lvgl)
 target_link_libraries(lvgl_demos PUBLIC lvgl)
 
@@ -8,12 +8,16 @@
  *********************/
 #include "lv_obj.h"
 #include "lv_indev.h"
+#include "../misc/lv_thread.h"
 
 /*********************
  *      DEFINES
  *********************/
 #define MY_CLASS &lv_obj_class
 
+/*The bit of an event code in `event_mask`. Different codes can share a bit.*/
+#define EVENT_MASK_BIT(code) ((uint32_t)1 << ((code) & 0x1F))
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -29,12 +33,15 @@ typedef struct _lv_event_dsc_t {
 static lv_event_dsc_t * lv_obj_get_event_dsc(const lv_obj_t * obj, uint32_t id);
 static lv_res_t event_send_core(lv_event_t * e);
 static bool event_is_bubbled(lv_event_t * e);
-
+static void event_mask_update(lv_obj_t * obj);
+static bool event_has_user_cb(const lv_obj_t * obj, lv_event_code_t code);
+static uint32_t get_class_skip_flag(lv_event_code_t code);
 
 /**********************
  *  STATIC VARIABLES
  **********************/
-static lv_event_t * event_head;
+static LV_THREAD_LOCAL lv_event_t * event_head;
+static bool fast_path_en = true;
 
 /**********************
  *      MACROS
@@ -87,8 +94,9 @@ lv_res_t lv_obj_event_base(const lv_obj_class_t * class_p, lv_event_t * e)
     if(class_p == NULL) base = e->current_target->class_p;
     else base = class_p->base_class;
 
-    /*Find a base in which call the ancestor's event handler_cb if set*/
-    while(base && base->event_cb == NULL) base = base->base_class;
+    /*Find a base in which call the ancestor's event handler_cb if set and handles this event*/
+    uint32_t skip = fast_path_en ? get_class_skip_flag(e->code & ~LV_EVENT_PREPROCESS) : 0;
+    while(base && (base->event_cb == NULL || (base->event_skip & skip))) base = base->base_class;
 
     if(base == NULL) return LV_RES_OK;
     if(base->event_cb == NULL) return LV_RES_OK;
@@ -104,6 +112,15 @@ lv_res_t lv_obj_event_base(const lv_obj_class_t * class_p, lv_event_t * e)
     return res;
 }
 
+void lv_event_enable_fast_path(bool en)
+{
+    fast_path_en = en;
+}
+
+bool lv_event_is_fast_path_enabled(void)
+{
+    return fast_path_en;
+}
 
 lv_obj_t * lv_event_get_target(lv_event_t * e)
 {
@@ -173,6 +190,7 @@ struct _lv_event_dsc_t * lv_obj_add_event_cb(lv_obj_t * obj, lv_event_cb_t event
     obj->spec_attr->event_dsc[obj->spec_attr->event_dsc_cnt - 1].cb = event_cb;
     obj->spec_attr->event_dsc[obj->spec_attr->event_dsc_cnt - 1].filter = filter;
     obj->spec_attr->event_dsc[obj->spec_attr->event_dsc_cnt - 1].user_data = user_data;
+    event_mask_update(obj);
 
     return &obj->spec_attr->event_dsc[obj->spec_attr->event_dsc_cnt - 1];
 }
@@ -193,6 +211,7 @@ bool lv_obj_remove_event_cb(lv_obj_t * obj, lv_event_cb_t event_cb)
             obj->spec_attr->event_dsc = lv_mem_realloc(obj->spec_attr->event_dsc,
                                                        obj->spec_attr->event_dsc_cnt * sizeof(lv_event_dsc_t));
             LV_ASSERT_MALLOC(obj->spec_attr->event_dsc);
+            event_mask_update(obj);
             return true;
         }
     }
@@ -218,6 +237,7 @@ bool lv_obj_remove_event_cb_with_user_data(lv_obj_t * obj, lv_event_cb_t event_c
             obj->spec_attr->event_dsc = lv_mem_realloc(obj->spec_attr->event_dsc,
                                                        obj->spec_attr->event_dsc_cnt * sizeof(lv_event_dsc_t));
             LV_ASSERT_MALLOC(obj->spec_attr->event_dsc);
+            event_mask_update(obj);
             return true;
         }
     }
@@ -243,6 +263,7 @@ bool lv_obj_remove_event_dsc(lv_obj_t * obj, struct _lv_event_dsc_t * event_dsc)
             obj->spec_attr->event_dsc = lv_mem_realloc(obj->spec_attr->event_dsc,
                                                        obj->spec_attr->event_dsc_cnt * sizeof(lv_event_dsc_t));
             LV_ASSERT_MALLOC(obj->spec_attr->event_dsc);
+            event_mask_update(obj);
             return true;
         }
     }
@@ -436,7 +457,8 @@ static lv_res_t event_send_core(lv_event_t * e)
     }
 
     lv_res_t res = LV_RES_OK;
-    lv_event_dsc_t * event_dsc = lv_obj_get_event_dsc(e->current_target, 0);
+    lv_event_dsc_t * event_dsc = event_has_user_cb(e->current_target, e->code) ?
+                                 lv_obj_get_event_dsc(e->current_target, 0) : NULL;
 
     uint32_t i = 0;
     while(event_dsc && res == LV_RES_OK) {
@@ -457,7 +479,8 @@ static lv_res_t event_send_core(lv_event_t * e)
 
     res = lv_obj_event_base(NULL, e);
 
-    event_dsc = res == LV_RES_INV ? NULL : lv_obj_get_event_dsc(e->current_target, 0);
+    event_dsc = res == LV_RES_INV || !event_has_user_cb(e->current_target, e->code) ?
+                NULL : lv_obj_get_event_dsc(e->current_target, 0);
 
     i = 0;
     while(event_dsc && res == LV_RES_OK) {
@@ -525,3 +548,51 @@ static bool event_is_bubbled(lv_event_t * e)
             return true;
     }
 }
+
+static void event_mask_update(lv_obj_t * obj)
+{
+    uint32_t mask = 0;
+    uint32_t i;
+    for(i = 0; i < obj->spec_attr->event_dsc_cnt; i++) {
+        lv_event_code_t filter = obj->spec_attr->event_dsc[i].filter & ~LV_EVENT_PREPROCESS;
+        if(filter == LV_EVENT_ALL) {
+            mask = UINT32_MAX;
+            break;
+        }
+        mask |= EVENT_MASK_BIT(filter);
+    }
+
+    obj->spec_attr->event_mask = mask;
+}
+
+/*Tell whether the user callbacks of `obj` need to be walked for `code`.
+ *Most objects have no callbacks for the frequent events (drawing, cover check, etc.)*/
+static bool event_has_user_cb(const lv_obj_t * obj, lv_event_code_t code)
+{
+    if(obj->spec_attr == NULL) return false;
+    if(!fast_path_en) return true;
+    return (obj->spec_attr->event_mask & EVENT_MASK_BIT(code)) != 0;
+}
+
+/*Get which flag of `lv_obj_class_t::event_skip` tells that a class doesn't handle `code`*/
+static uint32_t get_class_skip_flag(lv_event_code_t code)
+{
+    switch(code) {
+        case LV_EVENT_HIT_TEST:
+            return LV_OBJ_CLASS_EVENT_SKIP_HIT_TEST;
+        case LV_EVENT_COVER_CHECK:
+            return LV_OBJ_CLASS_EVENT_SKIP_COVER_CHECK;
+        case LV_EVENT_DRAW_MAIN_BEGIN:
+        case LV_EVENT_DRAW_MAIN_END:
+        case LV_EVENT_DRAW_POST_BEGIN:
+        case LV_EVENT_DRAW_POST_END:
+            return LV_OBJ_CLASS_EVENT_SKIP_DRAW_BEGIN_END;
+        case LV_EVENT_DRAW_PART_BEGIN:
+        case LV_EVENT_DRAW_PART_END:
+            return LV_OBJ_CLASS_EVENT_SKIP_DRAW_PART;
+        case LV_EVENT_GET_SELF_SIZE:
+            return LV_OBJ_CLASS_EVENT_SKIP_GET_SELF_SIZE;
+        default:
+            return 0;
+    }
+}
@@ -153,6 +153,21 @@ lv_res_t lv_event_send(struct _lv_obj_t * obj, lv_event_code_t event_code, void
  */
 lv_res_t lv_obj_event_base(const lv_obj_class_t * class_p, lv_event_t * e);
 
+/**
+ * Enable or disable skipping the event handlers which can't handle an event.
+ * If enabled, the user callbacks are walked only if the object has a callback for the event
+ * and the class event handlers are skipped if the class tells it doesn't handle the event
+ * (see `event_skip` in ::lv_obj_class_t).
+ * @param en        true: skip the handlers (default); false: call all handlers
+ */
+void lv_event_enable_fast_path(bool en);
+
+/**
+ * Tell whether the event handlers which can't handle an event are skipped
+ * @return          true: the fast path is enabled
+ */
+bool lv_event_is_fast_path_enabled(void);
+
 /**
  * Get the object originally targeted by the event. It's the same even if the event is bubbled.
  * @param e     pointer to the event descriptor
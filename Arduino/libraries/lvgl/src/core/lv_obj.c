@@ -74,12 +74,14 @@ const lv_obj_class_t lv_obj_class = {
     .constructor_cb = lv_obj_constructor,
     .destructor_cb = lv_obj_destructor,
     .event_cb = lv_obj_event,
+    .event_skip = LV_OBJ_CLASS_EVENT_SKIP_ALL & ~LV_OBJ_CLASS_EVENT_SKIP_COVER_CHECK,
     .width_def = LV_DPI_DEF,
     .height_def = LV_DPI_DEF,
     .editable = LV_OBJ_CLASS_EDITABLE_FALSE,
     .group_def = LV_OBJ_CLASS_GROUP_DEF_FALSE,
     .instance_size = (sizeof(lv_obj_t)),
     .base_class = NULL,
+    .parallel_draw = 1,
 };
 
 /**********************
@@ -196,6 +198,9 @@ void lv_init(void)
 
 void lv_deinit(void)
 {
+#if LV_USE_PARALLEL_REFR
+    _lv_refr_deinit();
+#endif
     _lv_gc_clear_roots();
 
     lv_disp_set_default(NULL);
@@ -457,6 +462,9 @@ static void lv_obj_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     lv_obj_enable_style_refresh(false); /*No need to refresh the style because the object will be deleted*/
     lv_obj_remove_style_all(obj);
     lv_obj_enable_style_refresh(true);
+#if LV_OBJ_STYLE_CACHE_SIZE
+    _lv_obj_style_cache_free(obj);
+#endif
 
     /*Remove the animations from this object*/
     lv_anim_del(obj, NULL);
@@ -890,6 +898,11 @@ static void lv_obj_set_state(lv_obj_t * obj, lv_state_t new_state)
     /*If there is no difference in styles there is nothing else to do*/
     if(cmp_res == _LV_STYLE_STATE_CMP_SAME) return;
 
+#if LV_OBJ_STYLE_CACHE_SIZE
+    /*The entries are stored per state, but the children might inherit the changed properties*/
+    _lv_obj_style_cache_invalidate(obj, LV_PART_MAIN, LV_STYLE_PROP_ANY);
+#endif
+
     _lv_obj_style_transition_dsc_t * ts = lv_mem_buf_get(sizeof(_lv_obj_style_transition_dsc_t) * STYLE_TRANSITION_MAX);
     lv_memset_00(ts, sizeof(_lv_obj_style_transition_dsc_t) * STYLE_TRANSITION_MAX);
     uint32_t tsi = 0;
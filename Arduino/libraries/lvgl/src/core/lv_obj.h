@@ -158,6 +158,7 @@ typedef struct {
     lv_group_t * group_p;
 
     struct _lv_event_dsc_t * event_dsc; /**< Dynamically allocated event callback and user data array*/
+    uint32_t event_mask;                /**< Bit `code % 32` is set if `event_dsc` might have a callback for `code`*/
     lv_point_t scroll;                  /**< The current X/Y scroll offset*/
 
     lv_coord_t ext_click_pad;           /**< Extra click padding in all direction*/
@@ -176,6 +177,9 @@ typedef struct _lv_obj_t {
     struct _lv_obj_t * parent;
     _lv_obj_spec_attr_t * spec_attr;
     _lv_obj_style_t * styles;
+#if LV_OBJ_STYLE_CACHE_SIZE
+    _lv_obj_style_cache_t * style_cache;
+#endif
 #if LV_USE_USER_DATA
     void * user_data;
 #endif
@@ -189,6 +193,13 @@ typedef struct _lv_obj_t {
     uint16_t h_layout   : 1;
     uint16_t w_layout   : 1;
     uint16_t being_deleted   : 1;
+#if LV_LAYOUT_CACHE
+    uint16_t layout_child_inv : 1;  /*A descendant's layout is invalidated*/
+#endif
+#if LV_REFR_OCCLUDER_MAX
+    uint16_t refr_culled : 1;       /*Covered on the area being refreshed, don't draw it with its children*/
+    uint16_t refr_main_clip : 1;    /*Partly covered on the area being refreshed, draw its main part on a smaller area*/
+#endif
 } lv_obj_t;
 
 
@@ -41,6 +41,20 @@ typedef enum {
     LV_OBJ_CLASS_GROUP_DEF_FALSE,
 } lv_obj_class_group_def_t;
 
+/**
+ * Frequent events which are handled only by a few classes.
+ * If a class's `event_cb` doesn't handle them, they can be sent directly to the base class.
+ */
+typedef enum {
+    LV_OBJ_CLASS_EVENT_SKIP_NONE = 0x00,            /**< Call `event_cb` for all events. Must have 0 value to let zero initialized class be called*/
+    LV_OBJ_CLASS_EVENT_SKIP_HIT_TEST = 0x01,        /**< `LV_EVENT_HIT_TEST`*/
+    LV_OBJ_CLASS_EVENT_SKIP_COVER_CHECK = 0x02,     /**< `LV_EVENT_COVER_CHECK`*/
+    LV_OBJ_CLASS_EVENT_SKIP_DRAW_BEGIN_END = 0x04,  /**< `LV_EVENT_DRAW_MAIN/POST_BEGIN` and `LV_EVENT_DRAW_MAIN/POST_END`*/
+    LV_OBJ_CLASS_EVENT_SKIP_DRAW_PART = 0x08,       /**< `LV_EVENT_DRAW_PART_BEGIN/END`*/
+    LV_OBJ_CLASS_EVENT_SKIP_GET_SELF_SIZE = 0x10,   /**< `LV_EVENT_GET_SELF_SIZE`*/
+    LV_OBJ_CLASS_EVENT_SKIP_ALL = 0x1F,
+} lv_obj_class_event_skip_t;
+
 typedef void (*lv_obj_class_event_cb_t)(struct _lv_obj_class_t * class_p, struct _lv_event_t * e);
 /**
  * Describe the common methods of every object.
@@ -59,7 +73,9 @@ typedef struct _lv_obj_class_t {
     lv_coord_t height_def;
     uint32_t editable : 2;             /**< Value from ::lv_obj_class_editable_t*/
     uint32_t group_def : 2;            /**< Value from ::lv_obj_class_group_def_t*/
+    uint32_t event_skip : 5;           /**< OR-ed values from ::lv_obj_class_event_skip_t: events not handled by `event_cb`*/
     uint32_t instance_size : 16;
+    uint32_t parallel_draw : 1;        /**< Drawing doesn't change a shared state so more threads can draw it at once (`LV_USE_PARALLEL_REFR`)*/
 } lv_obj_class_t;
 
 /**********************
@@ -32,6 +32,10 @@ static void transform_point(const lv_obj_t * obj, lv_point_t * p, bool inv);
  *  STATIC VARIABLES
  **********************/
 static uint32_t layout_cnt;
+#if LV_LAYOUT_CACHE
+    static bool layout_cache_en = true;
+    static lv_obj_layout_stat_t layout_stat;
+#endif
 
 /**********************
  *      MACROS
@@ -289,8 +293,15 @@ void lv_obj_mark_layout_as_dirty(lv_obj_t * obj)
 {
     obj->layout_inv = 1;
 
-    /*Mark the screen as dirty too to mark that there is something to do on this screen*/
-    lv_obj_t * scr = lv_obj_get_screen(obj);
+    /*Mark the ancestors too to find the invalidated objects without walking the whole screen.
+     *Mark the screen as dirty too to mark that there is something to do on this screen*/
+    lv_obj_t * scr = obj;
+    while(scr->parent) {
+        scr = scr->parent;
+#if LV_LAYOUT_CACHE
+        scr->layout_child_inv = 1;
+#endif
+    }
     scr->scr_layout_inv = 1;
 
     /*Make the display refreshing*/
@@ -320,6 +331,28 @@ void lv_obj_update_layout(const lv_obj_t * obj)
     mutex = false;
 }
 
+#if LV_LAYOUT_CACHE
+void lv_obj_enable_layout_cache(bool en)
+{
+    layout_cache_en = en;
+}
+
+bool lv_obj_is_layout_cache_enabled(void)
+{
+    return layout_cache_en;
+}
+
+void lv_obj_layout_get_stat(lv_obj_layout_stat_t * stat)
+{
+    *stat = layout_stat;
+}
+
+void lv_obj_layout_reset_stat(void)
+{
+    lv_memset_00(&layout_stat, sizeof(layout_stat));
+}
+#endif
+
 uint32_t lv_layout_register(lv_layout_update_cb_t cb, void * user_data)
 {
     layout_cnt++;
@@ -1130,6 +1163,13 @@ static lv_coord_t calc_content_height(lv_obj_t * obj)
 
 static void layout_update_core(lv_obj_t * obj)
 {
+#if LV_LAYOUT_CACHE
+    /*Skip the subtrees without invalidated layout*/
+    if(layout_cache_en && obj->layout_inv == 0 && obj->layout_child_inv == 0) return;
+    obj->layout_child_inv = 0;
+    layout_stat.visited++;
+#endif
+
     uint32_t i;
     uint32_t child_cnt = lv_obj_get_child_cnt(obj);
     for(i = 0; i < child_cnt; i++) {
@@ -1140,6 +1180,9 @@ static void layout_update_core(lv_obj_t * obj)
     if(obj->layout_inv == 0) return;
 
     obj->layout_inv = 0;
+#if LV_LAYOUT_CACHE
+    layout_stat.updated++;
+#endif
 
     lv_obj_refr_size(obj);
     lv_obj_refr_pos(obj);
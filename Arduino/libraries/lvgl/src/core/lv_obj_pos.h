@@ -30,6 +30,13 @@ typedef struct {
     void * user_data;
 } lv_layout_dsc_t;
 
+#if LV_LAYOUT_CACHE
+typedef struct {
+    uint32_t visited;   /*Objects visited while searching the invalidated layouts*/
+    uint32_t updated;   /*Objects whose size, position and layout were updated*/
+} lv_obj_layout_stat_t;
+#endif
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -152,6 +159,32 @@ void lv_obj_mark_layout_as_dirty(struct _lv_obj_t * obj);
  */
 void lv_obj_update_layout(const struct _lv_obj_t * obj);
 
+#if LV_LAYOUT_CACHE
+/**
+ * Enable or disable updating the layouts incrementally and caching the measured sizes.
+ * If disabled the whole screen is walked on each layout update and the sizes are always measured.
+ * @param en        true: update incrementally (default); false: update the whole screen
+ */
+void lv_obj_enable_layout_cache(bool en);
+
+/**
+ * Tell whether the layouts are updated incrementally and the measured sizes are cached
+ * @return          true: the layout cache is enabled
+ */
+bool lv_obj_is_layout_cache_enabled(void);
+
+/**
+ * Get the statistics of the layout updates since the last `lv_obj_layout_reset_stat()`
+ * @param stat      store the statistics here
+ */
+void lv_obj_layout_get_stat(lv_obj_layout_stat_t * stat);
+
+/**
+ * Reset the statistics of the layout updates
+ */
+void lv_obj_layout_reset_stat(void);
+#endif
+
 /**
  * Register a new layout
  * @param cb        the layout update callback
@@ -9,12 +9,17 @@
 #include "lv_obj.h"
 #include "lv_disp.h"
 #include "../misc/lv_gc.h"
+#include "../misc/lv_thread.h"
 
 /*********************
  *      DEFINES
  *********************/
 #define MY_CLASS &lv_obj_class
 
+#if LV_OBJ_STYLE_CACHE_SIZE & (LV_OBJ_STYLE_CACHE_SIZE - 1)
+    #error "LV_OBJ_STYLE_CACHE_SIZE needs to be a power of 2"
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -45,6 +50,10 @@ typedef enum {
 static lv_style_t * get_local_style(lv_obj_t * obj, lv_style_selector_t selector);
 static _lv_obj_style_t * get_trans_style(lv_obj_t * obj, uint32_t part);
 static lv_style_res_t get_prop_core(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop, lv_style_value_t * v);
+static lv_style_value_t resolve_prop(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop);
+#if LV_OBJ_STYLE_CACHE_SIZE
+    static _lv_obj_style_cache_entry_t * get_cache_entry(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop);
+#endif
 static void report_style_change_core(void * style, lv_obj_t * obj);
 static void refresh_children_style(lv_obj_t * obj);
 static bool trans_del(lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop, trans_t * tr_limit);
@@ -59,6 +68,11 @@ static void fade_in_anim_ready(lv_anim_t * a);
  *  STATIC VARIABLES
  **********************/
 static bool style_refr = true;
+#if LV_OBJ_STYLE_CACHE_SIZE
+    static bool style_cache_en = true;
+    static lv_obj_style_cache_stat_t cache_stat;
+    static uint32_t cache_gen = 1;    /*Incremented to clear all the caches. 0 is skipped, it marks the cleared caches*/
+#endif
 
 /**********************
  *      MACROS
@@ -152,7 +166,17 @@ void lv_obj_remove_style(lv_obj_t * obj, lv_style_t * style, lv_style_selector_t
 
 void lv_obj_report_style_change(lv_style_t * style)
 {
-    if(!style_refr) return;
+    if(!style_refr) {
+#if LV_OBJ_STYLE_CACHE_SIZE
+        /*The objects using the style are not searched now, so clear all the caches*/
+        cache_gen++;
+        if(cache_gen == 0) cache_gen = 1;
+        cache_stat.invalidate++;
+#endif
+        return;
+    }
+
+    /*The caches of the objects using the style are cleared by `lv_obj_refresh_style()`*/
     lv_disp_t * d = lv_disp_get_next(NULL);
 
     while(d) {
@@ -168,6 +192,10 @@ void lv_obj_refresh_style(lv_obj_t * obj, lv_style_selector_t selector, lv_style
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
+#if LV_OBJ_STYLE_CACHE_SIZE
+    _lv_obj_style_cache_invalidate(obj, lv_obj_style_get_selector_part(selector), prop);
+#endif
+
     if(!style_refr) return;
 
     lv_obj_invalidate(obj);
@@ -220,51 +248,73 @@ void lv_obj_enable_style_refresh(bool en)
     style_refr = en;
 }
 
-lv_style_value_t lv_obj_get_style_prop(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop)
+#if LV_OBJ_STYLE_CACHE_SIZE
+void lv_obj_enable_style_cache(bool en)
 {
-    lv_style_value_t value_act;
-    bool inheritable = lv_style_prop_has_flag(prop, LV_STYLE_PROP_INHERIT);
-    lv_style_res_t found = LV_STYLE_RES_NOT_FOUND;
-    while(obj) {
-        found = get_prop_core(obj, part, prop, &value_act);
-        if(found == LV_STYLE_RES_FOUND) break;
-        if(!inheritable) break;
+    style_cache_en = en;
+}
 
-        /*If not found, check the `MAIN` style first*/
-        if(found != LV_STYLE_RES_INHERIT && part != LV_PART_MAIN) {
-            part = LV_PART_MAIN;
-            continue;
-        }
+void lv_obj_style_cache_get_stat(lv_obj_style_cache_stat_t * stat)
+{
+    *stat = cache_stat;
+}
 
-        /*Check the parent too.*/
-        obj = lv_obj_get_parent(obj);
+void lv_obj_style_cache_reset_stat(void)
+{
+    lv_memset_00(&cache_stat, sizeof(cache_stat));
+}
+
+void _lv_obj_style_cache_invalidate(lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop)
+{
+    _lv_obj_style_cache_t * cache = obj->style_cache;
+    if(cache && cache->gen != 0) {
+        cache->gen = 0;
+        cache_stat.invalidate++;
     }
 
-    if(found != LV_STYLE_RES_FOUND) {
-        if(part == LV_PART_MAIN && (prop == LV_STYLE_WIDTH || prop == LV_STYLE_HEIGHT)) {
-            const lv_obj_class_t * cls = obj->class_p;
-            while(cls) {
-                if(prop == LV_STYLE_WIDTH) {
-                    if(cls->width_def != 0) break;
-                }
-                else {
-                    if(cls->height_def != 0) break;
-                }
-                cls = cls->base_class;
-            }
+    /*The children inherit only from the main part*/
+    if(part != LV_PART_ANY && part != LV_PART_MAIN) return;
+    if(prop != LV_STYLE_PROP_ANY && !lv_style_prop_has_flag(prop, LV_STYLE_PROP_INHERIT)) return;
 
-            if(cls) {
-                value_act.num = prop == LV_STYLE_WIDTH ? cls->width_def : cls->height_def;
-            }
-            else {
-                value_act.num = 0;
-            }
-        }
-        else {
-            value_act = lv_style_prop_get_default(prop);
-        }
+    uint32_t i;
+    uint32_t child_cnt = lv_obj_get_child_cnt(obj);
+    for(i = 0; i < child_cnt; i++) {
+        _lv_obj_style_cache_invalidate(obj->spec_attr->children[i], LV_PART_ANY, LV_STYLE_PROP_ANY);
     }
-    return value_act;
+}
+
+void _lv_obj_style_cache_free(lv_obj_t * obj)
+{
+    lv_mem_free(obj->style_cache);
+    obj->style_cache = NULL;
+}
+#endif
+
+lv_style_value_t lv_obj_get_style_prop(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop)
+{
+#if LV_OBJ_STYLE_CACHE_SIZE
+    _lv_obj_style_cache_entry_t * entry = get_cache_entry(obj, part, prop);
+    if(entry == NULL) return resolve_prop(obj, part, prop);
+
+    /*The rendering threads only read the caches*/
+    bool running = lv_thread_pool_is_running();
+    if(entry->prop == prop && entry->part == (part >> 16) && entry->state == obj->state) {
+        if(!running) cache_stat.hit++;
+        return entry->value;
+    }
+
+    lv_style_value_t value = resolve_prop(obj, part, prop);
+    if(!running) {
+        cache_stat.miss++;
+        entry->value = value;
+        entry->prop = prop;
+        entry->part = part >> 16;
+        entry->state = obj->state;
+    }
+    return value;
+#else
+    return resolve_prop(obj, part, prop);
+#endif
 }
 
 void lv_obj_set_local_style_prop(lv_obj_t * obj, lv_style_prop_t prop, lv_style_value_t value,
@@ -603,6 +653,98 @@ static _lv_obj_style_t * get_trans_style(lv_obj_t * obj,  lv_style_selector_t se
 }
 
 
+/**
+ * Search a property in the styles of an object (and its parents if the property is inherited)
+ * @param obj   pointer to an object
+ * @param part  the part of the object
+ * @param prop  the property
+ * @return      the value of the property or its default value
+ */
+static lv_style_value_t resolve_prop(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop)
+{
+    lv_style_value_t value_act;
+    bool inheritable = lv_style_prop_has_flag(prop, LV_STYLE_PROP_INHERIT);
+    lv_style_res_t found = LV_STYLE_RES_NOT_FOUND;
+    while(obj) {
+        found = get_prop_core(obj, part, prop, &value_act);
+        if(found == LV_STYLE_RES_FOUND) break;
+        if(!inheritable) break;
+
+        /*If not found, check the `MAIN` style first*/
+        if(found != LV_STYLE_RES_INHERIT && part != LV_PART_MAIN) {
+            part = LV_PART_MAIN;
+            continue;
+        }
+
+        /*Check the parent too.*/
+        obj = lv_obj_get_parent(obj);
+    }
+
+    if(found != LV_STYLE_RES_FOUND) {
+        if(part == LV_PART_MAIN && (prop == LV_STYLE_WIDTH || prop == LV_STYLE_HEIGHT)) {
+            const lv_obj_class_t * cls = obj->class_p;
+            while(cls) {
+                if(prop == LV_STYLE_WIDTH) {
+                    if(cls->width_def != 0) break;
+                }
+                else {
+                    if(cls->height_def != 0) break;
+                }
+                cls = cls->base_class;
+            }
+
+            if(cls) {
+                value_act.num = prop == LV_STYLE_WIDTH ? cls->width_def : cls->height_def;
+            }
+            else {
+                value_act.num = 0;
+            }
+        }
+        else {
+            value_act = lv_style_prop_get_default(prop);
+        }
+    }
+    return value_act;
+}
+
+#if LV_OBJ_STYLE_CACHE_SIZE
+/**
+ * Get the cache entry of a property of an object. Allocate or clear the cache if required.
+ * @param obj   pointer to an object
+ * @param part  the part of the object
+ * @param prop  the property
+ * @return      the entry, the property is in it if the `prop`, `part`, `state` fields match. NULL if not cached.
+ */
+static _lv_obj_style_cache_entry_t * get_cache_entry(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop)
+{
+    /*During transitions the values without the transition style are used*/
+    if(!style_cache_en || obj->skip_trans) return NULL;
+
+    bool running = lv_thread_pool_is_running();
+    uint32_t gen = cache_gen;
+    _lv_obj_style_cache_t * cache = obj->style_cache;
+    if(cache == NULL) {
+        if(running) return NULL;
+        cache = lv_mem_alloc(sizeof(_lv_obj_style_cache_t));
+        if(cache == NULL) return NULL;
+        cache->gen = 0;
+        ((lv_obj_t *)obj)->style_cache = cache;
+    }
+
+    if(cache->gen != gen) {
+        if(running) return NULL;
+        uint32_t i;
+        for(i = 0; i < LV_OBJ_STYLE_CACHE_SIZE; i++) cache->entries[i].prop = LV_STYLE_PROP_INV;
+        cache->gen = gen;
+    }
+
+    /*The properties used together have close IDs, so they go to different entries*/
+    uint32_t idx = (prop + (part >> 16) * 7) & (LV_OBJ_STYLE_CACHE_SIZE - 1);
+    return &cache->entries[idx];
+}
+#endif
+
+
 static lv_style_res_t get_prop_core(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop, lv_style_value_t * v)
 {
     uint8_t group = 1 << _lv_style_get_prop_group(prop);
@@ -738,6 +880,9 @@ static bool trans_del(lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop, tran
             for(i = 0; i < obj->style_cnt; i++) {
                 if(obj->styles[i].is_trans && (part == LV_PART_ANY || obj->styles[i].selector == part)) {
                     lv_style_remove_prop(obj->styles[i].style, tr->prop);
+#if LV_OBJ_STYLE_CACHE_SIZE
+                    _lv_obj_style_cache_invalidate(obj, lv_obj_style_get_selector_part(obj->styles[i].selector), tr->prop);
+#endif
                 }
             }
 
@@ -835,6 +980,9 @@ static void trans_anim_start_cb(lv_anim_t * a)
 
     _lv_obj_style_t * style_trans = get_trans_style(tr->obj, tr->selector);
     lv_style_set_prop(style_trans->style, tr->prop, tr->start_value);   /*Be sure `trans_style` has a valid value*/
+#if LV_OBJ_STYLE_CACHE_SIZE
+    _lv_obj_style_cache_invalidate(tr->obj, part, tr->prop);
+#endif
 
 }
 
@@ -865,6 +1013,9 @@ static void trans_anim_ready_cb(lv_anim_t * a)
 
                 _lv_obj_style_t * obj_style = &obj->styles[i];
                 lv_style_remove_prop(obj_style->style, prop);
+#if LV_OBJ_STYLE_CACHE_SIZE
+                _lv_obj_style_cache_invalidate(obj, lv_obj_style_get_selector_part(obj_style->selector), prop);
+#endif
 
                 if(lv_style_is_empty(obj->styles[i].style)) {
                     lv_obj_remove_style(obj, obj_style->style, obj_style->selector);
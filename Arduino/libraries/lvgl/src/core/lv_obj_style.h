@@ -54,6 +54,29 @@ typedef struct {
 #endif
 } _lv_obj_style_transition_dsc_t;
 
+#if LV_OBJ_STYLE_CACHE_SIZE
+/**
+ * A resolved (found in the styles, inherited or default) property of an object
+ */
+typedef struct {
+    lv_style_value_t value;
+    uint16_t prop;              /*`LV_STYLE_PROP_INV` if the entry is empty*/
+    lv_state_t state;           /*The state of the object when the property was resolved*/
+    uint8_t part;               /*`part >> 16`*/
+} _lv_obj_style_cache_entry_t;
+
+typedef struct {
+    uint32_t gen;               /*The entries are valid if it equals to the generation of all the caches, 0: cleared*/
+    _lv_obj_style_cache_entry_t entries[LV_OBJ_STYLE_CACHE_SIZE];
+} _lv_obj_style_cache_t;
+
+typedef struct {
+    uint32_t hit;               /*Properties returned from the cache*/
+    uint32_t miss;              /*Properties resolved from the styles*/
+    uint32_t invalidate;        /*Number of object caches cleared by style changes*/
+} lv_obj_style_cache_stat_t;
+#endif
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -118,6 +141,42 @@ void lv_obj_refresh_style(struct _lv_obj_t * obj, lv_part_t part, lv_style_prop_
  */
 void lv_obj_enable_style_refresh(bool en);
 
+#if LV_OBJ_STYLE_CACHE_SIZE
+/**
+ * Enable or disable caching the resolved style properties of the objects.
+ * Disabling it frees nothing, the caches are just not used.
+ * @param en        true: use the caches (default); false: always search the styles
+ */
+void lv_obj_enable_style_cache(bool en);
+
+/**
+ * Get the statistics of the style property caches since the last `lv_obj_style_cache_reset_stat()`
+ * @param stat      store the statistics here
+ */
+void lv_obj_style_cache_get_stat(lv_obj_style_cache_stat_t * stat);
+
+/**
+ * Reset the statistics of the style property caches
+ */
+void lv_obj_style_cache_reset_stat(void);
+
+/**
+ * Clear the style property cache of an object because its styles have changed.
+ * The caches of the children are cleared too if they can inherit the changed property.
+ * Changing a style shared by many objects clears their caches only via `lv_obj_report_style_change()`.
+ * @param obj       pointer to an object
+ * @param part      the part whose style was changed. E.g. `LV_PART_ANY`, `LV_PART_MAIN`
+ * @param prop      `LV_STYLE_PROP_ANY` or the changed property
+ */
+void _lv_obj_style_cache_invalidate(struct _lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop);
+
+/**
+ * Free the style property cache of an object. Called when the object is deleted.
+ * @param obj       pointer to an object
+ */
+void _lv_obj_style_cache_free(struct _lv_obj_t * obj);
+#endif
+
 /**
  * Get the value of a style property. The current state of the object will be considered.
  * Inherited properties will be inherited.
@@ -78,6 +78,11 @@ void lv_obj_del(lv_obj_t * obj)
         disp->act_scr = NULL;
     }
 
+#if LV_MEM_CUSTOM == 0 && LV_MEM_SLAB
+    /*Give back the pages emptied by deleting the screen at once*/
+    if(par == NULL) lv_mem_slab_trim();
+#endif
+
     LV_ASSERT_MEM_INTEGRITY();
     LV_LOG_TRACE("finished (delete %p)", (void *)obj);
 }
@@ -172,6 +177,11 @@ void lv_obj_set_parent(lv_obj_t * obj, lv_obj_t * parent)
 
     obj->parent = parent;
 
+#if LV_OBJ_STYLE_CACHE_SIZE
+    /*The inherited properties come from the new parent*/
+    _lv_obj_style_cache_invalidate(obj, LV_PART_ANY, LV_STYLE_PROP_ANY);
+#endif
+
     /*Notify the original parent because one of its children is lost*/
     lv_obj_readjust_scroll(old_parent, LV_ANIM_OFF);
     lv_obj_scrollbar_invalidate(old_parent);
@@ -15,7 +15,9 @@
 #include "../misc/lv_mem.h"
 #include "../misc/lv_math.h"
 #include "../misc/lv_gc.h"
+#include "../misc/lv_thread.h"
 #include "../draw/lv_draw.h"
+#include "../draw/sw/lv_draw_sw.h"
 #include "../font/lv_font_fmt_txt.h"
 #include "../extra/others/snapshot/lv_snapshot.h"
 
@@ -23,9 +25,17 @@
     #include "../widgets/lv_label.h"
 #endif
 
+#if LV_USE_PARALLEL_REFR
+    #include "../widgets/lv_img.h"
+#endif
+
 /*********************
  *      DEFINES
  *********************/
+#if LV_REFR_OCCLUDER_MAX
+    /*Max. number of objects marked as fully or partly covered on an area*/
+    #define OCCLUSION_REC_MAX   (LV_REFR_OCCLUDER_MAX * 4)
+#endif
 
 /**********************
  *      TYPEDEFS
@@ -36,6 +46,10 @@ typedef struct {
     uint32_t    frame_cnt;
     uint32_t    fps_sum_cnt;
     uint32_t    fps_sum_all;
+#if LV_USE_REFR_STAT
+    uint32_t    px_written;
+    uint32_t    px_rendered;
+#endif
 #if LV_USE_LABEL
     lv_obj_t  * perf_label;
 #endif
@@ -48,14 +62,32 @@ typedef struct {
 #endif
 } mem_monitor_t;
 
+#if LV_USE_PARALLEL_REFR
+typedef struct {
+    lv_draw_ctx_t * draw_ctx;   /*Draw context of the whole part, copied for each band*/
+    lv_obj_t * top_act_scr;
+    lv_obj_t * top_prev_scr;
+    lv_coord_t band_h;
+} refr_bands_t;
+#endif
+
+#if LV_REFR_OCCLUDER_MAX
+typedef struct {
+    lv_obj_t * obj;
+    lv_area_t main_clip;    /*Draw the main part of the object only here (invalid area: don't draw it)*/
+} occlusion_rec_t;
+#endif
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 static void lv_refr_join_area(void);
+static int32_t get_join_cost(const lv_area_t * a1, const lv_area_t * a2);
 static void refr_invalid_areas(void);
 static void refr_sync_areas(void);
 static void refr_area(const lv_area_t * area_p);
 static void refr_area_part(lv_draw_ctx_t * draw_ctx);
+static void refr_area_part_draw(lv_draw_ctx_t * draw_ctx, lv_obj_t * top_act_scr, lv_obj_t * top_prev_scr);
 static lv_obj_t * lv_refr_get_top_obj(const lv_area_t * area_p, lv_obj_t * obj);
 static void refr_obj_and_children(lv_draw_ctx_t * draw_ctx, lv_obj_t * top_obj);
 static void refr_obj(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj);
@@ -63,6 +95,26 @@ static uint32_t get_max_row(lv_disp_t * disp, lv_coord_t area_w, lv_coord_t area
 static void draw_buf_flush(lv_disp_t * disp);
 static void call_flush_cb(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * color_p);
 
+#if LV_USE_PARALLEL_REFR
+    static void refr_parallel_check(void);
+    static bool needs_one_thread(lv_obj_t * obj);
+    static uint32_t get_band_cnt(const lv_area_t * clip_area);
+    static void refr_bands(lv_draw_ctx_t * draw_ctx, uint32_t band_cnt, lv_obj_t * top_act_scr, lv_obj_t * top_prev_scr);
+    static void refr_band_cb(uint32_t band, uint32_t thread_id, void * user_data);
+    static void refr_cleanup_cb(uint32_t job, uint32_t thread_id, void * user_data);
+#endif
+#if LV_USE_REFR_STAT
+    static uint32_t get_union_size(const lv_area_t * areas, uint32_t cnt);
+#endif
+#if LV_REFR_OCCLUDER_MAX
+    static void occlusion_check(const lv_area_t * clip_area);
+    static void occlusion_check_obj(lv_obj_t * obj, const lv_area_t * clip_area, bool can_occlude);
+    static void occlusion_add(const lv_area_t * area);
+    static bool occlusion_trim(lv_area_t * area);
+    static occlusion_rec_t * occlusion_add_rec(lv_obj_t * obj);
+    static void occlusion_clear(void);
+    static bool occlusion_get_main_clip(lv_obj_t * obj, lv_area_t * clip_area);
+#endif
 #if LV_USE_PERF_MONITOR
     static void perf_monitor_init(perf_monitor_t * perf_monitor);
 #endif
@@ -76,6 +128,26 @@ static void call_flush_cb(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_
 static uint32_t px_num;
 static lv_disp_t * disp_refr; /*Display being refreshed*/
 
+#if LV_USE_PARALLEL_REFR
+    static uint32_t refr_thread_cnt = LV_PARALLEL_REFR_THREADS;
+    static bool refr_parallel;          /*The current refresh can be rendered in bands*/
+    static bool refr_bands_used;        /*The worker threads have drawn in the current refresh*/
+    static uint8_t * band_ctx_buf;      /*A draw context for each thread*/
+    static uint32_t band_ctx_buf_size;
+#endif
+
+#if LV_USE_REFR_STAT
+    static lv_refr_stat_t refr_stat;
+#endif
+
+#if LV_REFR_OCCLUDER_MAX
+    static bool occlusion_en = true;
+    static lv_area_t occluders[LV_REFR_OCCLUDER_MAX];   /*Opaque areas in front of the objects being checked*/
+    static uint32_t occluder_cnt;
+    static occlusion_rec_t occlusion_recs[OCCLUSION_REC_MAX];
+    static uint32_t occlusion_rec_cnt;
+#endif
+
 #if LV_USE_PERF_MONITOR
     static perf_monitor_t   perf_monitor;
 #endif
@@ -108,8 +180,34 @@ void _lv_refr_init(void)
 #if LV_USE_MEM_MONITOR
     mem_monitor_init(&mem_monitor);
 #endif
+#if LV_USE_PARALLEL_REFR
+    /*More threads than cores only take turns and make the refresh slower*/
+    uint32_t cpu_cnt = lv_thread_get_cpu_cnt();
+    refr_thread_cnt = LV_PARALLEL_REFR_THREADS;
+    if(cpu_cnt && refr_thread_cnt > cpu_cnt) refr_thread_cnt = cpu_cnt;
+#endif
+}
+
+#if LV_USE_PARALLEL_REFR
+void _lv_refr_deinit(void)
+{
+    lv_thread_pool_deinit();
+    lv_mem_free(band_ctx_buf);
+    band_ctx_buf = NULL;
+    band_ctx_buf_size = 0;
 }
 
+void lv_refr_set_thread_cnt(uint32_t cnt)
+{
+    refr_thread_cnt = cnt ? cnt : 1;
+}
+
+uint32_t lv_refr_get_thread_cnt(void)
+{
+    return refr_thread_cnt;
+}
+#endif
+
 void lv_refr_now(lv_disp_t * disp)
 {
     lv_anim_refr_now();
@@ -144,20 +242,33 @@ void lv_obj_redraw(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj)
     if(should_draw) {
         draw_ctx->clip_area = &clip_coords_for_obj;
 
-        lv_event_send(obj, LV_EVENT_DRAW_MAIN_BEGIN, draw_ctx);
-        lv_event_send(obj, LV_EVENT_DRAW_MAIN, draw_ctx);
-        lv_event_send(obj, LV_EVENT_DRAW_MAIN_END, draw_ctx);
+        bool draw_main = true;
+#if LV_REFR_OCCLUDER_MAX
+        /*Draw only the part which is not covered by the objects in front of it*/
+        lv_area_t clip_coords_for_main;
+        if(obj->refr_main_clip) {
+            clip_coords_for_main = clip_coords_for_obj;
+            draw_main = occlusion_get_main_clip(obj, &clip_coords_for_main);
+            draw_ctx->clip_area = &clip_coords_for_main;
+        }
+#endif
+
+        if(draw_main) {
+            lv_event_send(obj, LV_EVENT_DRAW_MAIN_BEGIN, draw_ctx);
+            lv_event_send(obj, LV_EVENT_DRAW_MAIN, draw_ctx);
+            lv_event_send(obj, LV_EVENT_DRAW_MAIN_END, draw_ctx);
 #if LV_USE_REFR_DEBUG
-        lv_color_t debug_color = lv_color_make(lv_rand(0, 0xFF), lv_rand(0, 0xFF), lv_rand(0, 0xFF));
-        lv_draw_rect_dsc_t draw_dsc;
-        lv_draw_rect_dsc_init(&draw_dsc);
-        draw_dsc.bg_color.full = debug_color.full;
-        draw_dsc.bg_opa = LV_OPA_20;
-        draw_dsc.border_width = 1;
-        draw_dsc.border_opa = LV_OPA_30;
-        draw_dsc.border_color = debug_color;
-        lv_draw_rect(draw_ctx, &draw_dsc, &obj_coords_ext);
+            lv_color_t debug_color = lv_color_make(lv_rand(0, 0xFF), lv_rand(0, 0xFF), lv_rand(0, 0xFF));
+            lv_draw_rect_dsc_t draw_dsc;
+            lv_draw_rect_dsc_init(&draw_dsc);
+            draw_dsc.bg_color.full = debug_color.full;
+            draw_dsc.bg_opa = LV_OPA_20;
+            draw_dsc.border_width = 1;
+            draw_dsc.border_opa = LV_OPA_30;
+            draw_dsc.border_color = debug_color;
+            lv_draw_rect(draw_ctx, &draw_dsc, &obj_coords_ext);
 #endif
+        }
     }
 
     /*With overflow visible keep the previous clip area to let the children visible out of this object too
@@ -251,12 +362,23 @@ void _lv_inv_area(lv_disp_t * disp, const lv_area_t * area_p)
     /*Save the area*/
     if(disp->inv_p < LV_INV_BUF_SIZE) {
         lv_area_copy(&disp->inv_areas[disp->inv_p], &com_area);
+        disp->inv_p++;
     }
-    else {   /*If no place for the area add the screen*/
-        disp->inv_p = 0;
-        lv_area_copy(&disp->inv_areas[disp->inv_p], &scr_area);
+    else {   /*If no place for the area join it to the area which grows the least*/
+        int32_t min_cost = INT32_MAX;
+        uint16_t min_i = 0;
+        for(i = 0; i < disp->inv_p; i++) {
+            int32_t cost = get_join_cost(&com_area, &disp->inv_areas[i]);
+            if(cost < min_cost) {
+                min_cost = cost;
+                min_i = i;
+            }
+        }
+        _lv_area_join(&disp->inv_areas[min_i], &disp->inv_areas[min_i], &com_area);
+#if LV_USE_REFR_STAT
+        refr_stat.inv_overflow++;
+#endif
     }
-    disp->inv_p++;
     if(disp->refr_timer) lv_timer_resume(disp->refr_timer);
 }
 
@@ -320,8 +442,16 @@ void _lv_disp_refr_timer(lv_timer_t * tmr)
         return;
     }
 
+#if LV_USE_REFR_STAT
+    uint32_t px_dirty = get_union_size(disp_refr->inv_areas, disp_refr->inv_p);
+    uint32_t px_written_start = refr_stat.px_written;
+#endif
+
     lv_refr_join_area();
     refr_sync_areas();
+#if LV_USE_PARALLEL_REFR
+    refr_parallel_check();
+#endif
     refr_invalid_areas();
 
     /*If refresh happened ...*/
@@ -347,6 +477,16 @@ void _lv_disp_refr_timer(lv_timer_t * tmr)
 
         elaps = lv_tick_elaps(start);
 
+#if LV_USE_REFR_STAT
+        refr_stat.frames++;
+        refr_stat.px_dirty += px_dirty;
+        refr_stat.px_rendered += px_num;
+#if LV_USE_PERF_MONITOR
+        perf_monitor.px_written += refr_stat.px_written - px_written_start;
+        perf_monitor.px_rendered += px_num;
+#endif
+#endif
+
         /*Call monitor cb if present*/
         if(disp_refr->driver->monitor_cb) {
             disp_refr->driver->monitor_cb(disp_refr->driver, elaps, px_num);
@@ -360,6 +500,14 @@ void _lv_disp_refr_timer(lv_timer_t * tmr)
     _lv_draw_mask_cleanup();
 #endif
 
+#if LV_USE_PARALLEL_REFR
+    /*The worker threads have their own buffers and masks*/
+    if(refr_bands_used) {
+        lv_thread_pool_run_on_workers(refr_cleanup_cb, NULL);
+        refr_bands_used = false;
+    }
+#endif
+
 #if LV_USE_PERF_MONITOR && LV_USE_LABEL
     lv_obj_t * perf_label = perf_monitor.perf_label;
     if(perf_label == NULL) {
@@ -413,7 +561,19 @@ void _lv_disp_refr_timer(lv_timer_t * tmr)
         perf_monitor.fps_sum_all += fps;
         perf_monitor.fps_sum_cnt ++;
         uint32_t cpu = 100 - lv_timer_get_idle();
+#if LV_USE_REFR_STAT
+        /*Written pixels per rendered pixels*/
+        uint32_t overdraw = 100;
+        if(perf_monitor.px_rendered) {
+            overdraw = (uint32_t)(((uint64_t)perf_monitor.px_written * 100) / perf_monitor.px_rendered);
+        }
+        perf_monitor.px_written = 0;
+        perf_monitor.px_rendered = 0;
+        lv_label_set_text_fmt(perf_label, "%"LV_PRIu32" FPS\n%"LV_PRIu32"%% CPU\n%"LV_PRIu32".%02"LV_PRIu32" overdraw",
+                              fps, cpu, overdraw / 100, overdraw % 100);
+#else
         lv_label_set_text_fmt(perf_label, "%"LV_PRIu32" FPS\n%"LV_PRIu32"%% CPU", fps, cpu);
+#endif
     }
 #endif
 
@@ -467,6 +627,25 @@ uint32_t lv_refr_get_fps_avg(void)
 }
 #endif
 
+#if LV_REFR_OCCLUDER_MAX
+void lv_refr_enable_occlusion(bool en)
+{
+    occlusion_en = en;
+}
+#endif
+
+#if LV_USE_REFR_STAT
+void lv_refr_get_stat(lv_refr_stat_t * stat)
+{
+    *stat = refr_stat;
+}
+
+void lv_refr_reset_stat(void)
+{
+    lv_memset_00(&refr_stat, sizeof(refr_stat));
+}
+#endif
+
 
 /**********************
  *   STATIC FUNCTIONS
@@ -479,36 +658,51 @@ static void lv_refr_join_area(void)
 {
     uint32_t join_from;
     uint32_t join_in;
-    lv_area_t joined_area;
-    for(join_in = 0; join_in < disp_refr->inv_p; join_in++) {
-        if(disp_refr->inv_area_joined[join_in] != 0) continue;
-
-        /*Check all areas to join them in 'join_in'*/
-        for(join_from = 0; join_from < disp_refr->inv_p; join_from++) {
-            /*Handle only unjoined areas and ignore itself*/
-            if(disp_refr->inv_area_joined[join_from] != 0 || join_in == join_from) {
-                continue;
-            }
+    bool joined = true;
 
-            /*Check if the areas are on each other*/
-            if(_lv_area_is_on(&disp_refr->inv_areas[join_in], &disp_refr->inv_areas[join_from]) == false) {
-                continue;
-            }
+    /*A joined area can be joined with an other, so repeat until there is nothing to join*/
+    while(joined) {
+        joined = false;
+        for(join_in = 0; join_in < disp_refr->inv_p; join_in++) {
+            if(disp_refr->inv_area_joined[join_in] != 0) continue;
 
-            _lv_area_join(&joined_area, &disp_refr->inv_areas[join_in], &disp_refr->inv_areas[join_from]);
+            /*Check all areas to join them in 'join_in'*/
+            for(join_from = join_in + 1; join_from < disp_refr->inv_p; join_from++) {
+                /*Handle only unjoined areas*/
+                if(disp_refr->inv_area_joined[join_from] != 0) continue;
 
-            /*Join two area only if the joined area size is smaller*/
-            if(lv_area_get_size(&joined_area) < (lv_area_get_size(&disp_refr->inv_areas[join_in]) +
-                                                 lv_area_get_size(&disp_refr->inv_areas[join_from]))) {
-                lv_area_copy(&disp_refr->inv_areas[join_in], &joined_area);
+                /*Join two areas only if rendering the extra pixels is cheaper than rendering one more area*/
+                if(get_join_cost(&disp_refr->inv_areas[join_in], &disp_refr->inv_areas[join_from]) > LV_REFR_AREA_JOIN_COST) {
+                    continue;
+                }
+
+                _lv_area_join(&disp_refr->inv_areas[join_in], &disp_refr->inv_areas[join_in],
+                              &disp_refr->inv_areas[join_from]);
 
                 /*Mark 'join_form' is joined into 'join_in'*/
                 disp_refr->inv_area_joined[join_from] = 1;
+                joined = true;
             }
         }
     }
 }
 
+/**
+ * Get how many more pixels would be rendered if two areas were joined
+ * @param a1    pointer to an area
+ * @param a2    pointer to an other area
+ * @return      the pixels of the joined area minus the pixels of the two areas.
+ *              Negative if the areas overlap so much that the joined area is smaller,
+ *              because the common part would be rendered twice otherwise.
+ */
+static int32_t get_join_cost(const lv_area_t * a1, const lv_area_t * a2)
+{
+    lv_area_t joined_area;
+    _lv_area_join(&joined_area, a1, a2);
+
+    return (int32_t)lv_area_get_size(&joined_area) - (int32_t)(lv_area_get_size(a1) + lv_area_get_size(a2));
+}
+
 /**
  * Refresh the sync areas
  */
@@ -618,6 +812,9 @@ static void refr_invalid_areas(void)
             refr_area(&disp_refr->inv_areas[i]);
 
             px_num += lv_area_get_size(&disp_refr->inv_areas[i]);
+#if LV_USE_REFR_STAT
+            refr_stat.areas++;
+#endif
         }
     }
 
@@ -728,12 +925,46 @@ static void refr_area_part(lv_draw_ctx_t * draw_ctx)
     lv_obj_t * top_act_scr = NULL;
     lv_obj_t * top_prev_scr = NULL;
 
+#if LV_REFR_OCCLUDER_MAX
+    /*Mark the objects which are covered by opaque objects in front of them*/
+    occlusion_check(draw_ctx->clip_area);
+#endif
+#if LV_USE_REFR_STAT
+    draw_ctx->px_written = 0;
+#endif
+
     /*Get the most top object which is not covered by others*/
     top_act_scr = lv_refr_get_top_obj(draw_ctx->buf_area, lv_disp_get_scr_act(disp_refr));
     if(disp_refr->prev_scr) {
         top_prev_scr = lv_refr_get_top_obj(draw_ctx->buf_area, disp_refr->prev_scr);
     }
 
+#if LV_USE_PARALLEL_REFR
+    uint32_t band_cnt = get_band_cnt(draw_ctx->clip_area);
+    if(band_cnt > 1) refr_bands(draw_ctx, band_cnt, top_act_scr, top_prev_scr);
+    else refr_area_part_draw(draw_ctx, top_act_scr, top_prev_scr);
+#else
+    refr_area_part_draw(draw_ctx, top_act_scr, top_prev_scr);
+#endif
+
+#if LV_USE_REFR_STAT
+    refr_stat.px_written += draw_ctx->px_written;
+#endif
+#if LV_REFR_OCCLUDER_MAX
+    occlusion_clear();
+#endif
+
+    draw_buf_flush(disp_refr);
+}
+
+/**
+ * Draw the background, the screens and the layers of the display on the clip area of a draw context
+ * @param draw_ctx      the draw context
+ * @param top_act_scr   the most top object of the active screen which covers the area (or NULL)
+ * @param top_prev_scr  the most top object of the previous screen which covers the area (or NULL)
+ */
+static void refr_area_part_draw(lv_draw_ctx_t * draw_ctx, lv_obj_t * top_act_scr, lv_obj_t * top_prev_scr)
+{
     /*Draw a display background if there is no top object*/
     if(top_act_scr == NULL && top_prev_scr == NULL) {
         lv_area_t a;
@@ -794,10 +1025,163 @@ static void refr_area_part(lv_draw_ctx_t * draw_ctx)
     /*Also refresh top and sys layer unconditionally*/
     refr_obj_and_children(draw_ctx, lv_disp_get_layer_top(disp_refr));
     refr_obj_and_children(draw_ctx, lv_disp_get_layer_sys(disp_refr));
+}
 
-    draw_buf_flush(disp_refr);
+#if LV_USE_PARALLEL_REFR
+
+/**
+ * Start or stop the rendering threads if required and check if the current refresh can be rendered in bands
+ */
+static void refr_parallel_check(void)
+{
+    if(lv_thread_pool_get_cnt() != refr_thread_cnt) {
+        if(lv_thread_pool_init(refr_thread_cnt) != LV_RES_OK) {
+            LV_LOG_WARN("couldn't start the rendering threads");
+        }
+        refr_thread_cnt = lv_thread_pool_get_cnt();
+    }
+
+    refr_parallel = false;
+    if(refr_thread_cnt <= 1) return;
+
+    /*Only the software renderer's state is thread local*/
+    if(disp_refr->driver->draw_ctx_init != lv_draw_sw_init_ctx) return;
+
+    /*Some objects change a shared state while they are drawn*/
+    if(needs_one_thread(disp_refr->act_scr) || needs_one_thread(disp_refr->prev_scr) ||
+       needs_one_thread(disp_refr->top_layer) || needs_one_thread(disp_refr->sys_layer)) return;
+
+    uint32_t size = disp_refr->driver->draw_ctx_size * refr_thread_cnt;
+    if(band_ctx_buf_size < size) {
+        lv_mem_free(band_ctx_buf);
+        band_ctx_buf = lv_mem_alloc(size);
+        LV_ASSERT_MALLOC(band_ctx_buf);
+        band_ctx_buf_size = band_ctx_buf ? size : 0;
+        if(band_ctx_buf == NULL) return;
+    }
+
+    refr_parallel = true;
+}
+
+/**
+ * Check if an object or any of its children can't be drawn by more threads at once
+ * @param obj   pointer to an object (can be NULL)
+ * @return      true: a visible object
+ *              - is drawn via a layer (changes `screen_transp` of the driver),
+ *              - is a transformed image (changes its coordinates to draw its background),
+ *              - or its class isn't marked with `parallel_draw` (e.g. button matrix, table
+ *                and drop-down list change their state to get the styles of their parts).
+ *                The exact class is checked as a derived class can draw differently.
+ */
+static bool needs_one_thread(lv_obj_t * obj)
+{
+    if(obj == NULL || lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN)) return false;
+    if(_lv_obj_get_layer_type(obj) != LV_LAYER_TYPE_NONE) return true;
+    if(!obj->class_p->parallel_draw) return true;
+
+#if LV_USE_IMG
+    if(lv_obj_has_class(obj, &lv_img_class) && lv_img_get_size_mode(obj) != LV_IMG_SIZE_MODE_REAL &&
+       (lv_img_get_angle(obj) != 0 || lv_img_get_zoom(obj) != LV_IMG_ZOOM_NONE)) return true;
+#endif
+
+    uint32_t i;
+    uint32_t child_cnt = lv_obj_get_child_cnt(obj);
+    for(i = 0; i < child_cnt; i++) {
+        if(needs_one_thread(obj->spec_attr->children[i])) return true;
+    }
+
+    return false;
+}
+
+/**
+ * Get the number of bands to split an area to
+ * @param clip_area     the area to render
+ * @return              1: render it on the calling thread
+ */
+static uint32_t get_band_cnt(const lv_area_t * clip_area)
+{
+    if(!refr_parallel) return 1;
+
+    /*More bands than threads to balance the load if the content is not even*/
+    uint32_t band_cnt = refr_thread_cnt * 2;
+    uint32_t band_max = lv_area_get_height(clip_area) / LV_PARALLEL_REFR_MIN_ROWS;
+    if(band_cnt > band_max) band_cnt = band_max;
+
+    return band_cnt ? band_cnt : 1;
+}
+
+/**
+ * Render the clip area of a draw context in horizontal bands on the rendering threads
+ * @param draw_ctx      the draw context of the area
+ * @param band_cnt      number of bands
+ * @param top_act_scr   the most top object of the active screen which covers the area (or NULL)
+ * @param top_prev_scr  the most top object of the previous screen which covers the area (or NULL)
+ */
+static void refr_bands(lv_draw_ctx_t * draw_ctx, uint32_t band_cnt, lv_obj_t * top_act_scr, lv_obj_t * top_prev_scr)
+{
+    refr_bands_t bands;
+    bands.draw_ctx = draw_ctx;
+    bands.top_act_scr = top_act_scr;
+    bands.top_prev_scr = top_prev_scr;
+    bands.band_h = (lv_area_get_height(draw_ctx->clip_area) + band_cnt - 1) / band_cnt;
+
+#if LV_USE_REFR_STAT
+    /*Each thread counts the written pixels in its own draw context*/
+    uint32_t ctx_size = disp_refr->driver->draw_ctx_size;
+    uint32_t i;
+    for(i = 0; i < refr_thread_cnt; i++) {
+        ((lv_draw_ctx_t *)(band_ctx_buf + i * ctx_size))->px_written = 0;
+    }
+#endif
+
+    lv_thread_pool_run(refr_band_cb, band_cnt, &bands);
+    refr_bands_used = true;
+
+#if LV_USE_REFR_STAT
+    for(i = 0; i < refr_thread_cnt; i++) {
+        draw_ctx->px_written += ((lv_draw_ctx_t *)(band_ctx_buf + i * ctx_size))->px_written;
+    }
+#endif
+}
+
+static void refr_band_cb(uint32_t band, uint32_t thread_id, void * user_data)
+{
+    refr_bands_t * bands = user_data;
+
+    /*Each thread draws with its own copy of the draw context into the same buffer*/
+    uint32_t ctx_size = disp_refr->driver->draw_ctx_size;
+    lv_draw_ctx_t * draw_ctx = (lv_draw_ctx_t *)(band_ctx_buf + thread_id * ctx_size);
+#if LV_USE_REFR_STAT
+    uint32_t px_written = draw_ctx->px_written;
+    lv_memcpy(draw_ctx, bands->draw_ctx, ctx_size);
+    draw_ctx->px_written = px_written;
+#else
+    lv_memcpy(draw_ctx, bands->draw_ctx, ctx_size);
+#endif
+
+    lv_area_t clip_area = *bands->draw_ctx->clip_area;
+    clip_area.y1 += band * bands->band_h;
+    clip_area.y2 = LV_MIN(clip_area.y1 + bands->band_h - 1, bands->draw_ctx->clip_area->y2);
+    draw_ctx->clip_area = &clip_area;
+
+    refr_area_part_draw(draw_ctx, bands->top_act_scr, bands->top_prev_scr);
+}
+
+static void refr_cleanup_cb(uint32_t job, uint32_t thread_id, void * user_data)
+{
+    LV_UNUSED(job);
+    LV_UNUSED(thread_id);
+    LV_UNUSED(user_data);
+
+    lv_mem_buf_free_all();
+    _lv_font_clean_up_fmt_txt();
+#if LV_DRAW_COMPLEX
+    _lv_draw_mask_cleanup();
+#endif
 }
 
+#endif /*LV_USE_PARALLEL_REFR*/
+
 /**
  * Search the most top object which fully covers an area
  * @param area_p pointer to an area
@@ -969,6 +1353,10 @@ void refr_obj(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj)
 {
     /*Do not refresh hidden objects*/
     if(lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN)) return;
+#if LV_REFR_OCCLUDER_MAX
+    /*Do not refresh the objects covered by others*/
+    if(obj->refr_culled) return;
+#endif
     lv_layer_type_t layer_type = _lv_obj_get_layer_type(obj);
     if(layer_type == LV_LAYER_TYPE_NONE) {
         lv_obj_redraw(draw_ctx, obj);
@@ -1327,6 +1715,327 @@ static void call_flush_cb(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_
     drv->flush_cb(drv, &offset_area, color_p);
 }
 
+#if LV_USE_REFR_STAT
+/**
+ * Get the number of pixels covered by some areas, counting the overlapping pixels only once
+ * @param areas     array of areas
+ * @param cnt       number of areas
+ * @return          size of the union of the areas
+ */
+static uint32_t get_union_size(const lv_area_t * areas, uint32_t cnt)
+{
+    if(cnt == 0) return 0;
+
+    /*The left and right edges of the areas split the screen to columns.
+     *In each column the vertical ranges of the areas are merged*/
+    lv_coord_t * xs = lv_mem_buf_get(cnt * 2 * sizeof(lv_coord_t));
+    const lv_area_t ** col = lv_mem_buf_get(cnt * sizeof(lv_area_t *));
+
+    uint32_t i;
+    uint32_t j;
+    for(i = 0; i < cnt; i++) {
+        xs[i * 2] = areas[i].x1;
+        xs[i * 2 + 1] = areas[i].x2 + 1;
+    }
+
+    for(i = 1; i < cnt * 2; i++) {
+        lv_coord_t x = xs[i];
+        for(j = i; j > 0 && xs[j - 1] > x; j--) xs[j] = xs[j - 1];
+        xs[j] = x;
+    }
+
+    uint32_t size = 0;
+    for(i = 0; i + 1 < cnt * 2; i++) {
+        if(xs[i] == xs[i + 1]) continue;
+
+        /*Collect the areas in the column ordered by y1*/
+        uint32_t col_cnt = 0;
+        for(j = 0; j < cnt; j++) {
+            if(areas[j].x1 > xs[i] || areas[j].x2 < xs[i + 1] - 1) continue;
+            uint32_t k;
+            for(k = col_cnt; k > 0 && col[k - 1]->y1 > areas[j].y1; k--) col[k] = col[k - 1];
+            col[k] = &areas[j];
+            col_cnt++;
+        }
+
+        uint32_t h = 0;
+        lv_coord_t y_end = LV_COORD_MIN;  /*The first row below the ranges counted so far*/
+        for(j = 0; j < col_cnt; j++) {
+            lv_coord_t y1 = LV_MAX(col[j]->y1, y_end);
+            if(col[j]->y2 >= y1) {
+                h += col[j]->y2 - y1 + 1;
+                y_end = col[j]->y2 + 1;
+            }
+        }
+
+        size += (uint32_t)(xs[i + 1] - xs[i]) * h;
+    }
+
+    lv_mem_buf_release(col);
+    lv_mem_buf_release(xs);
+
+    return size;
+}
+#endif
+
+#if LV_REFR_OCCLUDER_MAX
+/**
+ * Find the objects which are fully or partly covered by opaque objects drawn after them
+ * and mark them to not draw them or to draw only their visible part.
+ * @param clip_area     the area which will be redrawn
+ */
+static void occlusion_check(const lv_area_t * clip_area)
+{
+    occluder_cnt = 0;
+    occlusion_rec_cnt = 0;
+    if(!occlusion_en) return;
+
+    /*Check in the reverse order of drawing: the objects in front first*/
+    occlusion_check_obj(lv_disp_get_layer_sys(disp_refr), clip_area, true);
+    occlusion_check_obj(lv_disp_get_layer_top(disp_refr), clip_area, true);
+
+    lv_obj_t * scr_front = disp_refr->act_scr;
+    lv_obj_t * scr_back = disp_refr->prev_scr;
+    if(disp_refr->draw_prev_over_act) {
+        scr_front = disp_refr->prev_scr;
+        scr_back = disp_refr->act_scr;
+    }
+    if(scr_front) occlusion_check_obj(scr_front, clip_area, true);
+    if(scr_back) occlusion_check_obj(scr_back, clip_area, true);
+}
+
+/**
+ * Check an object and its children in front to back order.
+ * Mark the object if it's covered and add its opaque area to the occluders.
+ * @param obj           pointer to an object
+ * @param clip_area     the area where the object can be drawn
+ * @param can_occlude   false: the object can't cover the others, e.g. a parent masks it
+ */
+static void occlusion_check_obj(lv_obj_t * obj, const lv_area_t * clip_area, bool can_occlude)
+{
+    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN)) return;
+
+    /*The layers are drawn differently, they don't cover and aren't covered*/
+    if(_lv_obj_get_layer_type(obj) != LV_LAYER_TYPE_NONE) return;
+
+    /*The same areas as in `lv_obj_redraw()`*/
+    lv_area_t obj_coords_ext;
+    lv_obj_get_coords(obj, &obj_coords_ext);
+    lv_coord_t ext_draw_size = _lv_obj_get_ext_draw_size(obj);
+    lv_area_increase(&obj_coords_ext, ext_draw_size, ext_draw_size);
+    lv_area_t clip_coords_for_obj;
+    bool main_visible = _lv_area_intersect(&clip_coords_for_obj, clip_area, &obj_coords_ext);
+
+    bool overflow_visible = lv_obj_has_flag(obj, LV_OBJ_FLAG_OVERFLOW_VISIBLE);
+    if(!main_visible && !overflow_visible) return;
+
+    /*If the children are clipped everything is drawn on the extended area.
+     *If it's covered skip the whole object.*/
+    if(main_visible && !overflow_visible) {
+        lv_area_t visible_area = clip_coords_for_obj;
+        if(occlusion_trim(&visible_area)) {
+            if(occlusion_add_rec(obj)) {
+                obj->refr_culled = 1;
+#if LV_USE_REFR_STAT
+                refr_stat.obj_culled++;
+#endif
+            }
+            return;
+        }
+    }
+
+    lv_cover_check_info_t info;
+    info.res = LV_COVER_RES_NOT_COVER;
+    lv_area_t cover_area;
+    bool cover_visible = _lv_area_intersect(&cover_area, clip_area, &obj->coords);
+    if(cover_visible) {
+        info.res = LV_COVER_RES_COVER;
+        info.area = &cover_area;
+        lv_event_send(obj, LV_EVENT_COVER_CHECK, &info);
+    }
+
+    /*The masks added while drawing the main part might be required by the children*/
+    bool masked = !cover_visible || info.res == LV_COVER_RES_MASKED;
+
+    lv_area_t clip_coords_for_children;
+    bool children_visible = true;
+    if(overflow_visible) clip_coords_for_children = *clip_area;
+    else children_visible = _lv_area_intersect(&clip_coords_for_children, clip_area, &obj->coords);
+
+    if(children_visible) {
+        /*The opacity of the object is applied on its children too*/
+        bool children_can_occlude = can_occlude && !masked && lv_obj_get_style_opa(obj, LV_PART_MAIN) >= LV_OPA_MAX;
+        int32_t i;
+        for(i = (int32_t)lv_obj_get_child_cnt(obj) - 1; i >= 0; i--) {
+            occlusion_check_obj(obj->spec_attr->children[i], &clip_coords_for_children, children_can_occlude);
+        }
+    }
+
+    /*The children are drawn after the main part so they might cover it*/
+    if(main_visible && !masked) {
+        lv_area_t visible_area = clip_coords_for_obj;
+        bool covered = occlusion_trim(&visible_area);
+        if(covered || !_lv_area_is_equal(&visible_area, &clip_coords_for_obj)) {
+            occlusion_rec_t * rec = occlusion_add_rec(obj);
+            if(rec) {
+                obj->refr_main_clip = 1;
+                if(covered) {
+                    lv_area_set(&rec->main_clip, 0, 0, -1, -1);
+                }
+                else {
+                    rec->main_clip = visible_area;
+                }
+#if LV_USE_REFR_STAT
+                if(covered) refr_stat.obj_culled++;
+                else refr_stat.obj_clipped++;
+#endif
+            }
+        }
+    }
+
+    if(!can_occlude || masked) return;
+
+    if(info.res == LV_COVER_RES_COVER) {
+        occlusion_add(&cover_area);
+        return;
+    }
+
+    /*A rounded object still covers the band between its corners*/
+    lv_coord_t w = lv_obj_get_width(obj);
+    lv_coord_t h = lv_obj_get_height(obj);
+    lv_coord_t r = lv_obj_get_style_radius(obj, LV_PART_MAIN);
+    r = LV_MIN(r, LV_MIN(w, h) / 2);
+    if(r <= 0) return;
+
+    lv_area_t band = obj->coords;
+    if(w >= h) lv_area_increase(&band, -r, 0);
+    else lv_area_increase(&band, 0, -r);
+    if(!_lv_area_intersect(&cover_area, clip_area, &band)) return;
+
+    info.res = LV_COVER_RES_COVER;
+    info.area = &cover_area;
+    lv_event_send(obj, LV_EVENT_COVER_CHECK, &info);
+    if(info.res == LV_COVER_RES_COVER) occlusion_add(&cover_area);
+}
+
+/**
+ * Add an opaque area. If there is no more space replace the smallest one with it.
+ * @param area      the opaque area
+ */
+static void occlusion_add(const lv_area_t * area)
+{
+    if(occluder_cnt < LV_REFR_OCCLUDER_MAX) {
+        occluders[occluder_cnt] = *area;
+        occluder_cnt++;
+        return;
+    }
+
+    uint32_t size = lv_area_get_size(area);
+    uint32_t min_i = 0;
+    uint32_t min_size = UINT32_MAX;
+    uint32_t i;
+    for(i = 0; i < occluder_cnt; i++) {
+        uint32_t s = lv_area_get_size(&occluders[i]);
+        if(s < min_size) {
+            min_size = s;
+            min_i = i;
+        }
+    }
+
+    if(size > min_size) occluders[min_i] = *area;
+}
+
+/**
+ * Remove the covered edges of an area. Only full rows and columns are removed
+ * to keep it a rectangle.
+ * @param area      the area to trim
+ * @return          true: the whole area is covered
+ */
+static bool occlusion_trim(lv_area_t * area)
+{
+    bool changed = true;
+    while(changed) {
+        changed = false;
+        uint32_t i;
+        for(i = 0; i < occluder_cnt; i++) {
+            const lv_area_t * o = &occluders[i];
+            if(!_lv_area_is_on(o, area)) continue;
+            if(_lv_area_is_in(area, o, 0)) return true;
+
+            if(o->y1 <= area->y1 && o->y2 >= area->y2) {
+                if(o->x1 <= area->x1) {
+                    area->x1 = o->x2 + 1;
+                    changed = true;
+                }
+                else if(o->x2 >= area->x2) {
+                    area->x2 = o->x1 - 1;
+                    changed = true;
+                }
+            }
+            else if(o->x1 <= area->x1 && o->x2 >= area->x2) {
+                if(o->y1 <= area->y1) {
+                    area->y1 = o->y2 + 1;
+                    changed = true;
+                }
+                else if(o->y2 >= area->y2) {
+                    area->y2 = o->y1 - 1;
+                    changed = true;
+                }
+            }
+        }
+    }
+
+    return false;
+}
+
+/**
+ * Get a new record to mark an object as fully or partly covered
+ * @param obj       pointer to the object
+ * @return          pointer to the record or NULL if there is no more space
+ */
+static occlusion_rec_t * occlusion_add_rec(lv_obj_t * obj)
+{
+    if(occlusion_rec_cnt >= OCCLUSION_REC_MAX) return NULL;
+
+    occlusion_rec_t * rec = &occlusion_recs[occlusion_rec_cnt];
+    occlusion_rec_cnt++;
+    rec->obj = obj;
+    return rec;
+}
+
+/**
+ * Remove the marks from the objects after drawing
+ */
+static void occlusion_clear(void)
+{
+    uint32_t i;
+    for(i = 0; i < occlusion_rec_cnt; i++) {
+        occlusion_recs[i].obj->refr_culled = 0;
+        occlusion_recs[i].obj->refr_main_clip = 0;
+    }
+    occlusion_rec_cnt = 0;
+    occluder_cnt = 0;
+}
+
+/**
+ * Limit a clip area to the visible part of an object's main part
+ * @param obj           pointer to an object with `refr_main_clip` set
+ * @param clip_area     the clip area to limit
+ * @return              false: the main part is not visible on the clip area
+ */
+static bool occlusion_get_main_clip(lv_obj_t * obj, lv_area_t * clip_area)
+{
+    uint32_t i;
+    for(i = 0; i < occlusion_rec_cnt; i++) {
+        if(occlusion_recs[i].obj == obj) {
+            return _lv_area_intersect(clip_area, clip_area, &occlusion_recs[i].main_clip);
+        }
+    }
+
+    return true;
+}
+#endif
+
 #if LV_USE_PERF_MONITOR
 static void perf_monitor_init(perf_monitor_t * _perf_monitor)
 {
@@ -26,6 +26,19 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+#if LV_USE_REFR_STAT
+typedef struct {
+    uint32_t frames;            /*Refreshes which rendered something*/
+    uint32_t areas;             /*Areas rendered after joining the invalidated areas*/
+    uint32_t px_dirty;          /*Pixels really invalidated*/
+    uint32_t px_rendered;       /*Pixels rendered (dirty + added by joining the areas)*/
+    uint32_t inv_overflow;      /*Areas joined to an other because the area buffer was full*/
+    uint32_t px_written;        /*Pixels written by the software renderer (rendered + overdraw)*/
+    uint32_t obj_culled;        /*Objects or their main part not drawn because they were covered*/
+    uint32_t obj_clipped;       /*Objects whose main part was drawn on a smaller area because they were partly covered*/
+} lv_refr_stat_t;
+#endif
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
@@ -98,6 +111,47 @@ void lv_refr_reset_fps_counter(void);
 uint32_t lv_refr_get_fps_avg(void);
 #endif
 
+#if LV_USE_REFR_STAT
+/**
+ * Get the statistics of the refreshed areas since the last `lv_refr_reset_stat()`
+ * @param stat      store the statistics here
+ */
+void lv_refr_get_stat(lv_refr_stat_t * stat);
+
+/**
+ * Reset the statistics of the refreshed areas
+ */
+void lv_refr_reset_stat(void);
+#endif
+
+#if LV_USE_PARALLEL_REFR
+/**
+ * Stop the rendering threads and free their resources
+ */
+void _lv_refr_deinit(void);
+
+/**
+ * Set the number of threads rendering the refreshed areas.
+ * The threads are started or stopped on the next refresh.
+ * @param cnt   threads including the one calling `lv_timer_handler()`, 1: render only on the calling thread
+ */
+void lv_refr_set_thread_cnt(uint32_t cnt);
+
+/**
+ * Get the number of threads rendering the refreshed areas
+ * @return      the number of threads (1 if the threads couldn't be started)
+ */
+uint32_t lv_refr_get_thread_cnt(void);
+#endif
+
+#if LV_REFR_OCCLUDER_MAX
+/**
+ * Enable or disable skipping the drawing of the covered objects
+ * @param en    true: enable (default); false: draw every object
+ */
+void lv_refr_enable_occlusion(bool en);
+#endif
+
 /**
  * Called periodically to handle the refreshing
  * @param timer pointer to the timer itself
@@ -75,18 +75,18 @@ static uint32_t disp_ori_timer_period;
 static uint32_t anim_ori_timer_period;
 
 #if LV_DEMO_BENCHMARK_RGB565A8 && LV_COLOR_DEPTH == 16
-    LV_IMG_DECLARE(img_benchmark_cogwheel_rgb565a8);
+    LV_IMG_DECLARE(img_benchmark_cogwheel_rgb565a8)
 #else
-    LV_IMG_DECLARE(img_benchmark_cogwheel_argb);
+    LV_IMG_DECLARE(img_benchmark_cogwheel_argb)
 #endif
-LV_IMG_DECLARE(img_benchmark_cogwheel_rgb);
-LV_IMG_DECLARE(img_benchmark_cogwheel_chroma_keyed);
-LV_IMG_DECLARE(img_benchmark_cogwheel_indexed16);
-LV_IMG_DECLARE(img_benchmark_cogwheel_alpha16);
+LV_IMG_DECLARE(img_benchmark_cogwheel_rgb)
+LV_IMG_DECLARE(img_benchmark_cogwheel_chroma_keyed)
+LV_IMG_DECLARE(img_benchmark_cogwheel_indexed16)
+LV_IMG_DECLARE(img_benchmark_cogwheel_alpha16)
 
-LV_FONT_DECLARE(lv_font_benchmark_montserrat_12_compr_az);
-LV_FONT_DECLARE(lv_font_benchmark_montserrat_16_compr_az);
-LV_FONT_DECLARE(lv_font_benchmark_montserrat_28_compr_az);
+LV_FONT_DECLARE(lv_font_benchmark_montserrat_12_compr_az)
+LV_FONT_DECLARE(lv_font_benchmark_montserrat_16_compr_az)
+LV_FONT_DECLARE(lv_font_benchmark_montserrat_28_compr_az)
 
 static void monitor_cb(lv_disp_drv_t * drv, uint32_t time, uint32_t px);
 static void next_scene_timer_cb(lv_timer_t * timer);
@@ -637,6 +637,7 @@ static lv_obj_t * title;
 static lv_obj_t * subtitle;
 static uint32_t rnd_act;
 static lv_timer_t * next_scene_timer;
+static lv_timer_t * report_timer;
 
 static const uint32_t rnd_map[] = {
     0xbd13204f, 0x67d8167f, 0x20211c99, 0xb0a7cc05,
@@ -716,6 +717,10 @@ void lv_demo_benchmark_close(void)
     if(next_scene_timer) lv_timer_del(next_scene_timer);
     next_scene_timer = NULL;
 
+    /*The labels of the report are deleted below*/
+    if(report_timer) lv_timer_del(report_timer);
+    report_timer = NULL;
+
     lv_anim_del(NULL, NULL);
 
     lv_style_reset(&style_common);
@@ -728,7 +733,7 @@ void lv_demo_benchmark_run_scene(int_fast16_t scene_no)
 {
     benchmark_init();
 
-    if(((scene_no >> 1) >= dimof(scenes))) {
+    if(scene_no < 0 || (size_t)(scene_no >> 1) >= dimof(scenes)) {
         /* invalid scene number */
         return ;
     }
@@ -745,11 +750,24 @@ void lv_demo_benchmark_run_scene(int_fast16_t scene_no)
         rnd_reset();
         scenes[scene_act].create_cb();
 
-        lv_timer_t * t = lv_timer_create(report_cb, SCENE_TIME, NULL);
-        lv_timer_set_repeat_count(t, 1);
+        report_timer = lv_timer_create(report_cb, SCENE_TIME, NULL);
+        lv_timer_set_repeat_count(report_timer, 1);
     }
 }
 
+const char * lv_demo_benchmark_get_scene_name(int_fast16_t scene_no)
+{
+    if(scene_no < 0 || scene_no >= lv_demo_benchmark_get_scene_cnt()) return NULL;
+
+    return scenes[scene_no >> 1].name;
+}
+
+int_fast16_t lv_demo_benchmark_get_scene_cnt(void)
+{
+    /*The last scene is only a terminator*/
+    return (int_fast16_t)(dimof(scenes) - 1) * 2;
+}
+
 
 void lv_demo_benchmark_set_finished_cb(finished_cb_t * finished_cb)
 {
@@ -959,6 +977,9 @@ static void generate_report(void)
 
 static void report_cb(lv_timer_t * timer)
 {
+    LV_UNUSED(timer);
+    report_timer = NULL;
+
     if(NULL != benchmark_finished_cb) {
         (*benchmark_finished_cb)();
     }
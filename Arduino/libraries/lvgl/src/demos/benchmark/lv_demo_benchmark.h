@@ -34,6 +34,20 @@ void lv_demo_benchmark_close(void);
 
 void lv_demo_benchmark_run_scene(int_fast16_t scene_no);
 
+/**
+ * Get the name of a scene
+ * @param scene_no  the number of the scene as in `lv_demo_benchmark_run_scene()`.
+ *                  The odd numbers are the same scenes with opacity.
+ * @return          the name of the scene (without the " + opa" suffix) or NULL if `scene_no` is invalid
+ */
+const char * lv_demo_benchmark_get_scene_name(int_fast16_t scene_no);
+
+/**
+ * Get the number of scenes which can be passed to `lv_demo_benchmark_run_scene()`
+ * @return          number of scenes including the scenes with opacity
+ */
+int_fast16_t lv_demo_benchmark_get_scene_cnt(void);
+
 void lv_demo_benchmark_set_finished_cb(finished_cb_t * finished_cb);
 
 /**
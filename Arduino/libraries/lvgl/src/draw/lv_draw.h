@@ -72,6 +72,13 @@ typedef struct _lv_draw_ctx_t  {
      */
     const lv_area_t * clip_area;
 
+#if LV_USE_REFR_STAT
+    /**
+     * Number of pixels written by the software renderer
+     */
+    uint32_t px_written;
+#endif
+
     void (*init_buf)(struct _lv_draw_ctx_t * draw_ctx);
 
     void (*draw_rect)(struct _lv_draw_ctx_t * draw_ctx, const lv_draw_rect_dsc_t * dsc, const lv_area_t * coords);
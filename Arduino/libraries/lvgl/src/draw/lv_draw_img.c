@@ -13,6 +13,7 @@
 #include "../core/lv_refr.h"
 #include "../misc/lv_mem.h"
 #include "../misc/lv_math.h"
+#include "../misc/lv_thread.h"
 
 /*********************
  *      DEFINES
@@ -77,7 +78,10 @@ void lv_draw_img(lv_draw_ctx_t * draw_ctx, const lv_draw_img_dsc_t * dsc, const
     }
 
     if(res != LV_RES_OK) {
+        /*The cache entries can be closed by any opening, so keep them while the image is drawn*/
+        lv_thread_lock(LV_THREAD_LOCK_IMG_CACHE);
         res = decode_and_draw(draw_ctx, dsc, coords, src);
+        lv_thread_unlock(LV_THREAD_LOCK_IMG_CACHE);
     }
 
     if(res != LV_RES_OK) {
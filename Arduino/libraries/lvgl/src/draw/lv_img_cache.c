@@ -43,6 +43,7 @@
 #if LV_IMG_CACHE_DEF_SIZE
     static uint16_t entry_cnt;
 #endif
+static lv_img_cache_stat_t cache_stat;
 
 /**********************
  *      MACROS
@@ -97,7 +98,10 @@ _lv_img_cache_entry_t * _lv_img_cache_open(const void * src, lv_color_t color, i
     }
 
     /*The image is not cached then cache it now*/
-    if(cached_src) return cached_src;
+    if(cached_src) {
+        cache_stat.hit++;
+        return cached_src;
+    }
 
     /*Find an entry to reuse. Select the entry with the least life*/
     cached_src = &cache[0];
@@ -118,6 +122,8 @@ _lv_img_cache_entry_t * _lv_img_cache_open(const void * src, lv_color_t color, i
 #else
     cached_src = &LV_GC_ROOT(_lv_img_cache_single);
 #endif
+    cache_stat.miss++;
+
     /*Open the image and measure the time to open*/
     uint32_t t_start  = lv_tick_get();
     lv_res_t open_res = lv_img_decoder_open(&cached_src->dec_dsc, src, color, frame_id);
@@ -196,6 +202,16 @@ void lv_img_cache_invalidate_src(const void * src)
 #endif
 }
 
+void lv_img_cache_get_stat(lv_img_cache_stat_t * stat)
+{
+    *stat = cache_stat;
+}
+
+void lv_img_cache_reset_stat(void)
+{
+    lv_memset_00(&cache_stat, sizeof(cache_stat));
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -37,6 +37,11 @@ typedef struct {
     int32_t life;
 } _lv_img_cache_entry_t;
 
+typedef struct {
+    uint32_t hit;               /*Images found open in the cache*/
+    uint32_t miss;              /*Images opened with a decoder*/
+} lv_img_cache_stat_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -67,6 +72,17 @@ void lv_img_cache_set_size(uint16_t new_slot_num);
  */
 void lv_img_cache_invalidate_src(const void * src);
 
+/**
+ * Get the statistics of the image cache since the last `lv_img_cache_reset_stat()`
+ * @param stat      store the statistics here
+ */
+void lv_img_cache_get_stat(lv_img_cache_stat_t * stat);
+
+/**
+ * Reset the statistics of the image cache
+ */
+void lv_img_cache_reset_stat(void);
+
 /**********************
  *      MACROS
  **********************/
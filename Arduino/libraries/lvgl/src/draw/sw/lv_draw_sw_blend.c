@@ -8,6 +8,7 @@
  *********************/
 #include "lv_draw_sw.h"
 #include "../../misc/lv_math.h"
+#include "../../misc/lv_thread.h"
 #include "../../hal/lv_hal_disp.h"
 #include "../../core/lv_refr.h"
 
@@ -104,6 +105,12 @@ void lv_draw_sw_blend(lv_draw_ctx_t * draw_ctx, const lv_draw_sw_blend_dsc_t * d
 
     if(draw_ctx->wait_for_finish) draw_ctx->wait_for_finish(draw_ctx);
 
+#if LV_USE_REFR_STAT
+    if(dsc->mask_buf == NULL || dsc->mask_res != LV_DRAW_MASK_RES_TRANSP) {
+        draw_ctx->px_written += lv_area_get_size(&blend_area);
+    }
+#endif
+
     ((lv_draw_sw_ctx_t *)draw_ctx)->blend(draw_ctx, dsc);
 }
 
@@ -409,10 +416,10 @@ static inline void set_px_argb(uint8_t * buf, lv_color_t color, lv_opa_t opa)
 static inline void set_px_argb_blend(uint8_t * buf, lv_color_t color, lv_opa_t opa, lv_color_t (*blend_fp)(lv_color_t,
                                                                                                            lv_color_t, lv_opa_t))
 {
-    static lv_color_t last_dest_color;
-    static lv_color_t last_src_color;
-    static lv_color_t last_res_color;
-    static uint32_t last_opa = 0xffff; /*Set to an invalid value for first*/
+    static LV_THREAD_LOCAL lv_color_t last_dest_color;
+    static LV_THREAD_LOCAL lv_color_t last_src_color;
+    static LV_THREAD_LOCAL lv_color_t last_res_color;
+    static LV_THREAD_LOCAL uint32_t last_opa = 0xffff; /*Set to an invalid value for first*/
 
     lv_color_t bg_color;
 
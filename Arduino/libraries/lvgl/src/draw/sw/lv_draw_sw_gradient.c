@@ -9,6 +9,7 @@
 #include "lv_draw_sw_gradient.h"
 #include "../../misc/lv_gc.h"
 #include "../../misc/lv_types.h"
+#include "../../misc/lv_thread.h"
 
 /*********************
  *      DEFINES
@@ -40,7 +41,7 @@ static lv_grad_t * next_in_cache(lv_grad_t * item);
 typedef lv_res_t (*op_cache_t)(lv_grad_t * c, void * ctx);
 static lv_res_t iterate_cache(op_cache_t func, void * ctx, lv_grad_t ** out);
 static size_t get_cache_item_size(lv_grad_t * c);
-static lv_grad_t * allocate_item(const lv_grad_dsc_t * g, lv_coord_t w, lv_coord_t h);
+static lv_grad_t * allocate_item(const lv_grad_dsc_t * g, lv_coord_t w, lv_coord_t h, bool use_cache);
 static lv_res_t find_oldest_item_life(lv_grad_t * c, void * ctx);
 static lv_res_t kill_oldest_item(lv_grad_t * c, void * ctx);
 static lv_res_t find_item(lv_grad_t * c, void * ctx);
@@ -155,7 +156,7 @@ static lv_res_t find_item(lv_grad_t * c, void * ctx)
     return LV_RES_INV;
 }
 
-static lv_grad_t * allocate_item(const lv_grad_dsc_t * g, lv_coord_t w, lv_coord_t h)
+static lv_grad_t * allocate_item(const lv_grad_dsc_t * g, lv_coord_t w, lv_coord_t h, bool use_cache)
 {
     lv_coord_t size = g->dir == LV_GRAD_DIR_HOR ? w : h;
     lv_coord_t map_size = LV_MAX(w, h); /* The map is being used horizontally (width) unless
@@ -171,13 +172,13 @@ static lv_grad_t * allocate_item(const lv_grad_dsc_t * g, lv_coord_t w, lv_coord
 
     size_t act_size = (size_t)(grad_cache_end - LV_GC_ROOT(_lv_grad_cache_mem));
     lv_grad_t * item = NULL;
-    if(req_size + act_size < grad_cache_size) {
+    if(use_cache && req_size + act_size < grad_cache_size) {
         item = (lv_grad_t *)grad_cache_end;
         item->not_cached = 0;
     }
     else {
         /*Need to evict items from cache until we find enough space to allocate this one */
-        if(req_size <= grad_cache_size) {
+        if(use_cache && req_size <= grad_cache_size) {
             while(act_size + req_size > grad_cache_size) {
                 uint32_t oldest_life = UINT32_MAX;
                 iterate_cache(&find_oldest_item_life, &oldest_life, NULL);
@@ -253,9 +254,12 @@ lv_grad_t * lv_gradient_get(const lv_grad_dsc_t * g, lv_coord_t w, lv_coord_t h)
     /* No gradient, no cache */
     if(g->dir == LV_GRAD_DIR_NONE) return NULL;
 
+    /* The cache is shared by the rendering threads, don't use it while they are running */
+    bool use_cache = !lv_thread_pool_is_running();
+
     /* Step 0: Check if the cache exist (else create it) */
     static bool inited = false;
-    if(!inited) {
+    if(use_cache && !inited) {
         lv_gradient_set_cache_size(LV_GRAD_CACHE_DEF_SIZE);
         inited = true;
     }
@@ -264,13 +268,13 @@ lv_grad_t * lv_gradient_get(const lv_grad_dsc_t * g, lv_coord_t w, lv_coord_t h)
     lv_coord_t size = g->dir == LV_GRAD_DIR_HOR ? w : h;
     uint32_t key = compute_key(g, size, w);
     lv_grad_t * item = NULL;
-    if(iterate_cache(&find_item, &key, &item) == LV_RES_OK) {
+    if(use_cache && iterate_cache(&find_item, &key, &item) == LV_RES_OK) {
         item->life++; /* Don't forget to bump the counter */
         return item;
     }
 
     /* Step 2: Need to allocate an item for it */
-    item = allocate_item(g, w, h);
+    item = allocate_item(g, w, h, use_cache);
     if(item == NULL) {
         LV_LOG_WARN("Faild to allcoate item for teh gradient");
         return item;
@@ -35,7 +35,8 @@ const lv_obj_class_t lv_gif_class = {
     .constructor_cb = lv_gif_constructor,
     .destructor_cb = lv_gif_destructor,
     .instance_size = sizeof(lv_gif_t),
-    .base_class = &lv_img_class
+    .base_class = &lv_img_class,
+    .parallel_draw = 1,
 };
 
 /**********************
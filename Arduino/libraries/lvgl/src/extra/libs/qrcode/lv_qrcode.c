@@ -33,7 +33,8 @@ static void lv_qrcode_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
 const lv_obj_class_t lv_qrcode_class = {
     .constructor_cb = lv_qrcode_constructor,
     .destructor_cb = lv_qrcode_destructor,
-    .base_class = &lv_canvas_class
+    .base_class = &lv_canvas_class,
+    .parallel_draw = 1,
 };
 
 static lv_coord_t size_param;
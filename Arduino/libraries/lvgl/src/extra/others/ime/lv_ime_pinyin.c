@@ -53,7 +53,8 @@ const lv_obj_class_t lv_ime_pinyin_class = {
     .height_def     = LV_SIZE_CONTENT,
     .group_def      = LV_OBJ_CLASS_GROUP_DEF_TRUE,
     .instance_size  = sizeof(lv_ime_pinyin_t),
-    .base_class     = &lv_obj_class
+    .base_class     = &lv_obj_class,
+    .parallel_draw = 1,
 };
 
 #if LV_IME_PINYIN_USE_K9_MODE
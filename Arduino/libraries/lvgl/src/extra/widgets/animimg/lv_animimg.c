@@ -45,7 +45,8 @@ static void lv_animimg_constructor(const lv_obj_class_t * class_p, lv_obj_t * ob
 const lv_obj_class_t lv_animimg_class = {
     .constructor_cb = lv_animimg_constructor,
     .instance_size = sizeof(lv_animimg_t),
-    .base_class = &lv_img_class
+    .base_class = &lv_img_class,
+    .parallel_draw = 1,
 };
 
 /**********************
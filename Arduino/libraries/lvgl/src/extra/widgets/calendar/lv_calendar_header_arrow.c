@@ -36,7 +36,8 @@ const lv_obj_class_t lv_calendar_header_arrow_class = {
     .base_class = &lv_obj_class,
     .constructor_cb = my_constructor,
     .width_def = LV_PCT(100),
-    .height_def = LV_DPI_DEF / 3
+    .height_def = LV_DPI_DEF / 3,
+    .parallel_draw = 1,
 };
 
 static const char * month_names_def[12] = LV_CALENDAR_DEFAULT_MONTH_NAMES;
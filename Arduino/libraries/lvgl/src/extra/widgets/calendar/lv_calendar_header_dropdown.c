@@ -36,7 +36,8 @@ const lv_obj_class_t lv_calendar_header_dropdown_class = {
     .base_class = &lv_obj_class,
     .width_def = LV_PCT(100),
     .height_def = LV_SIZE_CONTENT,
-    .constructor_cb = my_constructor
+    .constructor_cb = my_constructor,
+    .parallel_draw = 1,
 };
 
 static const char * month_list = "01\n02\n03\n04\n05\n06\n07\n08\n09\n10\n11\n12";
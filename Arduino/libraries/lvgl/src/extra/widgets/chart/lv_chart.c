@@ -50,10 +50,12 @@ const lv_obj_class_t lv_chart_class = {
     .constructor_cb = lv_chart_constructor,
     .destructor_cb = lv_chart_destructor,
     .event_cb = lv_chart_event,
+    .event_skip = LV_OBJ_CLASS_EVENT_SKIP_ALL & ~LV_OBJ_CLASS_EVENT_SKIP_GET_SELF_SIZE,
     .width_def = LV_PCT(100),
     .height_def = LV_DPI_DEF * 2,
     .instance_size = sizeof(lv_chart_t),
-    .base_class = &lv_obj_class
+    .base_class = &lv_obj_class,
+    .parallel_draw = 1,
 };
 
 /**********************
@@ -11,6 +11,7 @@
 #if LV_USE_COLORWHEEL
 
 #include "../../../misc/lv_assert.h"
+#include "../../../misc/lv_thread.h"
 
 /*********************
  *      DEFINES
@@ -54,6 +55,8 @@ static uint16_t get_angle(lv_obj_t * obj);
 const lv_obj_class_t lv_colorwheel_class = {.instance_size = sizeof(lv_colorwheel_t), .base_class = &lv_obj_class,
                                             .constructor_cb = lv_colorwheel_constructor,
                                             .event_cb = lv_colorwheel_event,
+                                            .event_skip = LV_OBJ_CLASS_EVENT_SKIP_DRAW_BEGIN_END | LV_OBJ_CLASS_EVENT_SKIP_DRAW_PART |
+                                                          LV_OBJ_CLASS_EVENT_SKIP_GET_SELF_SIZE,
                                             .width_def = LV_DPI_DEF * 2,
                                             .height_def = LV_DPI_DEF * 2,
                                             .editable = LV_OBJ_CLASS_EDITABLE_TRUE,
@@ -649,9 +652,9 @@ static lv_color_t angle_to_mode_color_fast(lv_obj_t * obj, uint16_t angle)
 {
     lv_colorwheel_t * ext = (lv_colorwheel_t *)obj;
     uint8_t r = 0, g = 0, b = 0;
-    static uint16_t h = 0;
-    static uint8_t s = 0, v = 0, m = 255;
-    static uint16_t angle_saved = 0xffff;
+    static LV_THREAD_LOCAL uint16_t h = 0;
+    static LV_THREAD_LOCAL uint8_t s = 0, v = 0, m = 255;
+    static LV_THREAD_LOCAL uint16_t angle_saved = 0xffff;
 
     /*If the angle is different recalculate scaling*/
     if(angle_saved != angle) m = 255;
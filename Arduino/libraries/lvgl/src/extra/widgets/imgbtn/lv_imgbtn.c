@@ -38,6 +38,8 @@ const lv_obj_class_t lv_imgbtn_class = {
     .instance_size = sizeof(lv_imgbtn_t),
     .constructor_cb = lv_imgbtn_constructor,
     .event_cb = lv_imgbtn_event,
+    .event_skip = LV_OBJ_CLASS_EVENT_SKIP_HIT_TEST | LV_OBJ_CLASS_EVENT_SKIP_DRAW_BEGIN_END | LV_OBJ_CLASS_EVENT_SKIP_DRAW_PART,
+    .parallel_draw = 1,
 };
 
 /**********************
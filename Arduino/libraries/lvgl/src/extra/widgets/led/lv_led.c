@@ -35,7 +35,9 @@ const lv_obj_class_t lv_led_class  = {
     .width_def = LV_DPI_DEF / 5,
     .height_def = LV_DPI_DEF / 5,
     .event_cb = lv_led_event,
+    .event_skip = LV_OBJ_CLASS_EVENT_SKIP_ALL & ~LV_OBJ_CLASS_EVENT_SKIP_DRAW_BEGIN_END,
     .instance_size = sizeof(lv_led_t),
+    .parallel_draw = 1,
 };
 
 /**********************
@@ -30,15 +30,18 @@
 const lv_obj_class_t lv_list_class = {
     .base_class = &lv_obj_class,
     .width_def = (LV_DPI_DEF * 3) / 2,
-    .height_def = LV_DPI_DEF * 2
+    .height_def = LV_DPI_DEF * 2,
+    .parallel_draw = 1,
 };
 
 const lv_obj_class_t lv_list_btn_class = {
     .base_class = &lv_btn_class,
+    .parallel_draw = 1,
 };
 
 const lv_obj_class_t lv_list_text_class = {
     .base_class = &lv_label_class,
+    .parallel_draw = 1,
 };
 
 /**********************
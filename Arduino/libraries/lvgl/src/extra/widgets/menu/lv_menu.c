@@ -41,7 +41,8 @@ const lv_obj_class_t lv_menu_class = {
     .base_class = &lv_obj_class,
     .width_def = (LV_DPI_DEF * 3) / 2,
     .height_def = LV_DPI_DEF * 2,
-    .instance_size = sizeof(lv_menu_t)
+    .instance_size = sizeof(lv_menu_t),
+    .parallel_draw = 1,
 };
 const lv_obj_class_t lv_menu_page_class = {
     .constructor_cb = lv_menu_page_constructor,
@@ -49,43 +50,51 @@ const lv_obj_class_t lv_menu_page_class = {
     .base_class = &lv_obj_class,
     .width_def = LV_PCT(100),
     .height_def = LV_SIZE_CONTENT,
-    .instance_size = sizeof(lv_menu_page_t)
+    .instance_size = sizeof(lv_menu_page_t),
+    .parallel_draw = 1,
 };
 
 const lv_obj_class_t lv_menu_cont_class = {
     .constructor_cb = lv_menu_cont_constructor,
     .base_class = &lv_obj_class,
     .width_def = LV_PCT(100),
-    .height_def = LV_SIZE_CONTENT
+    .height_def = LV_SIZE_CONTENT,
+    .parallel_draw = 1,
 };
 
 const lv_obj_class_t lv_menu_section_class = {
     .constructor_cb = lv_menu_section_constructor,
     .base_class = &lv_obj_class,
     .width_def = LV_PCT(100),
-    .height_def = LV_SIZE_CONTENT
+    .height_def = LV_SIZE_CONTENT,
+    .parallel_draw = 1,
 };
 
 const lv_obj_class_t lv_menu_separator_class = {
     .base_class = &lv_obj_class,
     .width_def = LV_SIZE_CONTENT,
-    .height_def = LV_SIZE_CONTENT
+    .height_def = LV_SIZE_CONTENT,
+    .parallel_draw = 1,
 };
 
 const lv_obj_class_t lv_menu_sidebar_cont_class = {
-    .base_class = &lv_obj_class
+    .base_class = &lv_obj_class,
+    .parallel_draw = 1,
 };
 
 const lv_obj_class_t lv_menu_main_cont_class = {
-    .base_class = &lv_obj_class
+    .base_class = &lv_obj_class,
+    .parallel_draw = 1,
 };
 
 const lv_obj_class_t lv_menu_main_header_cont_class = {
-    .base_class = &lv_obj_class
+    .base_class = &lv_obj_class,
+    .parallel_draw = 1,
 };
 
 const lv_obj_class_t lv_menu_sidebar_header_cont_class = {
-    .base_class = &lv_obj_class
+    .base_class = &lv_obj_class,
+    .parallel_draw = 1,
 };
 
 static void lv_menu_refr(lv_obj_t * obj);
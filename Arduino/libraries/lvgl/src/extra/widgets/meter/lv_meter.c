@@ -39,8 +39,10 @@ const lv_obj_class_t lv_meter_class = {
     .constructor_cb = lv_meter_constructor,
     .destructor_cb = lv_meter_destructor,
     .event_cb = lv_meter_event,
+    .event_skip = LV_OBJ_CLASS_EVENT_SKIP_ALL,
     .instance_size = sizeof(lv_meter_t),
-    .base_class = &lv_obj_class
+    .base_class = &lv_obj_class,
+    .parallel_draw = 1,
 };
 
 /**********************
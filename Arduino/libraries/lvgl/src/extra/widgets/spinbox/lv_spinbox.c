@@ -34,10 +34,12 @@ static void lv_spinbox_updatevalue(lv_obj_t * obj);
 const lv_obj_class_t lv_spinbox_class = {
     .constructor_cb = lv_spinbox_constructor,
     .event_cb = lv_spinbox_event,
+    .event_skip = LV_OBJ_CLASS_EVENT_SKIP_ALL,
     .width_def = LV_DPI_DEF,
     .instance_size = sizeof(lv_spinbox_t),
     .editable = LV_OBJ_CLASS_EDITABLE_TRUE,
-    .base_class = &lv_textarea_class
+    .base_class = &lv_textarea_class,
+    .parallel_draw = 1,
 };
 /**********************
  *      MACROS
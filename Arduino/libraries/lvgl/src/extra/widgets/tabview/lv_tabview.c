@@ -36,10 +36,12 @@ const lv_obj_class_t lv_tabview_class = {
     .constructor_cb = lv_tabview_constructor,
     .destructor_cb = lv_tabview_destructor,
     .event_cb = lv_tabview_event,
+    .event_skip = LV_OBJ_CLASS_EVENT_SKIP_ALL,
     .width_def = LV_PCT(100),
     .height_def = LV_PCT(100),
     .base_class = &lv_obj_class,
-    .instance_size = sizeof(lv_tabview_t)
+    .instance_size = sizeof(lv_tabview_t),
+    .parallel_draw = 1,
 };
 
 static lv_dir_t tabpos_create;
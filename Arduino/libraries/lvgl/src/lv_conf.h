@@ -66,6 +66,17 @@
     #define LV_MEM_CUSTOM_REALLOC realloc
 #endif     /*LV_MEM_CUSTOM*/
 
+/*Serve the small allocations of the built-in `lv_mem_alloc()` (`LV_MEM_CUSTOM == 0`) from pages of equal sized slots.
+ *The objects, styles, list nodes, etc. don't fragment the heap this way and creating and deleting screens is faster.*/
+#define LV_MEM_SLAB 0
+#if LV_MEM_SLAB
+    /*Allocations up to this size are served from the slabs. There is a size class in every 8 bytes*/
+    #define LV_MEM_SLAB_MAX_SIZE 64         /*[bytes]*/
+
+    /*Size of the pages allocated for the size classes. Needs to be a power of 2*/
+    #define LV_MEM_SLAB_PAGE_SIZE 512       /*[bytes]*/
+#endif
+
 /*Number of the intermediate memory buffer used during rendering and other internal processing mechanisms.
  *You will see an error log message if there wasn't enough buffers. */
 #define LV_MEM_BUF_MAX_NUM 16
@@ -80,6 +91,17 @@
 /*Default display refresh period. LVG will redraw changed areas with this period time*/
 #define LV_DISP_DEF_REFR_PERIOD 30      /*[ms]*/
 
+/*Join two invalidated areas if the joined area has at most this many more pixels than the two areas together
+ *(the common part of overlapping areas would be rendered twice if they were not joined).
+ *Rendering an area has a fixed cost (checking the widgets, calling `flush_cb`, setting the window of the display)
+ *which is about the same as rendering this many pixels.*/
+#define LV_REFR_AREA_JOIN_COST 1024     /*[px]*/
+
+/*Don't draw the widgets (or parts of them) which are covered by opaque widgets in front of them.
+ *The opaque areas are collected before drawing each part of the invalidated areas. Max number of opaque areas to use
+ *(e.g. 16). It helps if opaque widgets cover others, e.g. stacked pages or panels with opaque background.*/
+#define LV_REFR_OCCLUDER_MAX 0          /*0: disable*/
+
 /*Input device read period in milliseconds*/
 #define LV_INDEV_DEF_READ_PERIOD 30     /*[ms]*/
 
@@ -172,6 +194,17 @@
  *Only used if software rotation is enabled in the display driver.*/
 #define LV_DISP_ROT_MAX_BUF (10*1024)
 
+/*Render the refreshed areas in horizontal bands on several threads (needs POSIX threads).
+ *Only the software renderer is used in parallel and the draw events are sent from the worker threads.
+ *LV_PARALLEL_REFR_THREADS: threads rendering a frame, including the one calling `lv_timer_handler()`,
+ *                          by default not more than the cores online
+ *LV_PARALLEL_REFR_MIN_ROWS: bands are not made smaller than this (rows)*/
+#define LV_USE_PARALLEL_REFR 0
+#if LV_USE_PARALLEL_REFR
+    #define LV_PARALLEL_REFR_THREADS  4
+    #define LV_PARALLEL_REFR_MIN_ROWS 16
+#endif
+
 /*-------------
  * GPU
  *-----------*/
@@ -294,6 +327,10 @@
 /*1: Draw random colored rectangles over the redrawn areas*/
 #define LV_USE_REFR_DEBUG 0
 
+/*1: Count the rendered, the really invalidated and the written pixels. See `lv_refr_get_stat()`
+ *The performance monitor shows the overdraw (written / rendered pixels) too.*/
+#define LV_USE_REFR_STAT 0
+
 /*Change the built in (v)snprintf functions*/
 #define LV_SPRINTF_CUSTOM 0
 #if LV_SPRINTF_CUSTOM
@@ -306,6 +343,12 @@
 
 #define LV_USE_USER_DATA 1
 
+/*Cache the resolved style properties of the objects to avoid searching their styles again and again.
+ *Number of cached properties per object (power of 2, e.g. 64). It costs about 12 bytes per property for each object
+ *on 32 bit systems, but the cache is allocated only when a property of the object is read.
+ *0: disable caching*/
+#define LV_OBJ_STYLE_CACHE_SIZE 0
+
 /*Garbage Collector settings
  *Used if lvgl is bound to higher level language and the memory is managed by that language*/
 #define LV_ENABLE_GC 0
@@ -602,6 +645,10 @@
 /*A layout similar to Grid in CSS.*/
 #define LV_USE_GRID 1
 
+/*Update the layout only in the containers where it was invalidated and
+ *cache the measured size of the labels and images until their content changes*/
+#define LV_LAYOUT_CACHE 0
+
 /*---------------------
  * 3rd party libraries
  *--------------------*/
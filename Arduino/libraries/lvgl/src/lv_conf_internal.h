@@ -188,6 +188,35 @@
     #endif
 #endif     /*LV_MEM_CUSTOM*/
 
+/*Serve the small allocations of the built-in `lv_mem_alloc()` (`LV_MEM_CUSTOM == 0`) from pages of equal sized slots.
+ *The objects, styles, list nodes, etc. don't fragment the heap this way and creating and deleting screens is faster.*/
+#ifndef LV_MEM_SLAB
+    #ifdef CONFIG_LV_MEM_SLAB
+        #define LV_MEM_SLAB CONFIG_LV_MEM_SLAB
+    #else
+        #define LV_MEM_SLAB 0
+    #endif
+#endif
+#if LV_MEM_SLAB
+    /*Allocations up to this size are served from the slabs. There is a size class in every 8 bytes*/
+    #ifndef LV_MEM_SLAB_MAX_SIZE
+        #ifdef CONFIG_LV_MEM_SLAB_MAX_SIZE
+            #define LV_MEM_SLAB_MAX_SIZE CONFIG_LV_MEM_SLAB_MAX_SIZE
+        #else
+            #define LV_MEM_SLAB_MAX_SIZE 64         /*[bytes]*/
+        #endif
+    #endif
+
+    /*Size of the pages allocated for the size classes. Needs to be a power of 2*/
+    #ifndef LV_MEM_SLAB_PAGE_SIZE
+        #ifdef CONFIG_LV_MEM_SLAB_PAGE_SIZE
+            #define LV_MEM_SLAB_PAGE_SIZE CONFIG_LV_MEM_SLAB_PAGE_SIZE
+        #else
+            #define LV_MEM_SLAB_PAGE_SIZE 512       /*[bytes]*/
+        #endif
+    #endif
+#endif
+
 /*Number of the intermediate memory buffer used during rendering and other internal processing mechanisms.
  *You will see an error log message if there wasn't enough buffers. */
 #ifndef LV_MEM_BUF_MAX_NUM
@@ -220,6 +249,29 @@
     #endif
 #endif
 
+/*Join two invalidated areas if the joined area has at most this many more pixels than the two areas together
+ *(the common part of overlapping areas would be rendered twice if they were not joined).
+ *Rendering an area has a fixed cost (checking the widgets, calling `flush_cb`, setting the window of the display)
+ *which is about the same as rendering this many pixels.*/
+#ifndef LV_REFR_AREA_JOIN_COST
+    #ifdef CONFIG_LV_REFR_AREA_JOIN_COST
+        #define LV_REFR_AREA_JOIN_COST CONFIG_LV_REFR_AREA_JOIN_COST
+    #else
+        #define LV_REFR_AREA_JOIN_COST 1024     /*[px]*/
+    #endif
+#endif
+
+/*Don't draw the widgets (or parts of them) which are covered by opaque widgets in front of them.
+ *The opaque areas are collected before drawing each part of the invalidated areas. Max number of opaque areas to use
+ *(e.g. 16). It helps if opaque widgets cover others, e.g. stacked pages or panels with opaque background.*/
+#ifndef LV_REFR_OCCLUDER_MAX
+    #ifdef CONFIG_LV_REFR_OCCLUDER_MAX
+        #define LV_REFR_OCCLUDER_MAX CONFIG_LV_REFR_OCCLUDER_MAX
+    #else
+        #define LV_REFR_OCCLUDER_MAX 0          /*0: disable*/
+    #endif
+#endif
+
 /*Input device read period in milliseconds*/
 #ifndef LV_INDEV_DEF_READ_PERIOD
     #ifdef CONFIG_LV_INDEV_DEF_READ_PERIOD
@@ -412,6 +464,34 @@
     #endif
 #endif
 
+/*Render the refreshed areas in horizontal bands on several threads (needs POSIX threads).
+ *Only the software renderer is used in parallel and the draw events are sent from the worker threads.
+ *LV_PARALLEL_REFR_THREADS: threads rendering a frame, including the one calling `lv_timer_handler()`
+ *LV_PARALLEL_REFR_MIN_ROWS: bands are not made smaller than this (rows)*/
+#ifndef LV_USE_PARALLEL_REFR
+    #ifdef CONFIG_LV_USE_PARALLEL_REFR
+        #define LV_USE_PARALLEL_REFR CONFIG_LV_USE_PARALLEL_REFR
+    #else
+        #define LV_USE_PARALLEL_REFR 0
+    #endif
+#endif
+#if LV_USE_PARALLEL_REFR
+    #ifndef LV_PARALLEL_REFR_THREADS
+        #ifdef CONFIG_LV_PARALLEL_REFR_THREADS
+            #define LV_PARALLEL_REFR_THREADS CONFIG_LV_PARALLEL_REFR_THREADS
+        #else
+            #define LV_PARALLEL_REFR_THREADS  4
+        #endif
+    #endif
+    #ifndef LV_PARALLEL_REFR_MIN_ROWS
+        #ifdef CONFIG_LV_PARALLEL_REFR_MIN_ROWS
+            #define LV_PARALLEL_REFR_MIN_ROWS CONFIG_LV_PARALLEL_REFR_MIN_ROWS
+        #else
+            #define LV_PARALLEL_REFR_MIN_ROWS 16
+        #endif
+    #endif
+#endif
+
 /*-------------
  * GPU
  *-----------*/
@@ -796,6 +876,16 @@
     #endif
 #endif
 
+/*1: Count the rendered, the really invalidated and the written pixels. See `lv_refr_get_stat()`
+ *The performance monitor shows the overdraw (written / rendered pixels) too.*/
+#ifndef LV_USE_REFR_STAT
+    #ifdef CONFIG_LV_USE_REFR_STAT
+        #define LV_USE_REFR_STAT CONFIG_LV_USE_REFR_STAT
+    #else
+        #define LV_USE_REFR_STAT 0
+    #endif
+#endif
+
 /*Change the built in (v)snprintf functions*/
 #ifndef LV_SPRINTF_CUSTOM
     #ifdef CONFIG_LV_SPRINTF_CUSTOM
@@ -848,6 +938,18 @@
     #endif
 #endif
 
+/*Cache the resolved style properties of the objects to avoid searching their styles again and again.
+ *Number of cached properties per object (power of 2, e.g. 64). It costs about 12 bytes per property for each object
+ *on 32 bit systems, but the cache is allocated only when a property of the object is read.
+ *0: disable caching*/
+#ifndef LV_OBJ_STYLE_CACHE_SIZE
+    #ifdef CONFIG_LV_OBJ_STYLE_CACHE_SIZE
+        #define LV_OBJ_STYLE_CACHE_SIZE CONFIG_LV_OBJ_STYLE_CACHE_SIZE
+    #else
+        #define LV_OBJ_STYLE_CACHE_SIZE 0
+    #endif
+#endif
+
 /*Garbage Collector settings
  *Used if lvgl is bound to higher level language and the memory is managed by that language*/
 #ifndef LV_ENABLE_GC
@@ -1972,6 +2074,16 @@
     #endif
 #endif
 
+/*Update the layout only in the containers where it was invalidated and
+ *cache the measured size of the labels and images until their content changes*/
+#ifndef LV_LAYOUT_CACHE
+    #ifdef CONFIG_LV_LAYOUT_CACHE
+        #define LV_LAYOUT_CACHE CONFIG_LV_LAYOUT_CACHE
+    #else
+        #define LV_LAYOUT_CACHE 0
+    #endif
+#endif
+
 /*---------------------
  * 3rd party libraries
  *--------------------*/
@@ -20,26 +20,67 @@
  *********************/
 #define LV_ANIM_RESOLUTION 1024
 #define LV_ANIM_RES_SHIFT 10
+#define ANIM_POOL_BLOCK_SIZE 16 /*Number of animations allocated at once*/
+#define ANIM_GROUP_DEF_SIZE 8
+#define ANIM_CHUNK_SIZE 64   /*Number of animations stepped together*/
+
+/*The groups of the built-in paths. The others are in `ANIM_GROUP_CUSTOM`*/
+#define ANIM_GROUP_LINEAR       0
+#define ANIM_GROUP_EASE_IN      1
+#define ANIM_GROUP_EASE_OUT     2
+#define ANIM_GROUP_EASE_IN_OUT  3
+#define ANIM_GROUP_OVERSHOOT    4
+#define ANIM_GROUP_STEP         5
+#define ANIM_GROUP_CUSTOM       6
 
 /**********************
  *      TYPEDEFS
  **********************/
+typedef struct _anim_pool_block_t {
+    struct _anim_pool_block_t * next;
+    lv_anim_t anims[ANIM_POOL_BLOCK_SIZE];
+} anim_pool_block_t;
 
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 static void anim_timer(lv_timer_t * param);
-static void anim_mark_list_change(void);
-static void anim_ready_handler(lv_anim_t * a);
+static void anim_step_chunk(uint32_t group_id, uint32_t start, uint32_t end, uint32_t elaps);
+static void anim_start_handler(lv_anim_t * a);
+static void anim_ready_handler(lv_anim_t * a, uint32_t group_id, uint32_t idx);
+static uint32_t anim_get_group_id(lv_anim_path_cb_t path_cb);
+static bool anim_add(lv_anim_t * a);
+static void anim_remove(uint32_t group_id, uint32_t idx);
+static void anim_lock(void);
+static void anim_unlock(void);
+static lv_anim_t * anim_pool_alloc(void);
+static void anim_pool_free(lv_anim_t * a);
+static void anim_pool_release(void);
+static void anim_update_timer(void);
+static inline int32_t anim_get_progress(const lv_anim_t * a);
+static inline uint32_t ease_bezier3(uint32_t t, uint32_t u1, uint32_t u2);
 
 /**********************
  *  STATIC VARIABLES
  **********************/
 static uint32_t last_timer_run;
-static bool anim_list_changed;
-static bool anim_run_round;
+static bool anim_timer_running;
+static uint32_t anim_cnt;
+static uint32_t anim_lock_cnt;  /*While locked the removed animations leave a NULL in the groups*/
+static bool anim_has_gap;
+static lv_anim_t * anim_free_head;
 static lv_timer_t * _lv_anim_tmr;
 
+static const lv_anim_path_cb_t group_paths[_LV_ANIM_GROUP_NUM] = {
+    [ANIM_GROUP_LINEAR] = lv_anim_path_linear,
+    [ANIM_GROUP_EASE_IN] = lv_anim_path_ease_in,
+    [ANIM_GROUP_EASE_OUT] = lv_anim_path_ease_out,
+    [ANIM_GROUP_EASE_IN_OUT] = lv_anim_path_ease_in_out,
+    [ANIM_GROUP_OVERSHOOT] = lv_anim_path_overshoot,
+    [ANIM_GROUP_STEP] = lv_anim_path_step,
+    [ANIM_GROUP_CUSTOM] = NULL,
+};
+
 /**********************
  *      MACROS
  **********************/
@@ -56,10 +97,15 @@ static lv_timer_t * _lv_anim_tmr;
 
 void _lv_anim_core_init(void)
 {
-    _lv_ll_init(&LV_GC_ROOT(_lv_anim_ll), sizeof(lv_anim_t));
+    lv_memset_00(LV_GC_ROOT(_lv_anim_groups), sizeof(LV_GC_ROOT(_lv_anim_groups)));
+    LV_GC_ROOT(_lv_anim_pool) = NULL;
+    anim_free_head = NULL;
+    anim_cnt = 0;
+    anim_lock_cnt = 0;
+    anim_has_gap = false;
+    anim_timer_running = false;
     _lv_anim_tmr = lv_timer_create(anim_timer, LV_DISP_DEF_REFR_PERIOD, NULL);
-    anim_mark_list_change(); /*Turn off the animation timer*/
-    anim_list_changed = false;
+    anim_update_timer(); /*Turn off the animation timer*/
 }
 
 void lv_anim_init(lv_anim_t * a)
@@ -80,20 +126,26 @@ lv_anim_t * lv_anim_start(const lv_anim_t * a)
     /*Do not let two animations for the same 'var' with the same 'exec_cb'*/
     if(a->exec_cb != NULL) lv_anim_del(a->var, a->exec_cb); /*exec_cb == NULL would delete all animations of var*/
 
-    /*If the list is empty the anim timer was suspended and it's last run measure is invalid*/
-    if(_lv_ll_is_empty(&LV_GC_ROOT(_lv_anim_ll))) {
+    /*If there are no animations the anim timer was suspended and it's last run measure is invalid*/
+    if(anim_cnt == 0) {
         last_timer_run = lv_tick_get();
     }
 
-    /*Add the new animation to the animation linked list*/
-    lv_anim_t * new_anim = _lv_ll_ins_head(&LV_GC_ROOT(_lv_anim_ll));
+    lv_anim_t * new_anim = anim_pool_alloc();
     LV_ASSERT_MALLOC(new_anim);
     if(new_anim == NULL) return NULL;
 
     /*Initialize the animation descriptor*/
     lv_memcpy(new_anim, a, sizeof(lv_anim_t));
     if(a->var == a) new_anim->var = new_anim;
-    new_anim->run_round = anim_run_round;
+
+    /*Add it to the end of its group. If the animations are being stepped, it will run only in the next round.*/
+    if(!anim_add(new_anim)) {
+        anim_pool_free(new_anim);
+        anim_pool_release();
+        return NULL;
+    }
+    anim_update_timer();
 
     /*Set the start value*/
     if(new_anim->early_apply) {
@@ -106,10 +158,6 @@ lv_anim_t * lv_anim_start(const lv_anim_t * a)
         if(new_anim->exec_cb && new_anim->var) new_anim->exec_cb(new_anim->var, new_anim->start_value);
     }
 
-    /*Creating an animation changed the linked list.
-     *It's important if it happens in a ready callback. (see `anim_timer`)*/
-    anim_mark_list_change();
-
     TRACE_ANIM("finished");
     return new_anim;
 }
@@ -137,41 +185,58 @@ uint32_t lv_anim_get_playtime(lv_anim_t * a)
 
 bool lv_anim_del(void * var, lv_anim_exec_xcb_t exec_cb)
 {
-    lv_anim_t * a;
-    lv_anim_t * a_next;
     bool del = false;
-    a        = _lv_ll_get_head(&LV_GC_ROOT(_lv_anim_ll));
-    while(a != NULL) {
-        /*'a' might be deleted, so get the next object while 'a' is valid*/
-        a_next = _lv_ll_get_next(&LV_GC_ROOT(_lv_anim_ll), a);
-
-        if((a->var == var || var == NULL) && (a->exec_cb == exec_cb || exec_cb == NULL)) {
-            _lv_ll_remove(&LV_GC_ROOT(_lv_anim_ll), a);
-            if(a->deleted_cb != NULL) a->deleted_cb(a);
-            lv_mem_free(a);
-            anim_mark_list_change(); /*Read by `anim_timer`. It need to know if a delete occurred in
-                                       the linked list*/
-            del = true;
-        }
 
-        a = a_next;
+    /*The callbacks can start and delete animations, so keep the indices valid*/
+    anim_lock();
+    uint32_t g;
+    for(g = 0; g < _LV_ANIM_GROUP_NUM; g++) {
+        _lv_anim_group_t * group = &LV_GC_ROOT(_lv_anim_groups)[g];
+        uint32_t i;
+        for(i = 0; i < group->cnt; i++) {
+            lv_anim_t * a = group->anims[i];
+            if(a == NULL) continue;
+            if((a->var == var || var == NULL) && (a->exec_cb == exec_cb || exec_cb == NULL)) {
+                anim_remove(g, i);
+                if(a->deleted_cb != NULL) a->deleted_cb(a);
+                anim_pool_free(a);
+                del = true;
+            }
+        }
     }
+    anim_unlock();
 
     return del;
 }
 
 void lv_anim_del_all(void)
 {
-    _lv_ll_clear(&LV_GC_ROOT(_lv_anim_ll));
-    anim_mark_list_change();
+    anim_lock();
+    uint32_t g;
+    for(g = 0; g < _LV_ANIM_GROUP_NUM; g++) {
+        _lv_anim_group_t * group = &LV_GC_ROOT(_lv_anim_groups)[g];
+        uint32_t i;
+        for(i = 0; i < group->cnt; i++) {
+            lv_anim_t * a = group->anims[i];
+            if(a == NULL) continue;
+            anim_remove(g, i);
+            anim_pool_free(a);
+        }
+    }
+    anim_unlock();
 }
 
 lv_anim_t * lv_anim_get(void * var, lv_anim_exec_xcb_t exec_cb)
 {
-    lv_anim_t * a;
-    _LV_LL_READ(&LV_GC_ROOT(_lv_anim_ll), a) {
-        if(a->var == var && (a->exec_cb == exec_cb || exec_cb == NULL)) {
-            return a;
+    uint32_t g;
+    for(g = 0; g < _LV_ANIM_GROUP_NUM; g++) {
+        _lv_anim_group_t * group = &LV_GC_ROOT(_lv_anim_groups)[g];
+        uint32_t i;
+        for(i = 0; i < group->cnt; i++) {
+            lv_anim_t * a = group->anims[i];
+            if(a && a->var == var && (a->exec_cb == exec_cb || exec_cb == NULL)) {
+                return a;
+            }
         }
     }
 
@@ -185,11 +250,7 @@ struct _lv_timer_t * lv_anim_get_timer(void)
 
 uint16_t lv_anim_count_running(void)
 {
-    uint16_t cnt = 0;
-    lv_anim_t * a;
-    _LV_LL_READ(&LV_GC_ROOT(_lv_anim_ll), a) cnt++;
-
-    return cnt;
+    return anim_cnt > UINT16_MAX ? UINT16_MAX : (uint16_t)anim_cnt;
 }
 
 uint32_t lv_anim_speed_to_time(uint32_t speed, int32_t start, int32_t end)
@@ -212,7 +273,7 @@ void lv_anim_refr_now(void)
 int32_t lv_anim_path_linear(const lv_anim_t * a)
 {
     /*Calculate the current step*/
-    int32_t step = lv_map(a->act_time, 0, a->time, 0, LV_ANIM_RESOLUTION);
+    int32_t step = anim_get_progress(a);
 
     /*Get the new value which will be proportional to `step`
      *and the `start` and `end` values*/
@@ -227,8 +288,7 @@ int32_t lv_anim_path_linear(const lv_anim_t * a)
 int32_t lv_anim_path_ease_in(const lv_anim_t * a)
 {
     /*Calculate the current step*/
-    uint32_t t = lv_map(a->act_time, 0, a->time, 0, LV_BEZIER_VAL_MAX);
-    int32_t step = lv_bezier3(t, 0, 50, 100, LV_BEZIER_VAL_MAX);
+    int32_t step = ease_bezier3(anim_get_progress(a), 50, 100);
 
     int32_t new_value;
     new_value = step * (a->end_value - a->start_value);
@@ -241,8 +301,7 @@ int32_t lv_anim_path_ease_in(const lv_anim_t * a)
 int32_t lv_anim_path_ease_out(const lv_anim_t * a)
 {
     /*Calculate the current step*/
-    uint32_t t = lv_map(a->act_time, 0, a->time, 0, LV_BEZIER_VAL_MAX);
-    int32_t step = lv_bezier3(t, 0, 900, 950, LV_BEZIER_VAL_MAX);
+    int32_t step = ease_bezier3(anim_get_progress(a), 900, 950);
 
     int32_t new_value;
     new_value = step * (a->end_value - a->start_value);
@@ -255,8 +314,7 @@ int32_t lv_anim_path_ease_out(const lv_anim_t * a)
 int32_t lv_anim_path_ease_in_out(const lv_anim_t * a)
 {
     /*Calculate the current step*/
-    uint32_t t = lv_map(a->act_time, 0, a->time, 0, LV_BEZIER_VAL_MAX);
-    int32_t step = lv_bezier3(t, 0, 50, 952, LV_BEZIER_VAL_MAX);
+    int32_t step = ease_bezier3(anim_get_progress(a), 50, 952);
 
     int32_t new_value;
     new_value = step * (a->end_value - a->start_value);
@@ -269,8 +327,7 @@ int32_t lv_anim_path_ease_in_out(const lv_anim_t * a)
 int32_t lv_anim_path_overshoot(const lv_anim_t * a)
 {
     /*Calculate the current step*/
-    uint32_t t = lv_map(a->act_time, 0, a->time, 0, LV_BEZIER_VAL_MAX);
-    int32_t step = lv_bezier3(t, 0, 1000, 1300, LV_BEZIER_VAL_MAX);
+    int32_t step = ease_bezier3(anim_get_progress(a), 1000, 1300);
 
     int32_t new_value;
     new_value = step * (a->end_value - a->start_value);
@@ -345,77 +402,141 @@ int32_t lv_anim_path_step(const lv_anim_t * a)
 
 /**
  * Periodically handle the animations.
+ * The animations are stepped in chunks of the groups: first the time of the animations is advanced,
+ * then the ease curve is evaluated in a loop without callbacks and finally the values are applied.
  * @param param unused
  */
 static void anim_timer(lv_timer_t * param)
 {
     LV_UNUSED(param);
 
-    uint32_t elaps = lv_tick_elaps(last_timer_run);
+    /*Might be called by `lv_anim_refr_now()` in an animation's callback*/
+    if(anim_timer_running) return;
+    anim_timer_running = true;
 
-    /*Flip the run round*/
-    anim_run_round = anim_run_round ? false : true;
+    uint32_t elaps = lv_tick_elaps(last_timer_run);
 
-    lv_anim_t * a = _lv_ll_get_head(&LV_GC_ROOT(_lv_anim_ll));
+    /*The animations started in the callbacks are added to the end of the groups.
+     *Run only the current ones.*/
+    uint32_t cnt[_LV_ANIM_GROUP_NUM];
+    uint32_t g;
+    for(g = 0; g < _LV_ANIM_GROUP_NUM; g++) {
+        cnt[g] = LV_GC_ROOT(_lv_anim_groups)[g].cnt;
+    }
 
-    while(a != NULL) {
-        /*It can be set by `lv_anim_del()` typically in `end_cb`. If set then an animation delete
-         * happened in `anim_ready_handler` which could make this linked list reading corrupt
-         * because the list is changed meanwhile
-         */
-        anim_list_changed = false;
+    anim_lock();
+    for(g = 0; g < _LV_ANIM_GROUP_NUM; g++) {
+        uint32_t start;
+        for(start = 0; start < cnt[g]; start += ANIM_CHUNK_SIZE) {
+            anim_step_chunk(g, start, LV_MIN(start + ANIM_CHUNK_SIZE, cnt[g]), elaps);
+        }
+    }
+    anim_unlock();
 
-        if(a->run_round != anim_run_round) {
-            a->run_round = anim_run_round; /*The list readying might be reset so need to know which anim has run already*/
+    anim_timer_running = false;
+    last_timer_run = lv_tick_get();
+}
 
-            /*The animation will run now for the first time. Call `start_cb`*/
-            int32_t new_act_time = a->act_time + elaps;
-            if(!a->start_cb_called && a->act_time <= 0 && new_act_time >= 0) {
-                if(a->early_apply == 0 && a->get_value_cb) {
-                    int32_t v_ofs = a->get_value_cb(a);
-                    a->start_value += v_ofs;
-                    a->end_value += v_ofs;
-                }
-                if(a->start_cb) a->start_cb(a);
-                a->start_cb_called = 1;
-            }
-            a->act_time += elaps;
-            if(a->act_time >= 0) {
-                if(a->act_time > a->time) a->act_time = a->time;
+/**
+ * Step a chunk of animations of a group.
+ * @param group_id  index of the group
+ * @param start     index of the first animation in the group
+ * @param end       index after the last animation
+ * @param elaps     elapsed time since the last step
+ */
+static void anim_step_chunk(uint32_t group_id, uint32_t start, uint32_t end, uint32_t elaps)
+{
+    /*Always read `group->anims` as the callbacks can reallocate it*/
+    _lv_anim_group_t * group = &LV_GC_ROOT(_lv_anim_groups)[group_id];
+    lv_anim_path_cb_t path_cb = group_paths[group_id];
+    uint32_t steps[ANIM_CHUNK_SIZE];
+    uint32_t cnt = end - start;
+    uint32_t i;
+
+    /*Advance the time and get the progress. Rarely an animation starts now: call its `start_cb`*/
+    for(i = 0; i < cnt; i++) {
+        steps[i] = 0;
+        lv_anim_t * a = group->anims[start + i];
+        if(a == NULL) continue;
+
+        int32_t new_act_time = a->act_time + elaps;
+        if(!a->start_cb_called && a->act_time <= 0 && new_act_time >= 0) {
+            anim_start_handler(a);
+            if(group->anims[start + i] != a) continue; /*Deleted in `start_cb`*/
+        }
 
-                int32_t new_value;
-                new_value = a->path_cb(a);
+        a->act_time += elaps;
+        if(a->act_time > a->time) a->act_time = a->time;
+        if(a->act_time >= 0) steps[i] = anim_get_progress(a);
+    }
 
-                if(new_value != a->current_value) {
-                    a->current_value = new_value;
-                    /*Apply the calculated value*/
-                    if(a->exec_cb) a->exec_cb(a->var, new_value);
-                }
+    /*Evaluate the ease curve for all of them. It's only arithmetic on an array so the compiler can vectorize it.*/
+    switch(group_id) {
+        case ANIM_GROUP_EASE_IN:
+            for(i = 0; i < cnt; i++) steps[i] = ease_bezier3(steps[i], 50, 100);
+            break;
+        case ANIM_GROUP_EASE_OUT:
+            for(i = 0; i < cnt; i++) steps[i] = ease_bezier3(steps[i], 900, 950);
+            break;
+        case ANIM_GROUP_EASE_IN_OUT:
+            for(i = 0; i < cnt; i++) steps[i] = ease_bezier3(steps[i], 50, 952);
+            break;
+        case ANIM_GROUP_OVERSHOOT:
+            for(i = 0; i < cnt; i++) steps[i] = ease_bezier3(steps[i], 1000, 1300);
+            break;
+        default:
+            break;
+    }
 
-                /*If the time is elapsed the animation is ready*/
-                if(a->act_time >= a->time) {
-                    anim_ready_handler(a);
-                }
+    /*Apply the values and handle the ready animations*/
+    for(i = 0; i < cnt; i++) {
+        lv_anim_t * a = group->anims[start + i];
+        if(a == NULL || a->act_time < 0) continue;
+
+        int32_t new_value;
+        if(a->path_cb != path_cb) new_value = a->path_cb(a);   /*Custom path or changed since started*/
+        else if(group_id == ANIM_GROUP_STEP) new_value = lv_anim_path_step(a);
+        else new_value = (((int32_t)steps[i] * (a->end_value - a->start_value)) >> LV_BEZIER_VAL_SHIFT) + a->start_value;
+
+        if(new_value != a->current_value) {
+            a->current_value = new_value;
+            /*Apply the calculated value*/
+            if(a->exec_cb) {
+                a->exec_cb(a->var, new_value);
+                if(group->anims[start + i] != a) continue; /*Deleted in `exec_cb`*/
             }
         }
 
-        /*If the linked list changed due to anim. delete then it's not safe to continue
-         *the reading of the list from here -> start from the head*/
-        if(anim_list_changed)
-            a = _lv_ll_get_head(&LV_GC_ROOT(_lv_anim_ll));
-        else
-            a = _lv_ll_get_next(&LV_GC_ROOT(_lv_anim_ll), a);
+        /*If the time is elapsed the animation is ready*/
+        if(a->act_time >= a->time) {
+            anim_ready_handler(a, group_id, start + i);
+        }
     }
+}
 
-    last_timer_run = lv_tick_get();
+/**
+ * Called when an animation starts to run after its delay
+ * @param a pointer to an animation descriptor
+ */
+static void anim_start_handler(lv_anim_t * a)
+{
+    if(a->early_apply == 0 && a->get_value_cb) {
+        int32_t v_ofs = a->get_value_cb(a);
+        a->start_value += v_ofs;
+        a->end_value += v_ofs;
+    }
+    if(a->start_cb) a->start_cb(a);
+    a->start_cb_called = 1;
 }
 
 /**
  * Called when an animation is ready to do the necessary thinks
  * e.g. repeat, play back, delete etc.
  * @param a pointer to an animation descriptor
+ * @param group_id index of the group of the animation
+ * @param idx index of the animation in its group
  */
-static void anim_ready_handler(lv_anim_t * a)
+static void anim_ready_handler(lv_anim_t * a, uint32_t group_id, uint32_t idx)
 {
     /*In the end of a forward anim decrement repeat cnt.*/
     if(a->playback_now == 0 && a->repeat_cnt > 0 && a->repeat_cnt != LV_ANIM_REPEAT_INFINITE) {
@@ -427,16 +548,14 @@ static void anim_ready_handler(lv_anim_t * a)
      * - no repeat, play back is enabled and play back is ready*/
     if(a->repeat_cnt == 0 && (a->playback_time == 0 || a->playback_now == 1)) {
 
-        /*Delete the animation from the list.
+        /*Remove the animation from its group.
          * This way the `ready_cb` will see the animations like it's animation is ready deleted*/
-        _lv_ll_remove(&LV_GC_ROOT(_lv_anim_ll), a);
-        /*Flag that the list has changed*/
-        anim_mark_list_change();
+        anim_remove(group_id, idx);
 
         /*Call the callback function at the end*/
         if(a->ready_cb != NULL) a->ready_cb(a);
         if(a->deleted_cb != NULL) a->deleted_cb(a);
-        lv_mem_free(a);
+        anim_pool_free(a);
     }
     /*If the animation is not deleted then restart it*/
     else {
@@ -460,11 +579,175 @@ static void anim_ready_handler(lv_anim_t * a)
     }
 }
 
-static void anim_mark_list_change(void)
+static uint32_t anim_get_group_id(lv_anim_path_cb_t path_cb)
 {
-    anim_list_changed = true;
-    if(_lv_ll_get_head(&LV_GC_ROOT(_lv_anim_ll)) == NULL)
+    uint32_t g;
+    for(g = 0; g < ANIM_GROUP_CUSTOM; g++) {
+        if(group_paths[g] == path_cb) return g;
+    }
+
+    return ANIM_GROUP_CUSTOM;
+}
+
+/**
+ * Add an animation to the end of the group of its path
+ * @param a pointer to an animation descriptor
+ * @return true: added, false: out of memory
+ */
+static bool anim_add(lv_anim_t * a)
+{
+    _lv_anim_group_t * group = &LV_GC_ROOT(_lv_anim_groups)[anim_get_group_id(a->path_cb)];
+    if(group->cnt == group->size) {
+        uint32_t new_size = group->size ? group->size * 2 : ANIM_GROUP_DEF_SIZE;
+        lv_anim_t ** new_anims = lv_mem_realloc(group->anims, new_size * sizeof(lv_anim_t *));
+        LV_ASSERT_MALLOC(new_anims);
+        if(new_anims == NULL) return false;
+        group->anims = new_anims;
+        group->size = new_size;
+    }
+
+    group->anims[group->cnt] = a;
+    group->cnt++;
+    anim_cnt++;
+    return true;
+}
+
+/**
+ * Remove an animation from its group. The descriptor is not freed.
+ * @param group_id index of the group
+ * @param idx index of the animation in the group
+ */
+static void anim_remove(uint32_t group_id, uint32_t idx)
+{
+    _lv_anim_group_t * group = &LV_GC_ROOT(_lv_anim_groups)[group_id];
+    if(anim_lock_cnt) {
+        /*Keep the indices, the gaps are removed in `anim_unlock()`*/
+        group->anims[idx] = NULL;
+        anim_has_gap = true;
+    }
+    else {
+        group->cnt--;
+        group->anims[idx] = group->anims[group->cnt];
+    }
+
+    anim_cnt--;
+    anim_update_timer();
+}
+
+static void anim_lock(void)
+{
+    anim_lock_cnt++;
+}
+
+static void anim_unlock(void)
+{
+    anim_lock_cnt--;
+    if(anim_lock_cnt) return;
+
+    if(anim_has_gap) {
+        uint32_t g;
+        for(g = 0; g < _LV_ANIM_GROUP_NUM; g++) {
+            _lv_anim_group_t * group = &LV_GC_ROOT(_lv_anim_groups)[g];
+            uint32_t i;
+            uint32_t cnt = 0;
+            for(i = 0; i < group->cnt; i++) {
+                if(group->anims[i]) {
+                    group->anims[cnt] = group->anims[i];
+                    cnt++;
+                }
+            }
+            group->cnt = cnt;
+        }
+        anim_has_gap = false;
+    }
+
+    anim_pool_release();
+}
+
+static lv_anim_t * anim_pool_alloc(void)
+{
+    if(anim_free_head == NULL) {
+        anim_pool_block_t * block = lv_mem_alloc(sizeof(anim_pool_block_t));
+        if(block == NULL) return NULL;
+
+        block->next = LV_GC_ROOT(_lv_anim_pool);
+        LV_GC_ROOT(_lv_anim_pool) = block;
+        uint32_t i;
+        for(i = 0; i < ANIM_POOL_BLOCK_SIZE; i++) {
+            anim_pool_free(&block->anims[i]);
+        }
+    }
+
+    /*The free descriptors are linked by their `var`*/
+    lv_anim_t * a = anim_free_head;
+    anim_free_head = a->var;
+    return a;
+}
+
+static void anim_pool_free(lv_anim_t * a)
+{
+    a->var = anim_free_head;
+    anim_free_head = a;
+}
+
+/**
+ * Free the memory of the pool and the groups if there are no animations
+ */
+static void anim_pool_release(void)
+{
+    if(anim_cnt || anim_lock_cnt) return;
+
+    anim_pool_block_t * block = LV_GC_ROOT(_lv_anim_pool);
+    while(block) {
+        anim_pool_block_t * next = block->next;
+        lv_mem_free(block);
+        block = next;
+    }
+    LV_GC_ROOT(_lv_anim_pool) = NULL;
+    anim_free_head = NULL;
+
+    uint32_t g;
+    for(g = 0; g < _LV_ANIM_GROUP_NUM; g++) {
+        _lv_anim_group_t * group = &LV_GC_ROOT(_lv_anim_groups)[g];
+        lv_mem_free(group->anims);
+        group->anims = NULL;
+        group->cnt = 0;
+        group->size = 0;
+    }
+}
+
+static void anim_update_timer(void)
+{
+    if(anim_cnt == 0)
         lv_timer_pause(_lv_anim_tmr);
     else
         lv_timer_resume(_lv_anim_tmr);
 }
+
+/**
+ * Get the progress of an animation
+ * @param a pointer to an animation descriptor
+ * @return the progress in [0..LV_BEZIER_VAL_MAX] range (same as `LV_ANIM_RESOLUTION`)
+ */
+static inline int32_t anim_get_progress(const lv_anim_t * a)
+{
+    /*The same as `lv_map(a->act_time, 0, a->time, 0, LV_BEZIER_VAL_MAX)` without a function call*/
+    if(a->act_time > 0 && a->act_time < a->time) return (a->act_time * LV_BEZIER_VAL_MAX) / a->time;
+    else return lv_map(a->act_time, 0, a->time, 0, LV_BEZIER_VAL_MAX);
+}
+
+/**
+ * The same as `lv_bezier3(t, 0, u1, u2, LV_BEZIER_VAL_MAX)` but can be inlined
+ */
+static inline uint32_t ease_bezier3(uint32_t t, uint32_t u1, uint32_t u2)
+{
+    uint32_t t_rem  = LV_BEZIER_VAL_MAX - t;
+    uint32_t t_rem2 = (t_rem * t_rem) >> 10;
+    uint32_t t2     = (t * t) >> 10;
+    uint32_t t3     = (t2 * t) >> 10;
+
+    uint32_t v2 = (3 * t_rem2 * t * u1) >> 20;
+    uint32_t v3 = (3 * t_rem * t2 * u2) >> 20;
+
+    return v2 + v3 + t3;
+}
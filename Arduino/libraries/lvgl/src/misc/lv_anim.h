@@ -94,10 +94,21 @@ typedef struct _lv_anim_t {
 
     /*Animation system use these - user shouldn't set*/
     uint8_t playback_now : 1; /**< Play back is in progress*/
-    uint8_t run_round : 1;    /**< Indicates the animation has run in this round*/
     uint8_t start_cb_called : 1;    /**< Indicates that the `start_cb` was already called*/
 } lv_anim_t;
 
+/** The running animations with the same built-in path are stored in one array (internal)*/
+typedef struct {
+    lv_anim_t ** anims;     /**< The animations. NULL if deleted while the animations are stepped*/
+    uint32_t cnt;           /**< Number of used elements in `anims`*/
+    uint32_t size;          /**< Allocated elements in `anims`*/
+} _lv_anim_group_t;
+
+/*linear, ease in, ease out, ease in-out, overshoot, step and the others*/
+#define _LV_ANIM_GROUP_NUM 7
+
+typedef _lv_anim_group_t _lv_anim_group_arr_t[_LV_ANIM_GROUP_NUM];
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -10,6 +10,7 @@
 
 #include "lv_area.h"
 #include "lv_math.h"
+#include "lv_thread.h"
 
 /*********************
  *      DEFINES
@@ -544,9 +545,9 @@ void lv_point_transform(lv_point_t * p, int32_t angle, int32_t zoom, const lv_po
         return;
     }
 
-    static int32_t angle_prev = INT32_MIN;
-    static int32_t sinma;
-    static int32_t cosma;
+    static LV_THREAD_LOCAL int32_t angle_prev = INT32_MIN;
+    static LV_THREAD_LOCAL int32_t sinma;
+    static LV_THREAD_LOCAL int32_t cosma;
     if(angle_prev != angle) {
         int32_t angle_limited = angle;
         if(angle_limited > 3600) angle_limited -= 3600;
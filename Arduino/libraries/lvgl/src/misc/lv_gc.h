@@ -18,7 +18,9 @@ extern "C" {
 #include "lv_mem.h"
 #include "lv_ll.h"
 #include "lv_timer.h"
+#include "lv_anim.h"
 #include "lv_types.h"
+#include "lv_thread.h"
 #include "../draw/lv_img_cache.h"
 #include "../draw/lv_draw_mask.h"
 #include "../core/lv_obj_pos.h"
@@ -45,7 +47,8 @@ extern "C" {
     LV_DISPATCH(f, lv_ll_t, _lv_disp_ll)  /*Linked list of display device*/                            \
     LV_DISPATCH(f, lv_ll_t, _lv_indev_ll) /*Linked list of input device*/                              \
     LV_DISPATCH(f, lv_ll_t, _lv_fsdrv_ll)                                                              \
-    LV_DISPATCH(f, lv_ll_t, _lv_anim_ll)                                                               \
+    LV_DISPATCH(f, _lv_anim_group_arr_t, _lv_anim_groups)                                              \
+    LV_DISPATCH(f, void *, _lv_anim_pool)                                                              \
     LV_DISPATCH(f, lv_ll_t, _lv_group_ll)                                                              \
     LV_DISPATCH(f, lv_ll_t, _lv_img_decoder_ll)                                                        \
     LV_DISPATCH(f, lv_ll_t, _lv_obj_style_trans_ll)                                                    \
@@ -53,12 +56,13 @@ extern "C" {
     LV_DISPATCH_COND(f, _lv_img_cache_entry_t*, _lv_img_cache_array, LV_IMG_CACHE_DEF, 1)              \
     LV_DISPATCH_COND(f, _lv_img_cache_entry_t, _lv_img_cache_single, LV_IMG_CACHE_DEF, 0)              \
     LV_DISPATCH(f, lv_timer_t*, _lv_timer_act)                                                         \
-    LV_DISPATCH(f, lv_mem_buf_arr_t , lv_mem_buf)                                                      \
-    LV_DISPATCH_COND(f, _lv_draw_mask_radius_circle_dsc_arr_t , _lv_circle_cache, LV_DRAW_COMPLEX, 1)  \
-    LV_DISPATCH_COND(f, _lv_draw_mask_saved_arr_t , _lv_draw_mask_list, LV_DRAW_COMPLEX, 1)            \
+    LV_DISPATCH(f, lv_timer_t **, _lv_timer_heap)                                                      \
+    LV_DISPATCH(f, LV_THREAD_LOCAL lv_mem_buf_arr_t , lv_mem_buf)                                      \
+    LV_DISPATCH_COND(f, LV_THREAD_LOCAL _lv_draw_mask_radius_circle_dsc_arr_t , _lv_circle_cache, LV_DRAW_COMPLEX, 1)  \
+    LV_DISPATCH_COND(f, LV_THREAD_LOCAL _lv_draw_mask_saved_arr_t , _lv_draw_mask_list, LV_DRAW_COMPLEX, 1)            \
     LV_DISPATCH(f, void * , _lv_theme_default_styles)                                                  \
     LV_DISPATCH(f, void * , _lv_theme_basic_styles)                                                  \
-    LV_DISPATCH_COND(f, uint8_t *, _lv_font_decompr_buf, LV_USE_FONT_COMPRESSED, 1)                    \
+    LV_DISPATCH_COND(f, LV_THREAD_LOCAL uint8_t *, _lv_font_decompr_buf, LV_USE_FONT_COMPRESSED, 1)    \
     LV_DISPATCH(f, uint8_t * , _lv_grad_cache_mem)                                                     \
     LV_DISPATCH(f, uint8_t * , _lv_style_custom_prop_flag_lookup_table)
 
@@ -69,6 +73,9 @@ extern "C" {
 #if LV_MEM_CUSTOM != 1
 #error "GC requires CUSTOM_MEM"
 #endif /*LV_MEM_CUSTOM*/
+#if LV_USE_PARALLEL_REFR
+#error "GC can't be used with PARALLEL_REFR (some roots are thread local)"
+#endif /*LV_USE_PARALLEL_REFR*/
 #include LV_GC_INCLUDE
 #else  /*LV_ENABLE_GC*/
 #define LV_GC_ROOT(x) x
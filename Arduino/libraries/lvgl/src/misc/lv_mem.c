@@ -12,6 +12,7 @@
 #include "lv_gc.h"
 #include "lv_assert.h"
 #include "lv_log.h"
+#include "lv_thread.h"
 
 #if LV_MEM_CUSTOM != 0
     #include LV_MEM_CUSTOM_INCLUDE
@@ -39,9 +40,43 @@
 
 #define ZERO_MEM_SENTINEL  0xa1b2c3d4
 
+#if LV_MEM_CUSTOM == 0 && LV_MEM_SLAB
+    #if LV_MEM_SLAB_MAX_SIZE % 8 != 0 || LV_MEM_SLAB_MAX_SIZE == 0
+        #error "LV_MEM_SLAB_MAX_SIZE needs to be a multiple of 8"
+    #endif
+    #if (LV_MEM_SLAB_PAGE_SIZE & (LV_MEM_SLAB_PAGE_SIZE - 1)) != 0 || LV_MEM_SLAB_PAGE_SIZE < 2 * LV_MEM_SLAB_MAX_SIZE
+        #error "LV_MEM_SLAB_PAGE_SIZE needs to be a power of 2 and at least 2 times LV_MEM_SLAB_MAX_SIZE"
+    #endif
+
+    #define SLAB_CLASS_CNT      (LV_MEM_SLAB_MAX_SIZE / 8)
+    /*Pages which can be in the heap, +1 for the unaligned start and end of the heap*/
+    #define SLAB_PAGE_CNT       (LV_MEM_SIZE / LV_MEM_SLAB_PAGE_SIZE + 2)
+    /*The slots start after the header of the page, aligned to 8 bytes*/
+    #define SLAB_PAGE_HEADER    ((sizeof(slab_page_t) + 7) & ~((size_t)7))
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
+#if LV_MEM_CUSTOM == 0 && LV_MEM_SLAB
+/*A page of a size class. It's allocated from the heap aligned to its size,
+ *so the page of a slot is found by masking the address of the slot.*/
+typedef struct _slab_page_t {
+    struct _slab_page_t * prev; /*The pages of the class with free slots*/
+    struct _slab_page_t * next;
+    void * free_slot;           /*List of the free slots, the first bytes of a free slot point to the next*/
+    uint16_t used_cnt;
+    uint8_t class_id;
+} slab_page_t;
+
+typedef struct {
+    slab_page_t * free_pages;   /*The pages which have at least one free slot*/
+    uint32_t page_cnt;
+    uint32_t empty_cnt;
+    uint32_t live;
+    uint32_t peak;
+} slab_class_t;
+#endif
 
 /**********************
  *  STATIC PROTOTYPES
@@ -50,6 +85,18 @@
     static void lv_mem_walker(void * ptr, size_t size, int used, void * user);
 #endif
 
+#if LV_MEM_CUSTOM == 0 && LV_MEM_SLAB
+    static void slab_init(void * pool);
+    static inline void slab_set_page_map(slab_page_t * page, bool used);
+    static slab_page_t * slab_get_page(const void * p);
+    static void slab_page_link(slab_class_t * cls, slab_page_t * page);
+    static void slab_page_unlink(slab_class_t * cls, slab_page_t * page);
+    static slab_page_t * slab_page_create(uint32_t class_id);
+    static void slab_page_release(slab_class_t * cls, slab_page_t * page);
+    static void * slab_alloc(uint32_t class_id);
+    static void slab_free(slab_page_t * page, void * p);
+#endif
+
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -59,6 +106,13 @@
     static uint32_t max_used;
 #endif
 
+#if LV_MEM_CUSTOM == 0 && LV_MEM_SLAB
+    static slab_class_t slab_classes[SLAB_CLASS_CNT];
+    static uint8_t slab_page_map[(SLAB_PAGE_CNT + 7) / 8];    /*1 bit for every page sized area of the heap*/
+    static lv_uintptr_t slab_base;                              /*The start of the heap aligned down to the page size*/
+    static bool slab_en;
+#endif
+
 static uint32_t zero_mem = ZERO_MEM_SENTINEL; /*Give the address of this variable if 0 byte should be allocated*/
 
 /**********************
@@ -98,6 +152,10 @@ void lv_mem_init(void)
 #else
     tlsf = lv_tlsf_create_with_pool((void *)LV_MEM_ADR, LV_MEM_SIZE);
 #endif
+
+#if LV_MEM_SLAB
+    slab_init(lv_tlsf_get_pool(tlsf));
+#endif
 #endif
 
 #if LV_MEM_ADD_JUNK
@@ -131,7 +189,20 @@ void * lv_mem_alloc(size_t size)
     }
 
 #if LV_MEM_CUSTOM == 0
-    void * alloc = lv_tlsf_malloc(tlsf, size);
+    lv_thread_lock(LV_THREAD_LOCK_MEM);
+    void * alloc = NULL;
+#if LV_MEM_SLAB
+    /*If there is no space for a new page try the heap directly*/
+    if(slab_en && size <= LV_MEM_SLAB_MAX_SIZE) alloc = slab_alloc((uint32_t)(size - 1) / 8);
+#endif
+    if(alloc == NULL) {
+        alloc = lv_tlsf_malloc(tlsf, size);
+        if(alloc) {
+            cur_used += size;
+            max_used = LV_MAX(cur_used, max_used);
+        }
+    }
+    lv_thread_unlock(LV_THREAD_LOCK_MEM);
 #else
     void * alloc = LV_MEM_CUSTOM_ALLOC(size);
 #endif
@@ -153,10 +224,6 @@ void * lv_mem_alloc(size_t size)
 #endif
 
     if(alloc) {
-#if LV_MEM_CUSTOM == 0
-        cur_used += size;
-        max_used = LV_MAX(cur_used, max_used);
-#endif
         MEM_TRACE("allocated at %p", alloc);
     }
     return alloc;
@@ -173,12 +240,22 @@ void lv_mem_free(void * data)
     if(data == NULL) return;
 
 #if LV_MEM_CUSTOM == 0
+    lv_thread_lock(LV_THREAD_LOCK_MEM);
+#if LV_MEM_SLAB
+    slab_page_t * page = slab_get_page(data);
+    if(page) {
+        slab_free(page, data);
+        lv_thread_unlock(LV_THREAD_LOCK_MEM);
+        return;
+    }
+#endif
 #  if LV_MEM_ADD_JUNK
     lv_memset(data, 0xbb, lv_tlsf_block_size(data));
 #  endif
     size_t size = lv_tlsf_free(tlsf, data);
     if(cur_used > size) cur_used -= size;
     else cur_used = 0;
+    lv_thread_unlock(LV_THREAD_LOCK_MEM);
 #else
     LV_MEM_CUSTOM_FREE(data);
 #endif
@@ -202,8 +279,33 @@ void * lv_mem_realloc(void * data_p, size_t new_size)
 
     if(data_p == &zero_mem) return lv_mem_alloc(new_size);
 
+#if LV_MEM_CUSTOM == 0 && LV_MEM_SLAB
+    if(data_p == NULL) return lv_mem_alloc(new_size);
+
+    lv_thread_lock(LV_THREAD_LOCK_MEM);
+    slab_page_t * page = slab_get_page(data_p);
+    lv_thread_unlock(LV_THREAD_LOCK_MEM);
+    if(page) {
+        /*Keep it if the new size belongs to the same class, else move it to its new place*/
+        uint32_t slot_size = (page->class_id + 1) * 8;
+        if(new_size <= slot_size && new_size + 8 > slot_size) return data_p;
+
+        void * new_p = lv_mem_alloc(new_size);
+        if(new_p == NULL) {
+            LV_LOG_ERROR("couldn't allocate memory");
+            return NULL;
+        }
+        lv_memcpy(new_p, data_p, LV_MIN(new_size, slot_size));
+        lv_mem_free(data_p);
+        MEM_TRACE("allocated at %p", new_p);
+        return new_p;
+    }
+#endif
+
 #if LV_MEM_CUSTOM == 0
+    lv_thread_lock(LV_THREAD_LOCK_MEM);
     void * new_p = lv_tlsf_realloc(tlsf, data_p, new_size);
+    lv_thread_unlock(LV_THREAD_LOCK_MEM);
 #else
     void * new_p = LV_MEM_CUSTOM_REALLOC(data_p, new_size);
 #endif
@@ -250,7 +352,9 @@ void lv_mem_monitor(lv_mem_monitor_t * mon_p)
 #if LV_MEM_CUSTOM == 0
     MEM_TRACE("begin");
 
+    lv_thread_lock(LV_THREAD_LOCK_MEM);
     lv_tlsf_walk_pool(lv_tlsf_get_pool(tlsf), lv_mem_walker, mon_p);
+    lv_thread_unlock(LV_THREAD_LOCK_MEM);
 
     mon_p->total_size = LV_MEM_SIZE;
     mon_p->used_pct = 100 - (100U * mon_p->free_size) / mon_p->total_size;
@@ -264,10 +368,77 @@ void lv_mem_monitor(lv_mem_monitor_t * mon_p)
 
     mon_p->max_used = max_used;
 
+#if LV_MEM_SLAB
+    /*The pages are single blocks of the heap, count the allocations in them instead*/
+    uint32_t i;
+    for(i = 0; i < SLAB_CLASS_CNT; i++) {
+        mon_p->used_cnt = mon_p->used_cnt - slab_classes[i].page_cnt + slab_classes[i].live;
+    }
+#endif
+
     MEM_TRACE("finished");
 #endif
 }
 
+void lv_mem_reset_max_used(void)
+{
+#if LV_MEM_CUSTOM == 0
+    lv_thread_lock(LV_THREAD_LOCK_MEM);
+    max_used = cur_used;
+    lv_thread_unlock(LV_THREAD_LOCK_MEM);
+#endif
+}
+
+#if LV_MEM_CUSTOM == 0 && LV_MEM_SLAB
+
+void lv_mem_slab_enable(bool en)
+{
+    slab_en = en;
+}
+
+uint32_t lv_mem_slab_get_class_cnt(void)
+{
+    return SLAB_CLASS_CNT;
+}
+
+void lv_mem_slab_get_stat(uint32_t class_id, lv_mem_slab_stat_t * stat)
+{
+    lv_memset_00(stat, sizeof(lv_mem_slab_stat_t));
+    if(class_id >= SLAB_CLASS_CNT) return;
+
+    lv_thread_lock(LV_THREAD_LOCK_MEM);
+    slab_class_t * cls = &slab_classes[class_id];
+    stat->slot_size = (class_id + 1) * 8;
+    stat->slot_per_page = (LV_MEM_SLAB_PAGE_SIZE - SLAB_PAGE_HEADER) / stat->slot_size;
+    stat->page_cnt = cls->page_cnt;
+    stat->live = cls->live;
+    stat->peak = cls->peak;
+    uint32_t slot_cnt = cls->page_cnt * stat->slot_per_page;
+    if(slot_cnt) stat->frag_pct = 100 - (100U * cls->live) / slot_cnt;
+    lv_thread_unlock(LV_THREAD_LOCK_MEM);
+}
+
+void lv_mem_slab_trim(void)
+{
+    lv_thread_lock(LV_THREAD_LOCK_MEM);
+    uint32_t i;
+    for(i = 0; i < SLAB_CLASS_CNT; i++) {
+        slab_class_t * cls = &slab_classes[i];
+        slab_page_t * page = cls->free_pages;
+        while(page && cls->empty_cnt) {
+            slab_page_t * next = page->next;
+            if(page->used_cnt == 0) {
+                slab_page_release(cls, page);
+                cls->empty_cnt--;
+            }
+            page = next;
+        }
+    }
+    lv_thread_unlock(LV_THREAD_LOCK_MEM);
+}
+
+#endif /*LV_MEM_CUSTOM == 0 && LV_MEM_SLAB*/
+
 
 /**
  * Get a temporal buffer with the given size.
@@ -564,3 +735,152 @@ static void lv_mem_walker(void * ptr, size_t size, int used, void * user)
     }
 }
 #endif
+
+#if LV_MEM_CUSTOM == 0 && LV_MEM_SLAB
+
+static void slab_init(void * pool)
+{
+    lv_memset_00(slab_classes, sizeof(slab_classes));
+    lv_memset_00(slab_page_map, sizeof(slab_page_map));
+    slab_base = (lv_uintptr_t)pool & ~((lv_uintptr_t)LV_MEM_SLAB_PAGE_SIZE - 1);
+    slab_en = true;
+}
+
+static inline void slab_set_page_map(slab_page_t * page, bool used)
+{
+    uint32_t idx = (uint32_t)(((lv_uintptr_t)page - slab_base) / LV_MEM_SLAB_PAGE_SIZE);
+    if(used) slab_page_map[idx >> 3] |= (uint8_t)(1 << (idx & 0x7));
+    else slab_page_map[idx >> 3] &= (uint8_t)~(1 << (idx & 0x7));
+}
+
+/*Get the page of a memory if it was allocated from a slab, else return NULL*/
+static slab_page_t * slab_get_page(const void * p)
+{
+    lv_uintptr_t adr = (lv_uintptr_t)p;
+    if(adr < slab_base) return NULL;
+
+    lv_uintptr_t idx = (adr - slab_base) / LV_MEM_SLAB_PAGE_SIZE;
+    if(idx >= SLAB_PAGE_CNT) return NULL;
+    if((slab_page_map[idx >> 3] & (1 << (idx & 0x7))) == 0) return NULL;
+
+    return (slab_page_t *)(slab_base + idx * LV_MEM_SLAB_PAGE_SIZE);
+}
+
+static void slab_page_link(slab_class_t * cls, slab_page_t * page)
+{
+    page->prev = NULL;
+    page->next = cls->free_pages;
+    if(cls->free_pages) cls->free_pages->prev = page;
+    cls->free_pages = page;
+}
+
+static void slab_page_unlink(slab_class_t * cls, slab_page_t * page)
+{
+    if(page->prev) page->prev->next = page->next;
+    else cls->free_pages = page->next;
+    if(page->next) page->next->prev = page->prev;
+    page->prev = NULL;
+    page->next = NULL;
+}
+
+static slab_page_t * slab_page_create(uint32_t class_id)
+{
+    slab_page_t * page = lv_tlsf_memalign(tlsf, LV_MEM_SLAB_PAGE_SIZE, LV_MEM_SLAB_PAGE_SIZE);
+    if(page == NULL) return NULL;
+
+    cur_used += LV_MEM_SLAB_PAGE_SIZE;
+    max_used = LV_MAX(cur_used, max_used);
+    slab_set_page_map(page, true);
+
+    /*Chain all the slots into the free list*/
+    uint32_t slot_size = (class_id + 1) * 8;
+    uint32_t slot_cnt = (LV_MEM_SLAB_PAGE_SIZE - SLAB_PAGE_HEADER) / slot_size;
+    uint8_t * slot = (uint8_t *)page + SLAB_PAGE_HEADER;
+    page->free_slot = slot;
+    uint32_t i;
+    for(i = 0; i < slot_cnt - 1; i++) {
+        *((void **)slot) = slot + slot_size;
+        slot += slot_size;
+    }
+    *((void **)slot) = NULL;
+
+    page->used_cnt = 0;
+    page->class_id = (uint8_t)class_id;
+
+    slab_class_t * cls = &slab_classes[class_id];
+    slab_page_link(cls, page);
+    cls->page_cnt++;
+    cls->empty_cnt++;
+
+    return page;
+}
+
+static void slab_page_release(slab_class_t * cls, slab_page_t * page)
+{
+    slab_page_unlink(cls, page);
+    slab_set_page_map(page, false);
+    cls->page_cnt--;
+
+    size_t size = lv_tlsf_free(tlsf, page);
+    if(cur_used > size) cur_used -= size;
+    else cur_used = 0;
+}
+
+static void * slab_alloc(uint32_t class_id)
+{
+    slab_class_t * cls = &slab_classes[class_id];
+    slab_page_t * page = cls->free_pages;
+    if(page == NULL) {
+        page = slab_page_create(class_id);
+        if(page == NULL) return NULL;
+    }
+    /*Fill the partly used pages first and keep the empty one for later*/
+    else if(page->used_cnt == 0 && page->next) {
+        page = page->next;
+    }
+
+    void ** slot = page->free_slot;
+    page->free_slot = *slot;
+    if(page->used_cnt == 0) cls->empty_cnt--;
+    page->used_cnt++;
+    if(page->free_slot == NULL) slab_page_unlink(cls, page);
+
+    cls->live++;
+    if(cls->live > cls->peak) cls->peak = cls->live;
+
+    return slot;
+}
+
+static void slab_free(slab_page_t * page, void * p)
+{
+    slab_class_t * cls = &slab_classes[page->class_id];
+
+#if LV_MEM_ADD_JUNK
+    lv_memset(p, 0xbb, (page->class_id + 1) * 8);
+#endif
+
+    /*It was full, so it's not in the list of the pages with free slots*/
+    if(page->free_slot == NULL) slab_page_link(cls, page);
+
+    *((void **)p) = page->free_slot;
+    page->free_slot = p;
+    page->used_cnt--;
+    cls->live--;
+
+    if(page->used_cnt == 0) {
+        /*Keep only one empty page to not allocate and free pages over and over again*/
+        if(cls->empty_cnt > 0) {
+            slab_page_release(cls, page);
+        }
+        else {
+            cls->empty_cnt++;
+            /*Move it to the head of the list, slab_alloc() skips it if there are other pages*/
+            if(cls->free_pages != page) {
+                slab_page_unlink(cls, page);
+                slab_page_link(cls, page);
+            }
+        }
+    }
+}
+
+#endif /*LV_MEM_CUSTOM == 0 && LV_MEM_SLAB*/
@@ -16,6 +16,7 @@ extern "C" {
 #include "../lv_conf_internal.h"
 
 #include <stdint.h>
+#include <stdbool.h>
 #include <stddef.h>
 #include <string.h>
 
@@ -43,6 +44,18 @@ typedef struct {
     uint8_t frag_pct; /**< Amount of fragmentation*/
 } lv_mem_monitor_t;
 
+/**
+ * Information about a size class of the slab allocator.
+ */
+typedef struct {
+    uint32_t slot_size; /**< Size of the allocations served by the class*/
+    uint32_t slot_per_page; /**< Number of allocations fitting into a page*/
+    uint32_t page_cnt; /**< Number of pages of the class (including the empty ones)*/
+    uint32_t live; /**< Number of allocations in use*/
+    uint32_t peak; /**< Max. value of `live`*/
+    uint8_t frag_pct; /**< Percentage of the slots of the pages which are not used*/
+} lv_mem_slab_stat_t;
+
 typedef struct {
     void * p;
     uint16_t size;
@@ -101,6 +114,44 @@ lv_res_t lv_mem_test(void);
  */
 void lv_mem_monitor(lv_mem_monitor_t * mon_p);
 
+/**
+ * Restart tracking the peak usage (`max_used` of `lv_mem_monitor_t`) from the current usage.
+ * Useful to measure the peak of a given operation.
+ * @note It works only if `LV_MEM_CUSTOM == 0`
+ */
+void lv_mem_reset_max_used(void);
+
+#if LV_MEM_CUSTOM == 0 && LV_MEM_SLAB
+
+/**
+ * Enable or disable serving the new small allocations from the slabs.
+ * The memories already allocated in the slabs can be freed normally.
+ * @param en    true: use the slabs (default); false: allocate everything directly from the heap
+ */
+void lv_mem_slab_enable(bool en);
+
+/**
+ * Get the number of size classes of the slab allocator
+ * @return      number of classes, `LV_MEM_SLAB_MAX_SIZE / 8`
+ */
+uint32_t lv_mem_slab_get_class_cnt(void);
+
+/**
+ * Get the statistics of a size class of the slab allocator
+ * @param class_id  index of the class, `0 ... lv_mem_slab_get_class_cnt() - 1`
+ * @param stat      the result will be stored here
+ */
+void lv_mem_slab_get_stat(uint32_t class_id, lv_mem_slab_stat_t * stat);
+
+/**
+ * Give back the empty pages of the slabs to the heap.
+ * An empty page per class is kept to not allocate and free a page over and over again.
+ * It's called automatically when a screen is deleted.
+ */
+void lv_mem_slab_trim(void);
+
+#endif /*LV_MEM_CUSTOM == 0 && LV_MEM_SLAB*/
+
 
 /**
  * Get a temporal buffer with the given size.
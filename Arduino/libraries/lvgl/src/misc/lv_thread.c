@@ -0,0 +1,247 @@
+/**
+ * @file lv_thread.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_thread.h"
+
+#if LV_USE_PARALLEL_REFR
+
+#include <pthread.h>
+#include <unistd.h>
+#include "lv_mem.h"
+#include "lv_log.h"
+#include "lv_assert.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    pthread_mutex_t mutex;
+    pthread_cond_t start_cond;      /*Signaled when new jobs are added*/
+    pthread_cond_t done_cond;       /*Signaled when the last worker is done*/
+    pthread_t * threads;
+    uint32_t cnt;                   /*Worker threads + the caller*/
+    uint32_t generation;            /*Incremented for each run*/
+    uint32_t busy_cnt;              /*Workers still running the jobs of this generation*/
+    lv_thread_job_cb_t cb;
+    void * user_data;
+    uint32_t job_cnt;
+    uint32_t job_next;
+    bool on_workers;                /*Run `cb` once on each worker*/
+    bool running;
+    bool quit;
+} thread_pool_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void * worker_main(void * param);
+static void run_jobs(uint32_t thread_id);
+static void start_and_wait(void);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static thread_pool_t pool = {
+    .mutex = PTHREAD_MUTEX_INITIALIZER,
+    .start_cond = PTHREAD_COND_INITIALIZER,
+    .done_cond = PTHREAD_COND_INITIALIZER,
+    .cnt = 1,
+};
+
+/*One initializer for each `LV_THREAD_LOCK_...`*/
+static pthread_mutex_t locks[_LV_THREAD_LOCK_LAST] = {
+    PTHREAD_MUTEX_INITIALIZER,
+    PTHREAD_MUTEX_INITIALIZER,
+    PTHREAD_MUTEX_INITIALIZER,
+};
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_res_t lv_thread_pool_init(uint32_t cnt)
+{
+    lv_thread_pool_deinit();
+    if(cnt <= 1) return LV_RES_OK;
+
+    pool.threads = lv_mem_alloc((cnt - 1) * sizeof(pthread_t));
+    LV_ASSERT_MALLOC(pool.threads);
+    if(pool.threads == NULL) return LV_RES_INV;
+
+    pool.quit = false;
+    pool.generation = 0;
+
+    uint32_t i;
+    for(i = 1; i < cnt; i++) {
+        if(pthread_create(&pool.threads[i - 1], NULL, worker_main, (void *)(uintptr_t)i) != 0) {
+            LV_LOG_WARN("couldn't create worker thread %d", (int)i);
+            break;
+        }
+        pool.cnt = i + 1;
+    }
+
+    if(pool.cnt == 1) {
+        lv_mem_free(pool.threads);
+        pool.threads = NULL;
+        return LV_RES_INV;
+    }
+
+    LV_LOG_INFO("%d rendering threads", (int)pool.cnt);
+    return LV_RES_OK;
+}
+
+uint32_t lv_thread_get_cpu_cnt(void)
+{
+#ifdef _SC_NPROCESSORS_ONLN
+    long cnt = sysconf(_SC_NPROCESSORS_ONLN);
+    return cnt > 0 ? (uint32_t)cnt : 0;
+#else
+    return 0;
+#endif
+}
+
+void lv_thread_pool_deinit(void)
+{
+    if(pool.cnt <= 1) return;
+
+    pthread_mutex_lock(&pool.mutex);
+    pool.quit = true;
+    pthread_cond_broadcast(&pool.start_cond);
+    pthread_mutex_unlock(&pool.mutex);
+
+    uint32_t i;
+    for(i = 0; i < pool.cnt - 1; i++) {
+        pthread_join(pool.threads[i], NULL);
+    }
+
+    lv_mem_free(pool.threads);
+    pool.threads = NULL;
+    pool.cnt = 1;
+    pool.quit = false;
+}
+
+uint32_t lv_thread_pool_get_cnt(void)
+{
+    return pool.cnt;
+}
+
+void lv_thread_pool_run(lv_thread_job_cb_t cb, uint32_t job_cnt, void * user_data)
+{
+    if(pool.cnt <= 1 || job_cnt <= 1) {
+        uint32_t i;
+        for(i = 0; i < job_cnt; i++) cb(i, 0, user_data);
+        return;
+    }
+
+    pthread_mutex_lock(&pool.mutex);
+    pool.cb = cb;
+    pool.user_data = user_data;
+    pool.job_cnt = job_cnt;
+    pool.job_next = 0;
+    pool.on_workers = false;
+    start_and_wait();
+    pthread_mutex_unlock(&pool.mutex);
+}
+
+void lv_thread_pool_run_on_workers(lv_thread_job_cb_t cb, void * user_data)
+{
+    if(pool.cnt <= 1) return;
+
+    pthread_mutex_lock(&pool.mutex);
+    pool.cb = cb;
+    pool.user_data = user_data;
+    pool.on_workers = true;
+    start_and_wait();
+    pthread_mutex_unlock(&pool.mutex);
+}
+
+bool lv_thread_pool_is_running(void)
+{
+    return pool.running;
+}
+
+void lv_thread_lock(lv_thread_lock_t lock)
+{
+    pthread_mutex_lock(&locks[lock]);
+}
+
+void lv_thread_unlock(lv_thread_lock_t lock)
+{
+    pthread_mutex_unlock(&locks[lock]);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Wake up the workers, help them and wait for the last one. Called with `pool.mutex` taken.
+ */
+static void start_and_wait(void)
+{
+    pool.busy_cnt = pool.cnt - 1;
+    pool.generation++;
+    pool.running = true;
+    pthread_cond_broadcast(&pool.start_cond);
+
+    if(!pool.on_workers) run_jobs(0);
+
+    while(pool.busy_cnt) pthread_cond_wait(&pool.done_cond, &pool.mutex);
+    pool.running = false;
+}
+
+/**
+ * Take jobs until there are no more. Called with `pool.mutex` taken, released while a job runs.
+ */
+static void run_jobs(uint32_t thread_id)
+{
+    if(pool.on_workers) {
+        pthread_mutex_unlock(&pool.mutex);
+        pool.cb(thread_id, thread_id, pool.user_data);
+        pthread_mutex_lock(&pool.mutex);
+        return;
+    }
+
+    while(pool.job_next < pool.job_cnt) {
+        uint32_t job = pool.job_next++;
+        pthread_mutex_unlock(&pool.mutex);
+        pool.cb(job, thread_id, pool.user_data);
+        pthread_mutex_lock(&pool.mutex);
+    }
+}
+
+static void * worker_main(void * param)
+{
+    uint32_t thread_id = (uint32_t)(uintptr_t)param;
+    uint32_t generation = 0;
+
+    pthread_mutex_lock(&pool.mutex);
+    while(1) {
+        while(pool.generation == generation && !pool.quit) pthread_cond_wait(&pool.start_cond, &pool.mutex);
+        if(pool.quit) break;
+
+        generation = pool.generation;
+        run_jobs(thread_id);
+
+        pool.busy_cnt--;
+        if(pool.busy_cnt == 0) pthread_cond_signal(&pool.done_cond);
+    }
+    pthread_mutex_unlock(&pool.mutex);
+
+    return NULL;
+}
+
+#endif /*LV_USE_PARALLEL_REFR*/
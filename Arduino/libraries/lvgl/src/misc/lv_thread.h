@@ -0,0 +1,154 @@
+/**
+ * @file lv_thread.h
+ * Worker threads and locks used by the parallel refresh (`LV_USE_PARALLEL_REFR`)
+ */
+
+#ifndef LV_THREAD_H
+#define LV_THREAD_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../lv_conf_internal.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "lv_types.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/*Storage class of the state which is used while drawing (buffers, masks, small caches).
+ *With the parallel refresh every rendering thread has its own copy.*/
+#if LV_USE_PARALLEL_REFR
+#  if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+#    define LV_THREAD_LOCAL _Thread_local
+#  else
+#    define LV_THREAD_LOCAL __thread
+#  endif
+#else
+#  define LV_THREAD_LOCAL
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * Shared resources which can be used by more rendering threads
+ */
+enum {
+    LV_THREAD_LOCK_MEM,             /*The built-in heap (`LV_MEM_CUSTOM == 0`)*/
+    LV_THREAD_LOCK_IMG_CACHE,       /*The image cache and the decoders*/
+    LV_THREAD_LOCK_SHADOW_CACHE,    /*The shadow cache of the software renderer*/
+    _LV_THREAD_LOCK_LAST,
+};
+
+typedef uint8_t lv_thread_lock_t;
+
+/**
+ * Job of the thread pool
+ * @param job           index of the job
+ * @param thread_id     index of the thread running the job, 0 is the caller of `lv_thread_pool_run()`
+ * @param user_data     the `user_data` passed to `lv_thread_pool_run()`
+ */
+typedef void (*lv_thread_job_cb_t)(uint32_t job, uint32_t thread_id, void * user_data);
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+#if LV_USE_PARALLEL_REFR
+
+/**
+ * Start the worker threads
+ * @param cnt       number of threads running the jobs, including the caller of `lv_thread_pool_run()`
+ * @return          LV_RES_OK: the threads are running; LV_RES_INV: the threads couldn't be created
+ */
+lv_res_t lv_thread_pool_init(uint32_t cnt);
+
+/**
+ * Stop the worker threads
+ */
+void lv_thread_pool_deinit(void);
+
+/**
+ * Get the number of processor cores
+ * @return          the cores online, 0 if unknown
+ */
+uint32_t lv_thread_get_cpu_cnt(void);
+
+/**
+ * Get the number of threads running the jobs
+ * @return          the worker threads + 1 for the caller, 1 if the pool is not started
+ */
+uint32_t lv_thread_pool_get_cnt(void);
+
+/**
+ * Run jobs on the threads of the pool and on the calling thread and wait until all of them are done.
+ * The jobs are taken in order by the first free thread.
+ * @param cb        the job
+ * @param job_cnt   number of jobs, `cb` is called with `job` = 0 ... `job_cnt - 1`
+ * @param user_data passed to `cb`
+ */
+void lv_thread_pool_run(lv_thread_job_cb_t cb, uint32_t job_cnt, void * user_data);
+
+/**
+ * Call a function once on each worker thread (not on the caller) and wait for them.
+ * Used to clean up the thread local state.
+ * @param cb        the function, `job` is the same as `thread_id`
+ * @param user_data passed to `cb`
+ */
+void lv_thread_pool_run_on_workers(lv_thread_job_cb_t cb, void * user_data);
+
+/**
+ * Tell if jobs are running on more threads now
+ * @return          true: between the start and the end of `lv_thread_pool_run()`
+ */
+bool lv_thread_pool_is_running(void);
+
+/**
+ * Take a lock of a shared resource
+ * @param lock      the resource, an element of `LV_THREAD_LOCK_...`
+ */
+void lv_thread_lock(lv_thread_lock_t lock);
+
+/**
+ * Release a lock of a shared resource
+ * @param lock      the resource, an element of `LV_THREAD_LOCK_...`
+ */
+void lv_thread_unlock(lv_thread_lock_t lock);
+
+#else
+
+static inline bool lv_thread_pool_is_running(void)
+{
+    return false;
+}
+
+static inline void lv_thread_lock(lv_thread_lock_t lock)
+{
+    LV_UNUSED(lock);
+}
+
+static inline void lv_thread_unlock(lv_thread_lock_t lock)
+{
+    LV_UNUSED(lock);
+}
+
+#endif /*LV_USE_PARALLEL_REFR*/
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_THREAD_H*/
@@ -17,6 +17,11 @@
  *********************/
 #define IDLE_MEAS_PERIOD 500 /*[ms]*/
 #define DEF_PERIOD 500
+#define HEAP_DEF_SIZE 8
+
+/*Special `heap_idx` values*/
+#define HEAP_IDX_NONE   0xFFFFFFFF  /*Not in the heap (paused)*/
+#define HEAP_IDX_RAN    0xFFFFFFFE  /*Ran in this `lv_timer_handler()` call, will be added to the heap again*/
 
 /**********************
  *      TYPEDEFS
@@ -25,16 +30,24 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
-static bool lv_timer_exec(lv_timer_t * timer);
+static void lv_timer_exec(lv_timer_t * timer);
 static uint32_t lv_timer_time_remaining(lv_timer_t * timer);
+static int64_t heap_key(const lv_timer_t * timer, uint32_t tick);
+static void heap_move_up(uint32_t idx, uint32_t tick);
+static void heap_move_down(uint32_t idx, uint32_t tick);
+static void heap_set(uint32_t idx, lv_timer_t * timer);
+static bool heap_insert(lv_timer_t * timer);
+static void heap_remove(lv_timer_t * timer);
+static void heap_update(lv_timer_t * timer);
 
 /**********************
  *  STATIC VARIABLES
  **********************/
 static bool lv_timer_run = false;
 static uint8_t idle_last = 0;
-static bool timer_deleted;
-static bool timer_created;
+static uint32_t heap_cnt;
+static uint32_t heap_size;
+static lv_timer_t * ran_head; /*Timers which ran in this `lv_timer_handler()` call*/
 
 /**********************
  *      MACROS
@@ -55,6 +68,10 @@ static bool timer_created;
 void _lv_timer_core_init(void)
 {
     _lv_ll_init(&LV_GC_ROOT(_lv_timer_ll), sizeof(lv_timer_t));
+    LV_GC_ROOT(_lv_timer_heap) = NULL;
+    heap_cnt = 0;
+    heap_size = 0;
+    ran_head = NULL;
 
     /*Initially enable the lv_timer handling*/
     lv_timer_enable(true);
@@ -95,40 +112,31 @@ uint32_t LV_ATTRIBUTE_TIMER_HANDLER lv_timer_handler(void)
         }
     }
 
-    /*Run all timer from the list*/
-    lv_timer_t * next;
-    do {
-        timer_deleted             = false;
-        timer_created             = false;
-        LV_GC_ROOT(_lv_timer_act) = _lv_ll_get_head(&LV_GC_ROOT(_lv_timer_ll));
-        while(LV_GC_ROOT(_lv_timer_act)) {
-            /*The timer might be deleted if it runs only once ('repeat_count = 1')
-             *So get next element until the current is surely valid*/
-            next = _lv_ll_get_next(&LV_GC_ROOT(_lv_timer_ll), LV_GC_ROOT(_lv_timer_act));
-
-            if(lv_timer_exec(LV_GC_ROOT(_lv_timer_act))) {
-                /*If a timer was created or deleted then this or the next item might be corrupted*/
-                if(timer_created || timer_deleted) {
-                    TIMER_TRACE("Start from the first timer again because a timer was created or deleted");
-                    break;
-                }
-            }
+    /*Run the ready timers in the order of their deadlines.
+     *The timers which ran are kept out of the heap to run them only once in a call.*/
+    ran_head = NULL;
+    while(heap_cnt > 0) {
+        lv_timer_t * timer = LV_GC_ROOT(_lv_timer_heap)[0];
+        if(lv_timer_time_remaining(timer) != 0) break;
 
-            LV_GC_ROOT(_lv_timer_act) = next; /*Load the next timer*/
-        }
-    } while(LV_GC_ROOT(_lv_timer_act));
-
-    uint32_t time_till_next = LV_NO_TIMER_READY;
-    next = _lv_ll_get_head(&LV_GC_ROOT(_lv_timer_ll));
-    while(next) {
-        if(!next->paused) {
-            uint32_t delay = lv_timer_time_remaining(next);
-            if(delay < time_till_next)
-                time_till_next = delay;
-        }
+        heap_remove(timer);
+        timer->heap_idx = HEAP_IDX_RAN;
+        timer->ran_next = ran_head;
+        ran_head = timer;
 
-        next = _lv_ll_get_next(&LV_GC_ROOT(_lv_timer_ll), next); /*Find the next timer*/
+        LV_GC_ROOT(_lv_timer_act) = timer;
+        lv_timer_exec(timer); /*Might delete the timer and any other timers*/
     }
+    LV_GC_ROOT(_lv_timer_act) = NULL;
+
+    while(ran_head) {
+        lv_timer_t * timer = ran_head;
+        ran_head = timer->ran_next;
+        timer->heap_idx = HEAP_IDX_NONE;
+        if(!timer->paused) heap_insert(timer);
+    }
+
+    uint32_t time_till_next = lv_timer_get_time_until_next();
 
     busy_time += lv_tick_elaps(handler_start);
     uint32_t idle_period_time = lv_tick_elaps(idle_period_start);
@@ -178,8 +186,14 @@ lv_timer_t * lv_timer_create(lv_timer_cb_t timer_xcb, uint32_t period, void * us
     new_timer->paused = 0;
     new_timer->last_run = lv_tick_get();
     new_timer->user_data = user_data;
+    new_timer->heap_idx = HEAP_IDX_NONE;
+    new_timer->ran_next = NULL;
 
-    timer_created = true;
+    if(!heap_insert(new_timer)) {
+        _lv_ll_remove(&LV_GC_ROOT(_lv_timer_ll), new_timer);
+        lv_mem_free(new_timer);
+        return NULL;
+    }
 
     return new_timer;
 }
@@ -200,8 +214,18 @@ void lv_timer_set_cb(lv_timer_t * timer, lv_timer_cb_t timer_cb)
  */
 void lv_timer_del(lv_timer_t * timer)
 {
+    if(timer->heap_idx == HEAP_IDX_RAN) {
+        lv_timer_t ** ran_p = &ran_head;
+        while(*ran_p != timer) ran_p = &(*ran_p)->ran_next;
+        *ran_p = timer->ran_next;
+    }
+    else if(timer->heap_idx != HEAP_IDX_NONE) {
+        heap_remove(timer);
+    }
+
+    if(LV_GC_ROOT(_lv_timer_act) == timer) LV_GC_ROOT(_lv_timer_act) = NULL;
+
     _lv_ll_remove(&LV_GC_ROOT(_lv_timer_ll), timer);
-    timer_deleted = true;
 
     lv_mem_free(timer);
 }
@@ -213,11 +237,15 @@ void lv_timer_del(lv_timer_t * timer)
 void lv_timer_pause(lv_timer_t * timer)
 {
     timer->paused = true;
+    if(timer->heap_idx != HEAP_IDX_NONE && timer->heap_idx != HEAP_IDX_RAN) {
+        heap_remove(timer);
+    }
 }
 
 void lv_timer_resume(lv_timer_t * timer)
 {
     timer->paused = false;
+    if(timer->heap_idx == HEAP_IDX_NONE) heap_insert(timer);
 }
 
 /**
@@ -228,6 +256,7 @@ void lv_timer_resume(lv_timer_t * timer)
 void lv_timer_set_period(lv_timer_t * timer, uint32_t period)
 {
     timer->period = period;
+    heap_update(timer);
 }
 
 /**
@@ -237,16 +266,21 @@ void lv_timer_set_period(lv_timer_t * timer, uint32_t period)
 void lv_timer_ready(lv_timer_t * timer)
 {
     timer->last_run = lv_tick_get() - timer->period - 1;
+    heap_update(timer);
 }
 
 /**
  * Set the number of times a timer will repeat.
+ * With 0 the timer is also made ready to delete it in the next `lv_timer_handler()` call.
  * @param timer pointer to a lv_timer.
  * @param repeat_count -1 : infinity;  0 : stop ;  n >0: residual times
  */
 void lv_timer_set_repeat_count(lv_timer_t * timer, int32_t repeat_count)
 {
     timer->repeat_count = repeat_count;
+
+    /*`lv_timer_handler()` checks only the timers which are due, so make it ready to delete it in the next call*/
+    if(repeat_count == 0) lv_timer_ready(timer);
 }
 
 /**
@@ -257,6 +291,7 @@ void lv_timer_set_repeat_count(lv_timer_t * timer, int32_t repeat_count)
 void lv_timer_reset(lv_timer_t * timer)
 {
     timer->last_run = lv_tick_get();
+    heap_update(timer);
 }
 
 /**
@@ -277,6 +312,17 @@ uint8_t lv_timer_get_idle(void)
     return idle_last;
 }
 
+/**
+ * Get the time until the next timer needs to run
+ * @return the time in ms, 0 if a timer is ready, or `LV_NO_TIMER_READY` if there are no running timers
+ */
+uint32_t lv_timer_get_time_until_next(void)
+{
+    if(heap_cnt == 0) return LV_NO_TIMER_READY;
+
+    return lv_timer_time_remaining(LV_GC_ROOT(_lv_timer_heap)[0]);
+}
+
 /**
  * Iterate through the timers
  * @param timer NULL to start iteration or the previous return value to get the next timer
@@ -293,37 +339,27 @@ lv_timer_t * lv_timer_get_next(lv_timer_t * timer)
  **********************/
 
 /**
- * Execute timer if its remaining time is zero
- * @param timer pointer to lv_timer
- * @return true: execute, false: not executed
+ * Execute a ready timer and delete it if its repeat count is over
+ * @param timer pointer to lv_timer, should be `_lv_timer_act`
  */
-static bool lv_timer_exec(lv_timer_t * timer)
+static void lv_timer_exec(lv_timer_t * timer)
 {
-    if(timer->paused) return false;
-
-    bool exec = false;
-    if(lv_timer_time_remaining(timer) == 0) {
-        /* Decrement the repeat count before executing the timer_cb.
-         * If any timer is deleted `if(timer->repeat_count == 0)` is not executed below
-         * but at least the repeat count is zero and the timer can be deleted in the next round*/
-        int32_t original_repeat_count = timer->repeat_count;
-        if(timer->repeat_count > 0) timer->repeat_count--;
-        timer->last_run = lv_tick_get();
-        TIMER_TRACE("calling timer callback: %p", *((void **)&timer->timer_cb));
-        if(timer->timer_cb && original_repeat_count != 0) timer->timer_cb(timer);
-        TIMER_TRACE("timer callback %p finished", *((void **)&timer->timer_cb));
-        LV_ASSERT_MEM_INTEGRITY();
-        exec = true;
-    }
+    /* Decrement the repeat count before executing the timer_cb.
+     * If the timer is deleted in the callback `if(timer->repeat_count == 0)` is not executed below*/
+    int32_t original_repeat_count = timer->repeat_count;
+    if(timer->repeat_count > 0) timer->repeat_count--;
+    timer->last_run = lv_tick_get();
+    TIMER_TRACE("calling timer callback: %p", *((void **)&timer->timer_cb));
+    if(timer->timer_cb && original_repeat_count != 0) timer->timer_cb(timer);
+    TIMER_TRACE("timer callback %p finished", *((void **)&timer->timer_cb));
+    LV_ASSERT_MEM_INTEGRITY();
 
-    if(timer_deleted == false) { /*The timer might be deleted by itself as well*/
+    if(LV_GC_ROOT(_lv_timer_act) == timer) { /*The timer might be deleted by itself as well*/
         if(timer->repeat_count == 0) { /*The repeat count is over, delete the timer*/
             TIMER_TRACE("deleting timer with %p callback because the repeat count is over", *((void **)&timer->timer_cb));
             lv_timer_del(timer);
         }
     }
-
-    return exec;
 }
 
 /**
@@ -339,3 +375,126 @@ static uint32_t lv_timer_time_remaining(lv_timer_t * timer)
         return 0;
     return timer->period - elp;
 }
+
+/**
+ * Get the time until the deadline of a timer. Unlike `lv_timer_time_remaining()`
+ * it's negative if the deadline has passed, so the order of the timers doesn't change as the time elapses.
+ * @param timer pointer to lv_timer
+ * @param tick the current tick
+ * @return the time until the deadline
+ */
+static int64_t heap_key(const lv_timer_t * timer, uint32_t tick)
+{
+    return (int64_t)timer->period - (int64_t)(uint32_t)(tick - timer->last_run);
+}
+
+/**
+ * Move a timer toward the root of the heap until its parent has an earlier deadline
+ * @param idx index of the timer in the heap
+ * @param tick the current tick
+ */
+static void heap_move_up(uint32_t idx, uint32_t tick)
+{
+    lv_timer_t ** heap = LV_GC_ROOT(_lv_timer_heap);
+    lv_timer_t * timer = heap[idx];
+    int64_t key = heap_key(timer, tick);
+    while(idx > 0) {
+        uint32_t parent = (idx - 1) / 2;
+        if(heap_key(heap[parent], tick) <= key) break;
+        heap_set(idx, heap[parent]);
+        idx = parent;
+    }
+    heap_set(idx, timer);
+}
+
+/**
+ * Move a timer toward the leaves of the heap until its children have later deadlines
+ * @param idx index of the timer in the heap
+ * @param tick the current tick
+ */
+static void heap_move_down(uint32_t idx, uint32_t tick)
+{
+    lv_timer_t ** heap = LV_GC_ROOT(_lv_timer_heap);
+    lv_timer_t * timer = heap[idx];
+    int64_t key = heap_key(timer, tick);
+    while(1) {
+        uint32_t child = idx * 2 + 1;
+        if(child >= heap_cnt) break;
+
+        int64_t child_key = heap_key(heap[child], tick);
+        if(child + 1 < heap_cnt) {
+            int64_t right_key = heap_key(heap[child + 1], tick);
+            if(right_key < child_key) {
+                child++;
+                child_key = right_key;
+            }
+        }
+
+        if(key <= child_key) break;
+        heap_set(idx, heap[child]);
+        idx = child;
+    }
+    heap_set(idx, timer);
+}
+
+static void heap_set(uint32_t idx, lv_timer_t * timer)
+{
+    LV_GC_ROOT(_lv_timer_heap)[idx] = timer;
+    timer->heap_idx = idx;
+}
+
+/**
+ * Add a timer to the heap
+ * @param timer pointer to lv_timer which is not in the heap
+ * @return true: added, false: out of memory
+ */
+static bool heap_insert(lv_timer_t * timer)
+{
+    if(heap_cnt == heap_size) {
+        uint32_t new_size = heap_size ? heap_size * 2 : HEAP_DEF_SIZE;
+        lv_timer_t ** new_heap = lv_mem_realloc(LV_GC_ROOT(_lv_timer_heap), new_size * sizeof(lv_timer_t *));
+        LV_ASSERT_MALLOC(new_heap);
+        if(new_heap == NULL) return false;
+        LV_GC_ROOT(_lv_timer_heap) = new_heap;
+        heap_size = new_size;
+    }
+
+    heap_cnt++;
+    heap_set(heap_cnt - 1, timer);
+    heap_move_up(heap_cnt - 1, lv_tick_get());
+    return true;
+}
+
+/**
+ * Remove a timer from the heap
+ * @param timer pointer to lv_timer which is in the heap
+ */
+static void heap_remove(lv_timer_t * timer)
+{
+    uint32_t idx = timer->heap_idx;
+    timer->heap_idx = HEAP_IDX_NONE;
+
+    heap_cnt--;
+    if(idx == heap_cnt) return;
+
+    /*Fill the gap with the last timer and restore the order*/
+    uint32_t tick = lv_tick_get();
+    lv_timer_t * last = LV_GC_ROOT(_lv_timer_heap)[heap_cnt];
+    heap_set(idx, last);
+    heap_move_up(idx, tick);
+    heap_move_down(last->heap_idx, tick);
+}
+
+/**
+ * Restore the order of the heap after the deadline of a timer has changed
+ * @param timer pointer to lv_timer
+ */
+static void heap_update(lv_timer_t * timer)
+{
+    /*Paused timers and the timers which ran in this call are added later*/
+    if(timer->heap_idx == HEAP_IDX_NONE || timer->heap_idx == HEAP_IDX_RAN) return;
+
+    uint32_t tick = lv_tick_get();
+    heap_move_up(timer->heap_idx, tick);
+    heap_move_down(timer->heap_idx, tick);
+}
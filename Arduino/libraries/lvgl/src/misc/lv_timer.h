@@ -48,6 +48,8 @@ typedef struct _lv_timer_t {
     void * user_data; /**< Custom user data*/
     int32_t repeat_count; /**< 1: One time;  -1 : infinity;  n>0: residual times*/
     uint32_t paused : 1;
+    uint32_t heap_idx; /**< Position in the deadline ordered heap (internal)*/
+    struct _lv_timer_t * ran_next; /**< Next timer which ran in the current `lv_timer_handler()` call (internal)*/
 } lv_timer_t;
 
 /**********************
@@ -141,6 +143,8 @@ void lv_timer_ready(lv_timer_t * timer);
 
 /**
  * Set the number of times a timer will repeat.
+ * With 0 the timer is also made ready (see `lv_timer_ready()`) so that it's deleted
+ * in the next `lv_timer_handler()` call without running its callback, not only after its period.
  * @param timer pointer to a lv_timer.
  * @param repeat_count -1 : infinity;  0 : stop ;  n>0: residual times
  */
@@ -165,6 +169,13 @@ void lv_timer_enable(bool en);
  */
 uint8_t lv_timer_get_idle(void);
 
+/**
+ * Get the time until the next timer needs to run.
+ * Useful to sleep until then in tickless main loops.
+ * @return the time in ms, 0 if a timer is ready, or `LV_NO_TIMER_READY` if there are no running timers
+ */
+uint32_t lv_timer_get_time_until_next(void);
+
 /**
  * Iterate through the timers
  * @param timer NULL to start iteration or the previous return value to get the next timer
@@ -61,10 +61,12 @@ const lv_obj_class_t lv_bar_class = {
     .constructor_cb = lv_bar_constructor,
     .destructor_cb = lv_bar_destructor,
     .event_cb = lv_bar_event,
+    .event_skip = LV_OBJ_CLASS_EVENT_SKIP_ALL,
     .width_def = LV_DPI_DEF * 2,
     .height_def = LV_DPI_DEF / 10,
     .instance_size = sizeof(lv_bar_t),
-    .base_class = &lv_obj_class
+    .base_class = &lv_obj_class,
+    .parallel_draw = 1,
 };
 
 /**********************
@@ -62,6 +62,7 @@ const lv_obj_class_t lv_btnmatrix_class = {
     .constructor_cb = lv_btnmatrix_constructor,
     .destructor_cb = lv_btnmatrix_destructor,
     .event_cb = lv_btnmatrix_event,
+    .event_skip = LV_OBJ_CLASS_EVENT_SKIP_ALL,
     .width_def = LV_DPI_DEF * 2,
     .height_def = LV_DPI_DEF,
     .instance_size = sizeof(lv_btnmatrix_t),
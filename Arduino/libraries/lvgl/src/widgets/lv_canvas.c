@@ -40,7 +40,8 @@ const lv_obj_class_t lv_canvas_class = {
     .constructor_cb = lv_canvas_constructor,
     .destructor_cb = lv_canvas_destructor,
     .instance_size = sizeof(lv_canvas_t),
-    .base_class = &lv_img_class
+    .base_class = &lv_img_class,
+    .parallel_draw = 1,
 };
 
 /**********************
@@ -63,18 +63,21 @@ const lv_obj_class_t lv_dropdown_class = {
     .constructor_cb = lv_dropdown_constructor,
     .destructor_cb = lv_dropdown_destructor,
     .event_cb = lv_dropdown_event,
+    .event_skip = LV_OBJ_CLASS_EVENT_SKIP_ALL & ~LV_OBJ_CLASS_EVENT_SKIP_GET_SELF_SIZE,
     .width_def = LV_DPI_DEF,
     .height_def = LV_SIZE_CONTENT,
     .instance_size = sizeof(lv_dropdown_t),
     .editable = LV_OBJ_CLASS_EDITABLE_TRUE,
     .group_def = LV_OBJ_CLASS_GROUP_DEF_TRUE,
-    .base_class = &lv_obj_class
+    .base_class = &lv_obj_class,
+    .parallel_draw = 1,
 };
 
 const lv_obj_class_t lv_dropdownlist_class = {
     .constructor_cb = lv_dropdownlist_constructor,
     .destructor_cb = lv_dropdownlist_destructor,
     .event_cb = lv_dropdown_list_event,
+    .event_skip = LV_OBJ_CLASS_EVENT_SKIP_ALL,
     .instance_size = sizeof(lv_dropdown_list_t),
     .base_class = &lv_obj_class
 };
@@ -33,6 +33,7 @@ static void lv_img_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
 static void lv_img_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
 static void lv_img_event(const lv_obj_class_t * class_p, lv_event_t * e);
 static void draw_img(lv_event_t * e);
+static void lv_img_inv_size_cache(lv_obj_t * obj);
 
 /**********************
  *  STATIC VARIABLES
@@ -41,10 +42,12 @@ const lv_obj_class_t lv_img_class = {
     .constructor_cb = lv_img_constructor,
     .destructor_cb = lv_img_destructor,
     .event_cb = lv_img_event,
+    .event_skip = LV_OBJ_CLASS_EVENT_SKIP_DRAW_BEGIN_END | LV_OBJ_CLASS_EVENT_SKIP_DRAW_PART,
     .width_def = LV_SIZE_CONTENT,
     .height_def = LV_SIZE_CONTENT,
     .instance_size = sizeof(lv_img_t),
-    .base_class = &lv_obj_class
+    .base_class = &lv_obj_class,
+    .parallel_draw = 1,
 };
 
 /**********************
@@ -151,6 +154,7 @@ void lv_img_set_src(lv_obj_t * obj, const void * src)
     img->cf       = header.cf;
     img->pivot.x = header.w / 2;
     img->pivot.y = header.h / 2;
+    lv_img_inv_size_cache(obj);
 
     lv_obj_refresh_self_size(obj);
 
@@ -200,6 +204,7 @@ void lv_img_set_angle(lv_obj_t * obj, int16_t angle)
     lv_obj_invalidate_area(obj, &a);
 
     img->angle = angle;
+    lv_img_inv_size_cache(obj);
 
     /* Disable invalidations because lv_obj_refresh_ext_draw_size would invalidate
      * the whole ext draw area */
@@ -234,6 +239,7 @@ void lv_img_set_pivot(lv_obj_t * obj, lv_coord_t x, lv_coord_t y)
 
     img->pivot.x = x;
     img->pivot.y = y;
+    lv_img_inv_size_cache(obj);
 
     /* Disable invalidations because lv_obj_refresh_ext_draw_size would invalidate
      * the whole ext draw area */
@@ -269,6 +275,7 @@ void lv_img_set_zoom(lv_obj_t * obj, uint16_t zoom)
     lv_obj_invalidate_area(obj, &a);
 
     img->zoom = zoom;
+    lv_img_inv_size_cache(obj);
 
     /* Disable invalidations because lv_obj_refresh_ext_draw_size would invalidate
      * the whole ext draw area */
@@ -402,6 +409,7 @@ static void lv_img_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     img->pivot.x = 0;
     img->pivot.y = 0;
     img->obj_size_mode = LV_IMG_SIZE_MODE_VIRTUAL;
+    lv_img_inv_size_cache(obj);
 
     lv_obj_clear_flag(obj, LV_OBJ_FLAG_CLICKABLE);
     lv_obj_add_flag(obj, LV_OBJ_FLAG_ADV_HITTEST);
@@ -424,14 +432,33 @@ static lv_point_t lv_img_get_transformed_size(lv_obj_t * obj)
 {
     lv_img_t * img = (lv_img_t *)obj;
 
+#if LV_LAYOUT_CACHE
+    if(img->size_cache.x >= 0 && lv_obj_is_layout_cache_enabled()) return img->size_cache;
+#endif
 
     lv_area_t area_transform;
     _lv_img_buf_get_transformed_area(&area_transform, img->w, img->h,
                                      img->angle, img->zoom, &img->pivot);
 
-    return (lv_point_t) {
-        lv_area_get_width(&area_transform), lv_area_get_height(&area_transform)
-    };
+    lv_point_t size = {lv_area_get_width(&area_transform), lv_area_get_height(&area_transform)};
+#if LV_LAYOUT_CACHE
+    img->size_cache = size;
+#endif
+    return size;
+}
+
+/**
+ * Calculate the transformed size again when it's required next time
+ * @param obj       pointer to an image object
+ */
+static void lv_img_inv_size_cache(lv_obj_t * obj)
+{
+#if LV_LAYOUT_CACHE
+    lv_img_t * img = (lv_img_t *)obj;
+    img->size_cache.x = -1;
+#else
+    LV_UNUSED(obj);
+#endif
 }
 
 static void lv_img_event(const lv_obj_class_t * class_p, lv_event_t * e)
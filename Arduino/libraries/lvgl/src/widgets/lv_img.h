@@ -46,6 +46,9 @@ typedef struct {
     uint16_t angle;    /*rotation angle of the image*/
     lv_point_t pivot;     /*rotation center of the image*/
     uint16_t zoom;         /*256 means no zoom, 512 double size, 128 half size*/
+#if LV_LAYOUT_CACHE
+    lv_point_t size_cache;  /*Transformed size of the image. `x < 0` if invalid*/
+#endif
     uint8_t src_type : 2;  /*See: lv_img_src_t*/
     uint8_t cf : 5;        /*Color format from `lv_img_color_format_t`*/
     uint8_t antialias : 1; /*Apply anti-aliasing in transformations (rotate, zoom)*/
@@ -17,6 +17,7 @@
 #include "../misc/lv_bidi.h"
 #include "../misc/lv_txt_ap.h"
 #include "../misc/lv_printf.h"
+#include "../misc/lv_thread.h"
 
 /*********************
  *      DEFINES
@@ -42,6 +43,7 @@ static void draw_main(lv_event_t * e);
 
 static void lv_label_refr_text(lv_obj_t * obj);
 static void lv_label_revert_dots(lv_obj_t * label);
+static void lv_label_inv_size_cache(lv_obj_t * obj);
 
 static bool lv_label_set_dot_tmp(lv_obj_t * label, char * data, uint32_t len);
 static char * lv_label_get_dot_tmp(lv_obj_t * label);
@@ -56,10 +58,12 @@ const lv_obj_class_t lv_label_class = {
     .constructor_cb = lv_label_constructor,
     .destructor_cb = lv_label_destructor,
     .event_cb = lv_label_event,
+    .event_skip = LV_OBJ_CLASS_EVENT_SKIP_ALL & ~LV_OBJ_CLASS_EVENT_SKIP_GET_SELF_SIZE,
     .width_def = LV_SIZE_CONTENT,
     .height_def = LV_SIZE_CONTENT,
     .instance_size = sizeof(lv_label_t),
-    .base_class = &lv_obj_class
+    .base_class = &lv_obj_class,
+    .parallel_draw = 1,
 };
 
 /**********************
@@ -88,6 +92,7 @@ void lv_label_set_text(lv_obj_t * obj, const char * text)
     lv_label_t * label = (lv_label_t *)obj;
 
     lv_obj_invalidate(obj);
+    lv_label_inv_size_cache(obj);
 
     /*If text is NULL then just refresh with the current text*/
     if(text == NULL) text = label->text;
@@ -150,6 +155,7 @@ void lv_label_set_text_fmt(lv_obj_t * obj, const char * fmt, ...)
     LV_ASSERT_NULL(fmt);
 
     lv_obj_invalidate(obj);
+    lv_label_inv_size_cache(obj);
     lv_label_t * label = (lv_label_t *)obj;
 
     /*If text is NULL then refresh*/
@@ -187,6 +193,7 @@ void lv_label_set_text_static(lv_obj_t * obj, const char * text)
         label->text       = (char *)text;
     }
 
+    lv_label_inv_size_cache(obj);
     lv_label_refr_text(obj);
 }
 
@@ -213,6 +220,7 @@ void lv_label_set_long_mode(lv_obj_t * obj, lv_label_long_mode_t long_mode)
     }
 
     label->long_mode = long_mode;
+    lv_label_inv_size_cache(obj);
     lv_label_refr_text(obj);
 }
 
@@ -224,6 +232,7 @@ void lv_label_set_recolor(lv_obj_t * obj, bool en)
     if(label->recolor == en) return;
 
     label->recolor = en == false ? 0 : 1;
+    lv_label_inv_size_cache(obj);
 
     /*Refresh the text because the potential color codes in text needs to be hidden or revealed*/
     lv_label_refr_text(obj);
@@ -676,6 +685,7 @@ void lv_label_cut_text(lv_obj_t * obj, uint32_t pos, uint32_t cnt)
     char * label_txt = lv_label_get_text(obj);
     /*Delete the characters*/
     _lv_txt_cut(label_txt, pos, cnt);
+    lv_label_inv_size_cache(obj);
 
     /*Refresh the label*/
     lv_label_refr_text(obj);
@@ -699,6 +709,9 @@ static void lv_label_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     label->long_mode  = LV_LABEL_LONG_WRAP;
     label->offset.x = 0;
     label->offset.y = 0;
+#if LV_LAYOUT_CACHE
+    label->size_cache_w = LV_COORD_MIN;
+#endif
 
 #if LV_LABEL_LONG_TXT_HINT
     label->hint.line_start = -1;
@@ -747,6 +760,7 @@ static void lv_label_event(const lv_obj_class_t * class_p, lv_event_t * e)
     if(code == LV_EVENT_STYLE_CHANGED) {
         /*Revert dots for proper refresh*/
         lv_label_revert_dots(obj);
+        lv_label_inv_size_cache(obj);
         lv_label_refr_text(obj);
     }
     else if(code == LV_EVENT_REFR_EXT_DRAW_SIZE) {
@@ -776,7 +790,20 @@ static void lv_label_event(const lv_obj_class_t * class_p, lv_event_t * e)
         if(lv_obj_get_style_width(obj, LV_PART_MAIN) == LV_SIZE_CONTENT && !obj->w_layout) w = LV_COORD_MAX;
         else w = lv_obj_get_content_width(obj);
 
-        lv_txt_get_size(&size, label->text, font, letter_space, line_space, w, flag);
+#if LV_LAYOUT_CACHE
+        /*Measure the text again only if it, its style or the available width has changed*/
+        if(label->size_cache_w == w && lv_obj_is_layout_cache_enabled()) {
+            size = label->size_cache;
+        }
+        else
+#endif
+        {
+            lv_txt_get_size(&size, label->text, font, letter_space, line_space, w, flag);
+#if LV_LAYOUT_CACHE
+            label->size_cache = size;
+            label->size_cache_w = w;
+#endif
+        }
 
         lv_point_t * self_size = lv_event_get_param(e);
         self_size->x = LV_MAX(self_size->x, size.x);
@@ -834,6 +861,8 @@ static void draw_main(lv_event_t * e)
     lv_draw_label_hint_t * hint = &label->hint;
     if(label->long_mode == LV_LABEL_LONG_SCROLL_CIRCULAR || lv_area_get_height(&txt_coords) < LV_LABEL_HINT_HEIGHT_LIMIT)
         hint = NULL;
+    /*The hint is updated while drawing so it can't be shared by the rendering threads*/
+    if(lv_thread_pool_is_running()) hint = NULL;
 
 #else
     /*Just for compatibility*/
@@ -907,14 +936,17 @@ static void lv_label_refr_text(lv_obj_t * obj)
     lv_coord_t line_space = lv_obj_get_style_text_line_space(obj, LV_PART_MAIN);
     lv_coord_t letter_space = lv_obj_get_style_text_letter_space(obj, LV_PART_MAIN);
 
-    /*Calc. the height and longest line*/
-    lv_point_t size;
-    lv_text_flag_t flag = LV_TEXT_FLAG_NONE;
-    if(label->recolor != 0) flag |= LV_TEXT_FLAG_RECOLOR;
-    if(label->expand != 0) flag |= LV_TEXT_FLAG_EXPAND;
-    if(lv_obj_get_style_width(obj, LV_PART_MAIN) == LV_SIZE_CONTENT && !obj->w_layout) flag |= LV_TEXT_FLAG_FIT;
+    /*Calc. the height and longest line. Only the scrolling and dot modes need it.*/
+    lv_point_t size = {0, 0};
+    if(label->long_mode == LV_LABEL_LONG_SCROLL || label->long_mode == LV_LABEL_LONG_SCROLL_CIRCULAR ||
+       label->long_mode == LV_LABEL_LONG_DOT) {
+        lv_text_flag_t flag = LV_TEXT_FLAG_NONE;
+        if(label->recolor != 0) flag |= LV_TEXT_FLAG_RECOLOR;
+        if(label->expand != 0) flag |= LV_TEXT_FLAG_EXPAND;
+        if(lv_obj_get_style_width(obj, LV_PART_MAIN) == LV_SIZE_CONTENT && !obj->w_layout) flag |= LV_TEXT_FLAG_FIT;
 
-    lv_txt_get_size(&size, label->text, font, letter_space, line_space, max_w, flag);
+        lv_txt_get_size(&size, label->text, font, letter_space, line_space, max_w, flag);
+    }
 
     lv_obj_refresh_self_size(obj);
 
@@ -1158,6 +1190,7 @@ static void lv_label_refr_text(lv_obj_t * obj)
                 }
                 label->text[byte_id_ori + LV_LABEL_DOT_NUM] = '\0';
                 label->dot_end                              = letter_id + LV_LABEL_DOT_NUM;
+                lv_label_inv_size_cache(obj);
             }
         }
     }
@@ -1190,6 +1223,21 @@ static void lv_label_revert_dots(lv_obj_t * obj)
     lv_label_dot_tmp_free(obj);
 
     label->dot_end = LV_LABEL_DOT_END_INV;
+    lv_label_inv_size_cache(obj);
+}
+
+/**
+ * Measure the text again on the next layout update
+ * @param obj       pointer to a label object
+ */
+static void lv_label_inv_size_cache(lv_obj_t * obj)
+{
+#if LV_LAYOUT_CACHE
+    lv_label_t * label = (lv_label_t *)obj;
+    label->size_cache_w = LV_COORD_MIN;
+#else
+    LV_UNUSED(obj);
+#endif
 }
 
 /**
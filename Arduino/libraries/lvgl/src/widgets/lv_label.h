@@ -69,6 +69,10 @@ typedef struct {
 #endif
 
     lv_point_t offset; /*Text draw position offset*/
+#if LV_LAYOUT_CACHE
+    lv_point_t size_cache;      /*Size of the text measured for the layout*/
+    lv_coord_t size_cache_w;    /*Max. width used to measure `size_cache`. `LV_COORD_MIN` if invalid*/
+#endif
     lv_label_long_mode_t long_mode : 3; /*Determine what to do with the long texts*/
     uint8_t static_txt : 1;             /*Flag to indicate the text is static*/
     uint8_t recolor : 1;                /*Enable in-line letter re-coloring*/
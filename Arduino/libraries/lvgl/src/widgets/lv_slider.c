@@ -43,10 +43,12 @@ static bool is_slider_horizontal(lv_obj_t * obj);
 const lv_obj_class_t lv_slider_class = {
     .constructor_cb = lv_slider_constructor,
     .event_cb = lv_slider_event,
+    .event_skip = LV_OBJ_CLASS_EVENT_SKIP_ALL & ~LV_OBJ_CLASS_EVENT_SKIP_HIT_TEST,
     .editable = LV_OBJ_CLASS_EDITABLE_TRUE,
     .group_def = LV_OBJ_CLASS_GROUP_DEF_TRUE,
     .instance_size = sizeof(lv_slider_t),
-    .base_class = &lv_bar_class
+    .base_class = &lv_bar_class,
+    .parallel_draw = 1,
 };
 
 /**********************
@@ -22,16 +22,24 @@ build_only_options = {
 test_options = {
     'OPTIONS_TEST_SYSHEAP': 'Test config, system heap, 32 bit color depth',
     'OPTIONS_TEST_DEFHEAP': 'Test config, LVGL heap, 32 bit color depth',
+    'OPTIONS_TEST_FEATURES': 'Test config, optional features, LVGL heap, 32 bit color depth',
+}
+
+bench_options = {
+    'OPTIONS_BENCHMARK': 'Benchmark config, optimized, LVGL heap, 32 bit color depth',
 }
 
 
 def is_valid_option_name(option_name):
-    return option_name in build_only_options or option_name in test_options
+    return option_name in build_only_options or option_name in test_options \
+        or option_name in bench_options
 
 
 def get_option_description(option_name):
     if option_name in build_only_options:
         return build_only_options[option_name]
+    if option_name in bench_options:
+        return bench_options[option_name]
     return test_options[option_name]
 
 
@@ -126,6 +134,20 @@ def run_tests(options_name):
         ['ctest', '--timeout', '30', '--parallel', str(os.cpu_count()), '--output-on-failure'])
 
 
+def run_bench(options_name, bench_args):
+    '''Run the headless benchmark with the given arguments.'''
+
+    print()
+    print()
+    label = 'Running benchmark for %s' % options_abbrev(options_name)
+    print('=' * len(label))
+    print(label)
+    print('=' * len(label), flush=True)
+
+    os.chdir(get_build_dir(options_name))
+    subprocess.check_call([os.path.join('.', 'lv_test_bench')] + bench_args)
+
+
 def generate_code_coverage_report():
     '''Produce code coverage test reports for the test execution.'''
     global lvgl_test_dir
@@ -171,8 +193,13 @@ if __name__ == "__main__":
                         help='clean existing build artifacts before operation.')
     parser.add_argument('--report', action='store_true',
                         help='generate code coverage report for tests.')
-    parser.add_argument('actions', nargs='*', choices=['build', 'test'],
-                        help='build: compile build tests, test: compile/run executable tests.')
+    parser.add_argument('--bench-args', default='',
+                        help='''arguments of the benchmark runner, e.g.
+                        --bench-args="--res 240x240-round --format csv".
+                        See `lv_test_bench --help`.''')
+    parser.add_argument('actions', nargs='*', choices=['build', 'test', 'bench'],
+                        help='build: compile build tests, test: compile/run executable tests, '
+                        'bench: compile the benchmark optimized and run it.')
 
     args = parser.parse_args()
 
@@ -184,8 +211,12 @@ if __name__ == "__main__":
                 options_to_build = {**build_only_options, **test_options}
             else:
                 options_to_build = build_only_options
+        elif args.actions == ['bench']:
+            options_to_build = {}
         else:
             options_to_build = test_options
+        if 'bench' in args.actions:
+            options_to_build = {**options_to_build, **bench_options}
 
     for opt in options_to_build:
         if not is_valid_option_name(opt):
@@ -196,13 +227,16 @@ if __name__ == "__main__":
 
     for options_name in options_to_build:
         is_test = options_name in test_options
-        build_type = 'Debug'
+        is_bench = options_name in bench_options
+        build_type = 'Release' if is_bench else 'Debug'
         build_tests(options_name, build_type, args.clean)
-        if is_test:
-            try:
+        try:
+            if is_test:
                 run_tests(options_name)
-            except subprocess.CalledProcessError as e:
-                sys.exit(e.returncode)
+            if is_bench and 'bench' in args.actions:
+                run_bench(options_name, args.bench_args.split())
+        except subprocess.CalledProcessError as e:
+            sys.exit(e.returncode)
 
     if args.report:
         generate_code_coverage_report()
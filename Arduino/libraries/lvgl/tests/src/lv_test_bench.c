@@ -0,0 +1,720 @@
+/**
+ * @file lv_test_bench.c
+ *
+ * Headless benchmark runner.
+ * Renders the scenes of the benchmark demo and some custom scenes into a memory frame buffer
+ * with a simulated tick and reports the render time, the pixels blended, the flushes,
+ * the heap peak and the cache hit rates of every scene as JSON or CSV.
+ * The results can be compared to an earlier CSV report to catch the regressions.
+ *
+ * Run `lv_test_bench --help` for the options.
+ */
+
+#if LV_BUILD_TEST
+#include "../../lvgl.h"
+#include "../../demos/lv_demos.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define HOR_RES_MAX         800
+#define VER_RES_MAX         480
+#define SCENE_MAX           128
+#define LINE_MAX_LEN        512
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    const char * name;
+    lv_coord_t hor_res;
+    lv_coord_t ver_res;
+    bool round;             /*Only the pixels in the inscribed circle are visible*/
+} profile_t;
+
+typedef struct {
+    const char * name;
+    void (*create_cb)(void);
+    void (*frame_cb)(uint32_t frame);   /*Called before every frame to make changes. Can be NULL*/
+    void (*close_cb)(void);
+} custom_scene_t;
+
+typedef struct {
+    int32_t bench_no;                   /*Number of a benchmark demo scene or -1*/
+    const custom_scene_t * custom;      /*A custom scene if `bench_no < 0`*/
+} scene_ref_t;
+
+typedef struct {
+    char name[64];
+    uint32_t frames;
+    uint32_t time_us_avg;
+    uint32_t time_us_max;
+    uint32_t px_rendered;       /*Per frame*/
+    uint32_t px_blended;        /*Per frame*/
+    uint32_t flush_cnt;
+    uint32_t px_flushed;        /*Per frame, only the visible pixels*/
+    uint32_t heap_peak;
+    double style_cache_hit_pct;     /*Negative if the cache wasn't used*/
+    double img_cache_hit_pct;
+} result_t;
+
+typedef enum {
+    FORMAT_JSON,
+    FORMAT_CSV,
+} format_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void hal_init(const profile_t * p, uint32_t buf_lines);
+static void flush_cb(lv_disp_drv_t * disp_drv, const lv_area_t * area, lv_color_t * color_p);
+static void log_cb(const char * buf);
+static uint64_t time_us(void);
+static void run_scene(const scene_ref_t * scene, result_t * res);
+static void write_json(FILE * f, const result_t * res, uint32_t cnt);
+static void write_csv(FILE * f, const result_t * res, uint32_t cnt);
+static int compare_baseline(const char * path, const result_t * res, uint32_t cnt, uint32_t tolerance);
+static bool parse_scenes(const char * list);
+static void print_usage(void);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static const profile_t profiles[] = {
+    {"800x480", 800, 480, false},
+    {"480x320", 480, 320, false},
+    {"320x240", 320, 240, false},
+    {"240x240-round", 240, 240, true},
+};
+
+static const profile_t * profile = &profiles[0];
+static uint32_t frame_cnt = 60;
+static uint32_t warmup_cnt = 1;
+static uint32_t period = 16;
+
+static lv_color_t fb[HOR_RES_MAX * VER_RES_MAX];
+static lv_color_t draw_buf1[HOR_RES_MAX * VER_RES_MAX];
+static lv_disp_t * disp;
+
+/*The visible part of every row on round displays*/
+static lv_coord_t row_x1[VER_RES_MAX];
+static lv_coord_t row_x2[VER_RES_MAX];
+
+static uint32_t flush_cnt;
+static uint32_t px_flushed;
+
+static scene_ref_t scenes[SCENE_MAX];
+static uint32_t scene_cnt;
+static result_t results[SCENE_MAX];
+
+/**********************
+ *   CUSTOM SCENES
+ **********************/
+
+#if LV_USE_DEMO_WIDGETS
+static void widgets_frame_cb(uint32_t frame)
+{
+    LV_UNUSED(frame);
+    /*Measure full redraws*/
+    lv_obj_invalidate(lv_scr_act());
+}
+#endif
+
+#if LV_USE_LIST
+static lv_obj_t * list_obj;
+static int32_t list_step;
+
+static void list_create_cb(void)
+{
+    list_obj = lv_list_create(lv_scr_act());
+    lv_obj_set_size(list_obj, lv_pct(100), lv_pct(100));
+
+    /*Enough items to scroll but fits to small heaps too*/
+    uint32_t i;
+    for(i = 0; i < 40; i++) {
+        if(i % 10 == 0) {
+            lv_list_add_text(list_obj, "Section");
+            continue;
+        }
+        char buf[32];
+        lv_snprintf(buf, sizeof(buf), "Item %d", (int)i);
+        lv_list_add_btn(list_obj, i % 2 ? LV_SYMBOL_FILE : LV_SYMBOL_DIRECTORY, buf);
+    }
+    list_step = -7;
+}
+
+static void list_frame_cb(uint32_t frame)
+{
+    LV_UNUSED(frame);
+    /*Scroll up and down*/
+    if(lv_obj_get_scroll_bottom(list_obj) <= 0) list_step = 7;
+    else if(lv_obj_get_scroll_top(list_obj) <= 0) list_step = -7;
+    lv_obj_scroll_by(list_obj, 0, list_step, LV_ANIM_OFF);
+}
+
+static void list_close_cb(void)
+{
+    lv_obj_clean(lv_scr_act());
+    list_obj = NULL;
+}
+#endif
+
+static const custom_scene_t custom_scenes[] = {
+#if LV_USE_DEMO_WIDGETS
+    {"widgets", lv_demo_widgets, widgets_frame_cb, lv_demo_widgets_close},
+#endif
+#if LV_USE_LIST
+    {"list", list_create_cb, list_frame_cb, list_close_cb},
+#endif
+#if LV_USE_DEMO_STRESS
+    {"stress", lv_demo_stress, NULL, lv_demo_stress_close},
+#endif
+    {NULL, NULL, NULL, NULL}
+};
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+int main(int argc, char ** argv)
+{
+    format_t format = FORMAT_JSON;
+    const char * out_path = NULL;
+    const char * baseline_path = NULL;
+    const char * scene_list = "all";
+    uint32_t tolerance = 10;
+    uint32_t buf_lines = 0;
+    bool list_only = false;
+
+    int i;
+    for(i = 1; i < argc; i++) {
+        const char * arg = argv[i];
+        const char * val = i + 1 < argc ? argv[i + 1] : NULL;
+        bool has_val = true;
+        if(strcmp(arg, "--help") == 0) {
+            print_usage();
+            return 0;
+        }
+        else if(strcmp(arg, "--list") == 0) {
+            list_only = true;
+            has_val = false;
+        }
+        else if(val == NULL) {
+            fprintf(stderr, "Missing value of %s\n", arg);
+            return 2;
+        }
+        else if(strcmp(arg, "--res") == 0) {
+            uint32_t p;
+            profile = NULL;
+            for(p = 0; p < sizeof(profiles) / sizeof(profiles[0]); p++) {
+                if(strcmp(profiles[p].name, val) == 0) profile = &profiles[p];
+            }
+            if(profile == NULL) {
+                fprintf(stderr, "Unknown resolution profile: %s\n", val);
+                return 2;
+            }
+        }
+        else if(strcmp(arg, "--scenes") == 0) scene_list = val;
+        else if(strcmp(arg, "--frames") == 0) frame_cnt = strtoul(val, NULL, 10);
+        else if(strcmp(arg, "--warmup") == 0) warmup_cnt = strtoul(val, NULL, 10);
+        else if(strcmp(arg, "--period") == 0) period = strtoul(val, NULL, 10);
+        else if(strcmp(arg, "--buf-lines") == 0) buf_lines = strtoul(val, NULL, 10);
+        else if(strcmp(arg, "--out") == 0) out_path = val;
+        else if(strcmp(arg, "--baseline") == 0) baseline_path = val;
+        else if(strcmp(arg, "--tolerance") == 0) tolerance = strtoul(val, NULL, 10);
+        else if(strcmp(arg, "--format") == 0) {
+            if(strcmp(val, "json") == 0) format = FORMAT_JSON;
+            else if(strcmp(val, "csv") == 0) format = FORMAT_CSV;
+            else {
+                fprintf(stderr, "Unknown format: %s\n", val);
+                return 2;
+            }
+        }
+        else {
+            fprintf(stderr, "Unknown option: %s\n", arg);
+            print_usage();
+            return 2;
+        }
+
+        if(has_val) i++;
+    }
+
+    if(frame_cnt == 0 || period == 0) {
+        fprintf(stderr, "--frames and --period must be greater than 0\n");
+        return 2;
+    }
+
+    lv_init();
+#if LV_USE_LOG && LV_LOG_PRINTF == 0
+    lv_log_register_print_cb(log_cb);
+#else
+    LV_UNUSED(log_cb);
+#endif
+    hal_init(profile, buf_lines);
+
+    if(!parse_scenes(scene_list)) return 2;
+
+    uint32_t s;
+    if(list_only) {
+        for(s = 0; s < scene_cnt; s++) {
+#if LV_USE_DEMO_BENCHMARK
+            if(scenes[s].bench_no >= 0) {
+                printf("%d: %s%s\n", (int)scenes[s].bench_no, lv_demo_benchmark_get_scene_name(scenes[s].bench_no),
+                       scenes[s].bench_no & 1 ? " + opa" : "");
+                continue;
+            }
+#endif
+            printf("%s\n", scenes[s].custom->name);
+        }
+        return 0;
+    }
+
+    for(s = 0; s < scene_cnt; s++) {
+        run_scene(&scenes[s], &results[s]);
+        fprintf(stderr, "%s: %u us/frame\n", results[s].name, (unsigned)results[s].time_us_avg);
+    }
+
+    FILE * f = stdout;
+    if(out_path) {
+        f = fopen(out_path, "w");
+        if(f == NULL) {
+            fprintf(stderr, "Can't open %s\n", out_path);
+            return 2;
+        }
+    }
+
+    if(format == FORMAT_JSON) write_json(f, results, scene_cnt);
+    else write_csv(f, results, scene_cnt);
+
+    if(f != stdout) fclose(f);
+
+    if(baseline_path) return compare_baseline(baseline_path, results, scene_cnt, tolerance);
+
+    return 0;
+}
+
+void lv_test_assert_fail(void)
+{
+    fprintf(stderr, "Assertion failed\n");
+    abort();
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void hal_init(const profile_t * p, uint32_t buf_lines)
+{
+    static lv_disp_draw_buf_t draw_buf;
+    static lv_disp_drv_t disp_drv;
+
+    /*Partial rendering into 1/10 of the screen by default*/
+    if(buf_lines == 0) buf_lines = p->ver_res / 10;
+    if(buf_lines > (uint32_t)p->ver_res) buf_lines = p->ver_res;
+
+    lv_disp_draw_buf_init(&draw_buf, draw_buf1, NULL, p->hor_res * buf_lines);
+
+    lv_disp_drv_init(&disp_drv);
+    disp_drv.draw_buf = &draw_buf;
+    disp_drv.flush_cb = flush_cb;
+    disp_drv.hor_res = p->hor_res;
+    disp_drv.ver_res = p->ver_res;
+    disp = lv_disp_drv_register(&disp_drv);
+
+    /*Render and animate on every frame*/
+    lv_timer_set_period(disp->refr_timer, period);
+    lv_timer_set_period(lv_anim_get_timer(), period);
+
+    lv_coord_t y;
+    for(y = 0; y < p->ver_res; y++) {
+        if(!p->round) {
+            row_x1[y] = 0;
+            row_x2[y] = p->hor_res - 1;
+            continue;
+        }
+
+        /*The pixels whose center is in the circle. Use doubled coordinates to get the centers*/
+        int32_t r2 = p->hor_res;
+        int32_t dy = 2 * y + 1 - p->ver_res;
+        int32_t x = 0;
+        while(x < p->hor_res / 2 && (2 * x + 1) * (2 * x + 1) + dy * dy <= r2 * r2) x++;
+        row_x1[y] = p->hor_res / 2 - x;
+        row_x2[y] = p->hor_res / 2 + x - 1;
+    }
+}
+
+static void flush_cb(lv_disp_drv_t * disp_drv, const lv_area_t * area, lv_color_t * color_p)
+{
+    lv_coord_t w = lv_area_get_width(area);
+    lv_coord_t y;
+    for(y = area->y1; y <= area->y2; y++) {
+        /*A round panel has no pixels out of the circle*/
+        lv_coord_t x1 = LV_MAX(area->x1, row_x1[y]);
+        lv_coord_t x2 = LV_MIN(area->x2, row_x2[y]);
+        if(x1 <= x2) {
+            lv_memcpy(&fb[y * profile->hor_res + x1], &color_p[x1 - area->x1], (x2 - x1 + 1) * sizeof(lv_color_t));
+            px_flushed += x2 - x1 + 1;
+        }
+        color_p += w;
+    }
+
+    flush_cnt++;
+    lv_disp_flush_ready(disp_drv);
+}
+
+static void log_cb(const char * buf)
+{
+    fputs(buf, stderr);
+}
+
+static uint64_t time_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static void scene_create(const scene_ref_t * scene, result_t * res)
+{
+#if LV_USE_DEMO_BENCHMARK
+    if(scene->bench_no >= 0) {
+        lv_snprintf(res->name, sizeof(res->name), "%s%s", lv_demo_benchmark_get_scene_name(scene->bench_no),
+                    scene->bench_no & 1 ? " + opa" : "");
+        lv_demo_benchmark_run_scene(scene->bench_no);
+        return;
+    }
+#endif
+    lv_snprintf(res->name, sizeof(res->name), "%s", scene->custom->name);
+    scene->custom->create_cb();
+}
+
+static void scene_close(const scene_ref_t * scene)
+{
+#if LV_USE_DEMO_BENCHMARK
+    if(scene->bench_no >= 0) {
+        lv_demo_benchmark_close();
+        return;
+    }
+#endif
+    scene->custom->close_cb();
+}
+
+static void run_scene(const scene_ref_t * scene, result_t * res)
+{
+    lv_memset_00(res, sizeof(result_t));
+    res->style_cache_hit_pct = -1;
+    res->img_cache_hit_pct = -1;
+
+    /*Start from a clean screen*/
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(disp);
+
+    lv_mem_reset_max_used();
+    scene_create(scene, res);
+
+    uint32_t frame;
+    for(frame = 0; frame < warmup_cnt + frame_cnt; frame++) {
+        if(frame == warmup_cnt) {
+#if LV_USE_REFR_STAT
+            lv_refr_reset_stat();
+#endif
+#if LV_OBJ_STYLE_CACHE_SIZE
+            lv_obj_style_cache_reset_stat();
+#endif
+            lv_img_cache_reset_stat();
+            flush_cnt = 0;
+            px_flushed = 0;
+            res->time_us_avg = 0;
+            res->time_us_max = 0;
+        }
+
+        if(scene->bench_no < 0 && scene->custom->frame_cb) scene->custom->frame_cb(frame);
+
+        lv_tick_inc(period);
+        uint64_t t = time_us();
+        lv_timer_handler();
+        t = time_us() - t;
+
+        /*Sum here, divided at the end*/
+        res->time_us_avg += (uint32_t)t;
+        res->time_us_max = LV_MAX(res->time_us_max, (uint32_t)t);
+    }
+
+    res->frames = frame_cnt;
+    res->time_us_avg /= frame_cnt;
+    res->flush_cnt = flush_cnt;
+    res->px_flushed = px_flushed / frame_cnt;
+
+#if LV_USE_REFR_STAT
+    lv_refr_stat_t refr_stat;
+    lv_refr_get_stat(&refr_stat);
+    res->px_rendered = refr_stat.px_rendered / frame_cnt;
+    res->px_blended = refr_stat.px_written / frame_cnt;
+#endif
+
+#if LV_OBJ_STYLE_CACHE_SIZE
+    lv_obj_style_cache_stat_t style_stat;
+    lv_obj_style_cache_get_stat(&style_stat);
+    if(style_stat.hit + style_stat.miss) {
+        res->style_cache_hit_pct = (100.0 * style_stat.hit) / (style_stat.hit + style_stat.miss);
+    }
+#endif
+
+    lv_img_cache_stat_t img_stat;
+    lv_img_cache_get_stat(&img_stat);
+    if(img_stat.hit + img_stat.miss) {
+        res->img_cache_hit_pct = (100.0 * img_stat.hit) / (img_stat.hit + img_stat.miss);
+    }
+
+    /*The peak of the heap usage since the scene was created*/
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    res->heap_peak = mon.max_used;
+
+    scene_close(scene);
+}
+
+/*Print a percentage or `none_str` if it's negative*/
+static void write_pct(FILE * f, double pct, const char * none_str)
+{
+    if(pct < 0) fprintf(f, "%s", none_str);
+    else fprintf(f, "%.1f", pct);
+}
+
+static void write_json(FILE * f, const result_t * res, uint32_t cnt)
+{
+    fprintf(f, "{\n");
+    fprintf(f, "  \"lvgl\": \"%d.%d.%d\",\n", LVGL_VERSION_MAJOR, LVGL_VERSION_MINOR, LVGL_VERSION_PATCH);
+    fprintf(f, "  \"profile\": \"%s\",\n", profile->name);
+    fprintf(f, "  \"hor_res\": %d,\n", (int)profile->hor_res);
+    fprintf(f, "  \"ver_res\": %d,\n", (int)profile->ver_res);
+    fprintf(f, "  \"round\": %s,\n", profile->round ? "true" : "false");
+    fprintf(f, "  \"color_depth\": %d,\n", LV_COLOR_DEPTH);
+    fprintf(f, "  \"period_ms\": %u,\n", (unsigned)period);
+    fprintf(f, "  \"scenes\": [\n");
+
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        const result_t * r = &res[i];
+        fprintf(f, "    {\"scene\": \"%s\", \"frames\": %u, \"time_us_avg\": %u, \"time_us_max\": %u, "
+                "\"px_rendered\": %u, \"px_blended\": %u, \"flush_cnt\": %u, \"px_flushed\": %u, "
+                "\"heap_peak\": %u, \"style_cache_hit_pct\": ",
+                r->name, (unsigned)r->frames, (unsigned)r->time_us_avg, (unsigned)r->time_us_max,
+                (unsigned)r->px_rendered, (unsigned)r->px_blended, (unsigned)r->flush_cnt, (unsigned)r->px_flushed,
+                (unsigned)r->heap_peak);
+        write_pct(f, r->style_cache_hit_pct, "null");
+        fprintf(f, ", \"img_cache_hit_pct\": ");
+        write_pct(f, r->img_cache_hit_pct, "null");
+        fprintf(f, "}%s\n", i + 1 < cnt ? "," : "");
+    }
+
+    fprintf(f, "  ]\n");
+    fprintf(f, "}\n");
+}
+
+static void write_csv(FILE * f, const result_t * res, uint32_t cnt)
+{
+    fprintf(f, "scene,frames,time_us_avg,time_us_max,px_rendered,px_blended,flush_cnt,px_flushed,"
+            "heap_peak,style_cache_hit_pct,img_cache_hit_pct\n");
+
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        const result_t * r = &res[i];
+        fprintf(f, "\"%s\",%u,%u,%u,%u,%u,%u,%u,%u,",
+                r->name, (unsigned)r->frames, (unsigned)r->time_us_avg, (unsigned)r->time_us_max,
+                (unsigned)r->px_rendered, (unsigned)r->px_blended, (unsigned)r->flush_cnt, (unsigned)r->px_flushed,
+                (unsigned)r->heap_peak);
+        write_pct(f, r->style_cache_hit_pct, "");
+        fprintf(f, ",");
+        write_pct(f, r->img_cache_hit_pct, "");
+        fprintf(f, "\n");
+    }
+}
+
+/**
+ * Split a CSV line in place. The fields can be quoted but can't contain quotes.
+ * @return number of fields
+ */
+static uint32_t csv_split(char * line, char ** fields, uint32_t max)
+{
+    uint32_t cnt = 0;
+    char * p = line;
+    while(cnt < max) {
+        if(*p == '"') {
+            p++;
+            fields[cnt++] = p;
+            while(*p && *p != '"') p++;
+            if(*p) *p++ = '\0';
+        }
+        else {
+            fields[cnt++] = p;
+        }
+
+        while(*p && *p != ',' && *p != '\n' && *p != '\r') p++;
+        if(*p != ',') {
+            *p = '\0';
+            break;
+        }
+        *p++ = '\0';
+    }
+
+    return cnt;
+}
+
+static int32_t csv_find_col(char ** fields, uint32_t cnt, const char * name)
+{
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        if(strcmp(fields[i], name) == 0) return (int32_t)i;
+    }
+    return -1;
+}
+
+/**
+ * Check if a value is worse than the baseline by more than `tolerance` percent.
+ * Print the comparison too.
+ */
+static bool regressed(const char * scene, const char * metric, uint32_t base, uint32_t act, uint32_t tolerance)
+{
+    int32_t diff_pct = base ? (int32_t)(((int64_t)act - base) * 100 / base) : 0;
+    bool worse = (uint64_t)act * 100 > (uint64_t)base * (100 + tolerance);
+    fprintf(stderr, "%s: %s %u -> %u (%+d%%)%s\n", scene, metric, (unsigned)base, (unsigned)act, (int)diff_pct,
+            worse ? " REGRESSION" : "");
+    return worse;
+}
+
+static int compare_baseline(const char * path, const result_t * res, uint32_t cnt, uint32_t tolerance)
+{
+    FILE * f = fopen(path, "r");
+    if(f == NULL) {
+        fprintf(stderr, "Can't open the baseline %s\n", path);
+        return 2;
+    }
+
+    char line[LINE_MAX_LEN];
+    char * fields[16];
+    if(fgets(line, sizeof(line), f) == NULL) {
+        fprintf(stderr, "The baseline %s is empty\n", path);
+        fclose(f);
+        return 2;
+    }
+
+    uint32_t field_cnt = csv_split(line, fields, 16);
+    int32_t col_scene = csv_find_col(fields, field_cnt, "scene");
+    int32_t col_time = csv_find_col(fields, field_cnt, "time_us_avg");
+    int32_t col_px = csv_find_col(fields, field_cnt, "px_blended");
+    if(col_scene < 0 || col_time < 0 || col_px < 0) {
+        fprintf(stderr, "The baseline %s is not a CSV report of this program\n", path);
+        fclose(f);
+        return 2;
+    }
+
+    uint32_t regression_cnt = 0;
+    uint32_t matched_cnt = 0;
+    while(fgets(line, sizeof(line), f)) {
+        field_cnt = csv_split(line, fields, 16);
+        if(field_cnt <= (uint32_t)LV_MAX(col_scene, LV_MAX(col_time, col_px))) continue;
+
+        uint32_t i;
+        for(i = 0; i < cnt; i++) {
+            if(strcmp(res[i].name, fields[col_scene]) != 0) continue;
+
+            uint32_t base_time = strtoul(fields[col_time], NULL, 10);
+            uint32_t base_px = strtoul(fields[col_px], NULL, 10);
+            if(regressed(res[i].name, "time_us_avg", base_time, res[i].time_us_avg, tolerance)) regression_cnt++;
+            if(regressed(res[i].name, "px_blended", base_px, res[i].px_blended, tolerance)) regression_cnt++;
+            matched_cnt++;
+            break;
+        }
+    }
+    fclose(f);
+
+    fprintf(stderr, "%u of %u scenes compared to the baseline, %u regressions (tolerance %u%%)\n",
+            (unsigned)matched_cnt, (unsigned)cnt, (unsigned)regression_cnt, (unsigned)tolerance);
+
+    return regression_cnt ? 1 : 0;
+}
+
+static bool add_scene(int32_t bench_no, const custom_scene_t * custom)
+{
+    if(scene_cnt >= SCENE_MAX) {
+        fprintf(stderr, "Too many scenes\n");
+        return false;
+    }
+    scenes[scene_cnt].bench_no = bench_no;
+    scenes[scene_cnt].custom = custom;
+    scene_cnt++;
+    return true;
+}
+
+/**
+ * Parse a comma separated list of scenes.
+ * The items can be "all", "bench" (all benchmark scenes), a benchmark scene number or a custom scene name.
+ */
+static bool parse_scenes(const char * list)
+{
+    char buf[LINE_MAX_LEN];
+    lv_snprintf(buf, sizeof(buf), "%s", list);
+
+    char * item = strtok(buf, ",");
+    while(item) {
+        bool all = strcmp(item, "all") == 0;
+        bool found = false;
+#if LV_USE_DEMO_BENCHMARK
+        int32_t bench_cnt = lv_demo_benchmark_get_scene_cnt();
+        if(all || strcmp(item, "bench") == 0) {
+            int32_t i;
+            for(i = 0; i < bench_cnt; i++) {
+                if(!add_scene(i, NULL)) return false;
+            }
+            found = true;
+        }
+        else if(item[0] >= '0' && item[0] <= '9') {
+            int32_t no = strtol(item, NULL, 10);
+            if(no >= bench_cnt) {
+                fprintf(stderr, "Invalid benchmark scene: %s\n", item);
+                return false;
+            }
+            if(!add_scene(no, NULL)) return false;
+            found = true;
+        }
+#endif
+        const custom_scene_t * c;
+        for(c = custom_scenes; c->name; c++) {
+            if(all || strcmp(item, c->name) == 0) {
+                if(!add_scene(-1, c)) return false;
+                found = true;
+            }
+        }
+
+        if(!found && !all) {
+            fprintf(stderr, "Unknown scene: %s\n", item);
+            return false;
+        }
+        item = strtok(NULL, ",");
+    }
+
+    return true;
+}
+
+static void print_usage(void)
+{
+    printf("Usage: lv_test_bench [options]\n"
+           "  --res <profile>       800x480 (default), 480x320, 320x240 or 240x240-round\n"
+           "  --scenes <list>       comma separated benchmark scene numbers, \"bench\", custom scene names or \"all\" (default)\n"
+           "  --list                list the selected scenes and exit\n"
+           "  --frames <n>          measured frames per scene (default 60)\n"
+           "  --warmup <n>          not measured frames after creating a scene (default 1)\n"
+           "  --period <ms>         virtual time between the frames (default 16)\n"
+           "  --buf-lines <n>       lines in the draw buffer (default 1/10 of the screen)\n"
+           "  --format json|csv     report format (default json)\n"
+           "  --out <file>          write the report here instead of stdout\n"
+           "  --baseline <file>     compare to an earlier CSV report and exit with 1 on regression\n"
+           "  --tolerance <pct>     allowed increase of render time and blended pixels (default 10)\n");
+}
+
+#endif
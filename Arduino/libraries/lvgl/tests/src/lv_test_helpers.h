@@ -11,6 +11,10 @@
 
 static inline uint32_t lv_test_get_free_mem(void)
 {
+#if LV_MEM_CUSTOM == 0 && LV_MEM_SLAB
+    /*The empty pages of the slabs are used blocks for the heap*/
+    lv_mem_slab_trim();
+#endif
     lv_mem_monitor_t m1;
     lv_mem_monitor(&m1);
     return m1.free_size;
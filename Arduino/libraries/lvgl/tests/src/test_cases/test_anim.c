@@ -0,0 +1,308 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#include "lv_test_helpers.h"
+
+#define ANIM_CNT    500
+
+static int32_t values[ANIM_CNT];
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    lv_anim_del_all();
+    lv_obj_clean(lv_scr_act());
+}
+
+static void exec_cb(void * var, int32_t v)
+{
+    *((int32_t *)var) = v;
+}
+
+static void step(uint32_t ms)
+{
+    lv_tick_inc(ms);
+    lv_anim_refr_now();
+}
+
+/*The same as the built-in paths but they are not recognized as built-in*/
+static int32_t custom_linear(const lv_anim_t * a)
+{
+    return lv_anim_path_linear(a);
+}
+
+static int32_t custom_ease_in(const lv_anim_t * a)
+{
+    return lv_anim_path_ease_in(a);
+}
+
+static int32_t custom_ease_out(const lv_anim_t * a)
+{
+    return lv_anim_path_ease_out(a);
+}
+
+static int32_t custom_ease_in_out(const lv_anim_t * a)
+{
+    return lv_anim_path_ease_in_out(a);
+}
+
+static int32_t custom_overshoot(const lv_anim_t * a)
+{
+    return lv_anim_path_overshoot(a);
+}
+
+static int32_t custom_step(const lv_anim_t * a)
+{
+    return lv_anim_path_step(a);
+}
+
+void test_anim_built_in_paths(void)
+{
+    static const lv_anim_path_cb_t paths[] = {
+        lv_anim_path_linear, lv_anim_path_ease_in, lv_anim_path_ease_out,
+        lv_anim_path_ease_in_out, lv_anim_path_overshoot, lv_anim_path_step,
+    };
+    static const lv_anim_path_cb_t custom_paths[] = {
+        custom_linear, custom_ease_in, custom_ease_out,
+        custom_ease_in_out, custom_overshoot, custom_step,
+    };
+    const uint32_t path_cnt = sizeof(paths) / sizeof(paths[0]);
+
+    uint32_t i;
+    for(i = 0; i < path_cnt; i++) {
+        lv_anim_t a;
+        lv_anim_init(&a);
+        lv_anim_set_exec_cb(&a, exec_cb);
+        lv_anim_set_values(&a, -100 * (int32_t)i, 1000);
+        lv_anim_set_time(&a, 330);
+        lv_anim_set_delay(&a, 20);
+        lv_anim_set_playback_time(&a, 200);
+
+        lv_anim_set_var(&a, &values[i * 2]);
+        lv_anim_set_path_cb(&a, paths[i]);
+        lv_anim_start(&a);
+
+        lv_anim_set_var(&a, &values[i * 2 + 1]);
+        lv_anim_set_path_cb(&a, custom_paths[i]);
+        lv_anim_start(&a);
+    }
+
+    uint32_t t;
+    for(t = 0; t < 600; t += 7) {
+        step(7);
+        for(i = 0; i < path_cnt; i++) {
+            TEST_ASSERT_EQUAL_INT32(values[i * 2 + 1], values[i * 2]);
+        }
+    }
+
+    /*All of them returned*/
+    TEST_ASSERT_EQUAL_UINT16(0, lv_anim_count_running());
+    for(i = 0; i < path_cnt; i++) {
+        TEST_ASSERT_EQUAL_INT32(-100 * (int32_t)i, values[i * 2]);
+    }
+}
+
+static uint32_t ready_cnt;
+static uint32_t deleted_cnt;
+
+static void ready_restart_cb(lv_anim_t * a)
+{
+    ready_cnt++;
+
+    /*Not running anymore*/
+    TEST_ASSERT_NULL(lv_anim_get(a->var, exec_cb));
+
+    /*Start a new animation on the same variable. It shouldn't run in this round*/
+    if(ready_cnt < 3) {
+        lv_anim_t a2;
+        lv_memcpy(&a2, a, sizeof(a2));
+        lv_anim_set_values(&a2, 0, 100);
+        lv_anim_set_delay(&a2, 0);
+        lv_anim_set_early_apply(&a2, false);
+        lv_anim_start(&a2);
+    }
+}
+
+static void deleted_cb(lv_anim_t * a)
+{
+    LV_UNUSED(a);
+    deleted_cnt++;
+}
+
+void test_anim_start_in_ready_cb(void)
+{
+    ready_cnt = 0;
+    deleted_cnt = 0;
+
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_var(&a, &values[0]);
+    lv_anim_set_exec_cb(&a, exec_cb);
+    lv_anim_set_values(&a, 0, 100);
+    lv_anim_set_time(&a, 100);
+    lv_anim_set_ready_cb(&a, ready_restart_cb);
+    lv_anim_set_deleted_cb(&a, deleted_cb);
+    lv_anim_start(&a);
+
+    step(100);
+    TEST_ASSERT_EQUAL_UINT32(1, ready_cnt);
+    TEST_ASSERT_EQUAL_INT32(100, values[0]);
+    TEST_ASSERT_EQUAL_UINT16(1, lv_anim_count_running());
+
+    step(50);
+    TEST_ASSERT_EQUAL_INT32(50, values[0]);
+    step(50);
+    step(100);
+    TEST_ASSERT_EQUAL_UINT32(3, ready_cnt);
+    TEST_ASSERT_EQUAL_UINT32(3, deleted_cnt);
+    TEST_ASSERT_EQUAL_UINT16(0, lv_anim_count_running());
+}
+
+static void exec_del_others_cb(void * var, int32_t v)
+{
+    exec_cb(var, v);
+    /*Delete the animations of the other variables*/
+    uint32_t i;
+    for(i = 0; i < 10; i++) {
+        if(&values[i] != var) lv_anim_del(&values[i], NULL);
+    }
+}
+
+void test_anim_delete_in_exec_cb(void)
+{
+    uint32_t i;
+    for(i = 0; i < 10; i++) {
+        values[i] = -1;
+        lv_anim_t a;
+        lv_anim_init(&a);
+        lv_anim_set_var(&a, &values[i]);
+        lv_anim_set_exec_cb(&a, i == 5 ? exec_del_others_cb : exec_cb);
+        lv_anim_set_path_cb(&a, (i % 2 && i != 5) ? lv_anim_path_ease_in : lv_anim_path_linear);
+        lv_anim_set_values(&a, 0, 100);
+        lv_anim_set_time(&a, 100);
+        lv_anim_set_early_apply(&a, false);
+        lv_anim_start(&a);
+    }
+    TEST_ASSERT_EQUAL_UINT16(10, lv_anim_count_running());
+
+    step(50);
+    TEST_ASSERT_EQUAL_UINT16(1, lv_anim_count_running());
+    TEST_ASSERT_NOT_NULL(lv_anim_get(&values[5], NULL));
+    TEST_ASSERT_EQUAL_INT32(50, values[5]);
+
+    step(50);
+    TEST_ASSERT_EQUAL_UINT16(0, lv_anim_count_running());
+    TEST_ASSERT_EQUAL_INT32(100, values[5]);
+}
+
+void test_anim_repeat_and_playback(void)
+{
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_var(&a, &values[0]);
+    lv_anim_set_exec_cb(&a, exec_cb);
+    lv_anim_set_values(&a, 0, 100);
+    lv_anim_set_time(&a, 100);
+    lv_anim_set_playback_time(&a, 100);
+    lv_anim_set_repeat_count(&a, 2);
+    lv_anim_start(&a);
+
+    step(50);
+    TEST_ASSERT_EQUAL_INT32(50, values[0]);
+    step(50);
+    TEST_ASSERT_EQUAL_INT32(100, values[0]);
+    step(50);
+    TEST_ASSERT_EQUAL_INT32(50, values[0]);
+    step(50);
+    TEST_ASSERT_EQUAL_INT32(0, values[0]);
+    TEST_ASSERT_EQUAL_UINT16(1, lv_anim_count_running());
+    step(100);
+    step(100);
+    TEST_ASSERT_EQUAL_INT32(0, values[0]);
+    TEST_ASSERT_EQUAL_UINT16(0, lv_anim_count_running());
+}
+
+void test_anim_memory_is_released(void)
+{
+    size_t free_before = lv_test_get_free_mem();
+
+    uint32_t i;
+    for(i = 0; i < ANIM_CNT; i++) {
+        lv_anim_t a;
+        lv_anim_init(&a);
+        lv_anim_set_var(&a, &values[i]);
+        lv_anim_set_exec_cb(&a, exec_cb);
+        lv_anim_set_time(&a, 100 + i);
+        lv_anim_start(&a);
+    }
+    TEST_ASSERT_EQUAL_UINT16(ANIM_CNT, lv_anim_count_running());
+
+    step(1000);
+    TEST_ASSERT_EQUAL_UINT16(0, lv_anim_count_running());
+    LV_HEAP_CHECK(TEST_ASSERT_LESS_OR_EQUAL(free_before, lv_test_get_free_mem()));
+}
+
+/*`lv_obj_set_x()` takes `lv_coord_t` which can be 16 bit*/
+static void exec_x(void * obj, int32_t v)
+{
+    lv_obj_set_x(obj, (lv_coord_t)v);
+}
+
+static void bench_anim(bool on_objects)
+{
+    static const lv_anim_path_cb_t paths[] = {
+        lv_anim_path_linear, lv_anim_path_ease_in, lv_anim_path_ease_out, lv_anim_path_ease_in_out, lv_anim_path_overshoot
+    };
+
+    uint32_t i;
+    for(i = 0; i < ANIM_CNT; i++) {
+        lv_anim_t a;
+        lv_anim_init(&a);
+        if(on_objects) {
+            lv_obj_t * obj = lv_obj_create(lv_scr_act());
+            lv_obj_set_size(obj, 10, 10);
+            lv_obj_set_pos(obj, (i % 25) * 30, (i / 25) * 20);
+            lv_anim_set_var(&a, obj);
+            lv_anim_set_exec_cb(&a, exec_x);
+            lv_anim_set_values(&a, (i % 25) * 30, (i % 25) * 30 + 20);
+        }
+        else {
+            lv_anim_set_var(&a, &values[i]);
+            lv_anim_set_exec_cb(&a, exec_cb);
+            lv_anim_set_values(&a, 0, 10000);
+        }
+        lv_anim_set_time(&a, 1000 + i);
+        lv_anim_set_path_cb(&a, paths[i % (sizeof(paths) / sizeof(paths[0]))]);
+        lv_anim_set_playback_time(&a, 1000);
+        lv_anim_set_repeat_count(&a, LV_ANIM_REPEAT_INFINITE);
+        lv_anim_start(&a);
+    }
+
+    uint32_t step_cnt = on_objects ? 100 : 2000;
+    uint32_t t = custom_tick_get();
+    for(i = 0; i < step_cnt; i++) {
+        step(1);
+    }
+    t = custom_tick_get() - t;
+
+    TEST_PRINTF("%d animations on %s: %u us per step", ANIM_CNT, on_objects ? "objects" : "variables",
+                (unsigned)(t * 1000 / step_cnt));
+
+    lv_anim_del_all();
+    lv_obj_clean(lv_scr_act());
+}
+
+void test_anim_benchmark(void)
+{
+    bench_anim(false);
+    bench_anim(true);
+    TEST_ASSERT_EQUAL_UINT16(0, lv_anim_count_running());
+}
+
+#endif
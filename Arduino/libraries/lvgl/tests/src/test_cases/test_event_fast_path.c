@@ -0,0 +1,227 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../demos/lv_demos.h"
+
+#include "unity/unity.h"
+
+void setUp(void)
+{
+    /*Don't let the perf. monitor invalidate its label*/
+    lv_obj_add_flag(lv_layer_sys(), LV_OBJ_FLAG_HIDDEN);
+}
+
+void tearDown(void)
+{
+    lv_event_enable_fast_path(true);
+    lv_obj_clear_flag(lv_layer_sys(), LV_OBJ_FLAG_HIDDEN);
+    lv_obj_clean(lv_scr_act());
+}
+
+static uint32_t event_cnt;
+static uint32_t last_code;
+
+static void event_cb(lv_event_t * e)
+{
+    event_cnt++;
+    last_code = lv_event_get_code(e);
+}
+
+void test_event_fast_path_user_cb_is_called(void)
+{
+    lv_obj_t * obj = lv_obj_create(lv_scr_act());
+
+    event_cnt = 0;
+    lv_obj_add_event_cb(obj, event_cb, LV_EVENT_DRAW_MAIN_BEGIN, NULL);
+    lv_event_send(obj, LV_EVENT_DRAW_MAIN_BEGIN, NULL);
+    lv_event_send(obj, LV_EVENT_DRAW_MAIN_END, NULL);
+    lv_event_send(obj, LV_EVENT_DRAW_PART_BEGIN, NULL);
+    TEST_ASSERT_EQUAL_UINT32(1, event_cnt);
+    TEST_ASSERT_EQUAL_UINT32(LV_EVENT_DRAW_MAIN_BEGIN, last_code);
+
+    /*A custom event code*/
+    uint32_t my_event = lv_event_register_id();
+    lv_obj_add_event_cb(obj, event_cb, my_event, NULL);
+    lv_event_send(obj, my_event, NULL);
+    TEST_ASSERT_EQUAL_UINT32(2, event_cnt);
+    TEST_ASSERT_EQUAL_UINT32(my_event, last_code);
+
+    /*Not called after removing it*/
+    lv_obj_remove_event_cb(obj, event_cb);
+    lv_obj_remove_event_cb(obj, event_cb);
+    lv_event_send(obj, LV_EVENT_DRAW_MAIN_BEGIN, NULL);
+    lv_event_send(obj, my_event, NULL);
+    TEST_ASSERT_EQUAL_UINT32(2, event_cnt);
+
+    /*All events*/
+    lv_obj_add_event_cb(obj, event_cb, LV_EVENT_ALL, NULL);
+    lv_event_send(obj, LV_EVENT_DRAW_POST_END, NULL);
+    lv_event_send(obj, LV_EVENT_DRAW_PART_END, NULL);
+    TEST_ASSERT_EQUAL_UINT32(4, event_cnt);
+    TEST_ASSERT_EQUAL_UINT32(LV_EVENT_DRAW_PART_END, last_code);
+    lv_obj_remove_event_cb(obj, event_cb);
+
+    /*Preprocess*/
+    lv_obj_add_event_cb(obj, event_cb, LV_EVENT_COVER_CHECK | LV_EVENT_PREPROCESS, NULL);
+    lv_cover_check_info_t info;
+    info.res = LV_COVER_RES_COVER;
+    info.area = &obj->coords;
+    lv_event_send(obj, LV_EVENT_COVER_CHECK, &info);
+    TEST_ASSERT_EQUAL_UINT32(5, event_cnt);
+    TEST_ASSERT_EQUAL_UINT32(LV_EVENT_COVER_CHECK, last_code);
+}
+
+void test_event_fast_path_class_handlers_are_called(void)
+{
+    /*The label measures its text in LV_EVENT_GET_SELF_SIZE*/
+    lv_obj_t * label = lv_label_create(lv_scr_act());
+    lv_label_set_text(label, "Some text");
+    lv_obj_update_layout(label);
+    lv_coord_t w = lv_obj_get_width(label);
+    TEST_ASSERT_GREATER_THAN(0, w);
+
+    lv_event_enable_fast_path(false);
+    lv_obj_refresh_self_size(label);
+    lv_obj_update_layout(label);
+    TEST_ASSERT_EQUAL(w, lv_obj_get_width(label));
+
+    /*The arc can't be clicked in its middle (LV_EVENT_HIT_TEST)*/
+    lv_event_enable_fast_path(true);
+    lv_obj_t * arc = lv_arc_create(lv_scr_act());
+    lv_obj_set_pos(arc, 200, 200);
+    lv_obj_set_size(arc, 100, 100);
+    lv_obj_add_flag(arc, LV_OBJ_FLAG_ADV_HITTEST);
+    lv_obj_update_layout(arc);
+    lv_point_t p = {250, 250};
+    TEST_ASSERT_FALSE(lv_obj_hit_test(arc, &p));
+    p.x = 200 + lv_obj_get_style_pad_left(arc, LV_PART_MAIN) + 2;
+    TEST_ASSERT_TRUE(lv_obj_hit_test(arc, &p));
+
+    /*A symbol image doesn't cover its area (LV_EVENT_COVER_CHECK)*/
+    lv_obj_t * img = lv_img_create(lv_scr_act());
+    lv_img_set_src(img, LV_SYMBOL_OK);
+    lv_obj_update_layout(img);
+    lv_cover_check_info_t info;
+    info.res = LV_COVER_RES_COVER;
+    info.area = &img->coords;
+    lv_event_send(img, LV_EVENT_COVER_CHECK, &info);
+    TEST_ASSERT_EQUAL(LV_COVER_RES_NOT_COVER, info.res);
+}
+
+#if LV_USE_DEMO_WIDGETS
+/*The frame buffer of the test display (800x480)*/
+extern lv_color_t test_fb[];
+
+static lv_color_t fb_ref[800 * 480];
+#endif
+
+void test_event_fast_path_same_result(void)
+{
+#if LV_USE_DEMO_WIDGETS
+    lv_demo_widgets();
+    lv_anim_del(NULL, NULL);
+
+    lv_event_enable_fast_path(false);
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+    lv_memcpy(fb_ref, test_fb, sizeof(fb_ref));
+
+    lv_event_enable_fast_path(true);
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_MEMORY(fb_ref, test_fb, sizeof(fb_ref));
+    lv_demo_widgets_close();
+#endif
+}
+
+#define OBJ_CNT     500
+#define SEND_CNT    200
+#define REFR_CNT    10
+
+static uint32_t bench_send(lv_event_code_t code, void * param)
+{
+    uint32_t t = custom_tick_get();
+    uint32_t i;
+    for(i = 0; i < SEND_CNT; i++) {
+        uint32_t j;
+        for(j = 0; j < OBJ_CNT; j++) {
+            lv_event_send(lv_obj_get_child(lv_scr_act(), j), code, param);
+        }
+    }
+    return custom_tick_get() - t;
+}
+
+static void bench_events(bool fast_path)
+{
+    lv_event_enable_fast_path(fast_path);
+
+    lv_cover_check_info_t info;
+    info.res = LV_COVER_RES_COVER;
+    info.area = &lv_scr_act()->coords;
+    lv_point_t self_size = {0, 0};
+
+    uint32_t t_draw = bench_send(LV_EVENT_DRAW_MAIN_BEGIN, NULL);
+    t_draw += bench_send(LV_EVENT_DRAW_MAIN_END, NULL);
+    uint32_t t_part = bench_send(LV_EVENT_DRAW_PART_BEGIN, NULL);
+    uint32_t t_cover = bench_send(LV_EVENT_COVER_CHECK, &info);
+    uint32_t t_size = bench_send(LV_EVENT_GET_SELF_SIZE, &self_size);
+
+    TEST_PRINTF("%u objects, %s: draw begin/end %u ms, draw part %u ms, cover check %u ms, get self size %u ms",
+                (unsigned)OBJ_CNT, fast_path ? "fast path" : "no fast path",
+                (unsigned)t_draw, (unsigned)t_part, (unsigned)t_cover, (unsigned)t_size);
+}
+
+#if LV_USE_DEMO_WIDGETS
+static void bench_refr(const char * name, bool fast_path)
+{
+    lv_event_enable_fast_path(fast_path);
+
+    uint32_t t = custom_tick_get();
+    uint32_t i;
+    for(i = 0; i < REFR_CNT; i++) {
+        lv_obj_invalidate(lv_scr_act());
+        lv_refr_now(NULL);
+    }
+    t = custom_tick_get() - t;
+
+    TEST_PRINTF("%s, %s: %u us per frame", name, fast_path ? "fast path" : "no fast path",
+                (unsigned)(t * 1000 / REFR_CNT));
+}
+#endif
+
+void test_event_fast_path_benchmark(void)
+{
+    uint32_t i;
+    for(i = 0; i < OBJ_CNT; i++) {
+        lv_obj_t * obj;
+        switch(i % 4) {
+            case 0:
+                obj = lv_label_create(lv_scr_act());
+                break;
+            case 1:
+                obj = lv_btn_create(lv_scr_act());
+                break;
+            case 2:
+                obj = lv_slider_create(lv_scr_act());
+                break;
+            default:
+                obj = lv_obj_create(lv_scr_act());
+                break;
+        }
+        /*Some objects have user callbacks for other events*/
+        if(i % 3 == 0) lv_obj_add_event_cb(obj, event_cb, LV_EVENT_CLICKED, NULL);
+    }
+
+    bench_events(false);
+    bench_events(true);
+    lv_obj_clean(lv_scr_act());
+
+#if LV_USE_DEMO_WIDGETS
+    lv_demo_widgets();
+    lv_anim_del(NULL, NULL);
+    bench_refr("demo widgets", false);
+    bench_refr("demo widgets", true);
+    lv_demo_widgets_close();
+#endif
+}
+
+#endif
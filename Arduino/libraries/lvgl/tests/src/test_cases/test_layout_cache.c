@@ -0,0 +1,270 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+#if LV_LAYOUT_CACHE
+    lv_obj_enable_layout_cache(true);
+#endif
+    lv_obj_clean(lv_scr_act());
+}
+
+#if LV_LAYOUT_CACHE
+
+#define ITEM_CNT    500
+
+static lv_obj_t * create_list(void)
+{
+    lv_obj_t * list = lv_list_create(lv_scr_act());
+    lv_obj_set_size(list, 400, 480);
+
+    uint32_t i;
+    for(i = 0; i < ITEM_CNT; i++) {
+        char buf[32];
+        lv_snprintf(buf, sizeof(buf), "Item %d", (int)i);
+        lv_list_add_btn(list, i % 2 ? LV_SYMBOL_OK : NULL, buf);
+    }
+    lv_obj_update_layout(list);
+    return list;
+}
+
+static lv_obj_t * get_item_label(lv_obj_t * list, uint32_t i)
+{
+    lv_obj_t * btn = lv_obj_get_child(list, i);
+    return lv_obj_get_child(btn, lv_obj_get_child_cnt(btn) - 1);
+}
+
+void test_layout_cache_only_the_changed_subtree_is_updated(void)
+{
+    lv_obj_t * list = create_list();
+    lv_obj_t * label = get_item_label(list, 250);
+
+    lv_obj_layout_reset_stat();
+    lv_label_set_text(label, "Changed");
+    lv_obj_update_layout(list);
+
+    lv_obj_layout_stat_t stat;
+    lv_obj_layout_get_stat(&stat);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, stat.updated);
+    TEST_ASSERT_LESS_THAN_UINT32(20, stat.visited);
+
+    /*Nothing is visited if nothing changed*/
+    lv_obj_layout_reset_stat();
+    lv_obj_mark_layout_as_dirty(lv_scr_act());
+    lv_obj_update_layout(list);
+    lv_obj_layout_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(1, stat.visited);
+
+    /*A new line in the text moves the next items*/
+    lv_obj_t * next_btn = lv_obj_get_child(list, 251);
+    lv_coord_t y_ori = next_btn->coords.y1;
+    lv_label_set_long_mode(label, LV_LABEL_LONG_WRAP);
+    lv_label_set_text(label, "Changed\nin two lines");
+    lv_obj_update_layout(list);
+    TEST_ASSERT_GREATER_THAN(y_ori, next_btn->coords.y1);
+}
+
+void test_layout_cache_label_size(void)
+{
+    lv_obj_t * label = lv_label_create(lv_scr_act());
+    lv_label_set_text(label, "Short");
+    lv_obj_update_layout(label);
+    lv_coord_t w1 = lv_obj_get_width(label);
+    lv_coord_t h1 = lv_obj_get_height(label);
+
+    lv_label_set_text(label, "A much longer text");
+    lv_obj_update_layout(label);
+    TEST_ASSERT_GREATER_THAN(w1, lv_obj_get_width(label));
+
+    lv_label_set_text_fmt(label, "%s", "Short");
+    lv_obj_update_layout(label);
+    TEST_ASSERT_EQUAL(w1, lv_obj_get_width(label));
+
+    /*The style changes are seen too*/
+    lv_obj_set_style_text_letter_space(label, 10, 0);
+    lv_obj_update_layout(label);
+    TEST_ASSERT_GREATER_THAN(w1, lv_obj_get_width(label));
+    lv_obj_set_style_text_letter_space(label, 0, 0);
+    lv_obj_set_style_text_line_space(label, 20, 0);
+    lv_label_ins_text(label, LV_LABEL_POS_LAST, "\nline");
+    lv_obj_update_layout(label);
+    TEST_ASSERT_GREATER_OR_EQUAL(2 * h1 + 20, lv_obj_get_height(label));
+
+    lv_label_cut_text(label, 5, 5);
+    lv_obj_update_layout(label);
+    TEST_ASSERT_EQUAL(w1, lv_obj_get_width(label));
+    TEST_ASSERT_EQUAL(h1, lv_obj_get_height(label));
+
+    /*Fixed width: the text is wrapped*/
+    lv_obj_set_width(label, w1);
+    lv_label_set_text(label, "A much longer text");
+    lv_obj_update_layout(label);
+    TEST_ASSERT_GREATER_THAN(h1, lv_obj_get_height(label));
+}
+
+void test_layout_cache_img_size(void)
+{
+    lv_obj_t * img = lv_img_create(lv_scr_act());
+    lv_img_set_src(img, LV_SYMBOL_OK);
+    lv_obj_update_layout(img);
+    lv_coord_t w1 = lv_obj_get_width(img);
+
+    lv_img_set_src(img, LV_SYMBOL_OK LV_SYMBOL_OK);
+    lv_obj_update_layout(img);
+    TEST_ASSERT_GREATER_THAN(w1, lv_obj_get_width(img));
+
+    lv_img_set_size_mode(img, LV_IMG_SIZE_MODE_REAL);
+    lv_img_set_zoom(img, 512);
+    lv_obj_mark_layout_as_dirty(img);
+    lv_obj_update_layout(img);
+    TEST_ASSERT_GREATER_THAN(2 * w1, lv_obj_get_width(img));
+}
+
+/*Create flex and grid layouts, change them and save the coordinates of all objects*/
+static uint32_t layout_scenario(lv_area_t * coords, uint32_t coords_max)
+{
+    static const lv_coord_t col_dsc[] = {LV_GRID_CONTENT, LV_GRID_FR(1), 100, LV_GRID_TEMPLATE_LAST};
+    static const lv_coord_t row_dsc[] = {LV_GRID_CONTENT, LV_GRID_CONTENT, LV_GRID_FR(1), LV_GRID_TEMPLATE_LAST};
+
+    lv_obj_t * flex = lv_obj_create(lv_scr_act());
+    lv_obj_set_size(flex, 400, LV_SIZE_CONTENT);
+    lv_obj_set_flex_flow(flex, LV_FLEX_FLOW_ROW_WRAP);
+
+    lv_obj_t * grid = lv_obj_create(lv_scr_act());
+    lv_obj_set_pos(grid, 400, 0);
+    lv_obj_set_size(grid, 400, 300);
+    lv_obj_set_grid_dsc_array(grid, col_dsc, row_dsc);
+
+    uint32_t i;
+    for(i = 0; i < 20; i++) {
+        lv_obj_t * btn = lv_btn_create(flex);
+        if(i % 5 == 0) lv_obj_set_flex_grow(btn, 1);
+        lv_obj_t * label = lv_label_create(btn);
+        lv_label_set_text_fmt(label, "Button %d", (int)i);
+    }
+
+    for(i = 0; i < 9; i++) {
+        lv_obj_t * label = lv_label_create(grid);
+        lv_label_set_text_fmt(label, "Cell %d", (int)i);
+        lv_obj_set_grid_cell(label, LV_GRID_ALIGN_STRETCH, i % 3, 1, LV_GRID_ALIGN_START, i / 3, 1);
+    }
+    lv_obj_update_layout(lv_scr_act());
+
+    /*Change the texts, a style and a size*/
+    for(i = 0; i < 20; i += 3) {
+        lv_obj_t * label = lv_obj_get_child(lv_obj_get_child(flex, i), 0);
+        lv_label_set_text(label, i % 2 ? "Longer button text" : "B");
+        lv_obj_update_layout(lv_scr_act());
+    }
+    lv_label_set_text(lv_obj_get_child(grid, 0), "First\ncell");
+    lv_label_set_text(lv_obj_get_child(grid, 4), "A long text in the middle");
+    lv_obj_set_style_pad_column(flex, 30, 0);
+    lv_obj_set_width(grid, 350);
+    lv_obj_update_layout(lv_scr_act());
+
+    uint32_t cnt = 0;
+    lv_obj_t * conts[] = {flex, grid};
+    uint32_t c;
+    for(c = 0; c < 2; c++) {
+        coords[cnt++] = conts[c]->coords;
+        for(i = 0; i < lv_obj_get_child_cnt(conts[c]) && cnt < coords_max; i++) {
+            lv_obj_t * child = lv_obj_get_child(conts[c], i);
+            coords[cnt++] = child->coords;
+            if(lv_obj_get_child_cnt(child) && cnt < coords_max) coords[cnt++] = lv_obj_get_child(child, 0)->coords;
+        }
+    }
+
+    return cnt;
+}
+
+void test_layout_cache_same_result(void)
+{
+    static lv_area_t coords_ref[128];
+    static lv_area_t coords[128];
+
+    lv_obj_enable_layout_cache(false);
+    uint32_t cnt_ref = layout_scenario(coords_ref, 128);
+    lv_obj_clean(lv_scr_act());
+
+    lv_obj_enable_layout_cache(true);
+    uint32_t cnt = layout_scenario(coords, 128);
+
+    TEST_ASSERT_EQUAL_UINT32(cnt_ref, cnt);
+    TEST_ASSERT_EQUAL_MEMORY(coords_ref, coords, cnt * sizeof(lv_area_t));
+}
+
+#define UPDATE_CNT  200
+
+static void bench_list(bool cache_en, bool new_line)
+{
+    lv_obj_enable_layout_cache(cache_en);
+    lv_obj_t * list = create_list();
+    lv_obj_t * label = get_item_label(list, 250);
+    lv_label_set_long_mode(label, LV_LABEL_LONG_WRAP);
+
+    lv_obj_layout_reset_stat();
+    uint32_t t = custom_tick_get();
+    uint32_t i;
+    for(i = 0; i < UPDATE_CNT; i++) {
+        if(new_line) lv_label_set_text(label, i % 2 ? "Item\nchanged" : "Item");
+        else lv_label_set_text_fmt(label, "Item %d", (int)i);
+        lv_obj_update_layout(list);
+    }
+    t = custom_tick_get() - t;
+
+    lv_obj_layout_stat_t stat;
+    lv_obj_layout_get_stat(&stat);
+    TEST_PRINTF("%u items, %s, %s: %u us per layout update, %u visited, %u updated", (unsigned)ITEM_CNT,
+                new_line ? "new lines" : "same height", cache_en ? "with cache" : "without cache",
+                (unsigned)(t * 1000 / UPDATE_CNT), (unsigned)(stat.visited / UPDATE_CNT), (unsigned)(stat.updated / UPDATE_CNT));
+
+    lv_obj_clean(lv_scr_act());
+}
+
+void test_layout_cache_benchmark(void)
+{
+    bench_list(false, false);
+    bench_list(true, false);
+    bench_list(false, true);
+    bench_list(true, true);
+}
+
+#else
+
+/*The layout cache can be disabled*/
+
+void test_layout_cache_only_the_changed_subtree_is_updated(void)
+{
+    TEST_IGNORE();
+}
+
+void test_layout_cache_label_size(void)
+{
+    TEST_IGNORE();
+}
+
+void test_layout_cache_img_size(void)
+{
+    TEST_IGNORE();
+}
+
+void test_layout_cache_same_result(void)
+{
+    TEST_IGNORE();
+}
+
+void test_layout_cache_benchmark(void)
+{
+    TEST_IGNORE();
+}
+
+#endif
+
+#endif
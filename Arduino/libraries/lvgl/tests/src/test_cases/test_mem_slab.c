@@ -0,0 +1,272 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#include "lv_test_helpers.h"
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+#if LV_MEM_CUSTOM == 0 && LV_MEM_SLAB
+    lv_mem_slab_enable(true);
+#endif
+    lv_obj_clean(lv_scr_act());
+}
+
+#if LV_MEM_CUSTOM == 0 && LV_MEM_SLAB
+
+#define ALLOC_CNT   200
+
+static void * ptrs[ALLOC_CNT];
+
+static uint32_t get_page_cnt(void)
+{
+    uint32_t cnt = 0;
+    uint32_t i;
+    for(i = 0; i < lv_mem_slab_get_class_cnt(); i++) {
+        lv_mem_slab_stat_t stat;
+        lv_mem_slab_get_stat(i, &stat);
+        cnt += stat.page_cnt;
+    }
+    return cnt;
+}
+
+void test_mem_slab_stat(void)
+{
+    /*33..40 bytes are in the 5th class*/
+    lv_mem_slab_trim();
+    lv_mem_slab_stat_t stat_before;
+    lv_mem_slab_get_stat(4, &stat_before);
+    TEST_ASSERT_EQUAL_UINT32(40, stat_before.slot_size);
+
+    uint32_t i;
+    for(i = 0; i < ALLOC_CNT; i++) {
+        ptrs[i] = lv_mem_alloc(33 + i % 8);
+        TEST_ASSERT_NOT_NULL(ptrs[i]);
+        TEST_ASSERT_EQUAL_UINT32(0, (lv_uintptr_t)ptrs[i] & 0x7);
+        lv_memset(ptrs[i], (uint8_t)i, 33 + i % 8);
+    }
+
+    lv_mem_slab_stat_t stat;
+    lv_mem_slab_get_stat(4, &stat);
+    TEST_ASSERT_EQUAL_UINT32(stat_before.live + ALLOC_CNT, stat.live);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(stat.live, stat.peak);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(ALLOC_CNT / stat.slot_per_page, stat.page_cnt - stat_before.page_cnt);
+
+    /*The content is not overwritten by the other allocations*/
+    for(i = 0; i < ALLOC_CNT; i++) {
+        uint8_t * p = ptrs[i];
+        TEST_ASSERT_EACH_EQUAL_UINT8((uint8_t)i, p, 33 + i % 8);
+    }
+
+    /*Free every second: the pages can't be released but fragmented*/
+    for(i = 0; i < ALLOC_CNT; i += 2) {
+        lv_mem_free(ptrs[i]);
+    }
+    lv_mem_slab_get_stat(4, &stat);
+    TEST_ASSERT_EQUAL_UINT32(stat_before.live + ALLOC_CNT / 2, stat.live);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(40, stat.frag_pct);
+
+    for(i = 1; i < ALLOC_CNT; i += 2) {
+        lv_mem_free(ptrs[i]);
+    }
+    lv_mem_slab_get_stat(4, &stat);
+    TEST_ASSERT_EQUAL_UINT32(stat_before.live, stat.live);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(stat_before.live + ALLOC_CNT, stat.peak);
+
+    /*Only an empty page is kept*/
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(stat_before.page_cnt + 1, stat.page_cnt);
+    lv_mem_slab_trim();
+    lv_mem_slab_get_stat(4, &stat);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(stat_before.page_cnt, stat.page_cnt);
+}
+
+void test_mem_slab_realloc(void)
+{
+    uint8_t * p = lv_mem_alloc(20);
+    lv_memset(p, 0x5a, 20);
+
+    /*Stays in its slot in the same class*/
+    TEST_ASSERT_EQUAL_PTR(p, lv_mem_realloc(p, 24));
+
+    /*Moves to an other class and then to the heap*/
+    p = lv_mem_realloc(p, 100);
+    TEST_ASSERT_EACH_EQUAL_UINT8(0x5a, p, 20);
+    lv_memset(p, 0xa5, 100);
+    p = lv_mem_realloc(p, 1000);
+    TEST_ASSERT_EACH_EQUAL_UINT8(0xa5, p, 100);
+
+    /*Back to a small size*/
+    p = lv_mem_realloc(p, 10);
+    TEST_ASSERT_EACH_EQUAL_UINT8(0xa5, p, 10);
+    lv_mem_free(p);
+
+    p = lv_mem_realloc(NULL, 16);
+    TEST_ASSERT_NOT_NULL(p);
+    lv_mem_free(p);
+}
+
+void test_mem_slab_disable(void)
+{
+    lv_mem_slab_stat_t stat_before;
+    lv_mem_slab_get_stat(1, &stat_before);
+
+    lv_mem_slab_enable(false);
+    void * p1 = lv_mem_alloc(16);
+    lv_mem_slab_stat_t stat;
+    lv_mem_slab_get_stat(1, &stat);
+    TEST_ASSERT_EQUAL_UINT32(stat_before.live, stat.live);
+
+    /*Memories from both places can be freed*/
+    lv_mem_slab_enable(true);
+    void * p2 = lv_mem_alloc(16);
+    lv_mem_slab_get_stat(1, &stat);
+    TEST_ASSERT_EQUAL_UINT32(stat_before.live + 1, stat.live);
+    lv_mem_free(p1);
+    lv_mem_free(p2);
+    lv_mem_slab_get_stat(1, &stat);
+    TEST_ASSERT_EQUAL_UINT32(stat_before.live, stat.live);
+}
+
+static void create_widgets(lv_obj_t * parent, uint32_t seed)
+{
+    uint32_t i;
+    for(i = 0; i < 10; i++) {
+        lv_obj_t * btn = lv_btn_create(parent);
+        lv_obj_set_pos(btn, (i % 5) * 150, (i / 5) * 60);
+        lv_obj_t * label = lv_label_create(btn);
+        lv_label_set_text_fmt(label, "Button %d", (int)(seed + i));
+
+        lv_obj_t * slider = lv_slider_create(parent);
+        lv_obj_set_pos(slider, (i % 5) * 150, 150 + (i / 5) * 40);
+        lv_slider_set_value(slider, (int32_t)(i * 10), LV_ANIM_OFF);
+
+        label = lv_label_create(parent);
+        lv_obj_set_pos(label, (i % 5) * 150, 250 + (i / 5) * 30);
+        /*Texts with different lengths*/
+        lv_label_set_text_fmt(label, "%.*s", (int)((seed + i) % 20 + 1), "Lorem ipsum dolor sit amet");
+
+        lv_obj_t * cb = lv_checkbox_create(parent);
+        lv_obj_set_pos(cb, (i % 5) * 150, 350 + (i / 5) * 40);
+        if((seed + i) % 3 == 0) lv_obj_add_state(cb, LV_STATE_CHECKED);
+    }
+    lv_obj_update_layout(parent);
+}
+
+void test_mem_slab_screen_delete(void)
+{
+    lv_mem_slab_trim();
+    uint32_t page_cnt_before = get_page_cnt();
+    size_t free_before = lv_test_get_free_mem();
+
+    lv_obj_t * scr = lv_obj_create(NULL);
+    create_widgets(scr, 0);
+    TEST_ASSERT_GREATER_THAN_UINT32(page_cnt_before, get_page_cnt());
+
+    /*The emptied pages are released right away*/
+    lv_obj_del(scr);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(page_cnt_before, get_page_cnt());
+    LV_HEAP_CHECK(TEST_ASSERT_LESS_OR_EQUAL(free_before, lv_test_get_free_mem()));
+}
+
+#define CYCLE_CNT       100
+#define LONG_LIVED_CNT  50
+
+/*Create and delete screens while some long living objects are created in between*/
+static void bench_screens(bool slab_en)
+{
+    lv_mem_slab_enable(slab_en);
+    lv_mem_slab_trim();
+
+    static lv_obj_t * long_lived[LONG_LIVED_CNT];
+    lv_obj_t * scr_ori = lv_scr_act();
+    uint32_t long_lived_cnt = 0;
+
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    TEST_PRINTF("%s slabs, start: %u bytes used, %u free blocks, %u%% frag.", slab_en ? "with" : "without",
+                (unsigned)(mon.total_size - mon.free_size), (unsigned)mon.free_cnt, (unsigned)mon.frag_pct);
+
+    uint32_t t = custom_tick_get();
+    uint32_t cycle;
+    for(cycle = 0; cycle < CYCLE_CNT; cycle++) {
+        lv_obj_t * scr = lv_obj_create(NULL);
+        create_widgets(scr, cycle);
+        lv_scr_load(scr);
+
+        if(cycle % 2 == 0 && long_lived_cnt < LONG_LIVED_CNT) {
+            long_lived[long_lived_cnt] = lv_label_create(lv_layer_top());
+            lv_label_set_text_fmt(long_lived[long_lived_cnt], "%d", (int)cycle);
+            long_lived_cnt++;
+        }
+
+        lv_scr_load(scr_ori);
+        lv_obj_del(scr);
+
+        if((cycle + 1) % 25 == 0) {
+            lv_mem_monitor(&mon);
+            TEST_PRINTF("  cycle %u: %u bytes used, %u free blocks, %u%% frag.", (unsigned)cycle + 1,
+                        (unsigned)(mon.total_size - mon.free_size), (unsigned)mon.free_cnt, (unsigned)mon.frag_pct);
+        }
+    }
+    t = custom_tick_get() - t;
+
+    TEST_PRINTF("  %u us per screen create and delete", (unsigned)(t * 1000 / CYCLE_CNT));
+
+    uint32_t i;
+    for(i = 0; i < lv_mem_slab_get_class_cnt(); i++) {
+        lv_mem_slab_stat_t stat;
+        lv_mem_slab_get_stat(i, &stat);
+        if(stat.peak == 0) continue;
+        TEST_PRINTF("  %u bytes: %u live, %u peak, %u pages, %u%% frag.", (unsigned)stat.slot_size,
+                    (unsigned)stat.live, (unsigned)stat.peak, (unsigned)stat.page_cnt, (unsigned)stat.frag_pct);
+    }
+
+    for(i = 0; i < long_lived_cnt; i++) {
+        lv_obj_del(long_lived[i]);
+    }
+}
+
+void test_mem_slab_benchmark(void)
+{
+    bench_screens(false);
+    bench_screens(true);
+}
+
+#else
+
+/*The slabs are used only with the built-in allocator*/
+
+void test_mem_slab_stat(void)
+{
+    TEST_IGNORE();
+}
+
+void test_mem_slab_realloc(void)
+{
+    TEST_IGNORE();
+}
+
+void test_mem_slab_disable(void)
+{
+    TEST_IGNORE();
+}
+
+void test_mem_slab_screen_delete(void)
+{
+    TEST_IGNORE();
+}
+
+void test_mem_slab_benchmark(void)
+{
+    TEST_IGNORE();
+}
+
+#endif
+
+#endif
@@ -0,0 +1,290 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../demos/lv_demos.h"
+
+#include "unity/unity.h"
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+#if LV_OBJ_STYLE_CACHE_SIZE
+    lv_obj_enable_style_cache(true);
+#endif
+#if LV_USE_PARALLEL_REFR
+    lv_refr_set_thread_cnt(LV_PARALLEL_REFR_THREADS);
+#endif
+    lv_obj_clean(lv_scr_act());
+}
+
+#if LV_OBJ_STYLE_CACHE_SIZE
+
+#define REFR_CNT    5
+
+/*The frame buffer of the test display (800x480)*/
+extern lv_color_t test_fb[];
+
+static lv_color_t fb_ref[800 * 480];
+
+void test_obj_style_cache_hit(void)
+{
+    lv_obj_t * obj = lv_obj_create(lv_scr_act());
+    lv_obj_set_style_bg_color(obj, lv_color_hex(0x112233), 0);
+
+    lv_obj_style_cache_reset_stat();
+    lv_obj_get_style_bg_color(obj, LV_PART_MAIN);
+    lv_obj_get_style_bg_color(obj, LV_PART_MAIN);
+    lv_obj_get_style_bg_color(obj, LV_PART_MAIN);
+
+    lv_obj_style_cache_stat_t stat;
+    lv_obj_style_cache_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(1, stat.miss);
+    TEST_ASSERT_EQUAL_UINT32(2, stat.hit);
+    TEST_ASSERT_EQUAL_UINT32(0, stat.invalidate);
+    TEST_ASSERT_EQUAL_HEX32(lv_color_to32(lv_color_hex(0x112233)),
+                            lv_color_to32(lv_obj_get_style_bg_color(obj, LV_PART_MAIN)));
+
+    /*A new value is seen right away*/
+    lv_obj_set_style_bg_color(obj, lv_color_hex(0x445566), 0);
+    TEST_ASSERT_EQUAL_HEX32(lv_color_to32(lv_color_hex(0x445566)),
+                            lv_color_to32(lv_obj_get_style_bg_color(obj, LV_PART_MAIN)));
+    lv_obj_style_cache_get_stat(&stat);
+    TEST_ASSERT_GREATER_THAN(0, stat.invalidate);
+}
+
+void test_obj_style_cache_state_and_part(void)
+{
+    lv_obj_t * obj = lv_slider_create(lv_scr_act());
+    lv_obj_remove_style_all(obj);
+    lv_obj_set_style_bg_opa(obj, LV_OPA_10, LV_PART_MAIN);
+    lv_obj_set_style_bg_opa(obj, LV_OPA_20, LV_PART_INDICATOR);
+    lv_obj_set_style_bg_opa(obj, LV_OPA_30, LV_PART_INDICATOR | LV_STATE_PRESSED);
+
+    TEST_ASSERT_EQUAL(LV_OPA_10, lv_obj_get_style_bg_opa(obj, LV_PART_MAIN));
+    TEST_ASSERT_EQUAL(LV_OPA_20, lv_obj_get_style_bg_opa(obj, LV_PART_INDICATOR));
+
+    lv_obj_add_state(obj, LV_STATE_PRESSED);
+    TEST_ASSERT_EQUAL(LV_OPA_10, lv_obj_get_style_bg_opa(obj, LV_PART_MAIN));
+    TEST_ASSERT_EQUAL(LV_OPA_30, lv_obj_get_style_bg_opa(obj, LV_PART_INDICATOR));
+
+    lv_obj_clear_state(obj, LV_STATE_PRESSED);
+    TEST_ASSERT_EQUAL(LV_OPA_20, lv_obj_get_style_bg_opa(obj, LV_PART_INDICATOR));
+}
+
+void test_obj_style_cache_inherited(void)
+{
+    lv_obj_t * parent1 = lv_obj_create(lv_scr_act());
+    lv_obj_t * parent2 = lv_obj_create(lv_scr_act());
+    lv_obj_t * label = lv_label_create(parent1);
+    lv_obj_set_style_text_color(parent1, lv_color_hex(0xff0000), 0);
+    lv_obj_set_style_text_color(parent1, lv_color_hex(0x00ff00), LV_STATE_CHECKED);
+    lv_obj_set_style_text_color(parent2, lv_color_hex(0x0000ff), 0);
+
+    TEST_ASSERT_EQUAL_HEX32(lv_color_to32(lv_color_hex(0xff0000)), lv_color_to32(lv_obj_get_style_text_color(label, 0)));
+
+    /*The state of the parent changes the inherited value*/
+    lv_obj_add_state(parent1, LV_STATE_CHECKED);
+    TEST_ASSERT_EQUAL_HEX32(lv_color_to32(lv_color_hex(0x00ff00)), lv_color_to32(lv_obj_get_style_text_color(label, 0)));
+
+    lv_obj_set_parent(label, parent2);
+    TEST_ASSERT_EQUAL_HEX32(lv_color_to32(lv_color_hex(0x0000ff)), lv_color_to32(lv_obj_get_style_text_color(label, 0)));
+}
+
+void test_obj_style_cache_shared_style_changed(void)
+{
+    static lv_style_t style;
+    lv_style_init(&style);
+    lv_style_set_radius(&style, 5);
+
+    lv_obj_t * obj = lv_obj_create(lv_scr_act());
+    lv_obj_add_style(obj, &style, 0);
+    TEST_ASSERT_EQUAL(5, lv_obj_get_style_radius(obj, 0));
+
+    lv_style_set_radius(&style, 7);
+    lv_obj_report_style_change(&style);
+    TEST_ASSERT_EQUAL(7, lv_obj_get_style_radius(obj, 0));
+
+    lv_obj_remove_style(obj, &style, 0);
+    lv_style_reset(&style);
+}
+
+void test_obj_style_cache_other_objects_are_kept(void)
+{
+    lv_obj_t * parent = lv_obj_create(lv_scr_act());
+    lv_obj_t * child = lv_label_create(parent);
+    lv_obj_t * other = lv_obj_create(lv_scr_act());
+
+    lv_obj_get_style_bg_opa(parent, LV_PART_MAIN);
+    lv_obj_get_style_text_color(child, LV_PART_MAIN);
+    lv_obj_get_style_radius(other, LV_PART_MAIN);
+
+    /*Not inherited, only the cache of the parent is cleared*/
+    lv_obj_style_cache_reset_stat();
+    lv_obj_set_style_bg_opa(parent, LV_OPA_50, 0);
+    lv_obj_get_style_bg_opa(parent, LV_PART_MAIN);
+    lv_obj_get_style_text_color(child, LV_PART_MAIN);
+    lv_obj_get_style_radius(other, LV_PART_MAIN);
+
+    lv_obj_style_cache_stat_t stat;
+    lv_obj_style_cache_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(1, stat.invalidate);
+    TEST_ASSERT_EQUAL_UINT32(1, stat.miss);
+    TEST_ASSERT_EQUAL_UINT32(2, stat.hit);
+
+    /*Inherited, the child needs to see the new value, but the other object is not affected*/
+    lv_obj_style_cache_reset_stat();
+    lv_obj_set_style_text_color(parent, lv_color_hex(0x00ff00), 0);
+    TEST_ASSERT_EQUAL_HEX32(lv_color_to32(lv_color_hex(0x00ff00)),
+                            lv_color_to32(lv_obj_get_style_text_color(child, LV_PART_MAIN)));
+    lv_obj_get_style_radius(other, LV_PART_MAIN);
+
+    lv_obj_style_cache_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(2, stat.invalidate);
+    TEST_ASSERT_EQUAL_UINT32(1, stat.hit);
+}
+
+void test_obj_style_cache_animated_object(void)
+{
+#if LV_USE_PARALLEL_REFR
+    lv_refr_set_thread_cnt(1);
+#endif
+    lv_obj_t * cont = lv_obj_create(lv_scr_act());
+    lv_obj_set_size(cont, LV_PCT(100), LV_PCT(100));
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_ROW_WRAP);
+    uint32_t i;
+    for(i = 0; i < 30; i++) {
+        lv_obj_t * btn = lv_btn_create(cont);
+        lv_obj_t * label = lv_label_create(btn);
+        lv_label_set_text_fmt(label, "Button %d", (int)i);
+    }
+    lv_obj_t * obj = lv_obj_get_child(cont, 0);
+    lv_refr_now(NULL);
+
+    /*Changing the style of one object in every frame keeps the caches of the others*/
+    lv_obj_style_cache_reset_stat();
+    for(i = 0; i < 10; i++) {
+        lv_obj_set_style_bg_opa(obj, (lv_opa_t)(i * 25), 0);
+        lv_obj_invalidate(cont);
+        lv_refr_now(NULL);
+    }
+
+    lv_obj_style_cache_stat_t stat;
+    lv_obj_style_cache_get_stat(&stat);
+    uint32_t total = stat.hit + stat.miss;
+    TEST_PRINTF("animated object: %u%% hit of %u, inv %u", (unsigned)(stat.hit * 100 / total), (unsigned)total,
+                (unsigned)stat.invalidate);
+    TEST_ASSERT_EQUAL_UINT32(10, stat.invalidate);
+    TEST_ASSERT_GREATER_THAN(total * 9 / 10, stat.hit);
+}
+
+/*Redraw the whole screen a few times and return the average time of a refresh*/
+static uint32_t refr_screen(bool cache_en)
+{
+    lv_obj_enable_style_cache(cache_en);
+#if LV_USE_PARALLEL_REFR
+    /*The rendering threads only read the caches and don't count the hits*/
+    lv_refr_set_thread_cnt(1);
+#endif
+
+    uint32_t t = custom_tick_get();
+    uint32_t i;
+    for(i = 0; i < REFR_CNT; i++) {
+        lv_obj_invalidate(lv_scr_act());
+        lv_refr_now(NULL);
+    }
+
+    return (custom_tick_get() - t) / REFR_CNT;
+}
+
+static void compare_refr(const char * name)
+{
+    uint32_t time_off = refr_screen(false);
+    lv_memcpy(fb_ref, test_fb, sizeof(fb_ref));
+
+    lv_obj_style_cache_reset_stat();
+    uint32_t time_on = refr_screen(true);
+    TEST_ASSERT_EQUAL_MEMORY(fb_ref, test_fb, sizeof(fb_ref));
+
+    lv_obj_style_cache_stat_t stat;
+    lv_obj_style_cache_get_stat(&stat);
+    uint32_t total = stat.hit + stat.miss;
+    TEST_PRINTF("%s: %u ms -> %u ms with the cache, %u%% hit of %u, inv %u", name, (unsigned)time_off, (unsigned)time_on,
+                (unsigned)(total ? stat.hit * 100 / total : 0), (unsigned)total, (unsigned)stat.invalidate);
+}
+
+void test_obj_style_cache_demo_widgets(void)
+{
+#if LV_USE_DEMO_WIDGETS
+    lv_demo_widgets();
+    lv_anim_del(NULL, NULL);
+    compare_refr("demo widgets");
+#endif
+}
+
+void test_obj_style_cache_demo_benchmark(void)
+{
+#if LV_USE_DEMO_BENCHMARK
+    /*A few scenes with many widgets: rectangles, text and arcs*/
+    static const int_fast16_t scenes[] = {2, 6, 26, 30, 40};
+    uint32_t i;
+    for(i = 0; i < sizeof(scenes) / sizeof(scenes[0]); i++) {
+        lv_demo_benchmark_run_scene(scenes[i]);
+        lv_anim_del(NULL, NULL);
+        char name[32];
+        lv_snprintf(name, sizeof(name), "benchmark scene %d", (int)scenes[i]);
+        compare_refr(name);
+        lv_demo_benchmark_close();
+    }
+#endif
+}
+
+#else
+
+/*The style cache can be disabled*/
+
+void test_obj_style_cache_hit(void)
+{
+    TEST_IGNORE();
+}
+
+void test_obj_style_cache_state_and_part(void)
+{
+    TEST_IGNORE();
+}
+
+void test_obj_style_cache_inherited(void)
+{
+    TEST_IGNORE();
+}
+
+void test_obj_style_cache_shared_style_changed(void)
+{
+    TEST_IGNORE();
+}
+
+void test_obj_style_cache_other_objects_are_kept(void)
+{
+    TEST_IGNORE();
+}
+
+void test_obj_style_cache_animated_object(void)
+{
+    TEST_IGNORE();
+}
+
+void test_obj_style_cache_demo_widgets(void)
+{
+    TEST_IGNORE();
+}
+
+void test_obj_style_cache_demo_benchmark(void)
+{
+    TEST_IGNORE();
+}
+
+#endif
+
+#endif
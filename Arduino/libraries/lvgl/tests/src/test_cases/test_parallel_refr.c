@@ -0,0 +1,239 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../demos/lv_demos.h"
+
+#include "unity/unity.h"
+#include <sys/time.h>
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+#if LV_USE_PARALLEL_REFR
+    lv_refr_set_thread_cnt(LV_PARALLEL_REFR_THREADS);
+#endif
+    lv_obj_clean(lv_scr_act());
+}
+
+#if LV_USE_PARALLEL_REFR && LV_USE_DEMO_BENCHMARK
+
+#define REFR_CNT    3
+
+/*The frame buffer of the test display (800x480)*/
+extern lv_color_t test_fb[];
+
+static lv_color_t fb_ref[800 * 480];
+
+static uint32_t time_us(void)
+{
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return (uint32_t)(tv.tv_sec * 1000000 + tv.tv_usec);
+}
+
+/*Redraw an area of the screen a few times and return the average time of a refresh in us*/
+static uint32_t refr_area(const lv_area_t * area)
+{
+    uint32_t t = time_us();
+    uint32_t i;
+    for(i = 0; i < REFR_CNT; i++) {
+        lv_obj_invalidate_area(lv_scr_act(), area);
+        lv_refr_now(NULL);
+    }
+
+    return (time_us() - t) / REFR_CNT;
+}
+
+static uint32_t refr_screen(uint32_t thread_cnt)
+{
+    lv_refr_set_thread_cnt(thread_cnt);
+    return refr_area(&lv_scr_act()->coords);
+}
+
+/* Estimate the time of a refresh on `thread_cnt` threads running on their own cores.
+ * The bands are rendered one by one on one thread and given to the threads in order,
+ * each to the thread which is free first, as the rendering threads take them.
+ * The refresh overhead is counted for every band, so the estimate is pessimistic.*/
+static uint32_t refr_bands_estimate(uint32_t thread_cnt)
+{
+    lv_refr_set_thread_cnt(1);
+
+    uint32_t busy[LV_PARALLEL_REFR_THREADS] = {0};
+    uint32_t band_cnt = thread_cnt * 2;
+    lv_coord_t band_h = (lv_obj_get_height(lv_scr_act()) + band_cnt - 1) / band_cnt;
+    lv_area_t band = lv_scr_act()->coords;
+    uint32_t b;
+    for(b = 0; b < band_cnt; b++) {
+        band.y1 = lv_scr_act()->coords.y1 + b * band_h;
+        band.y2 = LV_MIN(band.y1 + band_h - 1, lv_scr_act()->coords.y2);
+
+        uint32_t first = 0;
+        uint32_t t;
+        for(t = 1; t < thread_cnt; t++) {
+            if(busy[t] < busy[first]) first = t;
+        }
+        busy[first] += refr_area(&band);
+    }
+
+    uint32_t time_max = 0;
+    for(b = 0; b < thread_cnt; b++) time_max = LV_MAX(time_max, busy[b]);
+    return time_max;
+}
+
+void test_parallel_refr_benchmark_scenes(void)
+{
+    uint32_t time_1_sum = 0;
+    uint32_t time_n_sum = 0;
+    uint32_t time_est_sum = 0;
+    int_fast16_t scene_no;
+    for(scene_no = 0; ; scene_no++) {
+        lv_demo_benchmark_run_scene(scene_no);
+        /*The last scene has no objects*/
+        if(lv_obj_get_child_cnt(lv_scr_act()) <= 3 && lv_obj_get_child_cnt(lv_obj_get_child(lv_scr_act(), 2)) == 0) {
+            lv_demo_benchmark_close();
+            break;
+        }
+
+        /*Keep the same frame for both renderings*/
+        lv_anim_del(NULL, NULL);
+
+        uint32_t time_1 = refr_screen(1);
+        lv_memcpy(fb_ref, test_fb, sizeof(fb_ref));
+
+        uint32_t time_n = refr_screen(LV_PARALLEL_REFR_THREADS);
+        TEST_ASSERT_EQUAL_UINT32(LV_PARALLEL_REFR_THREADS, lv_refr_get_thread_cnt());
+        TEST_ASSERT_EQUAL_MEMORY_MESSAGE(fb_ref, test_fb, sizeof(fb_ref), "bands rendered differently");
+
+        uint32_t time_est = refr_bands_estimate(LV_PARALLEL_REFR_THREADS);
+
+        TEST_PRINTF("scene %d: %u us -> %u us on %d threads (%u%%), %u us on %d cores estimated (%u%%)",
+                    (int)scene_no, (unsigned)time_1, (unsigned)time_n, LV_PARALLEL_REFR_THREADS,
+                    (unsigned)(time_n ? time_1 * 100 / time_n : 0),
+                    (unsigned)time_est, LV_PARALLEL_REFR_THREADS, (unsigned)(time_est ? time_1 * 100 / time_est : 0));
+        time_1_sum += time_1;
+        time_n_sum += time_n;
+        time_est_sum += time_est;
+
+        lv_demo_benchmark_close();
+    }
+
+    TEST_ASSERT_GREATER_THAN(0, scene_no);
+    TEST_PRINTF("all scenes: %u us -> %u us (%u%%), %u us estimated (%u%%)", (unsigned)time_1_sum,
+                (unsigned)time_n_sum, (unsigned)(time_n_sum ? time_1_sum * 100 / time_n_sum : 0),
+                (unsigned)time_est_sum, (unsigned)(time_est_sum ? time_1_sum * 100 / time_est_sum : 0));
+}
+
+void test_parallel_refr_falls_back_with_layers(void)
+{
+    lv_obj_t * obj = lv_obj_create(lv_scr_act());
+    lv_obj_set_size(obj, 400, 300);
+    lv_obj_set_style_opa(obj, LV_OPA_50, 0);
+    lv_obj_t * label = lv_label_create(obj);
+    lv_label_set_text(label, "semi transparent layer");
+
+    refr_screen(1);
+    lv_memcpy(fb_ref, test_fb, sizeof(fb_ref));
+
+    refr_screen(LV_PARALLEL_REFR_THREADS);
+    TEST_ASSERT_EQUAL_MEMORY(fb_ref, test_fb, sizeof(fb_ref));
+}
+
+/*These widgets change their state while they are drawn*/
+void test_parallel_refr_falls_back_with_state_changing_widgets(void)
+{
+    static const char * map[] = {"A", "B", "C", "\n", "D", "E", ""};
+    lv_obj_t * btnm = lv_btnmatrix_create(lv_scr_act());
+    lv_btnmatrix_set_map(btnm, map);
+    lv_btnmatrix_set_btn_ctrl(btnm, 1, LV_BTNMATRIX_CTRL_CHECKED | LV_BTNMATRIX_CTRL_CHECKABLE);
+    lv_btnmatrix_set_btn_ctrl(btnm, 3, LV_BTNMATRIX_CTRL_DISABLED);
+
+    lv_obj_t * table = lv_table_create(lv_scr_act());
+    lv_obj_set_pos(table, 400, 0);
+    uint16_t i;
+    for(i = 0; i < 20; i++) {
+        lv_table_set_cell_value_fmt(table, i, 0, "%d", i);
+        lv_table_set_cell_value(table, i, 1, "cell");
+    }
+    lv_table_add_cell_ctrl(table, 2, 1, LV_TABLE_CELL_CTRL_MERGE_RIGHT);
+
+    lv_obj_t * dd = lv_dropdown_create(lv_scr_act());
+    lv_obj_set_pos(dd, 10, 250);
+    lv_dropdown_set_options(dd, "One\nTwo\nThree\nFour");
+    lv_dropdown_set_selected(dd, 2);
+    lv_dropdown_open(dd);
+
+    refr_screen(1);
+    lv_memcpy(fb_ref, test_fb, sizeof(fb_ref));
+
+    for(i = 0; i < 10; i++) {
+        refr_screen(LV_PARALLEL_REFR_THREADS);
+        TEST_ASSERT_EQUAL_MEMORY(fb_ref, test_fb, sizeof(fb_ref));
+    }
+
+    lv_dropdown_close(dd);
+}
+
+static bool drawn_in_bands;
+
+static void draw_main_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+    if(lv_thread_pool_is_running()) drawn_in_bands = true;
+}
+
+/*Like a custom widget which didn't tell it can be drawn on more threads*/
+static const lv_obj_class_t unmarked_class = {
+    .base_class = &lv_obj_class,
+    .instance_size = sizeof(lv_obj_t),
+};
+
+void test_parallel_refr_only_marked_classes(void)
+{
+    lv_obj_t * obj = lv_obj_create(lv_scr_act());
+    lv_obj_set_size(obj, 400, 300);
+    lv_obj_add_event_cb(obj, draw_main_cb, LV_EVENT_DRAW_MAIN, NULL);
+
+    drawn_in_bands = false;
+    refr_screen(LV_PARALLEL_REFR_THREADS);
+    TEST_ASSERT_TRUE(drawn_in_bands);
+
+    /*The class is not inherited from `lv_obj_class`*/
+    lv_obj_t * custom = lv_obj_class_create_obj(&unmarked_class, lv_scr_act());
+    lv_obj_class_init_obj(custom);
+    lv_obj_set_pos(custom, 400, 300);
+
+    drawn_in_bands = false;
+    refr_screen(LV_PARALLEL_REFR_THREADS);
+    TEST_ASSERT_FALSE(drawn_in_bands);
+}
+
+#else
+
+/*Parallel rendering or the benchmark demo can be disabled*/
+
+void test_parallel_refr_benchmark_scenes(void)
+{
+    TEST_IGNORE();
+}
+
+void test_parallel_refr_falls_back_with_layers(void)
+{
+    TEST_IGNORE();
+}
+
+void test_parallel_refr_falls_back_with_state_changing_widgets(void)
+{
+    TEST_IGNORE();
+}
+
+void test_parallel_refr_only_marked_classes(void)
+{
+    TEST_IGNORE();
+}
+
+#endif
+
+#endif
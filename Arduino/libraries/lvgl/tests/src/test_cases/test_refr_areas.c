@@ -0,0 +1,215 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../demos/lv_demos.h"
+
+#include "unity/unity.h"
+
+void setUp(void)
+{
+    /*Don't let the perf. monitor invalidate its label*/
+    lv_obj_add_flag(lv_layer_sys(), LV_OBJ_FLAG_HIDDEN);
+}
+
+void tearDown(void)
+{
+    lv_obj_clear_flag(lv_layer_sys(), LV_OBJ_FLAG_HIDDEN);
+    lv_obj_clean(lv_scr_act());
+}
+
+#if LV_USE_REFR_STAT
+
+/*Refresh the given areas and get what was rendered*/
+static void refr_areas(const lv_area_t * areas, uint32_t cnt, lv_refr_stat_t * stat)
+{
+    /*Render the pending areas first*/
+    lv_refr_now(NULL);
+    lv_refr_reset_stat();
+
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        /*Directly on the display to not add the extra draw size of the screen*/
+        _lv_inv_area(NULL, &areas[i]);
+    }
+    lv_refr_now(NULL);
+
+    lv_refr_get_stat(stat);
+}
+
+void test_refr_areas_overlapping_are_joined(void)
+{
+    static const lv_area_t areas[] = {
+        {0, 0, 99, 99},
+        {50, 0, 149, 99},
+    };
+
+    lv_refr_stat_t stat;
+    refr_areas(areas, 2, &stat);
+    TEST_ASSERT_EQUAL_UINT32(1, stat.frames);
+    TEST_ASSERT_EQUAL_UINT32(1, stat.areas);
+    TEST_ASSERT_EQUAL_UINT32(150 * 100, stat.px_dirty);
+    TEST_ASSERT_EQUAL_UINT32(150 * 100, stat.px_rendered);
+}
+
+void test_refr_areas_large_overlap_is_joined(void)
+{
+    /*The bounding box has 2 * 30 * 100 clean pixels but it's smaller than the two areas together*/
+    static const lv_area_t areas[] = {
+        {0, 0, 99, 99},
+        {30, 30, 129, 129},
+    };
+
+    lv_refr_stat_t stat;
+    refr_areas(areas, 2, &stat);
+    TEST_ASSERT_EQUAL_UINT32(1, stat.areas);
+    TEST_ASSERT_EQUAL_UINT32(2 * 100 * 100 - 70 * 70, stat.px_dirty);
+    TEST_ASSERT_EQUAL_UINT32(130 * 130, stat.px_rendered);
+}
+
+void test_refr_areas_close_small_areas_are_joined(void)
+{
+    static const lv_area_t areas[] = {
+        {0, 0, 9, 9},
+        {30, 0, 39, 9},
+    };
+
+    lv_refr_stat_t stat;
+    refr_areas(areas, 2, &stat);
+    TEST_ASSERT_EQUAL_UINT32(1, stat.areas);
+    TEST_ASSERT_EQUAL_UINT32(2 * 10 * 10, stat.px_dirty);
+    TEST_ASSERT_EQUAL_UINT32(40 * 10, stat.px_rendered);
+}
+
+void test_refr_areas_distant_areas_are_not_joined(void)
+{
+    static const lv_area_t areas[] = {
+        {0, 0, 99, 99},
+        {400, 300, 499, 399},
+        {50, 0, 149, 99},
+    };
+
+    lv_refr_stat_t stat;
+    refr_areas(areas, 3, &stat);
+    TEST_ASSERT_EQUAL_UINT32(2, stat.areas);
+    TEST_ASSERT_EQUAL_UINT32(150 * 100 + 100 * 100, stat.px_dirty);
+    TEST_ASSERT_EQUAL_UINT32(150 * 100 + 100 * 100, stat.px_rendered);
+}
+
+void test_refr_areas_diagonal_overlap_is_not_joined(void)
+{
+    /*The bounding box has 50 * 50 more pixels than the two areas together*/
+    static const lv_area_t areas[] = {
+        {0, 0, 99, 99},
+        {50, 50, 149, 149},
+    };
+
+    lv_refr_stat_t stat;
+    refr_areas(areas, 2, &stat);
+    TEST_ASSERT_EQUAL_UINT32(2, stat.areas);
+    TEST_ASSERT_EQUAL_UINT32(2 * 100 * 100 - 50 * 50, stat.px_dirty);
+    TEST_ASSERT_EQUAL_UINT32(2 * 100 * 100, stat.px_rendered);
+}
+
+void test_refr_areas_overflow_does_not_redraw_the_screen(void)
+{
+    /*More areas than LV_INV_BUF_SIZE*/
+    lv_area_t areas[8 * 5];
+    uint32_t i;
+    for(i = 0; i < 8 * 5; i++) {
+        areas[i].x1 = (i % 8) * 100;
+        areas[i].y1 = (i / 8) * 96;
+        areas[i].x2 = areas[i].x1 + 9;
+        areas[i].y2 = areas[i].y1 + 9;
+    }
+
+    lv_refr_stat_t stat;
+    refr_areas(areas, 8 * 5, &stat);
+    TEST_ASSERT_EQUAL_UINT32(8 * 5 - LV_INV_BUF_SIZE, stat.inv_overflow);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(LV_INV_BUF_SIZE, stat.areas);
+    TEST_ASSERT_LESS_THAN_UINT32(800 * 480 / 10, stat.px_rendered);
+}
+
+void test_refr_areas_benchmark_scenes(void)
+{
+#if LV_USE_DEMO_BENCHMARK
+    uint32_t px_dirty_sum = 0;
+    uint32_t px_rendered_sum = 0;
+    int_fast16_t scene_no;
+    /*Only the normal scenes, the opa mode changes only the colors*/
+    for(scene_no = 0; ; scene_no += 2) {
+        lv_demo_benchmark_run_scene(scene_no);
+        /*The last scene has no objects*/
+        if(lv_obj_get_child_cnt(lv_scr_act()) <= 3 && lv_obj_get_child_cnt(lv_obj_get_child(lv_scr_act(), 2)) == 0) {
+            lv_demo_benchmark_close();
+            break;
+        }
+
+        /*Skip the first frame which redraws the whole screen*/
+        lv_refr_now(NULL);
+        lv_refr_reset_stat();
+
+        /*Less than the time of a scene*/
+        uint32_t i;
+        for(i = 0; i < 25; i++) {
+            lv_tick_inc(LV_DISP_DEF_REFR_PERIOD);
+            lv_timer_handler();
+        }
+
+        lv_refr_stat_t stat;
+        lv_refr_get_stat(&stat);
+        TEST_ASSERT_LESS_OR_EQUAL_UINT32(stat.px_rendered, stat.px_dirty);
+        TEST_PRINTF("scene %d: %u frames, %u areas, %u px dirty, %u px rendered (+%u%%), %u overflow",
+                    (int)scene_no, (unsigned)stat.frames, (unsigned)stat.areas, (unsigned)stat.px_dirty, (unsigned)stat.px_rendered,
+                    (unsigned)(stat.px_dirty ? (uint64_t)(stat.px_rendered - stat.px_dirty) * 100 / stat.px_dirty : 0),
+                    (unsigned)stat.inv_overflow);
+        px_dirty_sum += stat.px_dirty;
+        px_rendered_sum += stat.px_rendered;
+
+        lv_demo_benchmark_close();
+    }
+
+    TEST_PRINTF("all scenes: %u px dirty, %u px rendered", (unsigned)px_dirty_sum, (unsigned)px_rendered_sum);
+#endif
+}
+
+#else
+
+/*The statistics can be disabled*/
+
+void test_refr_areas_overlapping_are_joined(void)
+{
+    TEST_IGNORE();
+}
+
+void test_refr_areas_large_overlap_is_joined(void)
+{
+    TEST_IGNORE();
+}
+
+void test_refr_areas_close_small_areas_are_joined(void)
+{
+    TEST_IGNORE();
+}
+
+void test_refr_areas_distant_areas_are_not_joined(void)
+{
+    TEST_IGNORE();
+}
+
+void test_refr_areas_diagonal_overlap_is_not_joined(void)
+{
+    TEST_IGNORE();
+}
+
+void test_refr_areas_overflow_does_not_redraw_the_screen(void)
+{
+    TEST_IGNORE();
+}
+
+void test_refr_areas_benchmark_scenes(void)
+{
+    TEST_IGNORE();
+}
+
+#endif
+
+#endif
@@ -0,0 +1,230 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../demos/lv_demos.h"
+
+#include "unity/unity.h"
+
+void setUp(void)
+{
+    /*Don't let the perf. monitor invalidate its label*/
+    lv_obj_add_flag(lv_layer_sys(), LV_OBJ_FLAG_HIDDEN);
+}
+
+void tearDown(void)
+{
+#if LV_REFR_OCCLUDER_MAX
+    lv_refr_enable_occlusion(true);
+#endif
+    lv_obj_clear_flag(lv_layer_sys(), LV_OBJ_FLAG_HIDDEN);
+    lv_obj_clean(lv_scr_act());
+}
+
+#if LV_REFR_OCCLUDER_MAX && LV_USE_REFR_STAT
+
+#define REFR_CNT    5
+
+/*The frame buffer of the test display (800x480)*/
+extern lv_color_t test_fb[];
+
+static lv_color_t fb_ref[800 * 480];
+
+static uint32_t draw_main_cnt;
+static lv_area_t draw_main_clip;
+
+static void draw_main_cb(lv_event_t * e)
+{
+    lv_draw_ctx_t * draw_ctx = lv_event_get_draw_ctx(e);
+    draw_main_cnt++;
+    draw_main_clip = *draw_ctx->clip_area;
+}
+
+static lv_obj_t * create_rect(lv_obj_t * parent, lv_coord_t x, lv_coord_t y, lv_coord_t w, lv_coord_t h)
+{
+    lv_obj_t * obj = lv_obj_create(parent);
+    lv_obj_remove_style_all(obj);
+    lv_obj_set_style_bg_opa(obj, LV_OPA_COVER, 0);
+    lv_obj_set_pos(obj, x, y);
+    lv_obj_set_size(obj, w, h);
+    return obj;
+}
+
+static void refr_screen(void)
+{
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+}
+
+void test_refr_occlusion_covered_obj_is_not_drawn(void)
+{
+    lv_obj_t * back = create_rect(lv_scr_act(), 10, 10, 100, 100);
+    lv_obj_set_style_bg_color(back, lv_color_hex(0xff0000), 0);
+    lv_obj_add_event_cb(back, draw_main_cb, LV_EVENT_DRAW_MAIN, NULL);
+    lv_obj_t * front = create_rect(lv_scr_act(), 0, 0, 200, 200);
+    lv_obj_set_style_bg_color(front, lv_color_hex(0x0000ff), 0);
+
+    draw_main_cnt = 0;
+    lv_refr_reset_stat();
+    refr_screen();
+    TEST_ASSERT_EQUAL_UINT32(0, draw_main_cnt);
+
+    lv_refr_stat_t stat;
+    lv_refr_get_stat(&stat);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(1, stat.obj_culled);
+
+    lv_refr_enable_occlusion(false);
+    refr_screen();
+    TEST_ASSERT_GREATER_THAN_UINT32(0, draw_main_cnt);
+}
+
+void test_refr_occlusion_partly_covered_obj_is_clipped(void)
+{
+    lv_obj_t * back = create_rect(lv_scr_act(), 10, 10, 100, 100);
+    lv_obj_add_event_cb(back, draw_main_cb, LV_EVENT_DRAW_MAIN, NULL);
+    /*Covers the left half*/
+    create_rect(lv_scr_act(), 0, 0, 60, 200);
+
+    draw_main_cnt = 0;
+    lv_refr_reset_stat();
+    refr_screen();
+    TEST_ASSERT_GREATER_THAN_UINT32(0, draw_main_cnt);
+    TEST_ASSERT_EQUAL_INT(60, draw_main_clip.x1);
+    TEST_ASSERT_EQUAL_INT(109, draw_main_clip.x2);
+
+    lv_refr_stat_t stat;
+    lv_refr_get_stat(&stat);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(1, stat.obj_clipped);
+}
+
+void test_refr_occlusion_masked_children_do_not_cover(void)
+{
+    lv_obj_t * back = create_rect(lv_scr_act(), 0, 0, 200, 200);
+    lv_obj_set_style_bg_color(back, lv_color_hex(0xff0000), 0);
+    lv_obj_add_event_cb(back, draw_main_cb, LV_EVENT_DRAW_MAIN, NULL);
+
+    /*The child covers its parent but the corners of the parent are clipped*/
+    lv_obj_t * parent = create_rect(lv_scr_act(), 0, 0, 200, 200);
+    lv_obj_set_style_bg_opa(parent, LV_OPA_TRANSP, 0);
+    lv_obj_set_style_radius(parent, 50, 0);
+    lv_obj_set_style_clip_corner(parent, true, 0);
+    lv_obj_t * child = create_rect(parent, 0, 0, 200, 200);
+    lv_obj_set_style_bg_color(child, lv_color_hex(0x00ff00), 0);
+
+    draw_main_cnt = 0;
+    refr_screen();
+    TEST_ASSERT_GREATER_THAN_UINT32(0, draw_main_cnt);
+    lv_memcpy(fb_ref, test_fb, sizeof(fb_ref));
+
+    lv_refr_enable_occlusion(false);
+    refr_screen();
+    TEST_ASSERT_EQUAL_MEMORY(fb_ref, test_fb, sizeof(fb_ref));
+}
+
+void test_refr_occlusion_rounded_obj_covers_its_middle(void)
+{
+    lv_obj_t * back = create_rect(lv_scr_act(), 100, 100, 50, 50);
+    lv_obj_add_event_cb(back, draw_main_cb, LV_EVENT_DRAW_MAIN, NULL);
+    lv_obj_t * front = create_rect(lv_scr_act(), 0, 90, 400, 70);
+    lv_obj_set_style_radius(front, 20, 0);
+
+    draw_main_cnt = 0;
+    refr_screen();
+    TEST_ASSERT_EQUAL_UINT32(0, draw_main_cnt);
+    lv_memcpy(fb_ref, test_fb, sizeof(fb_ref));
+
+    lv_refr_enable_occlusion(false);
+    refr_screen();
+    TEST_ASSERT_EQUAL_MEMORY(fb_ref, test_fb, sizeof(fb_ref));
+}
+
+/*Refresh the screen with and without occlusion culling, compare the results and the written pixels*/
+static void compare_refr(const char * name)
+{
+    uint32_t i;
+    lv_refr_stat_t stat_off;
+    lv_refr_stat_t stat_on;
+
+    lv_refr_enable_occlusion(false);
+    lv_refr_reset_stat();
+    uint32_t time_off = custom_tick_get();
+    for(i = 0; i < REFR_CNT; i++) refr_screen();
+    time_off = custom_tick_get() - time_off;
+    lv_refr_get_stat(&stat_off);
+    lv_memcpy(fb_ref, test_fb, sizeof(fb_ref));
+
+    lv_refr_enable_occlusion(true);
+    lv_refr_reset_stat();
+    uint32_t time_on = custom_tick_get();
+    for(i = 0; i < REFR_CNT; i++) refr_screen();
+    time_on = custom_tick_get() - time_on;
+    lv_refr_get_stat(&stat_on);
+    TEST_ASSERT_EQUAL_MEMORY(fb_ref, test_fb, sizeof(fb_ref));
+
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(stat_off.px_written, stat_on.px_written);
+    TEST_PRINTF("%s: %u -> %u px written per frame (%u px rendered), %u -> %u ms, %u culled, %u clipped", name,
+                (unsigned)(stat_off.px_written / REFR_CNT), (unsigned)(stat_on.px_written / REFR_CNT),
+                (unsigned)(stat_on.px_rendered / REFR_CNT), (unsigned)(time_off / REFR_CNT), (unsigned)(time_on / REFR_CNT),
+                (unsigned)(stat_on.obj_culled / REFR_CNT), (unsigned)(stat_on.obj_clipped / REFR_CNT));
+}
+
+void test_refr_occlusion_demo_widgets(void)
+{
+#if LV_USE_DEMO_WIDGETS
+    lv_demo_widgets();
+    lv_anim_del(NULL, NULL);
+    compare_refr("demo widgets");
+#endif
+}
+
+void test_refr_occlusion_demo_benchmark(void)
+{
+#if LV_USE_DEMO_BENCHMARK
+    static const int_fast16_t scenes[] = {0, 2, 6, 18, 26, 30, 40};
+    uint32_t i;
+    for(i = 0; i < sizeof(scenes) / sizeof(scenes[0]); i++) {
+        lv_demo_benchmark_run_scene(scenes[i]);
+        lv_anim_del(NULL, NULL);
+        char name[32];
+        lv_snprintf(name, sizeof(name), "benchmark scene %d", (int)scenes[i]);
+        compare_refr(name);
+        lv_demo_benchmark_close();
+    }
+#endif
+}
+
+#else
+
+/*The culling and the counters are optional*/
+
+void test_refr_occlusion_covered_obj_is_not_drawn(void)
+{
+    TEST_IGNORE();
+}
+
+void test_refr_occlusion_partly_covered_obj_is_clipped(void)
+{
+    TEST_IGNORE();
+}
+
+void test_refr_occlusion_masked_children_do_not_cover(void)
+{
+    TEST_IGNORE();
+}
+
+void test_refr_occlusion_rounded_obj_covers_its_middle(void)
+{
+    TEST_IGNORE();
+}
+
+void test_refr_occlusion_demo_widgets(void)
+{
+    TEST_IGNORE();
+}
+
+void test_refr_occlusion_demo_benchmark(void)
+{
+    TEST_IGNORE();
+}
+
+#endif
+
+#endif
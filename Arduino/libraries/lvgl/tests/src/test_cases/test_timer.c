@@ -0,0 +1,259 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#define MAX_TIMERS  16
+#define LOG_SIZE    32
+
+/*The timers of LVGL (display, input devices, animations) are paused while testing*/
+static lv_timer_t * lib_timers[MAX_TIMERS];
+static uint32_t lib_timer_cnt;
+
+static uint32_t log_buf[LOG_SIZE];
+static uint32_t log_cnt;
+
+void setUp(void)
+{
+    lib_timer_cnt = 0;
+    lv_timer_t * timer = lv_timer_get_next(NULL);
+    while(timer) {
+        if(!timer->paused && lib_timer_cnt < MAX_TIMERS) {
+            lv_timer_pause(timer);
+            lib_timers[lib_timer_cnt] = timer;
+            lib_timer_cnt++;
+        }
+        timer = lv_timer_get_next(timer);
+    }
+
+    log_cnt = 0;
+}
+
+void tearDown(void)
+{
+    uint32_t i;
+    for(i = 0; i < lib_timer_cnt; i++) {
+        lv_timer_resume(lib_timers[i]);
+    }
+}
+
+static void log_cb(lv_timer_t * timer)
+{
+    if(log_cnt < LOG_SIZE) {
+        log_buf[log_cnt] = (uint32_t)(lv_uintptr_t)timer->user_data;
+        log_cnt++;
+    }
+}
+
+static void del_self_cb(lv_timer_t * timer)
+{
+    log_cb(timer);
+    lv_timer_del(timer);
+}
+
+static void tick(uint32_t ms)
+{
+    lv_tick_inc(ms);
+    lv_timer_handler();
+}
+
+void test_timer_run_in_deadline_order(void)
+{
+    lv_timer_t * t1 = lv_timer_create(log_cb, 30, (void *)1);
+    lv_timer_t * t2 = lv_timer_create(log_cb, 10, (void *)2);
+    lv_timer_t * t3 = lv_timer_create(log_cb, 15, (void *)3);
+
+    tick(10);
+    TEST_ASSERT_EQUAL_UINT32(1, log_cnt);
+    TEST_ASSERT_EQUAL_UINT32(2, log_buf[0]);
+
+    /*All of them are late: the one with the earliest deadline runs first*/
+    tick(25);
+    TEST_ASSERT_EQUAL_UINT32(4, log_cnt);
+    TEST_ASSERT_EQUAL_UINT32(3, log_buf[1]);
+    TEST_ASSERT_EQUAL_UINT32(2, log_buf[2]);
+    TEST_ASSERT_EQUAL_UINT32(1, log_buf[3]);
+
+    lv_timer_del(t1);
+    lv_timer_del(t2);
+    lv_timer_del(t3);
+}
+
+void test_timer_time_until_next(void)
+{
+    TEST_ASSERT_EQUAL_UINT32(LV_NO_TIMER_READY, lv_timer_get_time_until_next());
+
+    lv_timer_t * t1 = lv_timer_create(log_cb, 100, (void *)1);
+    lv_timer_t * t2 = lv_timer_create(log_cb, 300, (void *)2);
+    TEST_ASSERT_EQUAL_UINT32(100, lv_timer_get_time_until_next());
+
+    lv_tick_inc(60);
+    TEST_ASSERT_EQUAL_UINT32(40, lv_timer_handler());
+    TEST_ASSERT_EQUAL_UINT32(40, lv_timer_get_time_until_next());
+
+    lv_timer_pause(t1);
+    TEST_ASSERT_EQUAL_UINT32(240, lv_timer_get_time_until_next());
+
+    lv_timer_set_period(t2, 100);
+    TEST_ASSERT_EQUAL_UINT32(40, lv_timer_get_time_until_next());
+
+    lv_timer_reset(t2);
+    TEST_ASSERT_EQUAL_UINT32(100, lv_timer_get_time_until_next());
+
+    lv_timer_resume(t1);
+    lv_timer_ready(t1);
+    TEST_ASSERT_EQUAL_UINT32(0, lv_timer_get_time_until_next());
+    TEST_ASSERT_EQUAL_UINT32(100, lv_timer_handler());
+    TEST_ASSERT_EQUAL_UINT32(1, log_cnt);
+
+    lv_timer_del(t1);
+    lv_timer_del(t2);
+    TEST_ASSERT_EQUAL_UINT32(LV_NO_TIMER_READY, lv_timer_get_time_until_next());
+}
+
+void test_timer_repeat_count(void)
+{
+    lv_timer_t * t1 = lv_timer_create(log_cb, 10, (void *)1);
+    lv_timer_set_repeat_count(t1, 2);
+    lv_timer_t * t2 = lv_timer_create(log_cb, 10, (void *)2);
+    lv_timer_set_repeat_count(t2, 0);
+
+    tick(10);
+    tick(10);
+    tick(10);
+    TEST_ASSERT_EQUAL_UINT32(2, log_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, log_buf[0]);
+    TEST_ASSERT_EQUAL_UINT32(1, log_buf[1]);
+
+    /*Both are deleted*/
+    TEST_ASSERT_EQUAL_UINT32(LV_NO_TIMER_READY, lv_timer_get_time_until_next());
+}
+
+static lv_timer_t * victim;
+
+static void del_victim_cb(lv_timer_t * timer)
+{
+    log_cb(timer);
+    if(victim) {
+        lv_timer_del(victim);
+        victim = NULL;
+    }
+}
+
+static void create_cb(lv_timer_t * timer)
+{
+    log_cb(timer);
+    lv_timer_t * new_timer = lv_timer_create(del_self_cb, 0, (void *)9);
+    LV_UNUSED(new_timer);
+}
+
+void test_timer_create_and_delete_in_callback(void)
+{
+    /*t1 deletes t2 which is also ready*/
+    lv_timer_t * t1 = lv_timer_create(del_victim_cb, 10, (void *)1);
+    lv_timer_t * t2 = lv_timer_create(log_cb, 20, (void *)2);
+    lv_timer_create(del_self_cb, 20, (void *)3);
+
+    lv_tick_inc(5);
+    lv_timer_ready(t1);
+    victim = t2;
+    tick(0);
+    TEST_ASSERT_EQUAL_UINT32(1, log_cnt);
+    TEST_ASSERT_NULL(victim);
+
+    /*t1 is late more than t3, t3 deletes itself*/
+    tick(15);
+    TEST_ASSERT_EQUAL_UINT32(3, log_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, log_buf[1]);
+    TEST_ASSERT_EQUAL_UINT32(3, log_buf[2]);
+
+    /*t1 deletes itself after it ran in the same call*/
+    lv_timer_set_cb(t1, log_cb);
+    lv_timer_t * t4 = lv_timer_create(del_victim_cb, 10, (void *)4);
+    lv_timer_set_period(t1, 5);
+    victim = t1;
+    log_cnt = 0;
+    tick(10);
+    TEST_ASSERT_EQUAL_UINT32(2, log_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, log_buf[0]);
+    TEST_ASSERT_EQUAL_UINT32(4, log_buf[1]);
+
+    /*A timer created in a callback runs in the same call, the creator only once*/
+    lv_timer_set_cb(t4, create_cb);
+    log_cnt = 0;
+    tick(10);
+    TEST_ASSERT_EQUAL_UINT32(2, log_cnt);
+    TEST_ASSERT_EQUAL_UINT32(4, log_buf[0]);
+    TEST_ASSERT_EQUAL_UINT32(9, log_buf[1]);
+
+    lv_timer_del(t4);
+    TEST_ASSERT_EQUAL_UINT32(LV_NO_TIMER_READY, lv_timer_get_time_until_next());
+}
+
+void test_timer_many(void)
+{
+    /*Random periods, check that all timers run in time*/
+    static lv_timer_t * timers[500];
+    static uint32_t run_cnt[500];
+    uint32_t seed = 1;
+    uint32_t i;
+    for(i = 0; i < 500; i++) {
+        seed = seed * 1103515245 + 12345;
+        timers[i] = lv_timer_create(log_cb, 1 + (seed >> 16) % 100, (void *)(lv_uintptr_t)i);
+        run_cnt[i] = 0;
+    }
+
+    uint32_t t;
+    for(t = 0; t < 1000; t++) {
+        log_cnt = 0;
+        lv_tick_inc(1);
+        lv_timer_handler();
+        /*Only the first LOG_SIZE runs are logged, count the rest by time*/
+        for(i = 0; i < 500; i++) {
+            if(timers[i]->last_run == lv_tick_get()) run_cnt[i]++;
+        }
+    }
+
+    for(i = 0; i < 500; i++) {
+        TEST_ASSERT_EQUAL_UINT32(1000 / timers[i]->period, run_cnt[i]);
+        lv_timer_del(timers[i]);
+    }
+}
+
+static void empty_cb(lv_timer_t * timer)
+{
+    LV_UNUSED(timer);
+}
+
+void test_timer_handler_cost(void)
+{
+    static const uint32_t timer_nums[] = {10, 100, 1000};
+    static lv_timer_t * timers[1000];
+
+    uint32_t n;
+    for(n = 0; n < sizeof(timer_nums) / sizeof(timer_nums[0]); n++) {
+        uint32_t timer_num = timer_nums[n];
+        uint32_t i;
+        for(i = 0; i < timer_num; i++) {
+            /*Mostly idle timers and a few frequent ones*/
+            timers[i] = lv_timer_create(empty_cb, i % 10 == 0 ? 10 : 1000 + i, NULL);
+        }
+
+        uint32_t call_cnt = 20000;
+        uint32_t t = custom_tick_get();
+        for(i = 0; i < call_cnt; i++) {
+            lv_tick_inc(1);
+            lv_timer_handler();
+        }
+        t = custom_tick_get() - t;
+
+        TEST_PRINTF("%u timers: %u ns per lv_timer_handler() call", (unsigned)timer_num,
+                    (unsigned)((uint64_t)t * 1000000 / call_cnt));
+
+        for(i = 0; i < timer_num; i++) {
+            lv_timer_del(timers[i]);
+        }
+    }
+}
+
+#endif